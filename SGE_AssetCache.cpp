@@ -0,0 +1,180 @@
+/* SGE_AssetCache.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * ========================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include <fstream>
+
+#include "SGE_AssetCache.h"
+
+// ==============================/ Class AssetCache /==============================
+
+//                           +------------------+                            //
+// --------------------------+ CONSTRUCTORS ETC +--------------------------- //
+//                           +------------------+                            //
+
+flc::AssetCache::AssetCache() {
+    pShared = std::make_shared<SharedState>();
+}
+
+flc::AssetCache::~AssetCache() {}
+
+//                               +----------+                                //
+// ------------------------------+ METHODS  +------------------------------- //
+//                               +----------+                                //
+
+template <typename T>
+std::shared_ptr<T> flc::AssetCache::Find( const std::string &sKey ) {
+    std::lock_guard<std::mutex> lock( pShared->mtxEntries );
+    auto it = pShared->mEntries.find( sKey );
+    if (it != pShared->mEntries.end()) {
+        std::shared_ptr<void> pAsset = it->second.pAsset.lock();
+        if (pAsset != nullptr) {
+            pShared->nHits += 1;
+            return std::static_pointer_cast<T>( pAsset );
+        }
+    }
+    return nullptr;
+}
+
+// The asset is loaded outside the lock, so another thread may have loaded the same file in the mean time. In that
+// case the asset of the other thread is used, and fnRelease is called on pAsset right away.
+template <typename T, typename F>
+std::shared_ptr<T> flc::AssetCache::Insert( const std::string &sKey, Type eType, T *pAsset, size_t nBytes, F fnRelease ) {
+    std::shared_ptr<T> pResult;
+    {
+        std::lock_guard<std::mutex> lock( pShared->mtxEntries );
+        Entry &e = pShared->mEntries[sKey];
+        std::shared_ptr<void> pOther = e.pAsset.lock();
+        if (pOther != nullptr) {
+            pShared->nHits += 1;
+            pResult = std::static_pointer_cast<T>( pOther );
+        } else {
+            pShared->nMisses += 1;
+            uint64_t nSerial = pShared->nNextSerial++;
+            std::shared_ptr<SharedState> pState = pShared;
+            pResult = std::shared_ptr<T>( pAsset, [pState, sKey, eType, nBytes, nSerial, fnRelease]( T *p ) {
+                {
+                    std::lock_guard<std::mutex> lock( pState->mtxEntries );
+                    auto it = pState->mEntries.find( sKey );
+                    if (it != pState->mEntries.end() && it->second.nSerial == nSerial)
+                        pState->mEntries.erase( it );
+                    pState->aStats[eType].nAssets -= 1;
+                    pState->aStats[eType].nBytes  -= nBytes;
+                }
+                fnRelease( p );
+            } );
+            e.eType   = eType;
+            e.pAsset  = pResult;
+            e.nBytes  = nBytes;
+            e.nSerial = nSerial;
+            pShared->aStats[eType].nAssets += 1;
+            pShared->aStats[eType].nBytes  += nBytes;
+            return pResult;
+        }
+    }
+    fnRelease( pAsset );
+    return pResult;
+}
+
+std::shared_ptr<flc::Sprite> flc::AssetCache::GetSprite( const std::string &sFileName ) {
+    std::string sKey = "sprite|" + sFileName;
+    std::shared_ptr<Sprite> pResult = Find<Sprite>( sKey );
+    if (pResult == nullptr) {
+        Sprite *pSprite = new Sprite( sFileName );
+        if (pSprite->IsEmpty()) {
+            delete pSprite;
+            return nullptr;
+        }
+        size_t nBytes = size_t( pSprite->GetSurfacePtr()->pitch ) * pSprite->height;
+        pResult = Insert( sKey, SPRITE, pSprite, nBytes, []( Sprite *p ) { delete p; } );
+    }
+    return pResult;
+}
+
+// the decal handle holds a handle to the sprite, that is released after the decal is deleted
+std::shared_ptr<flc::Decal> flc::AssetCache::GetDecal( const std::string &sFileName, bool bFilter, bool bClamp ) {
+    std::string sKey = std::string( "decal|" ) + (bFilter ? "f" : "-") + (bClamp ? "c" : "-") + "|" + sFileName;
+    std::shared_ptr<Decal> pResult = Find<Decal>( sKey );
+    if (pResult == nullptr) {
+        std::shared_ptr<Sprite> pSprite = GetSprite( sFileName );
+        if (pSprite == nullptr)
+            return nullptr;
+        Decal *pDecal = new Decal( pSprite.get(), bFilter, bClamp );
+        size_t nBytes = size_t( pSprite->width ) * pSprite->height * 4;
+        pResult = Insert( sKey, DECAL, pDecal, nBytes, [pSprite]( Decal *p ) { delete p; } );
+    }
+    return pResult;
+}
+
+// music is streamed from the file, so the file size is used as the size in memory
+std::shared_ptr<flc::Music> flc::AssetCache::GetMusic( const std::string &sFileName ) {
+    std::string sKey = "music|" + sFileName;
+    std::shared_ptr<Music> pResult = Find<Music>( sKey );
+    if (pResult == nullptr) {
+        Music *pMusic = new Music( sFileName );
+        if (pMusic->IsEmpty()) {
+            delete pMusic;
+            return nullptr;
+        }
+        std::ifstream ifs( sFileName, std::ios::binary | std::ios::ate );
+        size_t nBytes = ifs.good() ? size_t( ifs.tellg() ) : 0;
+        pResult = Insert( sKey, MUSIC, pMusic, nBytes, []( Music *p ) { delete p; } );
+    }
+    return pResult;
+}
+
+std::shared_ptr<flc::Chunk> flc::AssetCache::GetChunk( const std::string &sFileName ) {
+    std::string sKey = "chunk|" + sFileName;
+    std::shared_ptr<Chunk> pResult = Find<Chunk>( sKey );
+    if (pResult == nullptr) {
+        Chunk *pChunk = new Chunk( sFileName );
+        if (pChunk->IsEmpty()) {
+            delete pChunk;
+            return nullptr;
+        }
+        pResult = Insert( sKey, CHUNK, pChunk, size_t( pChunk->GetSize() ), []( Chunk *p ) { delete p; } );
+    }
+    return pResult;
+}
+
+flc::AssetCache::Stats flc::AssetCache::GetStats( Type eType ) {
+    std::lock_guard<std::mutex> lock( pShared->mtxEntries );
+    return pShared->aStats[eType];
+}
+
+flc::AssetCache::Stats flc::AssetCache::GetTotalStats() {
+    std::lock_guard<std::mutex> lock( pShared->mtxEntries );
+    Stats sResult;
+    for (int i = 0; i < NR_OF_ASSET_TYPES; i++) {
+        sResult.nAssets += pShared->aStats[i].nAssets;
+        sResult.nBytes  += pShared->aStats[i].nBytes;
+    }
+    return sResult;
+}
+
+int flc::AssetCache::GetHits() {
+    std::lock_guard<std::mutex> lock( pShared->mtxEntries );
+    return pShared->nHits;
+}
+
+int flc::AssetCache::GetMisses() {
+    std::lock_guard<std::mutex> lock( pShared->mtxEntries );
+    return pShared->nMisses;
+}
@@ -0,0 +1,125 @@
+#ifndef SGE_ASSETCACHE_H
+#define SGE_ASSETCACHE_H
+
+/* SGE_AssetCache.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * ======================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module implements class AssetCache: it makes sure that each file is loaded only once, no matter how many parts
+ * of the program ask for it.
+ *
+ * The cache hands out shared handles (std::shared_ptr) to sprites, decals, music and chunks. The assets are keyed on
+ * their type, file name and load parameters. As long as there is a handle to an asset, asking for the same file again
+ * gives a handle to the same object. When the last handle is gone, the asset is deleted right away and removed from
+ * the cache - so the memory is freed at a predictable moment, and not when some cache decides to evict it:
+ *
+ *     std::shared_ptr<flc::Decal> pTree = GetAssetCache()->GetDecal( "tree.png" );
+ *     ...
+ *     DrawDecal( pos, pTree.get() );
+ *
+ * A decal handle keeps a handle to it's sprite, so GetSprite() with the same file gives the sprite the decal was made
+ * from. GetStats() tells how many assets of each type are alive, and how many bytes they take: for sprites the pixel
+ * data, for decals the texture size (4 bytes per pixel), for chunks the decoded sound data and for music the size of
+ * the file (music is streamed, so this is an estimate).
+ *
+ * The functions can be called from any thread, but decals must be created on the main thread (as always), and the
+ * last handle to a decal must be released there too. Failed loads give an empty handle, and are not cached.
+ */
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "SGE_Sprite.h"
+#include "SGE_Sound.h"
+
+namespace flc {
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    class AssetCache {
+    public:
+        enum Type { SPRITE = 0, DECAL, MUSIC, CHUNK, NR_OF_ASSET_TYPES };
+
+        // the number of assets (of one type) that are alive, and the bytes they take
+        struct Stats {
+            int    nAssets = 0;
+            size_t nBytes  = 0;
+        };
+
+    public:
+        AssetCache();
+        // handles that are still out there stay valid after the cache is gone
+        ~AssetCache();
+
+        // return a handle to the asset that is loaded from sFileName - it is only loaded if it's not alive already
+        std::shared_ptr<Sprite> GetSprite( const std::string &sFileName );
+        std::shared_ptr<Decal>  GetDecal(  const std::string &sFileName, bool bFilter = false, bool bClamp = true );
+        std::shared_ptr<Music>  GetMusic(  const std::string &sFileName );
+        std::shared_ptr<Chunk>  GetChunk(  const std::string &sFileName );
+
+        // statistics per asset type, resp. over all types
+        Stats GetStats( Type eType );
+        Stats GetTotalStats();
+        // the nr of Get...() calls that found the asset alive resp. had to load it
+        int GetHits();
+        int GetMisses();
+
+    private:
+        struct Entry {
+            Type                  eType;
+            std::weak_ptr<void>   pAsset;
+            size_t                nBytes  = 0;
+            uint64_t              nSerial = 0;    // to recognize the entry when it's asset is deleted
+        };
+        // the state is shared with the deleters of the handles, that can outlive the cache
+        struct SharedState {
+            std::mutex                             mtxEntries;
+            std::unordered_map<std::string, Entry> mEntries;
+            Stats                                  aStats[NR_OF_ASSET_TYPES];
+            uint64_t                               nNextSerial = 0;
+            int                                    nHits   = 0;
+            int                                    nMisses = 0;
+        };
+        std::shared_ptr<SharedState> pShared;
+
+        // internal functions - Find() returns the handle for sKey if it's alive. Insert() makes a handle for pAsset
+        // (that takes nBytes) and enters it in the cache - fnRelease is called when the last handle is gone, and must
+        // delete the asset. If another thread entered the same key in the mean time, that handle is returned instead.
+        template <typename T> std::shared_ptr<T> Find( const std::string &sKey );
+        template <typename T, typename F> std::shared_ptr<T> Insert( const std::string &sKey, Type eType, T *pAsset, size_t nBytes, F fnRelease );
+    };
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_ASSETCACHE_H
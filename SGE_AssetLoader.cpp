@@ -0,0 +1,157 @@
+/* SGE_AssetLoader.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =========================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include  <chrono>
+#include <climits>
+
+#include "SGE_AssetLoader.h"
+
+// ==============================/ Class AsyncAsset /==============================
+
+flc::AsyncAsset::~AsyncAsset() {
+    delete pDecal;
+    delete pSprite;
+    delete pMusic;
+    delete pChunk;
+    pDecal  = nullptr;
+    pSprite = nullptr;
+    pMusic  = nullptr;
+    pChunk  = nullptr;
+}
+
+// ==============================/ Class AssetLoader /==============================
+
+//                           +------------------+                            //
+// --------------------------+ CONSTRUCTORS ETC +--------------------------- //
+//                           +------------------+                            //
+
+flc::AssetLoader::AssetLoader( ThreadPool *pPool ) {
+    this->pPool = pPool;
+    pShared = std::make_shared<SharedState>();
+}
+
+// Tasks that are still queued or running only hold on to the shared state, and their results are dropped. The queued
+// ones don't load anything anymore.
+flc::AssetLoader::~AssetLoader() {
+    pShared->bCancelled = true;
+}
+
+//                               +----------+                                //
+// ------------------------------+ METHODS  +------------------------------- //
+//                               +----------+                                //
+
+flc::AsyncAssetPtr flc::AssetLoader::LoadSprite( const std::string &sFileName, bool bDecal ) {
+    AsyncAssetPtr pAsset( new AsyncAsset( AsyncAsset::SPRITE, sFileName ));
+    pAsset->bDecal = bDecal;
+    return StartLoad( pAsset );
+}
+
+flc::AsyncAssetPtr flc::AssetLoader::LoadMusic( const std::string &sFileName ) {
+    return StartLoad( AsyncAssetPtr( new AsyncAsset( AsyncAsset::MUSIC, sFileName )));
+}
+
+flc::AsyncAssetPtr flc::AssetLoader::LoadChunk( const std::string &sFileName ) {
+    return StartLoad( AsyncAssetPtr( new AsyncAsset( AsyncAsset::CHUNK, sFileName )));
+}
+
+// runs on a worker thread - only the members of pAsset are touched, and nothing else refers to them until the asset
+// is put into the done queue
+void flc::AssetLoader::LoadAsset( AsyncAsset *pAsset ) {
+    switch (pAsset->eType) {
+        case AsyncAsset::SPRITE: pAsset->pSprite = new Sprite( pAsset->sFileName ); break;
+        case AsyncAsset::MUSIC:  pAsset->pMusic  = new Music(  pAsset->sFileName ); break;
+        case AsyncAsset::CHUNK:  pAsset->pChunk  = new Chunk(  pAsset->sFileName ); break;
+    }
+}
+
+flc::AsyncAssetPtr flc::AssetLoader::StartLoad( AsyncAssetPtr pAsset ) {
+    nPending += 1;
+    std::shared_ptr<SharedState> pState = pShared;
+    // the task hands it's reference over to the done queue, so that it doesn't count as a user in Update(), and the
+    // asset (with it's decal) is released on the main thread
+    auto task = [pState, pAsset]() mutable {
+        if (pState->bCancelled)
+            return;
+        LoadAsset( pAsset.get() );
+        {
+            std::lock_guard<std::mutex> lock( pState->mtxDone );
+            pState->qDone.push_back( std::move( pAsset ));
+        }
+        pState->cvDone.notify_all();
+    };
+    if (pPool == nullptr || pPool->GetNrThreads() == 0) {
+        task();
+    } else {
+        pPool->Enqueue( task );
+    }
+    return pAsset;
+}
+
+void flc::AssetLoader::Update( int nBudgetMuSec ) {
+    std::deque<AsyncAssetPtr> qDone;
+    {
+        std::lock_guard<std::mutex> lock( pShared->mtxDone );
+        qDone.swap( pShared->qDone );
+    }
+    for (auto &pAsset : qDone) {
+        bool bFailed = (pAsset->pSprite != nullptr && pAsset->pSprite->IsEmpty()) ||
+                       (pAsset->pMusic  != nullptr && pAsset->pMusic->IsEmpty() ) ||
+                       (pAsset->pChunk  != nullptr && pAsset->pChunk->IsEmpty() );
+        if (bFailed) {
+            pAsset->eState = AsyncAsset::FAILED;
+            nPending -= 1;
+        } else if (pAsset->eType == AsyncAsset::SPRITE && pAsset->bDecal) {
+            qDecals.push_back( std::move( pAsset ));
+        } else {
+            pAsset->eState = AsyncAsset::READY;
+            nPending -= 1;
+        }
+    }
+
+    // create the decals, as far as the budget allows. Assets that nobody refers to anymore don't get a decal
+    auto tStart = std::chrono::steady_clock::now();
+    bool bFirst = true;
+    while (!qDecals.empty()) {
+        if (!bFirst) {
+            auto nElapsed = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - tStart ).count();
+            if (nElapsed >= nBudgetMuSec)
+                break;
+        }
+        AsyncAssetPtr pAsset = qDecals.front();
+        qDecals.pop_front();
+        if (pAsset.use_count() > 1) {
+            pAsset->pDecal = new Decal( pAsset->pSprite );
+            bFirst = false;
+        }
+        pAsset->eState = AsyncAsset::READY;
+        nPending -= 1;
+    }
+}
+
+void flc::AssetLoader::WaitAll() {
+    while (nPending > 0) {
+        Update( INT_MAX );
+        if (nPending > 0) {
+            std::unique_lock<std::mutex> lock( pShared->mtxDone );
+            pShared->cvDone.wait( lock, [this] { return !pShared->qDone.empty(); } );
+        }
+    }
+}
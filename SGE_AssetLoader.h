@@ -0,0 +1,164 @@
+#ifndef SGE_ASSETLOADER_H
+#define SGE_ASSETLOADER_H
+
+/* SGE_AssetLoader.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =======================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module implements class AssetLoader, that loads sprites, music and sound effects (chunks) in the background.
+ *
+ * Loading a sprite decodes the image file and converts it to the pixel format of the engine. For a level with lots
+ * of sprites this can take a noticable time, during which the game loop would freeze. The AssetLoader does the file
+ * loading and decoding on the thread pool of the engine, so that a number of files is decoded in parallel, while
+ * the game loop keeps running (showing a loading screen for instance).
+ *
+ * A load function returns a handle (an AsyncAsset) right away. The handle becomes ready once the asset is loaded:
+ *
+ *     flc::AsyncAssetPtr pTiles = GetAssetLoader()->LoadSprite( "tiles.png" );
+ *     ...
+ *     if (pTiles->IsReady())
+ *         DrawDecal( pos, pTiles->GetDecal() );
+ *
+ * Decals (textures) can only be created on the main thread. The engine calls Update() of it's loader each frame
+ * (before OnUserUpdate()), which creates the decals of the sprites that were decoded, within a time budget per frame.
+ * So when lots of sprites come in at once, their decals are spread over a number of frames. Handles only become
+ * ready in Update(), so during OnUserUpdate() their state doesn't change.
+ *
+ * The loaded objects are owned by the handle (AsyncAsset is reference counted, as a std::shared_ptr), and are deleted
+ * when the last reference to it is gone. Handles must be released on the main thread, since a decal is deleted with it.
+ */
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+#include "SGE_Sprite.h"
+#include "SGE_Sound.h"
+#include "SGE_ThreadPool.h"
+
+// the default time budget (in micro seconds) per frame for creating decals, see AssetLoader::Update()
+#define ASSET_DECAL_BUDGET 2000
+
+namespace flc {
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    // the handle to an asset that is (being) loaded by an AssetLoader
+    class AsyncAsset {
+    public:
+        enum Type  { SPRITE = 0, MUSIC, CHUNK };
+        enum State { LOADING = 0, READY, FAILED };
+
+    public:
+        ~AsyncAsset();
+
+        Type  GetType()  { return eType;  }
+        State GetState() { return eState; }
+        bool  IsReady()  { return eState == READY;  }
+        bool  IsFailed() { return eState == FAILED; }
+        const std::string &GetFileName() { return sFileName; }
+
+        // return the loaded objects, or nullptr as long as the asset isn't ready. The decal is only there if it was
+        // asked for in AssetLoader::LoadSprite()
+        Sprite *GetSprite() { return eState == READY ? pSprite : nullptr; }
+        Decal  *GetDecal()  { return eState == READY ? pDecal  : nullptr; }
+        Music  *GetMusic()  { return eState == READY ? pMusic  : nullptr; }
+        Chunk  *GetChunk()  { return eState == READY ? pChunk  : nullptr; }
+
+    private:
+        friend class AssetLoader;
+        AsyncAsset( Type eType, const std::string &sFileName ) : eType( eType ), sFileName( sFileName ) {}
+
+        Type        eType;
+        State       eState = LOADING;
+        std::string sFileName;
+        bool        bDecal = false;    // for sprites: whether a decal must be created
+
+        Sprite *pSprite = nullptr;
+        Decal  *pDecal  = nullptr;
+        Music  *pMusic  = nullptr;
+        Chunk  *pChunk  = nullptr;
+    };
+
+    typedef std::shared_ptr<AsyncAsset> AsyncAssetPtr;
+
+    class AssetLoader {
+    public:
+        // the loading is done on the worker threads of pPool. If the pool has no worker threads, the loads are done
+        // right away on the calling thread (the decals are still created in Update())
+        AssetLoader( ThreadPool *pPool );
+        // the loads that didn't start yet are cancelled
+        ~AssetLoader();
+
+        // Start loading a sprite (and create a decal for it if bDecal is true), music or a sound effect resp. The file
+        // loading is done on the thread pool, the returned handle becomes ready in a later call of Update().
+        AsyncAssetPtr LoadSprite( const std::string &sFileName, bool bDecal = true );
+        AsyncAssetPtr LoadMusic(  const std::string &sFileName );
+        AsyncAssetPtr LoadChunk(  const std::string &sFileName );
+
+        // Main thread only: makes the assets that were loaded ready, and creates the decals for them. When creating the
+        // decals takes longer than nBudgetMuSec, the rest is left for the next call (at least one decal is created per
+        // call). The engine calls this each frame.
+        void Update( int nBudgetMuSec = ASSET_DECAL_BUDGET );
+        // Main thread only: blocks until all assets that were asked for are ready (or failed)
+        void WaitAll();
+
+        // the nr of assets that are not ready yet
+        int GetNrPending() { return nPending; }
+
+    private:
+        // the state that is shared with the load tasks - it's reference counted, since tasks may still be running (or
+        // queued) when the loader is deleted
+        struct SharedState {
+            std::mutex                mtxDone;
+            std::condition_variable   cvDone;
+            std::deque<AsyncAssetPtr> qDone;    // loaded on a worker thread, waiting for Update()
+            std::atomic<bool>         bCancelled { false };    // set when the loader is deleted
+        };
+
+        ThreadPool                  *pPool = nullptr;
+        std::shared_ptr<SharedState> pShared;
+        std::deque<AsyncAssetPtr>    qDecals;    // sprites that wait for their decal
+        int                          nPending = 0;
+
+        // internal functions - starts the load of pAsset, resp. does the load (on a worker thread)
+        AsyncAssetPtr StartLoad( AsyncAssetPtr pAsset );
+        static void LoadAsset( AsyncAsset *pAsset );
+    };
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_ASSETLOADER_H
@@ -0,0 +1,194 @@
+/* SGE_ConsoleGrid.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =========================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include <algorithm>
+
+#include "SGE_Kernels.h"
+#include "SGE_ConsoleGrid.h"
+
+// ==============================/ Class ConsoleGrid /==============================
+
+//                           +------------------+                            //
+// --------------------------+ CONSTRUCTORS ETC +--------------------------- //
+//                           +------------------+                            //
+
+flc::ConsoleGrid::ConsoleGrid( SpriteFont *pFont, int nCols, int nRows ) {
+    if (pFont == nullptr) {
+        std::cout << "ERROR: ConsoleGrid() --> can't construct with a nullptr font pointer argument " << std::endl;
+    }
+    this->pFont = pFont;
+    this->nCols = std::max( 1, nCols );
+    this->nRows = std::max( 1, nRows );
+    vCells.resize( this->nCols * this->nRows );
+    vChanged.assign( vCells.size(), 0 );
+    vDirtyX0.assign( this->nRows, -1 );
+    vDirtyX1.assign( this->nRows, -1 );
+}
+
+flc::ConsoleGrid::~ConsoleGrid() {
+    delete pDecal;
+    delete pSprite;
+    pDecal  = nullptr;
+    pSprite = nullptr;
+}
+
+//                               +----------+                                //
+// ------------------------------+ METHODS  +------------------------------- //
+//                               +----------+                                //
+
+void flc::ConsoleGrid::MarkChanged( int nIx ) {
+    if (!vChanged[nIx]) {
+        vChanged[nIx] = 1;
+        vChangedIx.push_back( nIx );
+    }
+}
+
+void flc::ConsoleGrid::SetCell( int x, int y, char ch, Pixel fg, Pixel bg ) {
+    if (x < 0 || x >= nCols || y < 0 || y >= nRows)
+        return;
+    int nIx = y * nCols + x;
+    Cell &c = vCells[nIx];
+    if (c.ch != ch || c.fg != fg || c.bg != bg) {
+        c.ch = ch;
+        c.fg = fg;
+        c.bg = bg;
+        MarkChanged( nIx );
+    }
+}
+
+void flc::ConsoleGrid::Print( int x, int y, const std::string &sText, Pixel fg, Pixel bg ) {
+    for (int i = 0; i < (int)sText.length(); i++)
+        SetCell( x + i, y, sText[i], fg, bg );
+}
+
+void flc::ConsoleGrid::Clear( char ch, Pixel fg, Pixel bg ) {
+    for (int y = 0; y < nRows; y++)
+        for (int x = 0; x < nCols; x++)
+            SetCell( x, y, ch, fg, bg );
+}
+
+// the cells are moved via SetCell(), so only the cells that actually differ from the row below are rendered again
+void flc::ConsoleGrid::ScrollUp( int nLines, Pixel bg ) {
+    if (nLines <= 0)
+        return;
+    for (int y = 0; y < nRows; y++) {
+        for (int x = 0; x < nCols; x++) {
+            if (y + nLines < nRows) {
+                Cell c = vCells[ (y + nLines) * nCols + x ];
+                SetCell( x, y, c.ch, c.fg, c.bg );
+            } else {
+                SetCell( x, y, ' ', WHITE, bg );
+            }
+        }
+    }
+}
+
+flc::Sprite *flc::ConsoleGrid::GetSprite() {
+    Render();
+    return pSprite;
+}
+
+flc::Decal *flc::ConsoleGrid::GetDecal() {
+    Render();
+    Upload();
+    return pDecal;
+}
+
+// Renders the changed cells: the background is filled, and the character is drawn on top of it, clipped to the cell.
+// If the sprite doesn't exist yet, or the font or font mode was switched (a font switch changes the cell size), all
+// cells are rendered.
+void flc::ConsoleGrid::Render() {
+    if (pFont == nullptr)
+        return;
+    if (pSprite == nullptr || nFontIndex != pFont->GetFontIndex() || eFontMode != pFont->GetMode()) {
+        nFontIndex = pFont->GetFontIndex();
+        eFontMode  = pFont->GetMode();
+        vCellSize  = pFont->GetCharSize();
+        delete pDecal;
+        delete pSprite;
+        pSprite = new Sprite( nCols * vCellSize.x, nRows * vCellSize.y );
+        pDecal  = nullptr;
+        for (int i = 0; i < (int)vCells.size(); i++)
+            MarkChanged( i );
+    }
+    if (vChangedIx.empty())
+        return;
+
+    SDL_Surface *pSrfce = pSprite->GetSurfacePtr();
+    SDL_Rect sOldClip = pSrfce->clip_rect;
+    char sChar[2] = { ' ', '\0' };
+    for (auto nIx : vChangedIx) {
+        int x = nIx % nCols;
+        int y = nIx / nCols;
+        Cell &c = vCells[nIx];
+        SDL_Rect sCell;
+        InitSDL_Rect( sCell, x * vCellSize.x, y * vCellSize.y, vCellSize.x, vCellSize.y );
+
+        SDL_LockSurface( pSrfce );
+        uint32_t nBg = c.bg.Encode();
+        for (int yc = sCell.y; yc < sCell.y + sCell.h; yc++)
+            glb_Kernels.fill( (uint32_t *)((uint8_t *)pSrfce->pixels + yc * pSrfce->pitch) + sCell.x, nBg, sCell.w );
+        SDL_UnlockSurface( pSrfce );
+        if (c.ch != ' ') {
+            sChar[0] = c.ch;
+            SDL_SetClipRect( pSrfce, &sCell );
+            pFont->DrawString( pSrfce, sCell.x, sCell.y, sChar, c.fg, 1 );
+        }
+        vChanged[nIx] = 0;
+
+        // extend the dirty span of the row
+        vDirtyX0[y] = (vDirtyX0[y] < 0) ? x : std::min( vDirtyX0[y], x );
+        vDirtyX1[y] = std::max( vDirtyX1[y], x );
+    }
+    SDL_SetClipRect( pSrfce, &sOldClip );
+    vChangedIx.clear();
+    pSprite->InvalidateRLE();
+}
+
+// Puts the dirty spans into the texture. Consecutive rows with dirty cells are combined into one rect, spanning the
+// dirty columns of all of them. The first time (or after a font switch) the decal is created as a whole.
+void flc::ConsoleGrid::Upload() {
+    if (pSprite == nullptr)
+        return;
+    if (pDecal == nullptr) {
+        pDecal = new Decal( pSprite );
+        std::fill( vDirtyX0.begin(), vDirtyX0.end(), -1 );
+        std::fill( vDirtyX1.begin(), vDirtyX1.end(), -1 );
+        return;
+    }
+    int y = 0;
+    while (y < nRows) {
+        if (vDirtyX0[y] < 0) {
+            y++;
+            continue;
+        }
+        int y0 = y, x0 = vDirtyX0[y], x1 = vDirtyX1[y];
+        while (y < nRows && vDirtyX0[y] >= 0) {
+            x0 = std::min( x0, vDirtyX0[y] );
+            x1 = std::max( x1, vDirtyX1[y] );
+            vDirtyX0[y] = vDirtyX1[y] = -1;
+            y++;
+        }
+        SDL_Rect sRect;
+        InitSDL_Rect( sRect, x0 * vCellSize.x, y0 * vCellSize.y, (x1 - x0 + 1) * vCellSize.x, (y - y0) * vCellSize.y );
+        pDecal->UpdateSprite( sRect );
+    }
+}
@@ -0,0 +1,123 @@
+#ifndef SGE_CONSOLEGRID_H
+#define SGE_CONSOLEGRID_H
+
+/* SGE_ConsoleGrid.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =======================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module implements class ConsoleGrid: a grid of character cells, like a text terminal. It's meant for log
+ * viewers, debug consoles, roguelikes and the like, where drawing all the text with DrawString() each frame would be
+ * a waste, since only a few cells change per frame.
+ *
+ * Each cell holds a character, a foreground (text) colour and a background colour. The cells have the size of a
+ * character tile of the font. The grid keeps a sprite with the rendered cells, and only the cells that changed since
+ * the previous frame are rendered again. When the decal is used, only the rows that contain changed cells are put
+ * into GPU memory.
+ *
+ *     flc::ConsoleGrid cConsole( GetFont(), 200, 60 );
+ *     ...
+ *     cConsole.Print( 0, 59, "Player enters the dungeon", flc::YELLOW );
+ *     DrawDecal( { 0.0f, 0.0f }, cConsole.GetDecal() );             // or: DrawSprite( 0, 0, cConsole.GetSprite() );
+ *
+ * The setters don't render anything, so they can be called as often as needed. Since a decal is a texture of the
+ * renderer, GetDecal() must be called from the main thread.
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "SGE_Utilities.h"
+#include "SGE_Pixel.h"
+#include "SGE_Sprite.h"
+
+namespace flc {
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    class ConsoleGrid {
+    public:
+        // the contents of a cell
+        struct Cell {
+            char  ch = ' ';
+            Pixel fg = WHITE;
+            Pixel bg = BLACK;
+        };
+
+    public:
+        // pFont is the font to render with - it must outlive the ConsoleGrid. The grid has nCols x nRows cells.
+        ConsoleGrid( SpriteFont *pFont, int nCols, int nRows );
+        ~ConsoleGrid();
+
+        int GetCols() { return nCols; }
+        int GetRows() { return nRows; }
+        // the size of a cell in pixels (the character tile size of the font)
+        vi2d GetCellSize() { return vCellSize; }
+
+        // sets cell (x, y) - cells outside the grid are ignored. A cell is only marked as changed if it's value changes
+        void SetCell( int x, int y, char ch, Pixel fg = WHITE, Pixel bg = BLACK );
+        const Cell &GetCell( int x, int y ) { return vCells[ y * nCols + x ]; }
+        // sets the cells from (x, y) onwards to the characters of sText. The text is cut off at the end of the row
+        void Print( int x, int y, const std::string &sText, Pixel fg = WHITE, Pixel bg = BLACK );
+        // sets all cells to the specified character and colours
+        void Clear( char ch = ' ', Pixel fg = WHITE, Pixel bg = BLACK );
+        // moves all rows nLines up, and clears the rows that come free at the bottom (like a terminal that scrolls)
+        void ScrollUp( int nLines = 1, Pixel bg = BLACK );
+
+        // return the sprite resp. decal with the rendered grid, after rendering the changed cells
+        Sprite *GetSprite();
+        Decal  *GetDecal();
+
+    private:
+        SpriteFont *pFont = nullptr;
+        int  nCols = 0;
+        int  nRows = 0;
+        vi2d vCellSize = { 0, 0 };
+
+        std::vector<Cell>    vCells;
+        std::vector<uint8_t> vChanged;    // per cell: 1 if it changed since it was last rendered
+        std::vector<int>     vChangedIx;  // the indices of the changed cells, so that rendering doesn't need to scan the grid
+        // the first and last column per row that was rendered but not yet put into the decal, or -1 if none
+        std::vector<int>     vDirtyX0, vDirtyX1;
+
+        Sprite *pSprite    = nullptr;
+        Decal  *pDecal     = nullptr;
+        int     nFontIndex = -1;          // the font index the grid was rendered with
+        SpriteFont::Mode eFontMode = SpriteFont::BITMAP;    // and the font mode
+
+        // internal functions - renders the changed cells into the sprite, resp. puts the dirty rows into the decal
+        void Render();
+        void Upload();
+        void MarkChanged( int nIx );
+    };
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_CONSOLEGRID_H
@@ -106,7 +106,21 @@ void PrintPixelFormat( std::string sTitle, uint32_t nPixelFormat ) {
 //                           +------------------+                            //
 
 flc::SDL_GameEngine::SDL_GameEngine() {}
-flc::SDL_GameEngine::~SDL_GameEngine() {}
+flc::SDL_GameEngine::~SDL_GameEngine() {
+    // normally these are already gone at the end of Start(). The loader goes first, since it uses the thread pool
+    if (pAssetLoader != nullptr) {
+        delete pAssetLoader;
+        pAssetLoader = nullptr;
+    }
+    if (pAssetCache != nullptr) {
+        delete pAssetCache;
+        pAssetCache = nullptr;
+    }
+    if (pThreadPool != nullptr) {
+        delete pThreadPool;
+        pThreadPool = nullptr;
+    }
+}
 
 //                               +----------+                                //
 // ------------------------------+ METHODS  +------------------------------- //
@@ -154,6 +168,14 @@ bool flc::SDL_GameEngine::Construct( int nWinSizeX, int nWinSizeY,
     }
 
     if (DIAG_OUTPUT) std::cout << "done!" << std::endl;
+
+    // select the pixel kernels that match the instruction sets of the CPU
+    SIMDLevel nSIMDLevel = InitPixelKernels();
+    if (DIAG_OUTPUT) {
+        std::cout << "Construct() --> pixel kernels: " << SIMDLevelName( nSIMDLevel );
+        std::cout << " (CPU supports: " << SIMDLevelName( DetectSIMDLevel()) << ")" << std::endl;
+    }
+
     if (DIAG_OUTPUT) std::cout << "Construct() --> creating window (including renderer, canvas sprite, canvas texture and default layer), ";
     AddWindow( sAppName, nWinSizeX, nWinSizeY, nPixSizeX, nPixSizeY, bFullScreen, WIN_RESIZABLE, bVsynced, DEFAULT_RNDRR );
 
@@ -225,6 +247,7 @@ void flc::SDL_GameEngine::Start() {
     // initialize default font sprite
     if (DIAG_OUTPUT) std::cout << "Start()     --> setting default font and pixel mode " << std::endl;
     cFont.SetFont( 0 );
+    m_DrawContext.SetFont( &cFont );
     SetPixelMode( flc::Pixel::NORMAL );    // start with default pixel mode
 
     // do user initialisation stuff
@@ -321,6 +344,10 @@ void flc::SDL_GameEngine::Start() {
                 );
             }
 
+            // ASSETS - make the assets that were loaded in the background ready (this creates their decals)
+            if (pAssetLoader != nullptr)
+                pAssetLoader->Update();
+
             cEngineProfiler.Probe( 2 );  // -------------------------------------------------------------------
 
             // UPDATE - do the user game logic and drawing
@@ -330,6 +357,9 @@ void flc::SDL_GameEngine::Start() {
 
 // ====================   RENDERING CYCLE STARTS HERE   ==============================
 
+            // first gather the decals that were submitted to the decal buckets (possibly from other threads)
+            MergeDecalBuckets();
+
             // iterate all windows
             for (int winIx = 0; winIx < (int)vWindows.size(); winIx++) {
 
@@ -356,11 +386,19 @@ void flc::SDL_GameEngine::Start() {
                             // texture needs no update if the canvas is not "dirty" (i.e. altered since last frame)
                             if (vWindows[winIx]->vLayers[layIx].bDirty) {
 
+                                const void *pPixels = vWindows[winIx]->vLayers[layIx].pLayerCanvas->GetSurfacePtr()->pixels;
+                                int         nPitch  = vWindows[winIx]->vLayers[layIx].pLayerCanvas->GetSurfacePtr()->pitch;
+                                // if the layer has post processing, the output of the chain is uploaded instead of the canvas
+                                flc::PostProcessChain *pChain = vWindows[winIx]->vLayers[layIx].pPostChain;
+                                if (pChain != nullptr && !pChain->IsEmpty()) {
+                                    pPixels = pChain->Run( vWindows[winIx]->vLayers[layIx].pLayerCanvas, GetThreadPool() );
+                                    nPitch  = vWindows[winIx]->vLayers[layIx].pLayerCanvas->width * 4;
+                                }
                                 // update the layer texture from the layer surface
                                 SDL_UpdateTexture(
                                     vWindows[winIx]->vLayers[layIx].pRenderTexture, nullptr,
-                                    vWindows[winIx]->vLayers[layIx].pLayerCanvas->GetSurfacePtr()->pixels,
-                                    vWindows[winIx]->vLayers[layIx].pLayerCanvas->GetSurfacePtr()->pitch
+                                    pPixels,
+                                    nPitch
                                 );
                                 vWindows[winIx]->vLayers[layIx].bDirty = false;
                             }
@@ -402,7 +440,21 @@ void flc::SDL_GameEngine::Start() {
                             // 2. if there are decals for this layer/frame, render them on top of the layer texture
                             // ------------------------------------------------------------------------------------
 
+                            bool     bClipActive = false;
+                            SDL_Rect curClip     = { 0, 0, 0, 0 };
                             for (auto &elt : vWindows[winIx]->vLayers[layIx].vDecals) {
+                                // apply the clip rect that was set when the decal was drawn - only call SDL when it changes
+                                if (elt.m_bClipped) {
+                                    if (!bClipActive || elt.m_rect_clip.x != curClip.x || elt.m_rect_clip.y != curClip.y ||
+                                                        elt.m_rect_clip.w != curClip.w || elt.m_rect_clip.h != curClip.h) {
+                                        SDL_RenderSetClipRect( vWindows[winIx]->GetRendererPtr(), &elt.m_rect_clip );
+                                        curClip     = elt.m_rect_clip;
+                                        bClipActive = true;
+                                    }
+                                } else if (bClipActive) {
+                                    SDL_RenderSetClipRect( vWindows[winIx]->GetRendererPtr(), nullptr );
+                                    bClipActive = false;
+                                }
                                 // Tinting - 1 of 2: set the color modulation for this texture, to get the tinting effect
                                 SDL_SetTextureColorMod( elt.m_decal, elt.m_tint.getR(), elt.m_tint.getG(), elt.m_tint.getB());
                                 // Tinting - 2 of 2: set the alpha mode for this texture
@@ -419,6 +471,8 @@ void flc::SDL_GameEngine::Start() {
                                      SDL_FLIP_NONE
                                  );
                             }
+                            if (bClipActive)
+                                SDL_RenderSetClipRect( vWindows[winIx]->GetRendererPtr(), nullptr );
                         }
                         // clear the decal instance vector at the end of the render cycle - regardless if it's used or not
                         // otherwise disabled layers would pile up their decals
@@ -450,15 +504,29 @@ void flc::SDL_GameEngine::Start() {
     // ... dispose all dynamically allocated objects ...
     if (DIAG_OUTPUT) std::cout << "Start()     --> shutting down..." << std::endl << std::endl;
 
+    // the asset loading is stopped first, while the renderers and SDL are still there: the loads that didn't start
+    // yet are cancelled, and deleting the thread pool waits for the tasks that are running
+    delete pAssetLoader;
+    pAssetLoader = nullptr;
+    delete pAssetCache;
+    pAssetCache = nullptr;
+    delete pThreadPool;
+    pThreadPool = nullptr;
+
     for (auto &w : vWindows) {
         w->CloseWindow();
         delete w;
     }
     vWindows.clear();
 
+    for (auto &b : vDecalBuckets) {
+        delete b;
+    }
+    vDecalBuckets.clear();
+
     pActiveWindow       = nullptr;
     nActiveWindowIx     = -1;
-    pEngineDrawTarget   = nullptr;
+    m_DrawContext.SetDrawTarget( nullptr );
     nEngineDrawTargetIx = -1;
 
     // ... and close the SDL environment
@@ -488,30 +556,47 @@ int flc::SDL_GameEngine::GetFPS_mean() { return m_FPS_mean; }   // mean FPS over
 float flc::SDL_GameEngine::GetElapsedTime() {      return m_MuSecCurElapsed  / 1000.0f; }   // actual last elapsed time
 float flc::SDL_GameEngine::GetElapsedTime_mean() { return m_mSec_mean / 1000.0f; }   // mean elapsed time over 0.5 sec
 
-// Draw Target functions ==========
+// Thread pool ==========
 
-// Returns width and height of current draw target
-int flc::SDL_GameEngine::GetDrawTargetWidth() {
-    if (pEngineDrawTarget == nullptr) std::cout << "ERROR: GetDrawTargetWidth() --> nullptr drawtarget!" << std::endl;
-    return pEngineDrawTarget->width;
+// the thread pool is created upon first use, so that no threads are started if they are not needed
+flc::ThreadPool *flc::SDL_GameEngine::GetThreadPool() {
+    if (pThreadPool == nullptr) {
+        pThreadPool = new flc::ThreadPool();
+    }
+    return pThreadPool;
 }
 
-int flc::SDL_GameEngine::GetDrawTargetHeight() {
-    if (pEngineDrawTarget == nullptr) std::cout << "ERROR: GetDrawTargetHeight() --> nullptr drawtarget!" << std::endl;
-    return pEngineDrawTarget->height;
+flc::AssetLoader *flc::SDL_GameEngine::GetAssetLoader() {
+    if (pAssetLoader == nullptr) {
+        pAssetLoader = new flc::AssetLoader( GetThreadPool() );
+    }
+    return pAssetLoader;
 }
 
+flc::AssetCache *flc::SDL_GameEngine::GetAssetCache() {
+    if (pAssetCache == nullptr) {
+        pAssetCache = new flc::AssetCache();
+    }
+    return pAssetCache;
+}
+
+// Draw Target functions ==========
+
+// Returns width and height of current draw target
+int flc::SDL_GameEngine::GetDrawTargetWidth()  { return m_DrawContext.GetDrawTargetWidth();  }
+int flc::SDL_GameEngine::GetDrawTargetHeight() { return m_DrawContext.GetDrawTargetHeight(); }
+
 // Returns sprite pointer of the current draw target
-flc::Sprite* flc::SDL_GameEngine::GetDrawTarget() { return pEngineDrawTarget; }
+flc::Sprite* flc::SDL_GameEngine::GetDrawTarget() { return m_DrawContext.GetDrawTarget(); }
 
 // Set the draw target to be the parameter sprite pointer
 // NOTE if you specify 0 (nullptr, nullptr), the screen (= layer[0]) should be selected as the draw target
 void flc::SDL_GameEngine::SetDrawTarget( flc::Sprite *pDT ) {
     if (pDT == nullptr) {
-        pEngineDrawTarget = vWindows[nActiveWindowIx]->vLayers[0].pLayerCanvas;
+        m_DrawContext.SetDrawTarget( vWindows[nActiveWindowIx]->vLayers[0].pLayerCanvas );
         nEngineDrawTargetIx = 0;
     } else {
-        pEngineDrawTarget = pDT;
+        m_DrawContext.SetDrawTarget( pDT );
     }
 }
 
@@ -527,7 +612,7 @@ int flc::SDL_GameEngine::CreateLayer() {
 // set layer as the new drawtarget of the currently active window
 void flc::SDL_GameEngine::SetDrawTarget( uint8_t layer ) {
     vWindows[nActiveWindowIx]->SetDrawTarget( layer );
-    pEngineDrawTarget = vWindows[nActiveWindowIx]->GetDrawTarget();
+    m_DrawContext.SetDrawTarget( vWindows[nActiveWindowIx]->GetDrawTarget() );
     nEngineDrawTargetIx = layer;
 }
 
@@ -556,6 +641,16 @@ void flc::SDL_GameEngine::SetLayerTint( uint8_t layer, const flc::Pixel& tint )
     vWindows[nActiveWindowIx]->SetLayerTint( layer, tint );
 }
 
+// add a post processing pass to layer on the current window
+void flc::SDL_GameEngine::AddPostProcess( uint8_t layer, flc::PostProcessPass *pPass ) {
+    vWindows[nActiveWindowIx]->AddPostProcess( layer, pPass );
+}
+
+// remove all post processing passes from layer on the current window
+void flc::SDL_GameEngine::ClearPostProcess( uint8_t layer ) {
+    vWindows[nActiveWindowIx]->ClearPostProcess( layer );
+}
+
 // ========== Window selection / activation ====================
 
 // Make window with index nWinID the active window. As a side effect the draw target of the new
@@ -567,7 +662,7 @@ void flc::SDL_GameEngine::ActivateWindow( int nWinID ) {
     }
     nActiveWindowIx = nWinID;
     pActiveWindow   = vWindows[nActiveWindowIx];
-    pEngineDrawTarget   = pActiveWindow->GetDrawTarget();
+    m_DrawContext.SetDrawTarget( pActiveWindow->GetDrawTarget() );
     nEngineDrawTargetIx = pActiveWindow->GetDrawTargetIndex();
     // I must make sure that the glbRendererPtr is updated to the renderer * that belongs the the activated window!!
     glbRendererPtr = pActiveWindow->GetRendererPtr();
@@ -66,6 +66,8 @@
 #include   <iostream>                 // C++ libraries
 #include     <vector>
 #include <functional>
+#include  <algorithm>
+#include      <mutex>
 
 #include       <SDL.h>                // SDL libraries
 #include <SDL_image.h>
@@ -74,12 +76,22 @@
 
 #include  "SGE_Utilities.h"           // application dependencies
 #include      "SGE_Pixel.h"
+#include    "SGE_Kernels.h"
 #include     "SGE_Sprite.h"
 #include "SGE_Periferals.h"
 #include       "SGE_Draw.h"
 #include      "SGE_Sound.h"
 #include     "SGE_Window.h"
 #include      "SGE_Timer.h"
+#include "SGE_ThreadPool.h"
+#include "SGE_PostProcess.h"
+#include "SGE_DecalBucket.h"
+#include "SGE_TextDecal.h"
+#include "SGE_ConsoleGrid.h"
+#include "SGE_DecalAtlas.h"
+#include "SGE_AssetLoader.h"
+#include "SGE_AssetCache.h"
+#include "SGE_RawSprite.h"
 
 //                               +-----------+                               //
 // ------------------------------+ CONSTANTS +------------------------------ //
@@ -133,11 +145,11 @@ namespace flc {
             // screen - size interrogation and cleaning
             int ScreenWidth();
             int ScreenHeight();
-            void Clear( Pixel colour = BLACK );
+            void Clear( Pixel colour = BLACK ) { m_DrawContext.Clear( colour ); }
 
             // draw a single pixel in the specified colour
-            void Draw( int x, int y, Pixel colour = WHITE );
-            void Draw( int x, int y, uint32_t encodedCol );
+            void Draw( int x, int y, Pixel colour = WHITE ) { m_DrawContext.Draw( x, y, colour     ); }
+            void Draw( int x, int y, uint32_t encodedCol )  { m_DrawContext.Draw( x, y, encodedCol ); }
             void Draw( const flc::vi2d &pos, Pixel colour = WHITE ) {
                 Draw( pos.x, pos.y, colour );
             }
@@ -145,15 +157,28 @@ namespace flc {
                 Draw( pos.x, pos.y, encodedCol );
             }
 
+            // draw a batch of points - either each point in it's own (encoded) colour, or all points in the same colour.
+            // Use these instead of repeated Draw() calls if you need to plot a lot of points (particles, scatter plots, ...)
+            void DrawPoints( const flc::vi2d *pPoints, const uint32_t *pColours, size_t nPoints ) { m_DrawContext.DrawPoints( pPoints, pColours, nPoints ); }
+            void DrawPoints( const flc::vi2d *pPoints, size_t nPoints, Pixel colour = WHITE )     { m_DrawContext.DrawPoints( pPoints, nPoints,  colour  ); }
+            void DrawPoints( const std::vector<flc::vi2d> &vPoints, const std::vector<uint32_t> &vColours ) {
+                DrawPoints( vPoints.data(), vColours.data(), std::min( vPoints.size(), vColours.size() ));
+            }
+            void DrawPoints( const std::vector<flc::vi2d> &vPoints, Pixel colour = WHITE ) {
+                DrawPoints( vPoints.data(), vPoints.size(), colour );
+            }
+
             // draw a line from (x0, y0) to (x1, y1) in the specified colour and pattern
-            void DrawLine( int x0, int y0, int x1, int y1, Pixel colour = WHITE, uint32_t linePattern = 0xFFFFFFFF );
+            void DrawLine( int x0, int y0, int x1, int y1, Pixel colour = WHITE, uint32_t linePattern = 0xFFFFFFFF ) {
+                m_DrawContext.DrawLine( x0, y0, x1, y1, colour, linePattern );
+            }
             void DrawLine( const flc::vi2d &p1, const flc::vi2d &p2, Pixel colour = flc::WHITE, uint32_t linePattern = 0xFFFFFFFF ) {
                 DrawLine( p1.x, p1.y, p2.x, p2.y, colour, linePattern );
             }
 
             // draw resp. fill a rectangle in the specified colour
-            void DrawRect( int x, int y, int w, int h, Pixel colour = flc::WHITE );
-            void FillRect( int x, int y, int w, int h, Pixel colour = flc::WHITE );
+            void DrawRect( int x, int y, int w, int h, Pixel colour = flc::WHITE ) { m_DrawContext.DrawRect( x, y, w, h, colour ); }
+            void FillRect( int x, int y, int w, int h, Pixel colour = flc::WHITE ) { m_DrawContext.FillRect( x, y, w, h, colour ); }
             void DrawRect( const flc::vi2d &pos, const flc::vi2d &size, Pixel colour = flc::WHITE ) {
                 DrawRect( pos.x, pos.y, size.x, size.y, colour );
             }
@@ -162,8 +187,8 @@ namespace flc {
             }
 
             // draw resp. fill a triangle in the specified colour
-            void DrawTriangle( int x0, int y0, int x1, int y1, int x2, int y2, Pixel colour = flc::WHITE );
-            void FillTriangle( int x0, int y0, int x1, int y1, int x2, int y2, Pixel colour = flc::WHITE );
+            void DrawTriangle( int x0, int y0, int x1, int y1, int x2, int y2, Pixel colour = flc::WHITE ) { m_DrawContext.DrawTriangle( x0, y0, x1, y1, x2, y2, colour ); }
+            void FillTriangle( int x0, int y0, int x1, int y1, int x2, int y2, Pixel colour = flc::WHITE ) { m_DrawContext.FillTriangle( x0, y0, x1, y1, x2, y2, colour ); }
             void DrawTriangle( flc::vi2d &p0, flc::vi2d &p1, flc::vi2d &p2, Pixel colour = flc::WHITE ) {
                 DrawTriangle( p0.x, p0.y, p1.x, p1.y, p2.x, p2.y, colour );
             }
@@ -171,47 +196,89 @@ namespace flc {
                 FillTriangle( p0.x, p0.y, p1.x, p1.y, p2.x, p2.y, colour );
             }
 
+            // fill rule for polygons - see DrawContext::FillRule
+            typedef DrawContext::FillRule FillRule;
+            static const FillRule EVEN_ODD = DrawContext::EVEN_ODD;
+            static const FillRule NON_ZERO = DrawContext::NON_ZERO;
+
+            // draw resp. fill a polygon in the specified colour. The polygon is implicitly closed (the last vertex
+            // connects to the first one). Filling is done scanline by scanline, using an active edge table.
+            void DrawPolygon( const std::vector<flc::vi2d> &vPoints, Pixel colour = flc::WHITE )                           { m_DrawContext.DrawPolygon( vPoints, colour ); }
+            void FillPolygon( const std::vector<flc::vi2d> &vPoints, Pixel colour = flc::WHITE, FillRule rule = EVEN_ODD ) { m_DrawContext.FillPolygon( vPoints, colour, rule ); }
+            void FillPolygon( const std::vector<flc::vf2d> &vPoints, Pixel colour = flc::WHITE, FillRule rule = EVEN_ODD ) { m_DrawContext.FillPolygon( vPoints, colour, rule ); }
+
             // draw a circle in the specified colour
-            void DrawCircle( int   xc, int   yc, int   r, Pixel colour = flc::WHITE );
+            void DrawCircle( int   xc, int   yc, int   r, Pixel colour = flc::WHITE ) { m_DrawContext.DrawCircle( xc, yc, r, colour ); }
 //            void DrawCircle( float xc, float yc, float r, Pixel colour = flc::WHITE ) { DrawCircle( int(xc), int(yc), int(r), colour ); }
             void DrawCircle( flc::vi2d c, int r, Pixel colour ) {
                 DrawCircle( c.x, c.y, r, colour );
             }
 
             // fill a circle in the specified colour
-            void FillCircle( int   xc, int   yc, int   r, Pixel colour = flc::WHITE );
+            void FillCircle( int   xc, int   yc, int   r, Pixel colour = flc::WHITE ) { m_DrawContext.FillCircle( xc, yc, r, colour ); }
             void FillCircle( float xc, float yc, float r, Pixel colour = flc::WHITE ) { FillCircle( int(xc), int(yc), int(r), colour ); }
             void FillCircle( flc::vi2d c, int r, Pixel colour ) {
                 FillCircle( c.x, c.y, r, colour );
             }
 
             // draw a string in the specified colour with the specified scale
-            void DrawString( int x, int y, const std::string &sText, Pixel nColour = WHITE, int nScale = 1 );
+            void DrawString( int x, int y, const std::string &sText, Pixel nColour = WHITE, int nScale = 1 ) {
+                m_DrawContext.DrawString( x, y, sText, nColour, nScale );
+            }
             void DrawString( const flc::vi2d &pos, const std::string &sText, Pixel nColour = WHITE, int nScale = 1 ) {
                 DrawString( pos.x, pos.y, sText, nColour, nScale );
             }
             // like DrawString() but with variable (horizontal) character spacing
-            void DrawStringProp( int x, int y, const std::string &sText, Pixel nColour = WHITE, int nScale = 1 );
+            void DrawStringProp( int x, int y, const std::string &sText, Pixel nColour = WHITE, int nScale = 1 ) {
+                m_DrawContext.DrawStringProp( x, y, sText, nColour, nScale );
+            }
             void DrawStringProp( const flc::vi2d &pos, const std::string &sText, Pixel nColour = WHITE, int nScale = 1 ) {
                 DrawStringProp( pos.x, pos.y, sText, nColour, nScale );
             }
 
+            // returns the size in pixels that sText takes when drawn with DrawString() resp. DrawStringProp()
+            flc::vi2d GetTextSize(     const std::string &sText, int nScale = 1 ) { return cFont.GetTextSize( sText, nScale, false ); }
+            flc::vi2d GetTextSizeProp( const std::string &sText, int nScale = 1 ) { return cFont.GetTextSize( sText, nScale, true  ); }
+
             // select one of the available fonts
             void SetFont( int nFontIndex = 0 );
+            // select bitmap or SDF (smooth when scaled) rendering of the text
+            void SetFontMode( flc::SpriteFont::Mode eMode ) { cFont.SetMode( eMode ); }
             // Grabs a pointer to the font sprite
             flc::Sprite* GetFontSprite() { return cFont.GetSprite(); }
+            // Grabs a pointer to the font object (to pass to a DrawContext of your own)
+            flc::SpriteFont* GetFont() { return &cFont; }
 
             // Draws a sprite to the draw target at location (x, y)
-            void DrawSprite( int x, int y, Sprite* sprite, int scale = 1, Sprite::Flip flip = Sprite::NONE );
+            void DrawSprite( int x, int y, Sprite* sprite, int scale = 1, Sprite::Flip flip = Sprite::NONE ) {
+                m_DrawContext.DrawSprite( x, y, sprite, scale, flip );
+            }
             void DrawSprite( vi2d pos,     Sprite* sprite, int scale = 1, Sprite::Flip flip = Sprite::NONE ) {
                 DrawSprite( pos.x, pos.y, sprite, scale, flip );
             }
             // Draws an area of a sprite at location (x, y), where the selected area is (ox, oy) to (ox + w, oy + h)
-            void DrawPartialSprite( int x, int y, Sprite* sprite, int ox, int oy, int w, int h, int scale = 1, Sprite::Flip flip = Sprite::NONE );
+            void DrawPartialSprite( int x, int y, Sprite* sprite, int ox, int oy, int w, int h, int scale = 1, Sprite::Flip flip = Sprite::NONE ) {
+                m_DrawContext.DrawPartialSprite( x, y, sprite, ox, oy, w, h, scale, flip );
+            }
             void DrawPartialSprite( const flc::vi2d &pos, Sprite* sprite, const flc::vi2d &sourcepos, const flc::vi2d &size, int scale = 1, Sprite::Flip flip = Sprite::NONE ) {
                 DrawPartialSprite( pos.x, pos.y, sprite, sourcepos.x, sourcepos.y, size.x, size.y, scale, flip );
             }
 
+            // Same functions, but with a non integer scale (which must be > 0.0f). The filter parameter determines how the sprite is
+            // sampled [ NOTE that the filter parameter is not optional, otherwise the call would be ambiguous with the integer versions ]
+            void DrawSprite( int x, int y, Sprite* sprite, float scale, Sprite::Filter filter, Sprite::Flip flip = Sprite::NONE ) {
+                m_DrawContext.DrawSprite( x, y, sprite, scale, filter, flip );
+            }
+            void DrawSprite( vi2d pos,     Sprite* sprite, float scale, Sprite::Filter filter, Sprite::Flip flip = Sprite::NONE ) {
+                DrawSprite( pos.x, pos.y, sprite, scale, filter, flip );
+            }
+            void DrawPartialSprite( int x, int y, Sprite* sprite, int ox, int oy, int w, int h, float scale, Sprite::Filter filter, Sprite::Flip flip = Sprite::NONE ) {
+                m_DrawContext.DrawPartialSprite( x, y, sprite, ox, oy, w, h, scale, filter, flip );
+            }
+            void DrawPartialSprite( const flc::vi2d &pos, Sprite* sprite, const flc::vi2d &sourcepos, const flc::vi2d &size, float scale, Sprite::Filter filter, Sprite::Flip flip = Sprite::NONE ) {
+                DrawPartialSprite( pos.x, pos.y, sprite, sourcepos.x, sourcepos.y, size.x, size.y, scale, filter, flip );
+            }
+
             // Draws a decal to the draw target at location (x, y), with optional scale and tinting
             void DrawDecal( const vf2d &pos, Decal *decal, const vf2d &scale = { 1.0f,1.0f }, const Pixel &tint = WHITE );
             // Draws an area of a decal, with optional scaling and tinting
@@ -227,6 +294,14 @@ namespace flc {
             // DrawString() and DrawStringProp() are based on Sprites - these are the Decal versions
             void DrawStringDecal(     const flc::vf2d &pos, const std::string &sText, Pixel col = flc::WHITE, const flc::vf2d &scale = { 1.0f, 1.0f } );
             void DrawStringPropDecal( const flc::vf2d &pos, const std::string &sText, Pixel col = flc::WHITE, const flc::vf2d &scale = { 1.0f, 1.0f } );
+            // Draws text that was rendered into a decal of it's own (see SGE_TextDecal.h) - the position is that of the text,
+            // as with DrawStringDecal(). The text is rendered first if it was changed.
+            void DrawTextDecal( const flc::vf2d &pos, flc::TextDecal *pText, const flc::vf2d &scale = { 1.0f, 1.0f }, const Pixel &tint = WHITE );
+
+            // Returns decal bucket nBucket, for drawing decals from worker threads (see SGE_DecalBucket.h). The buckets are
+            // created upon first use, and merged into the decal lists of the layers at the start of the render cycle.
+            // Use a fixed bucket per job (the job index for instance), so that the merged order is the same each frame.
+            flc::DecalBucket *GetDecalBucket( int nBucket );
 
             // Alpha blending and pixel modes
 
@@ -236,13 +311,53 @@ namespace flc {
             //    * ALPHA  - blend pixel from source sprite with destination sprite
             //    * APROP  - as ALPHA, but with propagation of the alpha value to the destination sprite
             //    * CUSTOM - you can pass your own alpha blending function
-            void SetPixelMode( Pixel::Mode mode );
-            Pixel::Mode GetPixelMode();
+            void SetPixelMode( Pixel::Mode mode ) { m_DrawContext.SetPixelMode( mode ); }
+            Pixel::Mode GetPixelMode() { return m_DrawContext.GetPixelMode(); }
             // set your own custom blending function - NOTE this will set the PixelMode to CUSTOM
-            void SetPixelMode( std::function<flc::Pixel( const int x, const int y, const flc::Pixel& pSource, const flc::Pixel& pDest)> pixelMode );
+            void SetPixelMode( std::function<flc::Pixel( const int x, const int y, const flc::Pixel& pSource, const flc::Pixel& pDest)> pixelMode ) {
+                m_DrawContext.SetPixelMode( pixelMode );
+            }
             // set a new blend factor - fBlend must be in [ 0.0f, 1.0f ]
-            void  SetPixelBlend( float fBlend );
-            float GetPixelBlend();
+            void  SetPixelBlend( float fBlend ) { m_DrawContext.SetPixelBlend( fBlend ); }
+            float GetPixelBlend() { return m_DrawContext.GetPixelBlend(); }
+
+            // Clipping - restricts all drawing to the rectangle at (x, y) with size (w, h), in draw target coordinates.
+            // The clip rect applies to all software primitives, text and sprites, and to decals that are drawn while it is
+            // set. It stays in effect when switching draw targets, until ClearClipRect() is called.
+            void SetClipRect( int x, int y, int w, int h ) { m_DrawContext.SetClipRect( x, y, w, h ); }
+            void SetClipRect( const flc::vi2d &pos, const flc::vi2d &size ) {
+                SetClipRect( pos.x, pos.y, size.x, size.y );
+            }
+            void ClearClipRect() { m_DrawContext.ClearClipRect(); }
+            bool IsClipRectSet() { return m_DrawContext.IsClipRectSet(); }
+
+            // Returns the default draw context of the engine - all software primitives of the engine are drawn via this
+            // context. Copy it (and set another draw target) to draw with the same settings from another thread.
+            flc::DrawContext &GetDrawContext() { return m_DrawContext; }
+
+            // Parallel per pixel operations - the rows are divided into bands that are processed in parallel on the engine's
+            // thread pool, so the functions you pass must be thread safe. They are templates, so that your function can be
+            // inlined in the per pixel loops.
+
+            // Calls fn( x, y, pixel ) for each pixel of pSprite, where pixel is a uint32_t reference to the encoded pixel value
+            template <typename F> void ForEachPixel( flc::Sprite *pSprite, F &&fn );
+            // Calls fn( y, x0, x1, pRow ) for each row y of the rectangle (x, y) - (x + w, y + h) of the current draw target,
+            // clipped against the draw target and clip rect. pRow points to pixel (0, y), the pixels to process are pRow[x0]
+            // upto (excluding) pRow[x1]
+            template <typename F> void Shade( int x, int y, int w, int h, F &&fn );
+            // Lane width variant of Shade(): calls fn( x, y, pPixels ) for each group of LANES consecutive pixels, so that fn
+            // can be written with SIMD in mind. At the end of a row a partial group is passed in a padded buffer, so that
+            // fn always gets LANES pixels to work on (the padding is discarded afterwards)
+            template <int LANES, typename F> void ShadeLanes( int x, int y, int w, int h, F &&fn );
+
+            // Returns the thread pool of the engine - it's created upon first use
+            flc::ThreadPool *GetThreadPool();
+            // Returns the loader for loading assets in the background (see SGE_AssetLoader.h) - it's created upon first
+            // use, and it's Update() is called each frame before OnUserUpdate()
+            flc::AssetLoader *GetAssetLoader();
+            // Returns the cache that shares assets that are loaded from the same file (see SGE_AssetCache.h) - it's created
+            // upon first use
+            flc::AssetCache *GetAssetCache();
 
             // ========== SGE_periferals (I/O) methods) ====================
 
@@ -319,8 +434,22 @@ namespace flc {
 
             // ========== SGE_Draw private methods ====================
 
-            // internal function, only use if x, and y are guaranteed to be within boundaries of drawable object
-            inline void ClampedDraw( int x, int y, uint32_t colour, uint32_t *pixelPtr );
+            // internal function - adds a decal frame to the decal list of the current draw target layer
+            void AddDecalFrame( DecalFrame &dec );
+            // internal function - adds the decal frames for a text layout to the decal list of the current draw target layer
+            void AddTextLayout( const flc::vf2d &pos, const flc::TextLayout *pLayout, const flc::Pixel &tint );
+            // internal function - moves the decals from all decal buckets into the decal lists of the layers (sorted)
+            void MergeDecalBuckets();
+            // internal function - divides the rows [y0, y1) into bands, and calls fnBand( band_y0, band_y1 ) for each of
+            // them in parallel on the thread pool
+            void ParallelRows( int y0, int y1, const std::function<void( int, int )> &fnBand );
+
+            flc::ThreadPool  *pThreadPool  = nullptr;      // created upon first use, see GetThreadPool()
+            flc::AssetLoader *pAssetLoader = nullptr;      // created upon first use, see GetAssetLoader()
+            flc::AssetCache  *pAssetCache  = nullptr;      // created upon first use, see GetAssetCache()
+
+            std::vector<flc::DecalBucket *> vDecalBuckets; // created upon first use, see GetDecalBucket()
+            std::mutex                      mtxDecalBuckets;
 
         private:
             // At all times during execution of the engine exactly 1 window will be active. This is kept track of by both
@@ -330,13 +459,17 @@ namespace flc {
 
             // Similarly, exactly 1 draw target will be active within the active window. This is kept track of by both
             // a pointer to the draw target, and an index into the vLayers container of the active window
-            flc::Sprite  *pEngineDrawTarget   = nullptr;   // Always points to the current draw target
+            // The pointer to the draw target is held by the default draw context (see GetDrawContext())
             int           nEngineDrawTargetIx = 0;         // Always set to the current layer of drawing (for Decal Drawing)
 
             // Exactly 1 font will be active (in current implementation). You can switch between fonts, but there can only
             // be one active at any time.
             SpriteFont cFont;                              // sprite font object for text drawing
 
+            // The default draw context - it holds the draw target, the pixel mode and blend settings, the clip rect
+            // and the font for all software drawing by the engine
+            DrawContext m_DrawContext;
+
         private:
             // internal class variables for frame timing
             int   m_TimingCntr      = 0;
@@ -347,10 +480,6 @@ namespace flc {
             int   m_MuSecCum = 0;
             int   m_mSec_mean       = 0;
 
-            // internal class variables for alpha blending and pixel mode. So these are central within the engine class
-            Pixel::Mode m_PixelMode = Pixel::Mode::NORMAL;
-            std::function<flc::Pixel( const int x, const int y, const flc::Pixel& pSource, const flc::Pixel& pDest)> m_BlendFunc = nullptr;
-            float m_BlendFactor = 1.0f;
             // translate SGE blendmode value to SDL usable constant
             SDL_BlendMode TranslateBlendMode( Pixel::Mode blendMode );
 
@@ -370,6 +499,10 @@ namespace flc {
             void SetLayerScale(    uint8_t layer, const flc::vf2d &scale ) {  SetLayerScale(    layer,  scale.x,  scale.y ); }
             void SetLayerScaleInv( uint8_t layer, const flc::vf2d &scale ) {  SetLayerScaleInv( layer,  scale.x,  scale.y ); }
             void SetLayerTint(     uint8_t layer, const flc::Pixel &tint );
+            // add post processing passes to the layer - they are applied in the render cycle (in the order they were added)
+            // on a copy of the layer canvas. The passes are not owned by the engine.
+            void AddPostProcess(   uint8_t layer, flc::PostProcessPass *pPass );
+            void ClearPostProcess( uint8_t layer );
 
         public:
             // Create an additional window with the specified characteristics, and add it to the vWindows container
@@ -386,6 +519,69 @@ namespace flc {
             void ActivateWindow( int nWinID );
     };
 
+//                          +----------------------+                         //
+// -------------------------+ TEMPLATE DEFINITIONS +------------------------ //
+//                          +----------------------+                         //
+
+    template <typename F>
+    void SDL_GameEngine::ForEachPixel( flc::Sprite *pSprite, F &&fn ) {
+        if (pSprite == nullptr || pSprite->IsEmpty())
+            return;
+        SDL_Surface *pSrfce = pSprite->GetSurfacePtr();
+        uint32_t *pPixels = (uint32_t *)pSrfce->pixels;
+        int nPitch = pSrfce->pitch / 4;
+        int nWidth = pSprite->width;
+
+        SDL_LockSurface( pSrfce );
+        ParallelRows( 0, pSprite->height, [&]( int y0, int y1 ) {
+            for (int y = y0; y < y1; y++) {
+                uint32_t *pRow = pPixels + y * nPitch;
+                for (int x = 0; x < nWidth; x++)
+                    fn( x, y, pRow[x] );
+            }
+        } );
+        SDL_UnlockSurface( pSrfce );
+        pSprite->InvalidateRLE();
+    }
+
+    template <typename F>
+    void SDL_GameEngine::Shade( int x, int y, int w, int h, F &&fn ) {
+        int cx0, cy0, cx1, cy1;
+        if (!m_DrawContext.GetClipBounds( cx0, cy0, cx1, cy1 ))
+            return;
+        int x0 = std::max( x, cx0 ), x1 = std::min( x + w, cx1 );
+        int y0 = std::max( y, cy0 ), y1 = std::min( y + h, cy1 );
+        if (x0 >= x1 || y0 >= y1)
+            return;
+        SDL_Surface *pSrfce = m_DrawContext.GetDrawTarget()->GetSurfacePtr();
+        uint32_t *pPixels = (uint32_t *)pSrfce->pixels;
+        int nPitch = pSrfce->pitch / 4;
+
+        SDL_LockSurface( pSrfce );
+        ParallelRows( y0, y1, [&]( int band_y0, int band_y1 ) {
+            for (int j = band_y0; j < band_y1; j++)
+                fn( j, x0, x1, pPixels + j * nPitch );
+        } );
+        SDL_UnlockSurface( pSrfce );
+    }
+
+    template <int LANES, typename F>
+    void SDL_GameEngine::ShadeLanes( int x, int y, int w, int h, F &&fn ) {
+        static_assert( LANES > 0, "ShadeLanes() --> LANES must be > 0" );
+        Shade( x, y, w, h, [&]( int j, int x0, int x1, uint32_t *pRow ) {
+            int i = x0;
+            for ( ; i + LANES <= x1; i += LANES)
+                fn( i, j, pRow + i );
+            if (i < x1) {
+                // partial group at the end of the row - work on a padded copy
+                uint32_t aux[LANES] = { 0 };
+                std::copy( pRow + i, pRow + x1, aux );
+                fn( i, j, aux );
+                std::copy( aux, aux + (x1 - i), pRow + i );
+            }
+        } );
+    }
+
 } // namespace flc
 
 //                                                                           //
@@ -0,0 +1,243 @@
+/* SGE_DecalAtlas.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * ========================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include     <cmath>
+#include <algorithm>
+#include   <climits>
+
+#include "SGE_Kernels.h"
+#include "SGE_DecalAtlas.h"
+
+// ==============================/ Skyline packing /==============================
+
+// The skyline is the top edge of the area that is used so far, as a list of horizontal segments (from left to right,
+// together covering the width of the page). A rect is placed on the skyline where it's top ends lowest.
+struct SkylineSegment {
+    int x, y, w;
+};
+
+// auxiliary function - returns the y at which a rect of width w fits on the skyline starting at segment i, or -1 if
+// it runs off the right side of the page
+static int skyline_fit( const std::vector<SkylineSegment> &vSkyline, int i, int w, int nPageW ) {
+    int x = vSkyline[i].x;
+    if (x + w > nPageW)
+        return -1;
+    int y = 0, nLeft = w;
+    while (nLeft > 0) {
+        y      = std::max( y, vSkyline[i].y );
+        nLeft -= vSkyline[i].w;
+        i++;
+    }
+    return y;
+}
+
+// auxiliary function - finds a spot for a rect of w x h on the skyline of a page of nPageW x nPageH. Returns false if
+// there's no room, otherwise returns the position, and adds the rect to the skyline.
+static bool skyline_insert( std::vector<SkylineSegment> &vSkyline, int w, int h, int nPageW, int nPageH, int &nResX, int &nResY ) {
+    int nBest = -1, nBestY = INT_MAX, nBestW = INT_MAX;
+    for (int i = 0; i < (int)vSkyline.size(); i++) {
+        int y = skyline_fit( vSkyline, i, w, nPageW );
+        if (y >= 0 && y + h <= nPageH && (y < nBestY || (y == nBestY && vSkyline[i].w < nBestW))) {
+            nBest  = i;
+            nBestY = y;
+            nBestW = vSkyline[i].w;
+        }
+    }
+    if (nBest < 0)
+        return false;
+    nResX = vSkyline[nBest].x;
+    nResY = nBestY;
+
+    // the new segment replaces the part of the skyline it covers
+    vSkyline.insert( vSkyline.begin() + nBest, { nResX, nResY + h, w } );
+    int i = nBest + 1;
+    while (i < (int)vSkyline.size() && vSkyline[i].x < nResX + w) {
+        int nCut = nResX + w - vSkyline[i].x;
+        if (nCut >= vSkyline[i].w) {
+            vSkyline.erase( vSkyline.begin() + i );
+        } else {
+            vSkyline[i].x += nCut;
+            vSkyline[i].w -= nCut;
+            break;
+        }
+    }
+    // merge neighbouring segments at the same height
+    for (i = 0; i + 1 < (int)vSkyline.size(); ) {
+        if (vSkyline[i].y == vSkyline[i + 1].y) {
+            vSkyline[i].w += vSkyline[i + 1].w;
+            vSkyline.erase( vSkyline.begin() + i + 1 );
+        } else {
+            i++;
+        }
+    }
+    return true;
+}
+
+// ==============================/ Class DecalAtlas /==============================
+
+//                           +------------------+                            //
+// --------------------------+ CONSTRUCTORS ETC +--------------------------- //
+//                           +------------------+                            //
+
+flc::DecalAtlas::DecalAtlas( int nSpacing, int nMaxPageSize ) {
+    this->nSpacing     = std::max( 0, nSpacing );
+    this->nMaxPageSize = std::max( 1, nMaxPageSize );
+}
+
+flc::DecalAtlas::~DecalAtlas() {
+    Clear();
+}
+
+//                               +----------+                                //
+// ------------------------------+ METHODS  +------------------------------- //
+//                               +----------+                                //
+
+int flc::DecalAtlas::AddSprite( Sprite *pSprite ) {
+    if (pSprite == nullptr || pSprite->GetSurfacePtr() == nullptr) {
+        std::cout << "ERROR: DecalAtlas::AddSprite() --> nullptr or empty sprite" << std::endl;
+        return -1;
+    }
+    vSprites.push_back( pSprite );
+    return (int)vSprites.size() - 1;
+}
+
+void flc::DecalAtlas::DeletePages() {
+    for (auto &pDecal : vDecals) {
+        delete pDecal;
+        pDecal = nullptr;
+    }
+    vDecals.clear();
+    for (auto &p : vPages) {
+        delete p.pDecal;
+        delete p.pSprite;
+    }
+    vPages.clear();
+}
+
+void flc::DecalAtlas::Clear() {
+    DeletePages();
+    vSprites.clear();
+}
+
+// The sprites are packed in order of decreasing height, which keeps the skyline flat. The width of the pages is chosen
+// so that all sprites would fit in a roughly square page, limited by the maximum page size and the maximum texture size
+// of the renderer. When the sprites don't fit on the first page, more pages of the maximum size are used. At the end
+// each page is trimmed to the area that is used.
+bool flc::DecalAtlas::Build() {
+    DeletePages();
+    vDecals.resize( vSprites.size(), nullptr );
+
+    int nMaxW = nMaxPageSize, nMaxH = nMaxPageSize;
+    SDL_RendererInfo sInfo;
+    if (glbRendererPtr != nullptr && SDL_GetRendererInfo( glbRendererPtr, &sInfo ) == 0) {
+        if (sInfo.max_texture_width  > 0) nMaxW = std::min( nMaxW, sInfo.max_texture_width  );
+        if (sInfo.max_texture_height > 0) nMaxH = std::min( nMaxH, sInfo.max_texture_height );
+    }
+
+    bool bResult = true;
+    std::vector<int> vOrder;
+    long long nArea = 0;
+    int nWidest = 0;
+    for (int i = 0; i < (int)vSprites.size(); i++) {
+        int w = vSprites[i]->width  + nSpacing;
+        int h = vSprites[i]->height + nSpacing;
+        if (vSprites[i]->width > nMaxW || vSprites[i]->height > nMaxH) {
+            std::cout << "ERROR: DecalAtlas::Build() --> sprite " << i << " is larger than the maximum page size: "
+                      << vSprites[i]->width << " x " << vSprites[i]->height << std::endl;
+            bResult = false;
+        } else {
+            vOrder.push_back( i );
+            nArea  += (long long)w * h;
+            nWidest = std::max( nWidest, w );
+        }
+    }
+    std::stable_sort( vOrder.begin(), vOrder.end(), [&]( int a, int b ) { return vSprites[a]->height > vSprites[b]->height; } );
+
+    // the spacing is only needed between sprites, so the right and bottom edges of a page get it for free
+    int nPageW = std::min( nMaxW + nSpacing, std::max( nWidest, int( std::ceil( std::sqrt( double( nArea ))))));
+    int nPageH = nMaxH + nSpacing;
+
+    std::vector<std::vector<SkylineSegment>> vSkylines;
+    std::vector<SDL_Point> vPos( vSprites.size() );
+    std::vector<int>       vPageOf( vSprites.size(), -1 );
+    std::vector<SDL_Point> vUsed;    // per page, the width and height that is used
+    for (auto i : vOrder) {
+        int w = vSprites[i]->width  + nSpacing;
+        int h = vSprites[i]->height + nSpacing;
+        int x = 0, y = 0, p = 0;
+        while (p < (int)vSkylines.size() && !skyline_insert( vSkylines[p], w, h, nPageW, nPageH, x, y ))
+            p++;
+        if (p == (int)vSkylines.size()) {
+            // start a new page - after the first one, the pages get the maximum width
+            if (p > 0)
+                nPageW = nMaxW + nSpacing;
+            vSkylines.push_back( { { 0, 0, nPageW } } );
+            vUsed.push_back( { 0, 0 } );
+            skyline_insert( vSkylines[p], w, h, nPageW, nPageH, x, y );
+        }
+        InitSDL_Point( vPos[i], x, y );
+        vPageOf[i] = p;
+        vUsed[p].x = std::max( vUsed[p].x, x + vSprites[i]->width  );
+        vUsed[p].y = std::max( vUsed[p].y, y + vSprites[i]->height );
+    }
+
+    // create the page sprites and copy the sprites into them
+    for (auto &u : vUsed) {
+        Page sPage;
+        sPage.pSprite = new Sprite( u.x, u.y );
+        vPages.push_back( sPage );
+    }
+    for (auto i : vOrder) {
+        SDL_Surface *pDst = vPages[ vPageOf[i] ].pSprite->GetSurfacePtr();
+        SDL_Surface *pSrc = vSprites[i]->GetSurfacePtr();
+        SDL_LockSurface( pSrc );
+        for (int y = 0; y < pSrc->h; y++) {
+            glb_Kernels.copy( (uint32_t *)((uint8_t *)pDst->pixels + (vPos[i].y + y) * pDst->pitch) + vPos[i].x,
+                              (uint32_t *)((uint8_t *)pSrc->pixels + y * pSrc->pitch), pSrc->w );
+        }
+        SDL_UnlockSurface( pSrc );
+    }
+    // create the textures, and the decals that refer to them
+    for (auto &p : vPages)
+        p.pDecal = new Decal( p.pSprite );
+    for (auto i : vOrder)
+        vDecals[i] = new Decal( vPages[ vPageOf[i] ].pDecal, vSprites[i], vPos[i].x, vPos[i].y );
+
+    return bResult;
+}
+
+flc::Decal *flc::DecalAtlas::GetDecal( int nIx ) {
+    if (nIx < 0 || nIx >= (int)vDecals.size())
+        return nullptr;
+    return vDecals[nIx];
+}
+
+flc::Decal *flc::DecalAtlas::GetPage( int nPage ) {
+    if (nPage < 0 || nPage >= (int)vPages.size())
+        return nullptr;
+    return vPages[nPage].pDecal;
+}
+
+flc::Sprite *flc::DecalAtlas::GetPageSprite( int nPage ) {
+    if (nPage < 0 || nPage >= (int)vPages.size())
+        return nullptr;
+    return vPages[nPage].pSprite;
+}
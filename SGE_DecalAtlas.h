@@ -0,0 +1,120 @@
+#ifndef SGE_DECALATLAS_H
+#define SGE_DECALATLAS_H
+
+/* SGE_DecalAtlas.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * ======================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module implements class DecalAtlas: it packs many sprites into one or a few large textures (the pages of the
+ * atlas), and gives a decal per sprite that refers to it's part of a page.
+ *
+ * Each Decal normally has a texture of it's own, so drawing lots of different small decals makes the renderer switch
+ * textures all the time. The decals of an atlas share their textures, and can be used with all decal functions of
+ * the engine (DrawDecal(), DrawPartialDecal(), DrawRotatedDecal() etc) and with a DecalBucket, just like normal decals:
+ *
+ *     flc::DecalAtlas cAtlas;
+ *     for (auto pSprite : vTileSprites)
+ *         cAtlas.AddSprite( pSprite );
+ *     cAtlas.Build();
+ *     ...
+ *     DrawDecal( pos, cAtlas.GetDecal( nTile ));
+ *
+ * The sprites are packed with the skyline algorithm (each sprite is put at the lowest free spot). The pages are never
+ * larger than the maximum texture size of the renderer, and a new page is started when a page is full. Between the
+ * sprites a spacing is kept (1 pixel by default), so that scaled decals don't pick up pixels of their neighbours.
+ *
+ * Notes:
+ *   - the sprites are not copied: like with a normal decal, they must stay alive as long as their decals are used.
+ *     If a sprite is changed, UpdateSprite() on it's decal puts the changes into the page;
+ *   - DrawPartialDecal() with a source rect that falls outside the sprite shows the neighbouring sprites;
+ *   - Build() uses the current renderer (window), and must be called from the main thread.
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "SGE_Utilities.h"
+#include "SGE_Pixel.h"
+#include "SGE_Sprite.h"
+
+// the default maximum size of the pages - the renderer may limit it further
+#define DEFAULT_ATLAS_PAGE_SIZE 4096
+
+namespace flc {
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    class DecalAtlas {
+    public:
+        // nSpacing is the nr of blank pixels between the sprites, nMaxPageSize the maximum width and height of a page
+        DecalAtlas( int nSpacing = 1, int nMaxPageSize = DEFAULT_ATLAS_PAGE_SIZE );
+        ~DecalAtlas();
+
+        // adds a sprite to pack, and returns it's index (for GetDecal()). The sprite is owned by the caller.
+        int AddSprite( Sprite *pSprite );
+        int GetNrSprites() { return (int)vSprites.size(); }
+
+        // Packs all sprites that were added into pages, and creates the textures and decals. Returns false if not all
+        // sprites could be packed (a sprite that is larger than a page gets no decal). Build() can be called again after
+        // adding more sprites - all sprites are packed again, and the decals of the previous Build() are deleted.
+        bool Build();
+        // removes all sprites and deletes the pages and decals
+        void Clear();
+
+        // returns the decal of the sprite with index nIx, or nullptr if it doesn't exist (yet). The decal is owned by
+        // the atlas.
+        Decal *GetDecal( int nIx );
+        // the pages of the atlas, as a decal (resp. sprite) of their own
+        int     GetNrPages() { return (int)vPages.size(); }
+        Decal  *GetPage(       int nPage );
+        Sprite *GetPageSprite( int nPage );
+
+    private:
+        // a page of the atlas
+        struct Page {
+            Sprite *pSprite = nullptr;
+            Decal  *pDecal  = nullptr;
+        };
+
+        int nSpacing     = 1;
+        int nMaxPageSize = DEFAULT_ATLAS_PAGE_SIZE;
+
+        std::vector<Sprite *> vSprites;
+        std::vector<Decal  *> vDecals;    // per sprite, nullptr if it isn't packed
+        std::vector<Page>     vPages;
+
+        // internal function - deletes the pages and decals
+        void DeletePages();
+    };
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_DECALATLAS_H
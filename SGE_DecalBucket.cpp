@@ -0,0 +1,102 @@
+/* SGE_DecalBucket.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =========================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include     <cmath>
+#include <algorithm>
+
+#include "SGE_DecalBucket.h"
+
+// ==============================/ Class DecalBucket /==============================
+
+//                               +----------+                                //
+// ------------------------------+ METHODS  +------------------------------- //
+//                               +----------+                                //
+
+void flc::DecalBucket::SetTarget( int nLayer, int nWindow ) {
+    this->nLayer  = nLayer;
+    this->nWindow = nWindow;
+}
+
+void flc::DecalBucket::SetClipRect( int x, int y, int w, int h ) {
+    InitSDL_Rect( sClipRect, x, y, std::max( w, 0 ), std::max( h, 0 ));
+    bClipRectSet = true;
+}
+
+void flc::DecalBucket::ClearClipRect() {
+    bClipRectSet = false;
+}
+
+// internal function - the destination (window and layer) and the clip rect are taken from the current bucket settings.
+// The window and layer are validated when the buckets are merged, since the windows can't be accessed from here
+void flc::DecalBucket::AddEntry( int nSortKey, Decal *decal, const SDL_Rect &src, const SDL_Rect &dst, double dAngle, const SDL_Point &rot, const Pixel &tint ) {
+    vEntries.emplace_back();
+    Entry &e = vEntries.back();
+    e.nWindow  = nWindow;
+    e.nLayer   = nLayer;
+    e.nSortKey = nSortKey;
+
+    e.frame.m_decal         = decal->m_decal;
+    e.frame.m_tint          = tint;
+    e.frame.m_rect_src      = src;
+    e.frame.m_rect_src.x   += decal->m_origin.x;    // non zero for the decals of an atlas
+    e.frame.m_rect_src.y   += decal->m_origin.y;
+    e.frame.m_rect_dst      = dst;
+    e.frame.m_angle_degrees = dAngle;
+    e.frame.m_point_rot     = rot;
+    e.frame.m_bClipped      = bClipRectSet;
+    if (bClipRectSet)
+        e.frame.m_rect_clip = sClipRect;
+}
+
+// the parameters of the draw functions are converted in the same way as in the decal functions of the engine
+
+void flc::DecalBucket::DrawDecal( int nSortKey, const vf2d &pos, Decal *decal, const vf2d &scale, const Pixel &tint ) {
+    DrawPartialRotatedDecal( nSortKey, pos, decal, 0.0f, { 0.0f, 0.0f }, { 0.0f, 0.0f },
+                             { float( decal->m_sprite->width ), float( decal->m_sprite->height ) }, scale, tint );
+}
+
+void flc::DecalBucket::DrawPartialDecal( int nSortKey, const vf2d &pos, Decal *decal, const vf2d &src_pos, const vf2d &src_size, const vf2d &scale, const Pixel &tint ) {
+    DrawPartialRotatedDecal( nSortKey, pos, decal, 0.0f, { 0.0f, 0.0f }, src_pos, src_size, scale, tint );
+}
+
+void flc::DecalBucket::DrawPartialDecal( int nSortKey, const vf2d &pos, const vf2d &size, Decal *decal, const vf2d &src_pos, const vf2d &src_size, const Pixel &tint ) {
+    SDL_Rect  src, dst;
+    SDL_Point rot;
+    InitSDL_Rect( src, int( src_pos.x ), int( src_pos.y ), int( src_size.x ), int( src_size.y ));
+    InitSDL_Rect( dst, int(     pos.x ), int(     pos.y ), int(     size.x ), int(     size.y ));
+    InitSDL_Point( rot, 0, 0 );
+    AddEntry( nSortKey, decal, src, dst, 0.0, rot, tint );
+}
+
+void flc::DecalBucket::DrawRotatedDecal( int nSortKey, const vf2d &pos, Decal *decal, const float fAngle, const vf2d &center, const vf2d &scale, const Pixel &tint ) {
+    DrawPartialRotatedDecal( nSortKey, pos, decal, fAngle, center, { 0.0f, 0.0f },
+                             { float( decal->m_sprite->width ), float( decal->m_sprite->height ) }, scale, tint );
+}
+
+void flc::DecalBucket::DrawPartialRotatedDecal( int nSortKey, const vf2d &pos, Decal *decal, const float fAngle, const vf2d &center, const vf2d &src_pos, const vf2d &src_size, const vf2d &scale, const Pixel &tint ) {
+    SDL_Rect  src, dst;
+    SDL_Point rot;
+    InitSDL_Rect(  src, int( src_pos.x ), int( src_pos.y ), int( src_size.x ), int( src_size.y ));
+    InitSDL_Rect(  dst, int( pos.x - center.x * scale.x ), int( pos.y - center.y * scale.y ),
+                        int( (float)src.w * scale.x ), int( (float)src.h * scale.y ));
+    InitSDL_Point( rot, int( center.x * scale.x ), int( center.y * scale.y ));
+    AddEntry( nSortKey, decal, src, dst, double( fAngle ) * 360.0 / (2.0 * M_PI), rot, tint );
+}
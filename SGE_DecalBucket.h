@@ -0,0 +1,120 @@
+#ifndef SGE_DECALBUCKET_H
+#define SGE_DECALBUCKET_H
+
+/* SGE_DecalBucket.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =======================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module implements class DecalBucket: a submission buffer for decals that can be filled from any thread.
+ *
+ * The decal drawing functions of the engine (DrawDecal(), DrawPartialDecal() etc) add to the decal list of the
+ * current draw target layer, and must only be called from the main thread. If your entity updates run in parallel
+ * (on the thread pool for instance), each job can get a bucket of it's own from SDL_GameEngine::GetDecalBucket(),
+ * and submit it's decals into it without any locking:
+ *
+ *     GetThreadPool()->ParallelFor( nJobs, [&]( int nJob ) {
+ *         flc::DecalBucket *pBucket = GetDecalBucket( nJob );
+ *         pBucket->SetTarget( 1 );                      // layer 1 of window 0
+ *         for (auto &e : vEntities[ nJob ])
+ *             pBucket->DrawDecal( e.nDepth, e.pos, e.pDecal );
+ *     });
+ *
+ * At the start of the render cycle the engine merges all buckets into the decal lists of the layers. The decals
+ * are ordered on window, layer and sort key (lower keys are drawn first). Decals with the same sort key keep the
+ * order of the bucket indices, and within a bucket the order of submission. Since the bucket index is tied to the
+ * job and not to the thread that happened to run it, the result is the same each frame, regardless of scheduling.
+ * The decals from the buckets are drawn after the decals that were drawn directly on the same layer.
+ *
+ * Rules:
+ *   - a bucket must be used by one thread at a time;
+ *   - all jobs must be done before OnUserUpdate() returns;
+ *   - the decals must stay alive until the end of the frame (as with the engine decal functions).
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "SGE_Utilities.h"
+#include "SGE_Pixel.h"
+#include "SGE_Sprite.h"
+
+namespace flc {
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    class DecalBucket {
+    public:
+        // a submitted decal, together with it's destination and sort key
+        struct Entry {
+            int        nWindow  = 0;
+            int        nLayer   = 0;
+            int        nSortKey = 0;
+            DecalFrame frame;
+        };
+
+    public:
+        DecalBucket() {}
+        ~DecalBucket() {}
+
+        // sets the window and layer that subsequent decals are drawn to. The default is layer 0 of window 0
+        void SetTarget( int nLayer, int nWindow = 0 );
+        // clipping for subsequent decals, in the same way as SDL_GameEngine::SetClipRect()
+        void SetClipRect( int x, int y, int w, int h );
+        void ClearClipRect();
+
+        // these resemble the decal functions of the engine, with a sort key as extra (first) parameter
+        void DrawDecal( int nSortKey, const vf2d &pos, Decal *decal, const vf2d &scale = { 1.0f, 1.0f }, const Pixel &tint = WHITE );
+        void DrawPartialDecal( int nSortKey, const vf2d &pos, Decal *decal, const vf2d &src_pos, const vf2d &src_size, const vf2d &scale = { 1.0f, 1.0f }, const Pixel &tint = WHITE );
+        void DrawPartialDecal( int nSortKey, const vf2d &pos, const vf2d &size, Decal *decal, const vf2d &src_pos, const vf2d &src_size, const Pixel &tint = WHITE );
+        void DrawRotatedDecal( int nSortKey, const vf2d &pos, Decal *decal, const float fAngle, const vf2d &center = { 0.0f, 0.0f }, const vf2d &scale = { 1.0f, 1.0f }, const Pixel &tint = WHITE );
+        void DrawPartialRotatedDecal( int nSortKey, const vf2d &pos, Decal *decal, const float fAngle, const vf2d &center, const vf2d &src_pos, const vf2d &src_size, const vf2d &scale = { 1.0f, 1.0f }, const Pixel &tint = WHITE );
+
+        // the submitted decals, in order of submission
+        const std::vector<Entry> &GetEntries() { return vEntries; }
+        bool IsEmpty() { return vEntries.empty(); }
+        // removes all submitted decals - the capacity is kept, so that the next frame doesn't need to allocate
+        void Clear() { vEntries.clear(); }
+
+    private:
+        std::vector<Entry> vEntries;
+
+        int      nWindow      = 0;
+        int      nLayer       = 0;
+        bool     bClipRectSet = false;
+        SDL_Rect sClipRect    = { 0, 0, 0, 0 };
+
+        // internal function - adds an entry for the specified part of the decal
+        void AddEntry( int nSortKey, Decal *decal, const SDL_Rect &src, const SDL_Rect &dst, double dAngle, const SDL_Point &rot, const Pixel &tint );
+    };
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_DECALBUCKET_H
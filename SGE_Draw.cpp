@@ -20,78 +20,119 @@
  *
  * Change trace:
  * 09/29/2023 - bug fixed in DrawPartialSprite()
+ * 10/18/2026 - added DrawPolygon() and FillPolygon(), and a fast span writer for the filled primitives
+ * 10/18/2026 - added SetClipRect() / ClearClipRect(), all primitives clip once per call
+ * 10/18/2026 - added DrawPoints() for bulk point plotting
+ * 10/18/2026 - added DrawSprite() and DrawPartialSprite() with non integer scale and filtering
+ * 10/18/2026 - DrawSprite() and DrawPartialSprite() use the RLE representation of sprites if enabled
+ * 10/18/2026 - added ParallelRows() for ForEachPixel(), Shade() and ShadeLanes()
+ * 10/18/2026 - spans, sprite rows and blending use the run time selected pixel kernels (see SGE_Kernels.h)
+ * 10/18/2026 - all software primitives moved to class DrawContext, the engine delegates to it's default context
+ * 10/18/2026 - added GetDecalBucket() and MergeDecalBuckets() for decal submission from worker threads
+ * 10/18/2026 - DrawStringDecal() and DrawStringPropDecal() add cached text layouts in one go (AddTextLayout())
+ * 10/18/2026 - added DrawTextDecal()
+ * 10/18/2026 - added GetAssetLoader(), the engine calls it's Update() each frame before OnUserUpdate()
+ * 10/18/2026 - added GetAssetCache()
+ * 10/18/2026 - the pixels of the draw target and of sprites are addressed using the pitch (GetDrawTargetStride())
  */
 
+#include <algorithm>
+#include     <cmath>
+#include   <cstdlib>
+
 #include "SGE_Core.h"
 
+// ==============================/ Class DrawContext /==============================
+
+//                           +------------------+                            //
+// --------------------------+ CONSTRUCTORS ETC +--------------------------- //
+//                           +------------------+                            //
+
+flc::DrawContext::DrawContext( flc::Sprite *pTarget, flc::SpriteFont *pFont ) : pDrawTarget( pTarget ), pFont( pFont ) {}
+
 //                               +----------+                                //
 // ------------------------------+ METHODS  +------------------------------- //
 //                               +----------+                                //
 
-// screen stuff - size queries and clearing =====
+// draw target and font =====
 
-// returns the dimensions of the current active window
-int flc::SDL_GameEngine::ScreenWidth() {  return vWindows[nActiveWindowIx]->GetWidth();  }
-int flc::SDL_GameEngine::ScreenHeight() { return vWindows[nActiveWindowIx]->GetHeight(); }
+// Sets the sprite that is drawn upon. The pixels of a draw target are altered without the sprite knowing it, so any
+// run length encoding of the new draw target is outdated.
+void flc::DrawContext::SetDrawTarget( flc::Sprite *pTarget ) {
+    if (pTarget != nullptr) pTarget->InvalidateRLE();
+    pDrawTarget = pTarget;
+}
 
-// works on currently acive draw target!!
-void flc::SDL_GameEngine::Clear( Pixel colour ) {
+flc::Sprite *flc::DrawContext::GetDrawTarget() { return pDrawTarget; }
+
+// Returns width and height of the draw target
+int flc::DrawContext::GetDrawTargetWidth() {
+    if (pDrawTarget == nullptr) std::cout << "ERROR: GetDrawTargetWidth() --> nullptr drawtarget!" << std::endl;
+    return pDrawTarget->width;
+}
+
+int flc::DrawContext::GetDrawTargetHeight() {
+    if (pDrawTarget == nullptr) std::cout << "ERROR: GetDrawTargetHeight() --> nullptr drawtarget!" << std::endl;
+    return pDrawTarget->height;
+}
+
+// Returns the distance between the rows of the draw target in pixels (this can be more than it's width)
+int flc::DrawContext::GetDrawTargetStride() {
+    if (pDrawTarget == nullptr) std::cout << "ERROR: GetDrawTargetStride() --> nullptr drawtarget!" << std::endl;
+    return pDrawTarget->GetPitch() / 4;
+}
+
+// Sets the font for DrawString() and DrawStringProp(). The font is not owned by the context.
+void flc::DrawContext::SetFont( flc::SpriteFont *pNewFont ) { pFont = pNewFont; }
+
+flc::SpriteFont *flc::DrawContext::GetFont() { return pFont; }
+
+// clearing =====
+
+// clears the whole draw target (the clip rect is respected)
+void flc::DrawContext::Clear( Pixel colour ) {
     FillRect( 0, 0, GetDrawTargetWidth(), GetDrawTargetHeight(), colour );
 }
 
 // pixel drawing =====
 
+// NOTE - alpha blending of a single pixel is done by blend_alpha(), see SGE_Kernels.h
+
 // internal method - lowest level pixel drawing. The mask and alpha blending are implemented in here!
 // Parameters:
 //   * (x, y)     - the location in the draw target to draw the pixel
 //   * encodedCol - the colour (pixel) encoded as a uint32_t
 //   * pixelPtr   - a pointer to the pixels field of the SDL_Surface (i.e. the draw target)
+//   * nDTstride  - the stride of the draw target in pixels (GetDrawTargetStride())
 // NOTE - this method assumes that the SDL_Surface is locked already!
-void flc::SDL_GameEngine::ClampedDraw( int x, int y, uint32_t encodedCol, uint32_t *pixelPtr ) {
-
-    // grab the draw target width, it's needed in addressing of the pixels
-    int nDTwidth = GetDrawTargetWidth();
+void flc::DrawContext::ClampedDraw( int x, int y, uint32_t encodedCol, uint32_t *pixelPtr, int nDTstride ) {
 
     switch (m_PixelMode) {
         case flc::Pixel::NORMAL: {
                 // unconditionally write the pixel value to the draw target
-                pixelPtr[ y * nDTwidth + x ] = encodedCol;
+                pixelPtr[ y * nDTstride + x ] = encodedCol;
             }
             break;
         case flc::Pixel::MASK: {
                 // write the pixel value only if the alpha component has no transparency
                 if (unpackA( encodedCol ) == 255) {
-                    pixelPtr[ y * nDTwidth + x ] = encodedCol;
+                    pixelPtr[ y * nDTstride + x ] = encodedCol;
                 }
             }
             break;
         case flc::Pixel::ALPHA:
         case flc::Pixel::APROP: {
-                // blend the source and the destination value according to alpha blending calculations
-                // see: https://en.wikipedia.org/wiki/Alpha_compositing
-                flc::Pixel srcPix = Pixel( encodedCol );
-                flc::Pixel dstPix = Pixel( pixelPtr[ y * nDTwidth + x ] );
-                // lerp new alpha value from src and dst alphas
-                float fAlpha_src = float( srcPix.getA()) / 255.0f * m_BlendFactor;
-                float fAlpha_dst = float( dstPix.getA()) / 255.0f;
-                float fAlpha_new = fAlpha_src + fAlpha_dst * ( 1.0f - fAlpha_src );
-                // lerp new rgb values using src and dst alpha, and divide by new alpha value
-                int nR_new = int(( float( srcPix.getR() ) * fAlpha_src + float( dstPix.getR() ) * fAlpha_dst * (1.0f - fAlpha_src) ) / fAlpha_new);
-                int nG_new = int(( float( srcPix.getG() ) * fAlpha_src + float( dstPix.getG() ) * fAlpha_dst * (1.0f - fAlpha_src) ) / fAlpha_new);
-                int nB_new = int(( float( srcPix.getB() ) * fAlpha_src + float( dstPix.getB() ) * fAlpha_dst * (1.0f - fAlpha_src) ) / fAlpha_new);
-                int nA_new = int( fAlpha_new * 255 );
-                flc::Pixel newPixel = Pixel( (uint8_t)nR_new, (uint8_t)nG_new, (uint8_t)nB_new, (uint8_t)nA_new );
-                // write the calculated pixel value to the draw target
-                pixelPtr[ y * nDTwidth + x ] = newPixel.Encode();
+                // blend the source and the destination value, and write the result to the draw target
+                pixelPtr[ y * nDTstride + x ] = blend_alpha( encodedCol, pixelPtr[ y * nDTstride + x ], m_BlendFactor );
             }
             break;
         case flc::Pixel::CUSTOM: {
                 // use a user provide function to blend the src and dst pixel
                 flc::Pixel srcPixel = flc::Pixel( encodedCol );
-                flc::Pixel dstPixel = flc::Pixel( pixelPtr[ y * nDTwidth + x ] );
+                flc::Pixel dstPixel = flc::Pixel( pixelPtr[ y * nDTstride + x ] );
                 flc::Pixel newPixel = m_BlendFunc( x, y, srcPixel, dstPixel );
                 // write the calculated pixel value to the draw target
-                pixelPtr[ y * nDTwidth + x ] = newPixel.Encode();
+                pixelPtr[ y * nDTstride + x ] = newPixel.Encode();
             }
             break;
         default: {
@@ -100,171 +141,425 @@ void flc::SDL_GameEngine::ClampedDraw( int x, int y, uint32_t encodedCol, uint32
     }
 }
 
+// internal method - fast span writer. Draws the pixels x0 upto and including x1 on row y.
+// In NORMAL mode the row is filled in one go, in MASK mode the test is done once for the whole span, in the
+// alpha modes the span is blended by the blend kernel. The CUSTOM mode falls back on ClampedDraw() per pixel.
+// NOTE - this method assumes that the SDL_Surface is locked already, and that the span is within bounds!
+void flc::DrawContext::ClampedDrawSpan( int x0, int x1, int y, uint32_t encodedCol, uint32_t *pixelPtr ) {
+
+    int nDTstride = GetDrawTargetStride();
+    uint32_t *rowPtr = pixelPtr + y * nDTstride;
+
+    switch (m_PixelMode) {
+        case flc::Pixel::NORMAL:
+            glb_Kernels.fill( rowPtr + x0, encodedCol, x1 - x0 + 1 );
+            break;
+        case flc::Pixel::MASK:
+            if (unpackA( encodedCol ) == 255)
+                glb_Kernels.fill( rowPtr + x0, encodedCol, x1 - x0 + 1 );
+            break;
+        case flc::Pixel::ALPHA:
+        case flc::Pixel::APROP:
+            glb_Kernels.blend( rowPtr + x0, &encodedCol, 0, x1 - x0 + 1, m_BlendFactor );
+            break;
+        default:
+            for (int x = x0; x <= x1; x++)
+                ClampedDraw( x, y, encodedCol, pixelPtr, nDTstride );
+    }
+}
+
+// internal method - clips the span x0 upto and including x1 on row y against the draw target, and draws it
+void flc::DrawContext::DrawSpan( int x0, int x1, int y, uint32_t encodedCol ) {
+    int cx0, cy0, cx1, cy1;
+    if (!GetClipBounds( cx0, cy0, cx1, cy1 ))
+        return;
+    if (x0 > x1)
+        std::swap( x0, x1 );
+    if (y < cy0 || y >= cy1)
+        return;
+    x0 = std::max( x0, cx0 );
+    x1 = std::min( x1, cx1 - 1 );
+    if (x0 <= x1) {
+        SDL_Surface *pSrfce = pDrawTarget->GetSurfacePtr();
+        SDL_LockSurface( pSrfce );
+        ClampedDrawSpan( x0, x1, y, encodedCol, (uint32_t *)pSrfce->pixels );
+        SDL_UnlockSurface( pSrfce );
+    }
+}
+
+// clipping stuff =====
+
+// Sets the clip rect - all drawing is restricted to the rectangle at (x, y) with size (w, h)
+void flc::DrawContext::SetClipRect( int x, int y, int w, int h ) {
+    if (w < 0 || h < 0) {
+        std::cout << "WARNING: SetClipRect() --> negative size: " << w << ", " << h << std::endl;
+    }
+    InitSDL_Rect( m_ClipRect, x, y, std::max( w, 0 ), std::max( h, 0 ));
+    m_bClipRectSet = true;
+}
+
+// Removes the clip rect - drawing is only restricted by the boundaries of the draw target
+void flc::DrawContext::ClearClipRect() {
+    m_bClipRectSet = false;
+}
+
+// Determines the drawable area as the intersection of the draw target boundaries and the clip rect (if set).
+// This is meant to be called once per primitive, so that the per pixel work can be done without bounds checks.
+bool flc::DrawContext::GetClipBounds( int &x0, int &y0, int &x1, int &y1 ) {
+    if (pDrawTarget == nullptr)
+        return false;
+    x0 = 0;
+    y0 = 0;
+    x1 = GetDrawTargetWidth();
+    y1 = GetDrawTargetHeight();
+    if (m_bClipRectSet) {
+        x0 = std::max( x0, m_ClipRect.x );
+        y0 = std::max( y0, m_ClipRect.y );
+        x1 = std::min( x1, m_ClipRect.x + m_ClipRect.w );
+        y1 = std::min( y1, m_ClipRect.y + m_ClipRect.h );
+    }
+    return (x0 < x1 && y0 < y1);
+}
+
 // Draw a pixel of 'colour' to the drawtarget at location (x, y ). If this location is out of bounds for the draw target, nothing is drawn.
-void flc::SDL_GameEngine::Draw( int x, int y, Pixel colour ) {
+void flc::DrawContext::Draw( int x, int y, Pixel colour ) {
     Draw( x, y, colour.Encode() );
 }
 
-// Draw a pixel of encodedCol to the drawtarget at location (x, y ). If this location is out of bounds for the draw target, nothing is drawn.
-void flc::SDL_GameEngine::Draw( int x, int y, uint32_t encodedCol ) {
-    if (x >= 0 && x < GetDrawTargetWidth() && y >= 0 && y < GetDrawTargetHeight()) {
-        SDL_Surface *pSrfce = pEngineDrawTarget->GetSurfacePtr();
+// Draw a pixel of encodedCol to the drawtarget at location (x, y ). If this location is out of bounds for the draw target
+// (or outside the clip rect), nothing is drawn.
+void flc::DrawContext::Draw( int x, int y, uint32_t encodedCol ) {
+    int cx0, cy0, cx1, cy1;
+    if (GetClipBounds( cx0, cy0, cx1, cy1 ) && x >= cx0 && x < cx1 && y >= cy0 && y < cy1) {
+        SDL_Surface *pSrfce = pDrawTarget->GetSurfacePtr();
         uint32_t *aux = (uint32_t *)pSrfce->pixels;
         SDL_LockSurface( pSrfce );
-        ClampedDraw( x, y, encodedCol, aux );
+        ClampedDraw( x, y, encodedCol, aux, GetDrawTargetStride() );
         SDL_UnlockSurface( pSrfce );
     }
 }
 
+// bulk point drawing =====
+
+// Draws nPoints points, where point i is drawn in colour pColours[i] (encoded). The draw target is locked and the drawable
+// area is determined only once. Points outside the drawable area are skipped.
+void flc::DrawContext::DrawPoints( const flc::vi2d *pPoints, const uint32_t *pColours, size_t nPoints ) {
+    int cx0, cy0, cx1, cy1;
+    if (nPoints == 0 || !GetClipBounds( cx0, cy0, cx1, cy1 ))
+        return;
+    // a single unsigned compare per axis does the bounds check: the subtraction is done unsigned (so it can't overflow),
+    // and values below the lower bound wrap around to large values
+    uint32_t nClipW = uint32_t( cx1 - cx0 );
+    uint32_t nClipH = uint32_t( cy1 - cy0 );
+    int nDTstride = GetDrawTargetStride();
+    // a pixel is opaque if all of it's alpha bits are set
+    uint32_t nAmask = glb_amask;
+
+    SDL_Surface *pSrfce = pDrawTarget->GetSurfacePtr();
+    uint32_t *pixelPtr = (uint32_t *)pSrfce->pixels;
+    SDL_LockSurface( pSrfce );
+    switch (m_PixelMode) {
+        case flc::Pixel::NORMAL:
+            for (size_t i = 0; i < nPoints; i++) {
+                int x = pPoints[i].x, y = pPoints[i].y;
+                if (uint32_t( x ) - uint32_t( cx0 ) < nClipW && uint32_t( y ) - uint32_t( cy0 ) < nClipH)
+                    pixelPtr[ y * nDTstride + x ] = pColours[i];
+            }
+            break;
+        case flc::Pixel::MASK:
+            for (size_t i = 0; i < nPoints; i++) {
+                int x = pPoints[i].x, y = pPoints[i].y;
+                if (uint32_t( x ) - uint32_t( cx0 ) < nClipW && uint32_t( y ) - uint32_t( cy0 ) < nClipH && (pColours[i] & nAmask) == nAmask)
+                    pixelPtr[ y * nDTstride + x ] = pColours[i];
+            }
+            break;
+        case flc::Pixel::ALPHA:
+        case flc::Pixel::APROP:
+            for (size_t i = 0; i < nPoints; i++) {
+                int x = pPoints[i].x, y = pPoints[i].y;
+                if (uint32_t( x ) - uint32_t( cx0 ) < nClipW && uint32_t( y ) - uint32_t( cy0 ) < nClipH) {
+                    uint32_t &dst = pixelPtr[ y * nDTstride + x ];
+                    // fully opaque source pixels don't need blending
+                    dst = ((pColours[i] & nAmask) == nAmask && m_BlendFactor >= 1.0f) ? pColours[i] : blend_alpha( pColours[i], dst, m_BlendFactor );
+                }
+            }
+            break;
+        default:
+            for (size_t i = 0; i < nPoints; i++) {
+                int x = pPoints[i].x, y = pPoints[i].y;
+                if (uint32_t( x ) - uint32_t( cx0 ) < nClipW && uint32_t( y ) - uint32_t( cy0 ) < nClipH)
+                    ClampedDraw( x, y, pColours[i], pixelPtr, nDTstride );
+            }
+    }
+    SDL_UnlockSurface( pSrfce );
+}
+
+// Draws nPoints points, all in the same colour. The colour is encoded only once.
+void flc::DrawContext::DrawPoints( const flc::vi2d *pPoints, size_t nPoints, Pixel colour ) {
+    int cx0, cy0, cx1, cy1;
+    if (nPoints == 0 || !GetClipBounds( cx0, cy0, cx1, cy1 ))
+        return;
+    uint32_t nClipW = uint32_t( cx1 - cx0 );
+    uint32_t nClipH = uint32_t( cy1 - cy0 );
+    int nDTstride = GetDrawTargetStride();
+    uint32_t encodedCol = colour.Encode();
+
+    // in MASK mode a non opaque colour doesn't draw anything at all
+    if (m_PixelMode == flc::Pixel::MASK && unpackA( encodedCol ) != 255)
+        return;
+
+    SDL_Surface *pSrfce = pDrawTarget->GetSurfacePtr();
+    uint32_t *pixelPtr = (uint32_t *)pSrfce->pixels;
+    SDL_LockSurface( pSrfce );
+    bool bOpaque = (unpackA( encodedCol ) == 255 && m_BlendFactor >= 1.0f);
+    switch (m_PixelMode) {
+        case flc::Pixel::NORMAL:
+        case flc::Pixel::MASK:
+            for (size_t i = 0; i < nPoints; i++) {
+                int x = pPoints[i].x, y = pPoints[i].y;
+                if (uint32_t( x ) - uint32_t( cx0 ) < nClipW && uint32_t( y ) - uint32_t( cy0 ) < nClipH)
+                    pixelPtr[ y * nDTstride + x ] = encodedCol;
+            }
+            break;
+        case flc::Pixel::ALPHA:
+        case flc::Pixel::APROP:
+            for (size_t i = 0; i < nPoints; i++) {
+                int x = pPoints[i].x, y = pPoints[i].y;
+                if (uint32_t( x ) - uint32_t( cx0 ) < nClipW && uint32_t( y ) - uint32_t( cy0 ) < nClipH) {
+                    uint32_t &dst = pixelPtr[ y * nDTstride + x ];
+                    dst = bOpaque ? encodedCol : blend_alpha( encodedCol, dst, m_BlendFactor );
+                }
+            }
+            break;
+        default:
+            for (size_t i = 0; i < nPoints; i++) {
+                int x = pPoints[i].x, y = pPoints[i].y;
+                if (uint32_t( x ) - uint32_t( cx0 ) < nClipW && uint32_t( y ) - uint32_t( cy0 ) < nClipH)
+                    ClampedDraw( x, y, encodedCol, pixelPtr, nDTstride );
+            }
+    }
+    SDL_UnlockSurface( pSrfce );
+}
+
 // DrawLine() method and aux functions =====
 
+// auxiliary function - shortens the line to the part that is within [xlo, xhi] x [ylo, yhi] (Liang-Barsky). The new
+// end points are rounded to the nearest pixel. Returns false if no part of the line is within the rectangle.
+static bool clip_line_liang_barsky( int &x0, int &y0, int &x1, int &y1, int xlo, int ylo, int xhi, int yhi ) {
+    double dx = double( x1 ) - double( x0 );
+    double dy = double( y1 ) - double( y0 );
+    double p[4] = { -dx, dx, -dy, dy };
+    double q[4] = { double( x0 ) - xlo, double( xhi ) - x0, double( y0 ) - ylo, double( yhi ) - y0 };
+    double t0 = 0.0, t1 = 1.0;
+    for (int i = 0; i < 4; i++) {
+        if (p[i] == 0.0) {
+            if (q[i] < 0.0)
+                return false;
+        } else if (p[i] < 0.0) {
+            t0 = std::max( t0, q[i] / p[i] );
+        } else {
+            t1 = std::min( t1, q[i] / p[i] );
+        }
+    }
+    if (t0 > t1)
+        return false;
+    int nx0 = int( std::lround( x0 + t0 * dx )), ny0 = int( std::lround( y0 + t0 * dy ));
+    int nx1 = int( std::lround( x0 + t1 * dx )), ny1 = int( std::lround( y0 + t1 * dy ));
+    x0 = nx0; y0 = ny0; x1 = nx1; y1 = ny1;
+    return true;
+}
+
+// auxiliary function - clips a bresenham line that takes the steps i = 0 .. dMaj along it's major axis, starting at
+// (nMaj0, nMin0). After i steps the minor coordinate is nMin0 + nDir * k(i), with k(i) = ceil( (2 dMin i - dMaj) / (2 dMaj) ).
+// Returns the range of steps [i0, i1] for which both coordinates are within bounds, and k0 = k(i0). Returns false if
+// there are no such steps. dMaj and dMin must be >= 0, and dMaj < 2^30 (so that the products don't overflow).
+static bool clip_bresenham( long long nMaj0, long long nMin0, long long dMaj, long long dMin, int nDir,
+                            long long nMajLo, long long nMajHi, long long nMinLo, long long nMinHi,
+                            long long &i0, long long &i1, long long &k0 ) {
+    // range of steps for which the major coordinate is within bounds
+    i0 = std::max( 0LL, nMajLo - nMaj0 );
+    i1 = std::min( dMaj, nMajHi - nMaj0 );
+    // range of minor steps for which the minor coordinate is within bounds
+    long long kLo = (nDir > 0) ? nMinLo - nMin0 : nMin0 - nMinHi;
+    long long kHi = (nDir > 0) ? nMinHi - nMin0 : nMin0 - nMinLo;
+    kLo = std::max( kLo, 0LL );
+    kHi = std::min( kHi, dMin );
+    if (i0 > i1 || kLo > kHi)
+        return false;
+    // k(i) >= kLo for i > (2 dMaj (kLo - 1) + dMaj) / (2 dMin), and k(i) <= kHi for i <= (2 dMaj kHi + dMaj) / (2 dMin)
+    if (dMin > 0) {
+        if (kLo > 0)
+            i0 = std::max( i0, (2 * dMaj * (kLo - 1) + dMaj) / (2 * dMin) + 1 );
+        i1 = std::min( i1, (2 * dMaj * kHi + dMaj) / (2 * dMin) );
+    }
+    if (i0 > i1)
+        return false;
+    long long nNum = 2 * dMin * i0 - dMaj;
+    k0 = (nNum <= 0) ? 0 : (nNum + 2 * dMaj - 1) / (2 * dMaj);
+    return true;
+}
+
 // This method draws any line from (x0, y0) to (x1, y1) using colour and pattern.
 // Two cases of horizontal resp. vertical lines are handled separately.
 // All other lines are distinguished for their gradient.
-void flc::SDL_GameEngine::DrawLine( int x0, int y0, int x1, int y1, Pixel colour, uint32_t nLinePattern ) {
-
-    // lambda for drawing patterns - The 'cur' dot of the line that is drawn is mapped onto pattern.
-    // If a 1 bit isfound, this lambda returns true.
-    auto pattern_active = [=] ( int fst, int lst, int cur, uint32_t pattern ) -> bool {
-        int nBitIx = (fst - cur) % 32;
-        uint32_t mask = 0x00000001 << nBitIx;
-        return ((pattern & mask) != 0);
+void flc::DrawContext::DrawLine( int x0, int y0, int x1, int y1, Pixel colour, uint32_t nLinePattern ) {
+
+    // clipping is done once for the whole line, before any pixel is drawn. Horizontal and vertical lines are clipped
+    // to the clip bounds directly. For other lines the range of bresenham steps that is within the clip bounds is
+    // computed (see clip_bresenham()), so that only the visible pixels are visited. The pattern keeps it's phase.
+    int cx0, cy0, cx1, cy1;
+    if (!GetClipBounds( cx0, cy0, cx1, cy1 ) ||
+        std::max( x0, x1 ) < cx0 || std::min( x0, x1 ) >= cx1 ||
+        std::max( y0, y1 ) < cy0 || std::min( y0, y1 ) >= cy1)
+        return;
+
+    uint32_t encodedCol = colour.Encode();
+    SDL_Surface *pSrfce = pDrawTarget->GetSurfacePtr();
+    uint32_t *pixelPtr = (uint32_t *)pSrfce->pixels;
+    int nDTstride = GetDrawTargetStride();
+
+    // lambda for drawing patterns - The 'cur' dot of the line that is drawn is mapped onto pattern. If a 1 bit is
+    // found, this lambda returns true. The unsigned arithmetic keeps the phase for lines that start far off screen.
+    auto pattern_active = [=] ( int fst, int cur ) -> bool {
+        uint32_t nBitIx = (uint32_t( fst ) - uint32_t( cur )) & 31;
+        return ((nLinePattern >> nBitIx) & 1) != 0;
     };
 
-    auto plot_horizontal_line = [=] ( int x0, int x1, int y, Pixel colour, uint32_t linePattern ) -> void {
+    auto plot_horizontal_line = [=] ( int x0, int x1, int y ) -> void {
         if (x0 > x1)
             std::swap( x0, x1 );
-        for (int x = x0; x <= x1; x++)
-            if (pattern_active( x0, x1, x, linePattern ))
-                Draw( x, y, colour );
+        int xs = std::max( x0, cx0 );
+        int xe = std::min( x1, cx1 - 1 );
+        if (nLinePattern == 0xFFFFFFFF) {
+            ClampedDrawSpan( xs, xe, y, encodedCol, pixelPtr );
+        } else {
+            for (int x = xs; x <= xe; x++)
+                if (pattern_active( x0, x ))
+                    ClampedDraw( x, y, encodedCol, pixelPtr, nDTstride );
+        }
     };
 
-    auto plot_vertical_line = [=] ( int x, int y0, int y1, Pixel colour, uint32_t linePattern ) -> void {
+    auto plot_vertical_line = [=] ( int x, int y0, int y1 ) -> void {
         if (y0 > y1)
             std::swap( y0, y1 );
-        for (int y = y0; y <= y1; y++)
-            if (pattern_active( y0, y1, y, linePattern ))
-                Draw( x, y, colour );
+        int ys = std::max( y0, cy0 );
+        int ye = std::min( y1, cy1 - 1 );
+        for (int y = ys; y <= ye; y++)
+            if (pattern_active( y0, y ))
+                ClampedDraw( x, y, encodedCol, pixelPtr, nDTstride );
     };
 
-    // low gradient line - m = dy/dx in [-1, 1]: per 1 x step there's < 1 y step
-    auto plot_line_low_gradient = [=] ( int x0, int y0, int x1, int y1, Pixel colour, uint32_t linePattern ) -> void {
-        int dx = x1 - x0;
-        int dy = y1 - y0;
-        int yi = 1;
-        if (dy < 0) {
-            yi = -1;
-            dy = -dy;
+    // sloped line, stepping along the major axis from nMaj0 to nMaj1 (nMaj0 < nMaj1). If bSteep is true the major axis
+    // is y (high gradient line), otherwise it's x (low gradient line)
+    auto plot_sloped_line = [=] ( bool bSteep, int nMaj0, int nMin0, int nMaj1, int nMin1 ) -> void {
+        // the pattern phase is relative to the start of the unclipped line
+        int nPatFst = nMaj0;
+        // lines of 2^30 pixels or more are shortened to (about) the clip bounds first, so that clip_bresenham() can't
+        // overflow. The pixels of such lines can be 1 pixel off compared to the unclipped line.
+        if ((long long)nMaj1 - nMaj0 >= (1LL << 30)) {
+            int x0 = bSteep ? nMin0 : nMaj0, y0 = bSteep ? nMaj0 : nMin0;
+            int x1 = bSteep ? nMin1 : nMaj1, y1 = bSteep ? nMaj1 : nMin1;
+            if (!clip_line_liang_barsky( x0, y0, x1, y1, cx0 - 1, cy0 - 1, cx1, cy1 ))
+                return;
+            nMaj0 = bSteep ? y0 : x0; nMin0 = bSteep ? x0 : y0;
+            nMaj1 = bSteep ? y1 : x1; nMin1 = bSteep ? x1 : y1;
         }
-        int D = (2 * dy) - dx;
-        int y = y0;
-        for (int x = x0; x <= x1; x++) {
-            if (pattern_active( x0, x1, x, linePattern ))
-                Draw( x, y, colour );
-            if (D > 0) {
-                y += yi;
-                D += 2 * (dy - dx);
-            } else {
-                D = D + 2 * dy;
-            }
-        }
-    };
-
-    // high gradient line - m = dy/dx outside of [-1, 1]: per 1 y step there's < 1 x step
-    auto plot_line_high_gradient = [=] ( int x0, int y0, int x1, int y1, Pixel colour, uint32_t linePattern ) -> void {
-        int dx = x1 - x0;
-            int dy = y1 - y0;
-        int xi = 1;
-        if (dx < 0) {
-            xi = -1;
-            dx = -dx;
+        long long dMaj = (long long)nMaj1 - nMaj0;
+        long long dMin = (long long)nMin1 - nMin0;
+        int nDir = 1;
+        if (dMin < 0) {
+            nDir = -1;
+            dMin = -dMin;
         }
-        int D = (2 * dx) - dy;
-        int x = x0;
-        for (int y = y0; y <= y1; y++) {
-            if (pattern_active( y0, y1, y, linePattern ))
-                Draw( x, y, colour );
+        long long i0, i1, k0;
+        if (!clip_bresenham( nMaj0, nMin0, dMaj, dMin, nDir,
+                             bSteep ? cy0 : cx0, (bSteep ? cy1 : cx1) - 1,
+                             bSteep ? cx0 : cy0, (bSteep ? cx1 : cy1) - 1, i0, i1, k0 ))
+            return;
+        // the bresenham state at step i0
+        long long D = 2 * dMin * (i0 + 1) - dMaj - 2 * dMaj * k0;
+        int nMin = int( nMin0 + nDir * k0 );
+        int nMaj = int( nMaj0 + i0 );
+        for (long long i = i0; i <= i1; i++, nMaj++) {
+            if (pattern_active( nPatFst, nMaj )) {
+                if (bSteep)
+                    ClampedDraw( nMin, nMaj, encodedCol, pixelPtr, nDTstride );
+                else
+                    ClampedDraw( nMaj, nMin, encodedCol, pixelPtr, nDTstride );
+            }
             if (D > 0) {
-                x += xi;
-                D += 2 * (dx - dy);
+                nMin += nDir;
+                D += 2 * (dMin - dMaj);
             } else {
-                D += 2 * dx;
+                D += 2 * dMin;
             }
         }
     };
 
     // implementation of bresenham line plotting
     // See: https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+    SDL_LockSurface( pSrfce );
     if (x0 == x1) {
-        plot_vertical_line(   x0, y0, y1, colour, nLinePattern );
+        plot_vertical_line(   x0, y0, y1 );
     } else if (y0 == y1) {
-        plot_horizontal_line( x0, x1, y0, colour, nLinePattern );
+        plot_horizontal_line( x0, x1, y0 );
     } else {
-        if (abs(y1 - y0) < abs(x1 - x0)) {
+        if (std::llabs( (long long)y1 - y0 ) < std::llabs( (long long)x1 - x0 )) {
             if (x0 > x1) {
                 std::swap( x0, x1 );
                 std::swap( y0, y1 );
             }
-            plot_line_low_gradient( x0, y0, x1, y1, colour, nLinePattern );
+            plot_sloped_line( false, x0, y0, x1, y1 );
         } else {
             if (y0 > y1) {
                 std::swap( y0, y1 );
                 std::swap( x0, x1 );
             }
-            plot_line_high_gradient( x0, y0, x1, y1, colour, nLinePattern );
+            plot_sloped_line( true, y0, x0, y1, x1 );
         }
     }
+    SDL_UnlockSurface( pSrfce );
 }
 
 // rectangle drawing =====
 
 // Draw a (non filled) rectangle. The parameters are the upper left resp. lower right corner.
-void flc::SDL_GameEngine::DrawRect( int x, int y, int w, int h, Pixel colour ) {
-
-    auto plot_horizontal_line = [=]( int x0, int x1, int y, Pixel colour ) -> void {
-        if (x0 > x1)
-            std::swap( x0, x1 );
-        for (int x = x0; x <= x1; x++)
-            Draw( x, y, colour );
-    };
-
-    auto plot_vertical_line = [=]( int x, int y0, int y1, Pixel colour ) -> void {
-        if (y0 > y1)
-            std::swap( y0, y1 );
-        for (int y = y0; y <= y1; y++)
-            Draw( x, y, colour );
-    };
-
-    plot_horizontal_line( x    , x + w, y    , colour );
-    plot_horizontal_line( x    , x + w, y + h, colour );
-    plot_vertical_line(   x    , y    , y + h, colour );
-    plot_vertical_line(   x + w, y    , y + h, colour );
+void flc::DrawContext::DrawRect( int x, int y, int w, int h, Pixel colour ) {
+    // the horizontal sides are drawn as spans, the vertical sides as lines - both are clipped once per call
+    uint32_t encodedCol = colour.Encode();
+    DrawSpan( x, x + w, y    , encodedCol );
+    DrawSpan( x, x + w, y + h, encodedCol );
+    DrawLine( x    , y, x    , y + h, colour );
+    DrawLine( x + w, y, x + w, y + h, colour );
 }
 
 // Draw a filled rectangle. The parameters are the upper left resp. lower right corner.
-void flc::SDL_GameEngine::FillRect( int x, int y, int w, int h, Pixel colour ) {
-    // Clamp the corner points of the rectangle to fill within the boundaries of the drawtarget
-    int aux_x1 = Clamp( x    , 0, GetDrawTargetWidth()  );
-    int aux_y1 = Clamp( y    , 0, GetDrawTargetHeight() );
-    int aux_x2 = Clamp( x + w, 0, GetDrawTargetWidth()  );
-    int aux_y2 = Clamp( y + h, 0, GetDrawTargetHeight() );
-
-    // Fill the rectangle with calls to ClampedDraw()
-    uint32_t auxCol = colour.Encode();
-    SDL_Surface *pSrfce = pEngineDrawTarget->GetSurfacePtr();
-    uint32_t *aux = (uint32_t *)pSrfce->pixels;
-    SDL_LockSurface( pSrfce );
-    for (int i = aux_x1; i < aux_x2; i++) {
+void flc::DrawContext::FillRect( int x, int y, int w, int h, Pixel colour ) {
+    // Clamp the corner points of the rectangle to fill within the boundaries of the drawtarget and the clip rect
+    int cx0, cy0, cx1, cy1;
+    if (!GetClipBounds( cx0, cy0, cx1, cy1 ))
+        return;
+    int aux_x1 = Clamp( x    , cx0, cx1 );
+    int aux_y1 = Clamp( y    , cy0, cy1 );
+    int aux_x2 = Clamp( x + w, cx0, cx1 );
+    int aux_y2 = Clamp( y + h, cy0, cy1 );
+
+    // Fill the rectangle row by row with calls to ClampedDrawSpan()
+    if (aux_x1 < aux_x2) {
+        uint32_t auxCol = colour.Encode();
+        SDL_Surface *pSrfce = pDrawTarget->GetSurfacePtr();
+        uint32_t *aux = (uint32_t *)pSrfce->pixels;
+        SDL_LockSurface( pSrfce );
         for (int j = aux_y1; j < aux_y2; j++) {
-            ClampedDraw( i, j, auxCol, aux );
+            ClampedDrawSpan( aux_x1, aux_x2 - 1, j, auxCol, aux );
         }
+        SDL_UnlockSurface( pSrfce );
     }
-    SDL_UnlockSurface( pSrfce );
 }
 
 // DrawTriangle() method =====
 
-void flc::SDL_GameEngine::DrawTriangle( int x0, int y0, int x1, int y1, int x2, int y2, Pixel colour ) {
+void flc::DrawContext::DrawTriangle( int x0, int y0, int x1, int y1, int x2, int y2, Pixel colour ) {
     DrawLine( x0, y0, x1, y1, colour );
     DrawLine( x1, y1, x2, y2, colour );
     DrawLine( x2, y2, x0, y0, colour );
@@ -273,13 +568,18 @@ void flc::SDL_GameEngine::DrawTriangle( int x0, int y0, int x1, int y1, int x2,
 // FillTriangle() method and aux functions =====
 
 // https://www.avrfreaks.net/sites/default/files/triangles.c
-void flc::SDL_GameEngine::FillTriangle( int x1, int y1, int x2, int y2, int x3, int y3, Pixel c ) {
-
-    auto plot_horizontal_line = [ = ]( int x0, int x1, int y, Pixel colour ) -> void {
-        if (x0 > x1)
-            std::swap( x0, x1 );
-        for (int x = x0; x <= x1; x++)
-            Draw( x, y, colour );
+void flc::DrawContext::FillTriangle( int x1, int y1, int x2, int y2, int x3, int y3, Pixel c ) {
+
+    // reject the triangle at once if it's bounding box is outside the drawable area. The spans are clipped by DrawSpan()
+    int cx0, cy0, cx1, cy1;
+    if (!GetClipBounds( cx0, cy0, cx1, cy1 ) ||
+        std::max( { x1, x2, x3 } ) < cx0 || std::min( { x1, x2, x3 } ) >= cx1 ||
+        std::max( { y1, y2, y3 } ) < cy0 || std::min( { y1, y2, y3 } ) >= cy1)
+        return;
+
+    uint32_t encodedCol = c.Encode();
+    auto plot_horizontal_line = [ = ]( int x0, int x1, int y ) -> void {
+        DrawSpan( x0, x1, y, encodedCol );
     };
 
     int t1x, t2x, y, minx, maxx, t1xp, t2xp;
@@ -373,7 +673,7 @@ next2:
             if (minx > t2x) minx = t2x;
             if (maxx < t1x) maxx = t1x;
             if (maxx < t2x) maxx = t2x;
-            plot_horizontal_line( minx, maxx, y, c );    // Draw line from min to max points found on the y
+            plot_horizontal_line( minx, maxx, y );    // Draw line from min to max points found on the y
             // Now increase y
             if (!changed1) t1x += signx1;
             t1x += t1xp;
@@ -443,7 +743,7 @@ next4:
         if (minx > t2x) minx = t2x;
         if (maxx < t1x) maxx = t1x;
         if (maxx < t2x) maxx = t2x;
-        plot_horizontal_line( minx, maxx, y, c );
+        plot_horizontal_line( minx, maxx, y );
 
         if (!changed1) t1x += signx1;
         t1x += t1xp;
@@ -454,50 +754,248 @@ next4:
     }
 }
 
+// DrawPolygon() and FillPolygon() methods =====
+
+// Draws the outline of the polygon, the last vertex is connected to the first one
+void flc::DrawContext::DrawPolygon( const std::vector<flc::vi2d> &vPoints, Pixel colour ) {
+    int nPoints = (int)vPoints.size();
+    for (int i = 0; i < nPoints; i++) {
+        const flc::vi2d &p0 = vPoints[i];
+        const flc::vi2d &p1 = vPoints[(i + 1) % nPoints];
+        DrawLine( p0.x, p0.y, p1.x, p1.y, colour );
+    }
+}
+
+// The integer version samples at the pixel centers as well, so a polygon with corners (0, 0) and (10, 10)
+// covers the same pixels as FillRect( 0, 0, 10, 10 ).
+void flc::DrawContext::FillPolygon( const std::vector<flc::vi2d> &vPoints, Pixel colour, FillRule rule ) {
+    std::vector<flc::vf2d> vAux;
+    vAux.reserve( vPoints.size() );
+    for (auto &p : vPoints)
+        vAux.push_back( flc::vf2d( float( p.x ), float( p.y )));
+    FillPolygon( vAux, colour, rule );
+}
+
+// Scanline polygon fill using an active edge table. A pixel (x, y) is filled if it's center (x + 0.5, y + 0.5)
+// is inside the polygon according to the fill rule. Horizontal edges never cross a scanline, so they are
+// skipped. The scanlines and spans are clipped against the draw target (and clip rect), and the spans are drawn using the
+// fast span writer.
+// See: https://www.cs.rit.edu/~icss571/filling/how_to.html
+void flc::DrawContext::FillPolygon( const std::vector<flc::vf2d> &vPoints, Pixel colour, FillRule rule ) {
+
+    // edge info for the edge table
+    struct sEdge {
+        int   nFirst;   // first scanline this edge crosses
+        int   nLast;    // last  scanline this edge crosses
+        float fX;       // x value of the crossing with the current scanline
+        float fSlope;   // dx / dy
+        int   nDir;     // +1 for downward edges, -1 for upward edges (needed for winding number)
+    };
+
+    int nPoints = (int)vPoints.size();
+    if (nPoints < 3)
+        return;
+
+    // build the edge table from all non horizontal edges
+    std::vector<sEdge> vEdgeTable;
+    vEdgeTable.reserve( nPoints );
+    for (int i = 0; i < nPoints; i++) {
+        flc::vf2d p0 = vPoints[i];
+        flc::vf2d p1 = vPoints[(i + 1) % nPoints];
+        int nDir = 1;
+        if (p0.y > p1.y) {
+            std::swap( p0, p1 );
+            nDir = -1;
+        }
+        // scanline y is sampled at y + 0.5, so an edge crosses scanlines ceil( y0 - 0.5 ) upto ceil( y1 - 0.5 ) - 1
+        int nFirst = (int)std::ceil( p0.y - 0.5f );
+        int nLast  = (int)std::ceil( p1.y - 0.5f ) - 1;
+        if (nFirst <= nLast) {
+            float fSlope = (p1.x - p0.x) / (p1.y - p0.y);
+            vEdgeTable.push_back( { nFirst, nLast, p0.x + (float( nFirst ) + 0.5f - p0.y) * fSlope, fSlope, nDir } );
+        }
+    }
+    if (vEdgeTable.empty())
+        return;
+    // sort the edge table on first scanline, so that edges can be activated in order
+    std::sort( vEdgeTable.begin(), vEdgeTable.end(), []( const sEdge &a, const sEdge &b ) { return a.nFirst < b.nFirst; } );
+
+    // clip the range of scanlines against the draw target and clip rect
+    int cx0, cy0, cx1, cy1;
+    if (!GetClipBounds( cx0, cy0, cx1, cy1 ))
+        return;
+    int nYstart = std::max( vEdgeTable.front().nFirst, cy0 );
+    int nYend   = vEdgeTable.front().nLast;
+    for (auto &e : vEdgeTable)
+        nYend = std::max( nYend, e.nLast );
+    nYend = std::min( nYend, cy1 - 1 );
+
+    uint32_t encodedCol = colour.Encode();
+    SDL_Surface *pSrfce = pDrawTarget->GetSurfacePtr();
+    uint32_t *pixelPtr = (uint32_t *)pSrfce->pixels;
+    SDL_LockSurface( pSrfce );
+
+    std::vector<sEdge> vActive;
+    int nNextEdge = 0;
+    for (int y = nYstart; y <= nYend; y++) {
+        // remove the edges that are finished
+        vActive.erase( std::remove_if( vActive.begin(), vActive.end(), [=]( const sEdge &e ) { return e.nLast < y; } ), vActive.end() );
+        // activate the edges that start on or before this scanline. Edges that started above the draw target
+        // get their crossing moved to the current scanline.
+        while (nNextEdge < (int)vEdgeTable.size() && vEdgeTable[nNextEdge].nFirst <= y) {
+            sEdge e = vEdgeTable[nNextEdge++];
+            if (e.nLast >= y) {
+                e.fX += float( y - e.nFirst ) * e.fSlope;
+                vActive.push_back( e );
+            }
+        }
+        if (vActive.empty()) {
+            if (nNextEdge >= (int)vEdgeTable.size())
+                break;
+            continue;
+        }
+        // keep the active edges sorted on x. Insertion sort is efficient since the order hardly changes between scanlines
+        for (int i = 1; i < (int)vActive.size(); i++) {
+            sEdge aux = vActive[i];
+            int j = i - 1;
+            while (j >= 0 && vActive[j].fX > aux.fX) {
+                vActive[j + 1] = vActive[j];
+                j--;
+            }
+            vActive[j + 1] = aux;
+        }
+        // walk the crossings from left to right and draw the spans that are inside
+        int nWinding = 0;
+        for (int i = 0; i < (int)vActive.size() - 1; i++) {
+            nWinding += (rule == NON_ZERO) ? vActive[i].nDir : 1;
+            bool bInside = (rule == NON_ZERO) ? (nWinding != 0) : ((nWinding & 1) != 0);
+            if (bInside) {
+                // pixel x is in the span if x + 0.5 is in [ xa, xb )
+                int x0 = std::max( (int)std::ceil( vActive[i    ].fX - 0.5f ), cx0 );
+                int x1 = std::min( (int)std::ceil( vActive[i + 1].fX - 0.5f ) - 1, cx1 - 1 );
+                if (x0 <= x1)
+                    ClampedDrawSpan( x0, x1, y, encodedCol, pixelPtr );
+            }
+        }
+        // step all active edges to the next scanline
+        for (auto &e : vActive)
+            e.fX += e.fSlope;
+    }
+    SDL_UnlockSurface( pSrfce );
+}
+
 // DrawCircle() and FillCircle() method =====
 
+// auxiliary function - the y value at step x of the bresenham circle with radius r (see DrawCircle()). This is the
+// largest y for which F( x, y ) + F( x, y - 1 ) <= 0, with F( a, b ) = a^2 + b^2 - r^2. Valid for 0 <= x <= r.
+static int circle_step_y( int r, int x ) {
+    // find the largest y with 2y^2 - 2y + 1 <= t
+    unsigned long long t = 2 * ((unsigned long long)r * r - (unsigned long long)x * x);
+    unsigned long long y = (unsigned long long)((1.0 + std::sqrt( std::max( 0.0, 2.0 * double( t ) - 1.0 ))) / 2.0);
+    while (y > 0 && 2 * y * y - 2 * y + 1 > t)
+        y--;
+    while (2 * (y + 1) * (y + 1) - 2 * (y + 1) + 1 <= t)
+        y++;
+    return int( y );
+}
+
 // Function for circle-generation, using Bresenham's algorithm
 // see: https://cppsecrets.com/users/100741121141051219710912197115104485164103109971051084699111109/Bresenham-Circle-Drawing-Algorithm.php
-void flc::SDL_GameEngine::DrawCircle( int xc, int yc, int r, Pixel colour ) {
+void flc::DrawContext::DrawCircle( int xc, int yc, int r, Pixel colour ) {
+
+    // clipping is done once for the whole circle. If the bounding box is outside the drawable area nothing is drawn,
+    // and if it's completely inside, the pixels are drawn without any test. Otherwise only the steps of the algorithm
+    // that can have visible pixels are visited (see below)
+    int cx0, cy0, cx1, cy1;
+    if (r < 0 || !GetClipBounds( cx0, cy0, cx1, cy1 ) ||
+        (long long)xc + r < cx0 || (long long)xc - r >= cx1 || (long long)yc + r < cy0 || (long long)yc - r >= cy1)
+        return;
+    bool bInside = (long long)xc - r >= cx0 && (long long)xc + r < cx1 && (long long)yc - r >= cy0 && (long long)yc + r < cy1;
+
+    uint32_t encodedCol = colour.Encode();
+    SDL_Surface *pSrfce = pDrawTarget->GetSurfacePtr();
+    uint32_t *pixelPtr = (uint32_t *)pSrfce->pixels;
+    int nDTstride = GetDrawTargetStride();
+
+    auto plot = [=]( int x, int y ) -> void {
+        if (bInside || (x >= cx0 && x < cx1 && y >= cy0 && y < cy1))
+            ClampedDraw( x, y, encodedCol, pixelPtr, nDTstride );
+    };
 
     // this aux. lambda exploits the full potential of symmetry of a circle so that only
     // 1/8 of a circle points need to be calculated.
-    auto copy_circle_pixels = [=]( int xc, int yc, int x, int y, Pixel colour ) {
-        Draw( xc + x, yc + y, colour );
-        Draw( xc - x, yc + y, colour );
-        Draw( xc + x, yc - y, colour );
-        Draw( xc - x, yc - y, colour );
-        Draw( xc + y, yc + x, colour );
-        Draw( xc - y, yc + x, colour );
-        Draw( xc + y, yc - x, colour );
-        Draw( xc - y, yc - x, colour );
+    auto copy_circle_pixels = [=]( int xc, int yc, int x, int y ) {
+        plot( xc + x, yc + y );
+        plot( xc - x, yc + y );
+        plot( xc + x, yc - y );
+        plot( xc - x, yc - y );
+        plot( xc + y, yc + x );
+        plot( xc - y, yc + x );
+        plot( xc + y, yc - x );
+        plot( xc - y, yc - x );
     };
 
-    int pk, x, y;
-    pk = 3 - 2 * r;
-    x = 0;
-    y = r;
-    copy_circle_pixels( xc, yc, x, y, colour );
+    // the algorithm takes the steps x = 0 .. nLast, where nLast is the first step with x >= y
+    int nLast = std::max( 0, int( r / M_SQRT2 ) - 2 );
+    while (nLast < circle_step_y( r, nLast ))
+        nLast++;
+
+    // Each pixel of step x has xc +/- x as it's x coordinate, or yc +/- x as it's y coordinate. So only the steps for which
+    // one of these is within the clip bounds can have visible pixels - these are at most 4 ranges of steps.
+    std::pair<long long, long long> vRanges[4] = {
+        { (long long)cx0 - xc,      (long long)cx1 - 1 - xc },
+        { (long long)xc - cx1 + 1,  (long long)xc - cx0     },
+        { (long long)cy0 - yc,      (long long)cy1 - 1 - yc },
+        { (long long)yc - cy1 + 1,  (long long)yc - cy0     }
+    };
+    int nRanges = 4;
+    if (bInside) {
+        vRanges[0] = { 0, nLast };
+        nRanges = 1;
+    }
+    std::sort( vRanges, vRanges + nRanges );
 
-    while (x < y) {
-        if (pk <= 0) {
-            pk = pk + (4 * x) + 6;
-            copy_circle_pixels( xc, yc, ++x, y, colour );
-        } else {
-            pk = pk + (4 * (x - y)) + 10;
-            copy_circle_pixels(xc, yc, ++x, --y, colour );
+    SDL_LockSurface( pSrfce );
+    long long nNext = 0;    // first step that is not visited yet
+    for (int i = 0; i < nRanges; i++) {
+        int x0 = int( std::max( vRanges[i].first, nNext ));
+        int x1 = int( std::min( vRanges[i].second, (long long)nLast ));
+        if (x0 > x1)
+            continue;
+        nNext = (long long)x1 + 1;
+
+        // the state of the algorithm at step x0: pk = F( x + 1, y ) + F( x + 1, y - 1 )
+        int x = x0;
+        int y = circle_step_y( r, x );
+        unsigned long long t = 2 * ((unsigned long long)r * r - (unsigned long long)(x + 1) * (x + 1));
+        long long pk = (long long)(2 * (unsigned long long)y * y - 2 * (unsigned long long)y + 1 - t);
+        copy_circle_pixels( xc, yc, x, y );
+
+        while (x < x1) {
+            if (pk <= 0) {
+                pk = pk + (4 * (long long)x) + 6;
+                copy_circle_pixels( xc, yc, ++x, y );
+            } else {
+                pk = pk + (4 * ((long long)x - y)) + 10;
+                copy_circle_pixels( xc, yc, ++x, --y );
+            }
         }
     }
+    SDL_UnlockSurface( pSrfce );
 }
 
 // Function for circle-generation, using Bresenham's algorithm
-void flc::SDL_GameEngine::FillCircle( int xc, int yc, int r, Pixel colour ) {
+void flc::DrawContext::FillCircle( int xc, int yc, int r, Pixel colour ) {
 
-    auto plot_horizontal_line = [=]( int x0, int x1, int y, Pixel colour ) -> void {
-        if (x0 > x1)
-            std::swap( x0, x1 );
-        for (int x = x0; x <= x1; x++)
-            Draw( x, y, colour );
+    // reject the circle at once if it's bounding box is outside the drawable area. The spans are clipped by DrawSpan()
+    int cx0, cy0, cx1, cy1;
+    if (!GetClipBounds( cx0, cy0, cx1, cy1 ) ||
+        xc + r < cx0 || xc - r >= cx1 || yc + r < cy0 || yc - r >= cy1)
+        return;
+
+    uint32_t encodedCol = colour.Encode();
+    auto plot_horizontal_line = [=]( int x0, int x1, int y ) -> void {
+        DrawSpan( x0, x1, y, encodedCol );
     };
 
     int pk, x, y;
@@ -506,16 +1004,16 @@ void flc::SDL_GameEngine::FillCircle( int xc, int yc, int r, Pixel colour ) {
     y = r;
 
     while (x <= y) {
-        plot_horizontal_line( xc - y, xc + y, yc - x, colour );
+        plot_horizontal_line( xc - y, xc + y, yc - x );
         if (x > 0)
-            plot_horizontal_line( xc - y, xc + y, yc + x, colour );
+            plot_horizontal_line( xc - y, xc + y, yc + x );
         if (pk < 0) {
             pk = pk + (4 * x) + 6;
             x++;
         } else {
             if (x != y) {
-                plot_horizontal_line( xc - x, xc + x, yc - y, colour );
-                plot_horizontal_line( xc - x, xc + x, yc + y, colour );
+                plot_horizontal_line( xc - x, xc + x, yc - y );
+                plot_horizontal_line( xc - x, xc + x, yc + y );
             }
             pk = pk + (4 * (x - y)) + 10;
             x++;
@@ -527,27 +1025,39 @@ void flc::SDL_GameEngine::FillCircle( int xc, int yc, int r, Pixel colour ) {
 // text drawing stuff =====
 
 // Draws a string at specified location, in specified colour and scale
-void flc::SDL_GameEngine::DrawString( int x, int y, const std::string &sText, Pixel nColour, int nScale ) {
-    cFont.DrawString( pEngineDrawTarget->GetSurfacePtr(), x, y, sText, nColour, nScale );
+// NOTE - the text is blitted by SDL, which clips against the clip rect of the surface. So the engine's clip rect
+//        is put on the draw target surface for the duration of the call.
+void flc::DrawContext::DrawString( int x, int y, const std::string &sText, Pixel nColour, int nScale ) {
+    if (pDrawTarget == nullptr)
+        return;
+    if (pFont == nullptr) {
+        std::cout << "WARNING: DrawString() --> no font set for this draw context" << std::endl;
+        return;
+    }
+    if (m_bClipRectSet) SDL_SetClipRect( pDrawTarget->GetSurfacePtr(), &m_ClipRect );
+    pFont->DrawString( pDrawTarget->GetSurfacePtr(), x, y, sText, nColour, nScale );
+    if (m_bClipRectSet) SDL_SetClipRect( pDrawTarget->GetSurfacePtr(), nullptr );
 }
 
 // like DrawString() but with variable (horizontal) character spacing
-void flc::SDL_GameEngine::DrawStringProp( int x, int y, const std::string &sText, Pixel nColour, int nScale ) {
-    cFont.DrawStringProp( pEngineDrawTarget->GetSurfacePtr(), x, y, sText, nColour, nScale );
-}
-
-// Select one of the available fonts
-// NOTE: error checking is done by the FontSprite object.
-void flc::SDL_GameEngine::SetFont( int nFontIndex ) {
-    cFont.SetFont( nFontIndex );
+void flc::DrawContext::DrawStringProp( int x, int y, const std::string &sText, Pixel nColour, int nScale ) {
+    if (pDrawTarget == nullptr)
+        return;
+    if (pFont == nullptr) {
+        std::cout << "WARNING: DrawStringProp() --> no font set for this draw context" << std::endl;
+        return;
+    }
+    if (m_bClipRectSet) SDL_SetClipRect( pDrawTarget->GetSurfacePtr(), &m_ClipRect );
+    pFont->DrawStringProp( pDrawTarget->GetSurfacePtr(), x, y, sText, nColour, nScale );
+    if (m_bClipRectSet) SDL_SetClipRect( pDrawTarget->GetSurfacePtr(), nullptr );
 }
 
 // Sprite drawing stuff =====
 
 // inspired by Lazy Foo, thanks!
 uint32_t get_pixel32( SDL_Surface *surface, int x, int y ) {
-    uint32_t *pixelPtr = (uint32_t *)surface->pixels;
-    return pixelPtr[ (y * surface->w) + x ];
+    uint32_t *rowPtr = (uint32_t *)((uint8_t *)surface->pixels + y * surface->pitch);
+    return rowPtr[x];
 }
 
 // these four auxiliary lambda's are used in DrawSprite(). Using this construction I can set a function pointer to the right
@@ -560,9 +1070,11 @@ auto p_getter1_both = []( SDL_Surface *pSrfc, int x, int y ) { return get_pixel3
 // Draws an entire sprite at location (x, y) - the scale must be integer > 0.
 // I work with a function pointer to select the right 'pixel getter' depending on the value of the flip argument. This prevents
 // either having to do the same check for all pixels, or copying a lot of code.
-void flc::SDL_GameEngine::DrawSprite( int x, int y, Sprite* sprite, int scale, Sprite::Flip flip ) {
+void flc::DrawContext::DrawSprite( int x, int y, Sprite* sprite, int scale, Sprite::Flip flip ) {
 
-    if (scale >= 1) {
+    if (scale == 1 && flip == Sprite::NONE && UseRLE( sprite )) {
+        DrawSpriteRLE( x, y, sprite, 0, 0, sprite->width, sprite->height );
+    } else if (scale >= 1) {
         // select the correct pixel getting function from the flip mode
         uint32_t (*pixel_getter)( SDL_Surface *, int, int ) = nullptr;
         switch (flip) {
@@ -575,20 +1087,30 @@ void flc::SDL_GameEngine::DrawSprite( int x, int y, Sprite* sprite, int scale, S
         // grab a pointer to the sprite's SDL_Surface object
         SDL_Surface *pSrfce = sprite->GetSurfacePtr();
 
+        // clip the destination rectangle once against the drawable area, and only iterate the visible part of it
+        int cx0, cy0, cx1, cy1;
+        if (!GetClipBounds( cx0, cy0, cx1, cy1 ))
+            return;
+        int dx0 = std::max( x, cx0 ), dx1 = std::min( x + sprite->width  * scale, cx1 );
+        int dy0 = std::max( y, cy0 ), dy1 = std::min( y + sprite->height * scale, cy1 );
+        if (dx0 >= dx1 || dy0 >= dy1)
+            return;
+
+        SDL_Surface *pDstSrfce = pDrawTarget->GetSurfacePtr();
+        uint32_t *pixelPtr = (uint32_t *)pDstSrfce->pixels;
+        int nDTstride = GetDrawTargetStride();
+        SDL_LockSurface( pDstSrfce );
         // I decided to replace the call to SDL_BlitScaled with my own code, so that I could implement flipping
-        // xs and ys iterate over the source rectangle
-        for (int ys = 0; ys < sprite->height; ys++) {
-            for (int xs = 0; xs < sprite->width; xs++) {
+        // xd and yd iterate over the (clipped) destination rectangle, xs and ys are the corresponding source coordinates
+        for (int yd = dy0; yd < dy1; yd++) {
+            int ys = (yd - y) / scale;
+            for (int xd = dx0; xd < dx1; xd++) {
+                int xs = (xd - x) / scale;
                 // get the correct pixel using the right pixel_getter function
-                uint32_t tmp_pixel = pixel_getter( pSrfce, xs, ys );
-                // scale in integer numbers if so required
-                for (int y_scale = 0; y_scale < scale; y_scale++) {
-                    for (int x_scale = 0; x_scale < scale; x_scale++) {
-                        Draw( x + (xs * scale) + x_scale, y + (ys * scale) + y_scale, tmp_pixel );
-                    }
-                }
+                ClampedDraw( xd, yd, pixel_getter( pSrfce, xs, ys ), pixelPtr, nDTstride );
             }
         }
+        SDL_UnlockSurface( pDstSrfce );
     }
 }
 
@@ -603,9 +1125,11 @@ auto p_getter2_both = []( SDL_Surface *pSrfc, int _ox, int _oy, int _w, int _h,
 // sprite is (ox, oy) to (ox + w, oy + h). The scale must be integer > 0.
 // I work with a function pointer to select the right 'pixel getter' depending on the value of the flip argument. This prevents
 // either having to do the same check for all pixels, or copying a lot of code.
-void flc::SDL_GameEngine::DrawPartialSprite( int x, int y, Sprite* sprite, int ox, int oy, int w, int h, int scale, Sprite::Flip flip ) {
+void flc::DrawContext::DrawPartialSprite( int x, int y, Sprite* sprite, int ox, int oy, int w, int h, int scale, Sprite::Flip flip ) {
 
-    if (scale >= 1) {
+    if (scale == 1 && flip == Sprite::NONE && UseRLE( sprite )) {
+        DrawSpriteRLE( x, y, sprite, ox, oy, w, h );
+    } else if (scale >= 1) {
         // select the correct pixel getting function from the flip mode
         uint32_t (*pixel_getter)( SDL_Surface *, int, int, int, int, int, int ) = nullptr;
         switch (flip) {
@@ -618,25 +1142,325 @@ void flc::SDL_GameEngine::DrawPartialSprite( int x, int y, Sprite* sprite, int o
         // grab a pointer to the sprite's SDL_Surface object
         SDL_Surface *pSrfce = sprite->GetSurfacePtr();
 
+        // clip the destination rectangle once against the drawable area, and only iterate the visible part of it
+        int cx0, cy0, cx1, cy1;
+        if (!GetClipBounds( cx0, cy0, cx1, cy1 ))
+            return;
+        int dx0 = std::max( x, cx0 ), dx1 = std::min( x + w * scale, cx1 );
+        int dy0 = std::max( y, cy0 ), dy1 = std::min( y + h * scale, cy1 );
+        if (dx0 >= dx1 || dy0 >= dy1)
+            return;
+
+        SDL_Surface *pDstSrfce = pDrawTarget->GetSurfacePtr();
+        uint32_t *pixelPtr = (uint32_t *)pDstSrfce->pixels;
+        int nDTstride = GetDrawTargetStride();
+        SDL_LockSurface( pDstSrfce );
         // I decided to replace the call to SDL_BlitScaled with my own code, so that I could implement flipping
-        // xs and ys iterate over the source rectangle
-        for (int ys = 0; ys < h; ys++) {
-            for (int xs = 0; xs < w; xs++) {
+        // xd and yd iterate over the (clipped) destination rectangle, xs and ys are the corresponding source coordinates
+        for (int yd = dy0; yd < dy1; yd++) {
+            int ys = (yd - y) / scale;
+            for (int xd = dx0; xd < dx1; xd++) {
+                int xs = (xd - x) / scale;
                 // get the correct pixel using the right pixel_getter function
-                uint32_t tmp_pixel = pixel_getter( pSrfce, ox, oy, w, h, xs, ys );
-                // scale in integer numbers if so required
-                for (int y_scale = 0; y_scale < scale; y_scale++) {
-                    for (int x_scale = 0; x_scale < scale; x_scale++) {
-                        Draw( x + (xs * scale) + x_scale, y + (ys * scale) + y_scale, tmp_pixel );
-                    }
-                }
+                ClampedDraw( xd, yd, pixel_getter( pSrfce, ox, oy, w, h, xs, ys ), pixelPtr, nDTstride );
+            }
+        }
+        SDL_UnlockSurface( pDstSrfce );
+    }
+}
+
+// internal method - returns true if sprite must be drawn using it's run length encoded representation. This only pays off
+// in the modes where transparent pixels are not drawn.
+bool flc::DrawContext::UseRLE( Sprite *sprite ) {
+    return sprite->IsRLEEnabled() &&
+        (m_PixelMode == flc::Pixel::MASK || m_PixelMode == flc::Pixel::ALPHA || m_PixelMode == flc::Pixel::APROP);
+}
+
+// internal method - draws the area (ox, oy) to (ox + w, oy + h) of sprite at location (x, y) using it's run length
+// encoded representation. Transparent runs are skipped, opaque runs are copied as a whole and only partially transparent
+// runs are blended (in MASK mode these are skipped as well).
+void flc::DrawContext::DrawSpriteRLE( int x, int y, Sprite* sprite, int ox, int oy, int w, int h ) {
+
+    // the reference keeps the runs alive while drawing, even if another thread invalidates them meanwhile
+    std::shared_ptr<SpriteRLE> pRLE = sprite->GetRLE();
+    if (pRLE == nullptr)
+        return;
+    // make sure the source area is within the sprite
+    if (ox < 0) { x -= ox; w += ox; ox = 0; }
+    if (oy < 0) { y -= oy; h += oy; oy = 0; }
+    w = std::min( w, sprite->width  - ox );
+    h = std::min( h, sprite->height - oy );
+    // clip the destination rectangle once against the drawable area
+    int cx0, cy0, cx1, cy1;
+    if (w <= 0 || h <= 0 || !GetClipBounds( cx0, cy0, cx1, cy1 ))
+        return;
+    int dx0 = std::max( x, cx0 ), dx1 = std::min( x + w, cx1 );
+    int dy0 = std::max( y, cy0 ), dy1 = std::min( y + h, cy1 );
+    if (dx0 >= dx1 || dy0 >= dy1)
+        return;
+    // the visible source columns [sx0, sx1)
+    int sx0 = ox + dx0 - x;
+    int sx1 = ox + dx1 - x;
+
+    bool bMask        = (m_PixelMode == flc::Pixel::MASK);
+    bool bCopyOpaque  = bMask || m_BlendFactor >= 1.0f;
+
+    SDL_Surface *pSrcSrfce = sprite->GetSurfacePtr();
+    SDL_Surface *pDstSrfce = pDrawTarget->GetSurfacePtr();
+    uint32_t *pSrcPixels = (uint32_t *)pSrcSrfce->pixels;
+    uint32_t *pDstPixels = (uint32_t *)pDstSrfce->pixels;
+    int nSrcPitch = pSrcSrfce->pitch / 4;
+    int nDTstride = GetDrawTargetStride();
+
+    SDL_LockSurface( pDstSrfce );
+    for (int yd = dy0; yd < dy1; yd++) {
+        int sy = oy + yd - y;
+        const uint32_t *pSrcRow = pSrcPixels + sy * nSrcPitch;
+        // pointer to the destination pixel that corresponds with source column 0
+        uint32_t *pDstRow = pDstPixels + yd * nDTstride + (x - ox);
+
+        for (int i = pRLE->vRowIx[sy]; i < pRLE->vRowIx[sy + 1]; i++) {
+            const SpriteRLE::Run &run = pRLE->vRuns[i];
+            if (run.x >= sx1)
+                break;
+            int rs = std::max( run.x, sx0 );
+            int re = std::min( run.x + run.len, sx1 );
+            if (rs >= re)
+                continue;
+            if (run.bOpaque && bCopyOpaque) {
+                glb_Kernels.copy( pDstRow + rs, pSrcRow + rs, re - rs );
+            } else if (!bMask) {
+                glb_Kernels.blend( pDstRow + rs, pSrcRow + rs, 1, re - rs, m_BlendFactor );
+            }
+        }
+    }
+    SDL_UnlockSurface( pDstSrfce );
+}
+
+// auxiliary function - linear interpolation between two packed pixels, per 8 bit channel, with weight f in [0, 256] for c1.
+// Two channels are processed at once using 0x00FF00FF masks, so this works regardless of the channel order.
+static inline uint32_t lerp_packed( uint32_t c0, uint32_t c1, uint32_t f ) {
+    uint32_t rb = (((c0 & 0x00FF00FF) * (256 - f) + (c1 & 0x00FF00FF) * f) >> 8) & 0x00FF00FF;
+    uint32_t ag = (((c0 >> 8) & 0x00FF00FF) * (256 - f) + ((c1 >> 8) & 0x00FF00FF) * f) & 0xFF00FF00;
+    return rb | ag;
+}
+
+// Draws an entire sprite at location (x, y) with a non integer scale
+void flc::DrawContext::DrawSprite( int x, int y, Sprite* sprite, float scale, Sprite::Filter filter, Sprite::Flip flip ) {
+    DrawPartialSprite( x, y, sprite, 0, 0, sprite->width, sprite->height, scale, filter, flip );
+}
+
+// Draws the area (ox, oy) to (ox + w, oy + h) of a sprite at location (x, y) with a non integer scale.
+// The source coordinates are stepped with a 16.16 fixed point DDA. Since the mapping of destination columns onto source
+// columns is the same for each row, it is calculated only once (for the clipped destination width) and stored in tables.
+// Each destination row is then sampled into a row buffer, which is written to the draw target in one go.
+void flc::DrawContext::DrawPartialSprite( int x, int y, Sprite* sprite, int ox, int oy, int w, int h, float scale, Sprite::Filter filter, Sprite::Flip flip ) {
+
+    if (scale <= 0.0f || w <= 0 || h <= 0) {
+        if (scale <= 0.0f) std::cout << "WARNING: DrawPartialSprite() --> scale must be > 0.0f: " << scale << std::endl;
+        return;
+    }
+    // size of the destination rectangle
+    int dw = int( float( w ) * scale );
+    int dh = int( float( h ) * scale );
+    if (dw <= 0 || dh <= 0)
+        return;
+    // clip the destination rectangle once against the drawable area
+    int cx0, cy0, cx1, cy1;
+    if (!GetClipBounds( cx0, cy0, cx1, cy1 ))
+        return;
+    int dx0 = std::max( x, cx0 ), dx1 = std::min( x + dw, cx1 );
+    int dy0 = std::max( y, cy0 ), dy1 = std::min( y + dh, cy1 );
+    if (dx0 >= dx1 || dy0 >= dy1)
+        return;
+
+    bool bFlipX = (flip == Sprite::HORIZ || flip == Sprite::BOTH);
+    bool bFlipY = (flip == Sprite::VERT  || flip == Sprite::BOTH);
+    bool bBilinear = (filter == Sprite::BILINEAR);
+
+    // source step per destination pixel in 16.16 fixed point. The sample point for destination pixel i is the center of
+    // that pixel mapped back to the source: (i + 0.5) * step. For bilinear sampling it is shifted half a pixel, so that
+    // the weights are relative to the source pixel centers.
+    int64_t stepX = (int64_t( w ) << 16) / dw;
+    int64_t stepY = (int64_t( h ) << 16) / dh;
+    int64_t nBias = bBilinear ? (1 << 15) : 0;
+
+    // lambda to map a destination index onto 2 source indices and a weight (in [0, 256]) for the second one
+    auto map_coord = [=]( int i, int64_t step, int nSize, bool bFlip, int &s0, int &s1, uint32_t &f ) {
+        int64_t u = int64_t( i ) * step + (step >> 1) - nBias;
+        if (u < 0) u = 0;
+        s0 = int( u >> 16 );
+        f  = bBilinear ? uint32_t( (u >> 8) & 0xFF ) : 0;
+        if (s0 >= nSize - 1) {
+            s0 = nSize - 1;
+            f  = 0;
+        }
+        s1 = std::min( s0 + 1, nSize - 1 );
+        if (bFlip) {
+            s0 = nSize - 1 - s0;
+            s1 = nSize - 1 - s1;
+        }
+    };
+
+    // build the column tables for the clipped destination width
+    int nCols = dx1 - dx0;
+    std::vector<int>      vCol0( nCols ), vCol1( nCols );
+    std::vector<uint32_t> vColF( nCols );
+    for (int i = 0; i < nCols; i++) {
+        map_coord( dx0 - x + i, stepX, w, bFlipX, vCol0[i], vCol1[i], vColF[i] );
+        vCol0[i] += ox;
+        vCol1[i] += ox;
+    }
+    std::vector<uint32_t> vRowBuf( nCols );
+
+    SDL_Surface *pSrcSrfce = sprite->GetSurfacePtr();
+    SDL_Surface *pDstSrfce = pDrawTarget->GetSurfacePtr();
+    uint32_t *pSrcPixels = (uint32_t *)pSrcSrfce->pixels;
+    uint32_t *pDstPixels = (uint32_t *)pDstSrfce->pixels;
+    int nSrcPitch = pSrcSrfce->pitch / 4;
+    int nDTstride = GetDrawTargetStride();
+
+    SDL_LockSurface( pDstSrfce );
+    for (int yd = dy0; yd < dy1; yd++) {
+        int sy0, sy1;
+        uint32_t fy;
+        map_coord( yd - y, stepY, h, bFlipY, sy0, sy1, fy );
+        const uint32_t *pRow0 = pSrcPixels + (oy + sy0) * nSrcPitch;
+        const uint32_t *pRow1 = pSrcPixels + (oy + sy1) * nSrcPitch;
+        uint32_t *pBuf = vRowBuf.data();
+
+        // sample the source into the row buffer - these loops have no dependencies between iterations
+        if (bBilinear) {
+            for (int i = 0; i < nCols; i++) {
+                uint32_t top = lerp_packed( pRow0[ vCol0[i] ], pRow0[ vCol1[i] ], vColF[i] );
+                uint32_t bot = lerp_packed( pRow1[ vCol0[i] ], pRow1[ vCol1[i] ], vColF[i] );
+                pBuf[i] = lerp_packed( top, bot, fy );
             }
+        } else {
+            glb_Kernels.scale( pBuf, pRow0, vCol0.data(), nCols );
+        }
+        // write the row buffer to the draw target
+        if (m_PixelMode == flc::Pixel::NORMAL) {
+            glb_Kernels.copy( pDstPixels + yd * nDTstride + dx0, pBuf, nCols );
+        } else if (m_PixelMode == flc::Pixel::ALPHA || m_PixelMode == flc::Pixel::APROP) {
+            glb_Kernels.blend( pDstPixels + yd * nDTstride + dx0, pBuf, 1, nCols, m_BlendFactor );
+        } else {
+            for (int i = 0; i < nCols; i++)
+                ClampedDraw( dx0 + i, yd, pBuf[i], pDstPixels, nDTstride );
         }
     }
+    SDL_UnlockSurface( pDstSrfce );
+}
+
+// Pixel mode & alpha blending stuff =====
+
+void flc::DrawContext::SetPixelMode( Pixel::Mode mode ) {
+    m_PixelMode = mode;
+//    SDL_SetSurfaceBlendMode( pDrawTarget->GetSurface(), TranslateBlendMode( m_PixelMode ));
+}
+
+// set your own custom blending function - NOTE this will set the PixelMode to CUSTOM
+void flc::DrawContext::SetPixelMode( std::function<flc::Pixel( const int x, const int y, const flc::Pixel& pSource, const flc::Pixel& pDest)> blendFunc ) {
+    m_PixelMode = flc::Pixel::CUSTOM;
+//    SDL_SetSurfaceBlendMode( pDrawTarget->GetSurface(), TranslateBlendMode( m_PixelMode ));
+    m_BlendFunc = blendFunc;
+}
+
+flc::Pixel::Mode flc::DrawContext::GetPixelMode() {
+    return m_PixelMode;
+}
+
+// set a new blend factor for the screen / draw target - fBlend must be in [ 0.0f, 1.0f ]
+// NOT COMPLETE - this works for Sprites (SDL_Surfaces) that are drawn with the DrawClamped() function,
+//                but is IS NOT IMPLEMENTED YET for Decals (SDL_Textures). However it could be that the
+//                textures copy the surface attributes when created from them... ???
+void flc::DrawContext::SetPixelBlend( float fBlend ) {
+    m_BlendFactor = fBlend;
+}
+
+// return the blend factor, this should be in [ 0.0f, 1.0f ]
+float flc::DrawContext::GetPixelBlend() {
+    return m_BlendFactor;
+}
+
+// ==============================/ Class SDL_GameEngine /==============================
+
+//                               +----------+                                //
+// ------------------------------+ METHODS  +------------------------------- //
+//                               +----------+                                //
+
+// screen stuff - size queries =====
+
+// returns the dimensions of the current active window
+int flc::SDL_GameEngine::ScreenWidth() {  return vWindows[nActiveWindowIx]->GetWidth();  }
+int flc::SDL_GameEngine::ScreenHeight() { return vWindows[nActiveWindowIx]->GetHeight(); }
+
+// font selection =====
+
+// Select one of the available fonts
+// NOTE: error checking is done by the FontSprite object.
+void flc::SDL_GameEngine::SetFont( int nFontIndex ) {
+    cFont.SetFont( nFontIndex );
 }
 
 // Decal drawing stuff =====
 
+// internal method - adds the decal frame to the decal list of the current layer. If a clip rect is set, it is stored
+// with the decal frame, so that the render cycle can apply it using SDL_RenderSetClipRect()
+void flc::SDL_GameEngine::AddDecalFrame( DecalFrame &dec ) {
+    dec.m_bClipped = m_DrawContext.IsClipRectSet();
+    if (dec.m_bClipped)
+        dec.m_rect_clip = m_DrawContext.GetClipRect();
+    vWindows[nActiveWindowIx]->vLayers[nEngineDrawTargetIx].vDecals.push_back( dec );
+}
+
+// Returns decal bucket nBucket. It's created if it doesn't exist yet - the lock is only needed for that, the bucket
+// itself is used without locking
+flc::DecalBucket *flc::SDL_GameEngine::GetDecalBucket( int nBucket ) {
+    if (nBucket < 0) {
+        std::cout << "ERROR: GetDecalBucket() --> negative bucket index: " << nBucket << std::endl;
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock( mtxDecalBuckets );
+    while ((int)vDecalBuckets.size() <= nBucket) {
+        vDecalBuckets.push_back( new DecalBucket );
+    }
+    return vDecalBuckets[nBucket];
+}
+
+// internal method - the entries of all buckets are gathered in bucket order and sorted on window, layer and sort key.
+// The sort is stable, so entries with the same key keep the bucket order and the order of submission
+void flc::SDL_GameEngine::MergeDecalBuckets() {
+    std::lock_guard<std::mutex> lock( mtxDecalBuckets );
+
+    std::vector<const DecalBucket::Entry *> vMerged;
+    for (auto &b : vDecalBuckets) {
+        for (auto &e : b->GetEntries()) {
+            vMerged.push_back( &e );
+        }
+    }
+    if (vMerged.empty())
+        return;
+
+    std::stable_sort( vMerged.begin(), vMerged.end(), []( const DecalBucket::Entry *a, const DecalBucket::Entry *b ) {
+        if (a->nWindow != b->nWindow) return a->nWindow < b->nWindow;
+        if (a->nLayer  != b->nLayer ) return a->nLayer  < b->nLayer;
+        return a->nSortKey < b->nSortKey;
+    });
+
+    for (auto &e : vMerged) {
+        if (e->nWindow < 0 || e->nWindow >= (int)vWindows.size() ||
+            e->nLayer  < 0 || e->nLayer  >= (int)vWindows[e->nWindow]->vLayers.size()) {
+            std::cout << "WARNING: MergeDecalBuckets() --> decal dropped, no such window/layer: " << e->nWindow << "/" << e->nLayer << std::endl;
+            continue;
+        }
+        vWindows[e->nWindow]->vLayers[e->nLayer].vDecals.push_back( e->frame );
+    }
+    for (auto &b : vDecalBuckets) {
+        b->Clear();
+    }
+}
+
 // Draws a whole decal, with optional scale and tinting
 void flc::SDL_GameEngine::DrawDecal( const flc::vf2d &pos, flc::Decal *decal, const flc::vf2d &scale, const flc::Pixel &tint ) {
     DecalFrame dec;
@@ -644,7 +1468,7 @@ void flc::SDL_GameEngine::DrawDecal( const flc::vf2d &pos, flc::Decal *decal, co
     dec.m_tint  = tint;
 
     // draw the whole decal - this could be a nullptr
-    InitSDL_Rect( dec.m_rect_src,  0, 0, decal->m_sprite->width, decal->m_sprite->height );
+    InitSDL_Rect( dec.m_rect_src, decal->m_origin.x, decal->m_origin.y, decal->m_sprite->width, decal->m_sprite->height );
     // destination rect (x, y) is screen position of upper left corner of decal
     InitSDL_Rect( dec.m_rect_dst, int( pos.x ), int( pos.y ),
                                   int( (float)dec.m_rect_src.w * scale.x ), int( (float)dec.m_rect_src.h * scale.y ));
@@ -652,7 +1476,7 @@ void flc::SDL_GameEngine::DrawDecal( const flc::vf2d &pos, flc::Decal *decal, co
     dec.m_angle_degrees = 0;
     InitSDL_Point( dec.m_point_rot, 0, 0 );
 
-    vWindows[nActiveWindowIx]->vLayers[nEngineDrawTargetIx].vDecals.push_back( dec );
+    AddDecalFrame( dec );
 }
 
 // Draws a region of a decal, with optional scale and tinting
@@ -669,8 +1493,8 @@ void flc::SDL_GameEngine::DrawPartialDecal(
     dec.m_tint  = tint;
 
     // draw the part of the decal that is specified by source_pos and source_size
-    InitSDL_Rect(  dec.m_rect_src, int( source_pos.x  ),
-                                   int( source_pos.y  ),
+    InitSDL_Rect(  dec.m_rect_src, int( source_pos.x  ) + decal->m_origin.x,
+                                   int( source_pos.y  ) + decal->m_origin.y,
                                    int( source_size.x ),
                                    int( source_size.y ));
     // destination rect (x, y) is screen position of upper left corner of decal
@@ -680,7 +1504,7 @@ void flc::SDL_GameEngine::DrawPartialDecal(
     dec.m_angle_degrees = 0;
     InitSDL_Point( dec.m_point_rot, 0, 0 );
 
-    vWindows[nActiveWindowIx]->vLayers[nEngineDrawTargetIx].vDecals.push_back( dec );
+    AddDecalFrame( dec );
 }
 
 // Draws a region of a decal, with optional scale and tinting - the scaling is specified as a size parameter
@@ -697,8 +1521,8 @@ void flc::SDL_GameEngine::DrawPartialDecal(
     dec.m_tint  = tint;
 
     // draw the part of the decal that is specified by source_pos and source_size
-    InitSDL_Rect(  dec.m_rect_src, int( source_pos.x  ),
-                                   int( source_pos.y  ),
+    InitSDL_Rect(  dec.m_rect_src, int( source_pos.x  ) + decal->m_origin.x,
+                                   int( source_pos.y  ) + decal->m_origin.y,
                                    int( source_size.x ),
                                    int( source_size.y ));
     // destination rect (x, y) is screen position of upper left corner of decal
@@ -708,7 +1532,7 @@ void flc::SDL_GameEngine::DrawPartialDecal(
     dec.m_angle_degrees = 0;
     InitSDL_Point( dec.m_point_rot, 0, 0 );
 
-    vWindows[nActiveWindowIx]->vLayers[nEngineDrawTargetIx].vDecals.push_back( dec );
+    AddDecalFrame( dec );
 }
 
 // Draws a decal rotated to specified angle, with point of rotation offset
@@ -725,7 +1549,7 @@ void flc::SDL_GameEngine::DrawRotatedDecal(
     dec.m_tint  = tint;
 
     // draw the whole decal - this could be a nullptr
-    InitSDL_Rect(  dec.m_rect_src, 0, 0, decal->m_sprite->width, decal->m_sprite->height );
+    InitSDL_Rect(  dec.m_rect_src, decal->m_origin.x, decal->m_origin.y, decal->m_sprite->width, decal->m_sprite->height );
     // destination rect (x, y) is screen position of upper left corner of decal
     InitSDL_Rect(  dec.m_rect_dst, int( pos.x - center.x * scale.x ), int( pos.y - center.y * scale.y ),
                                    int( (float)dec.m_rect_src.w * scale.x ), int( (float)dec.m_rect_src.h * scale.y ));
@@ -733,7 +1557,7 @@ void flc::SDL_GameEngine::DrawRotatedDecal(
     InitSDL_Point( dec.m_point_rot, int( center.x * scale.x ), int( center.y * scale.y ));
     dec.m_angle_degrees = double( fAngle ) * 360.0 / (2.0 * M_PI);
 
-    vWindows[nActiveWindowIx]->vLayers[nEngineDrawTargetIx].vDecals.push_back( dec );
+    AddDecalFrame( dec );
 }
 
 void flc::SDL_GameEngine::DrawPartialRotatedDecal(
@@ -751,8 +1575,8 @@ void flc::SDL_GameEngine::DrawPartialRotatedDecal(
     dec.m_tint  = tint;
 
     // draw the part of the decal that is specified by source_pos and source_size
-    InitSDL_Rect(  dec.m_rect_src, int( source_pos.x ),
-                                   int( source_pos.y ),
+    InitSDL_Rect(  dec.m_rect_src, int( source_pos.x ) + decal->m_origin.x,
+                                   int( source_pos.y ) + decal->m_origin.y,
                                    int( source_size.x ),
                                    int( source_size.y ));
     // destination rect (x, y) is screen position of upper left corner of decal
@@ -763,49 +1587,68 @@ void flc::SDL_GameEngine::DrawPartialRotatedDecal(
                                     int( center.y * scale.y ));
     dec.m_angle_degrees = double( fAngle ) * 360.0 / (2.0 * M_PI);
 
-    vWindows[nActiveWindowIx]->vLayers[nEngineDrawTargetIx].vDecals.push_back( dec );
+    AddDecalFrame( dec );
 }
 
 // this is the decal version of DrawString()
 void flc::SDL_GameEngine::DrawStringDecal( const flc::vf2d &pos, const std::string &sText, Pixel nColour, const flc::vf2d &scale ) {
-
-    std::vector<std::pair<SDL_Rect, SDL_Rect>> decalDrawInfo;
-
-    // let the character font object work out the set of decals from this text
-    cFont.DrawStringDecal( pos.x, pos.y, sText, nColour, scale.x, scale.y, decalDrawInfo );
-
-    // set colour and alpha mode for this font texture
-    SDL_SetTextureColorMod( cFont.GetDecal()->m_decal, nColour.getR(), nColour.getG(), nColour.getB() );
-    SDL_SetTextureAlphaMod( cFont.GetDecal()->m_decal, nColour.getA() );
-
-    for (int i = 0; i < (int)decalDrawInfo.size(); i++) {
-        SDL_Rect src = decalDrawInfo[i].first;
-        SDL_Rect dst = decalDrawInfo[i].second;
-
-        DrawPartialDecal( vf2d( dst.x, dst.y ), cFont.GetDecal(), vf2d( src.x, src.y ), vf2d( src.w, src.h ), scale, nColour );
-    }
+    AddTextLayout( pos, cFont.GetTextLayout( sText, scale.x, scale.y, false ), nColour );
 }
 
 // this is the decal version of DrawStringProp()
 void flc::SDL_GameEngine::DrawStringPropDecal( const flc::vf2d &pos, const std::string &sText, Pixel nColour, const flc::vf2d &scale ) {
+    AddTextLayout( pos, cFont.GetTextLayout( sText, scale.x, scale.y, true ), nColour );
+}
 
-    std::vector<std::pair<SDL_Rect, SDL_Rect>> decalDrawInfo;
-
-    // let the character font object work out the set of decals from this text
-    cFont.DrawStringPropDecal( pos.x, pos.y, sText, nColour, scale.x, scale.y, decalDrawInfo );
-
-    // set colour mode for this font texture
-    SDL_SetTextureColorMod( cFont.GetDecal()->m_decal, nColour.getR(), nColour.getG(), nColour.getB() );
-    SDL_SetTextureAlphaMod( cFont.GetDecal()->m_decal, nColour.getA() );
-
-    for (int i = 0; i < (int)decalDrawInfo.size(); i++) {
-        SDL_Rect src = decalDrawInfo[i].first;
-        SDL_Rect dst = decalDrawInfo[i].second;
+// the decal of the text is offset from the text position, and this offset scales along with the decal
+void flc::SDL_GameEngine::DrawTextDecal( const flc::vf2d &pos, flc::TextDecal *pText, const flc::vf2d &scale, const flc::Pixel &tint ) {
+    flc::Decal *pDecal = pText->GetDecal();
+    if (pDecal == nullptr)
+        return;
+    flc::vi2d vOffset = pText->GetOffset();
+    DrawDecal( { pos.x + vOffset.x * scale.x, pos.y + vOffset.y * scale.y }, pDecal, scale, tint );
+}
 
-        DrawPartialDecal( vf2d( dst.x, dst.y ), cFont.GetDecal(), vf2d( src.x, src.y ), vf2d( src.w, src.h ), scale, nColour );
+// internal method - adds the decal frames for all characters of the (cached) text layout to the decal list of the current
+// layer in one go. Only the destination rects differ per character.
+void flc::SDL_GameEngine::AddTextLayout( const flc::vf2d &pos, const flc::TextLayout *pLayout, const flc::Pixel &tint ) {
+    DecalFrame dec;
+    dec.m_decal         = cFont.GetDecal()->m_decal;
+    dec.m_tint          = tint;
+    dec.m_angle_degrees = 0;
+    InitSDL_Point( dec.m_point_rot, 0, 0 );
+    dec.m_bClipped = m_DrawContext.IsClipRectSet();
+    if (dec.m_bClipped)
+        dec.m_rect_clip = m_DrawContext.GetClipRect();
+
+    std::vector<DecalFrame> &vDecals = vWindows[nActiveWindowIx]->vLayers[nEngineDrawTargetIx].vDecals;
+    vDecals.reserve( vDecals.size() + pLayout->vChars.size() );
+    int x = int( pos.x );
+    int y = int( pos.y );
+    for (auto &c : pLayout->vChars) {
+        dec.m_rect_src = c.src;
+        InitSDL_Rect( dec.m_rect_dst, int( x + c.fOffsetX ), y + c.nOffsetY, c.w, c.h );
+        vDecals.push_back( dec );
     }
 }
 
+// parallel per pixel operations =====
+
+// Divides the rows into bands and processes them on the thread pool. There are more bands than threads, so that the
+// load is balanced if some rows are more expensive than others (think of a Mandelbrot set).
+void flc::SDL_GameEngine::ParallelRows( int y0, int y1, const std::function<void( int, int )> &fnBand ) {
+    int nRows = y1 - y0;
+    if (nRows <= 0)
+        return;
+    flc::ThreadPool *pPool = GetThreadPool();
+    int nBands = std::min( nRows, (pPool->GetNrThreads() + 1) * 4 );
+    pPool->ParallelFor( nBands, [=, &fnBand]( int nBand ) {
+        int band_y0 = y0 + int( int64_t( nRows ) *  nBand      / nBands );
+        int band_y1 = y0 + int( int64_t( nRows ) * (nBand + 1) / nBands );
+        fnBand( band_y0, band_y1 );
+    } );
+}
+
 // Pixel mode & alpha blending stuff =====
 
 SDL_BlendMode flc::SDL_GameEngine::TranslateBlendMode( flc::Pixel::Mode blendMode ) {
@@ -821,35 +1664,6 @@ SDL_BlendMode flc::SDL_GameEngine::TranslateBlendMode( flc::Pixel::Mode blendMod
     return result;
 }
 
-void flc::SDL_GameEngine::SetPixelMode( Pixel::Mode mode ) {
-    m_PixelMode = mode;
-//    SDL_SetSurfaceBlendMode( pDrawTarget->GetSurface(), TranslateBlendMode( m_PixelMode ));
-}
-
-// set your own custom blending function - NOTE this will set the PixelMode to CUSTOM
-void flc::SDL_GameEngine::SetPixelMode( std::function<flc::Pixel( const int x, const int y, const flc::Pixel& pSource, const flc::Pixel& pDest)> blendFunc ) {
-    m_PixelMode = flc::Pixel::CUSTOM;
-//    SDL_SetSurfaceBlendMode( pDrawTarget->GetSurface(), TranslateBlendMode( m_PixelMode ));
-    m_BlendFunc = blendFunc;
-}
-
-flc::Pixel::Mode flc::SDL_GameEngine::GetPixelMode() {
-    return m_PixelMode;
-}
-
-// set a new blend factor for the screen / draw target - fBlend must be in [ 0.0f, 1.0f ]
-// NOT COMPLETE - this works for Sprites (SDL_Surfaces) that are drawn with the DrawClamped() function,
-//                but is IS NOT IMPLEMENTED YET for Decals (SDL_Textures). However it could be that the
-//                textures copy the surface attributes when created from them... ???
-void flc::SDL_GameEngine::SetPixelBlend( float fBlend ) {
-    m_BlendFactor = fBlend;
-}
-
-// return the blend factor, this should be in [ 0.0f, 1.0f ]
-float flc::SDL_GameEngine::GetPixelBlend() {
-    return m_BlendFactor;
-}
-
 //                                                                           //
 // ------------------------------------------------------------------------- //
 //                                                                           //
@@ -31,12 +31,158 @@
  * declared from 1 header file, so that the user only has to include 1 file (and all the other SGE code files
  * are included from that file).
  *
- * That is also the reason that this header file is empty: because all declarations of primitive functions are
- * put in the SGE_Core header file.
+ * The software primitives are implemented by class DrawContext. A draw context holds all the state that drawing
+ * depends upon: the draw target, the pixel mode and blend settings, the clip rect and the font. The engine has a
+ * default draw context, and it's primitives (declared in the SGE_Core header file) simply delegate to it.
+ *
+ * Since a draw context doesn't share any state with the engine, you can create your own contexts to draw into
+ * sprites from worker threads, while the main thread keeps on drawing via the engine. For instance:
+ *
+ *     flc::DrawContext dc( pTileSprite, GetFont() );    // or copy GetDrawContext() to inherit it's settings
+ *     GetThreadPool()->Enqueue( [=]() mutable {
+ *         dc.Clear( flc::DARK_GREEN );
+ *         dc.DrawString( 2, 2, "tile", flc::WHITE );
+ *     } );
+ *
+ * Rules to keep it thread safe:
+ *   - each thread must use it's own draw context, and no two threads may draw into the same sprite;
+ *   - sprites that are used as source (DrawSprite() etc.) may be shared, as long as nobody alters them meanwhile;
+ *   - fonts may be shared, but must be created on the main thread (they own a GPU texture). Switching the font or
+ *     it's mode waits for the string functions that are drawing. The decal functions are only available via the
+ *     engine, and must be called on the main thread.
  */
 
+#include <iostream>
+#include <vector>
+#include <functional>
+
+#include "SGE_Utilities.h"
+#include "SGE_Pixel.h"
+#include "SGE_Sprite.h"
+
+namespace flc {
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    class DrawContext {
+        public:
+            // creates a context that draws into pTarget, using pFont for text drawing. Neither is owned by the context.
+            DrawContext( flc::Sprite *pTarget = nullptr, flc::SpriteFont *pFont = nullptr );
+
+            // draw target and font setting and getting
+            void SetDrawTarget( flc::Sprite *pTarget );
+            flc::Sprite *GetDrawTarget();
+            int GetDrawTargetWidth();
+            int GetDrawTargetHeight();
+            // the distance between the rows of the draw target in pixels (the pitch of it's surface / 4)
+            int GetDrawTargetStride();
+            void SetFont( flc::SpriteFont *pFont );
+            flc::SpriteFont *GetFont();
+
+            // clear the (clipped area of the) draw target
+            void Clear( Pixel colour = BLACK );
+
+            // draw a single pixel in the specified colour
+            void Draw( int x, int y, Pixel colour = WHITE );
+            void Draw( int x, int y, uint32_t encodedCol );
+            void Draw( const flc::vi2d &pos, Pixel colour = WHITE ) { Draw( pos.x, pos.y, colour ); }
+
+            // draw a batch of points - either each point in it's own (encoded) colour, or all points in the same colour
+            void DrawPoints( const flc::vi2d *pPoints, const uint32_t *pColours, size_t nPoints );
+            void DrawPoints( const flc::vi2d *pPoints, size_t nPoints, Pixel colour = WHITE );
+
+            // draw a line from (x0, y0) to (x1, y1) in the specified colour and pattern
+            void DrawLine( int x0, int y0, int x1, int y1, Pixel colour = WHITE, uint32_t linePattern = 0xFFFFFFFF );
+            void DrawLine( const flc::vi2d &p1, const flc::vi2d &p2, Pixel colour = flc::WHITE, uint32_t linePattern = 0xFFFFFFFF ) {
+                DrawLine( p1.x, p1.y, p2.x, p2.y, colour, linePattern );
+            }
+
+            // draw resp. fill a rectangle in the specified colour
+            void DrawRect( int x, int y, int w, int h, Pixel colour = flc::WHITE );
+            void FillRect( int x, int y, int w, int h, Pixel colour = flc::WHITE );
+            void DrawRect( const flc::vi2d &pos, const flc::vi2d &size, Pixel colour = flc::WHITE ) { DrawRect( pos.x, pos.y, size.x, size.y, colour ); }
+            void FillRect( const flc::vi2d &pos, const flc::vi2d &size, Pixel colour = flc::WHITE ) { FillRect( pos.x, pos.y, size.x, size.y, colour ); }
+
+            // draw resp. fill a triangle in the specified colour
+            void DrawTriangle( int x0, int y0, int x1, int y1, int x2, int y2, Pixel colour = flc::WHITE );
+            void FillTriangle( int x0, int y0, int x1, int y1, int x2, int y2, Pixel colour = flc::WHITE );
+
+            // fill rule for polygons - determines which parts of a (self intersecting) polygon are considered inside
+            //    * EVEN_ODD - a pixel is inside if a ray from it crosses the outline an odd number of times
+            //    * NON_ZERO - a pixel is inside if the winding number of the outline around it is not zero
+            enum FillRule {
+                EVEN_ODD,
+                NON_ZERO
+            };
+
+            // draw resp. fill a polygon in the specified colour. The polygon is implicitly closed.
+            void DrawPolygon( const std::vector<flc::vi2d> &vPoints, Pixel colour = flc::WHITE );
+            void FillPolygon( const std::vector<flc::vi2d> &vPoints, Pixel colour = flc::WHITE, FillRule rule = EVEN_ODD );
+            void FillPolygon( const std::vector<flc::vf2d> &vPoints, Pixel colour = flc::WHITE, FillRule rule = EVEN_ODD );
+
+            // draw resp. fill a circle in the specified colour
+            void DrawCircle( int xc, int yc, int r, Pixel colour = flc::WHITE );
+            void FillCircle( int xc, int yc, int r, Pixel colour = flc::WHITE );
+
+            // draw a string in the specified colour with the specified scale, with fixed resp. variable character spacing
+            void DrawString(     int x, int y, const std::string &sText, Pixel nColour = WHITE, int nScale = 1 );
+            void DrawStringProp( int x, int y, const std::string &sText, Pixel nColour = WHITE, int nScale = 1 );
+
+            // draw (an area of) a sprite with integer scale
+            void DrawSprite(        int x, int y, Sprite* sprite,                             int scale = 1, Sprite::Flip flip = Sprite::NONE );
+            void DrawPartialSprite( int x, int y, Sprite* sprite, int ox, int oy, int w, int h, int scale = 1, Sprite::Flip flip = Sprite::NONE );
+            // same, with non integer scale (> 0.0f) and filtering
+            void DrawSprite(        int x, int y, Sprite* sprite,                             float scale, Sprite::Filter filter, Sprite::Flip flip = Sprite::NONE );
+            void DrawPartialSprite( int x, int y, Sprite* sprite, int ox, int oy, int w, int h, float scale, Sprite::Filter filter, Sprite::Flip flip = Sprite::NONE );
+
+            // pixel mode and alpha blending - see SDL_GameEngine::SetPixelMode()
+            void SetPixelMode( Pixel::Mode mode );
+            void SetPixelMode( std::function<flc::Pixel( const int x, const int y, const flc::Pixel& pSource, const flc::Pixel& pDest)> pixelMode );
+            Pixel::Mode GetPixelMode();
+            void  SetPixelBlend( float fBlend );
+            float GetPixelBlend();
+
+            // clipping - see SDL_GameEngine::SetClipRect()
+            void SetClipRect( int x, int y, int w, int h );
+            void ClearClipRect();
+            bool IsClipRectSet() { return m_bClipRectSet; }
+            const SDL_Rect &GetClipRect() { return m_ClipRect; }
+
+            // returns the drawable area of the draw target, i.e. the draw target rectangle intersected with the clip rect
+            // (if set). (x0, y0) is inclusive, (x1, y1) is exclusive. Returns false if the area is empty (or there's no
+            // draw target).
+            bool GetClipBounds( int &x0, int &y0, int &x1, int &y1 );
+
+        private:
+            // internal function, only use if x, and y are guaranteed to be within boundaries of drawable object. nStride is
+            // the stride of the draw target (see GetDrawTargetStride()), the caller gets it once per primitive
+            inline void ClampedDraw( int x, int y, uint32_t colour, uint32_t *pixelPtr, int nStride );
+            // internal function - fast span writer: draws the horizontal run of pixels x0 upto and including x1 on row y.
+            // Same preconditions as ClampedDraw(): the span must be within the boundaries, and the surface must be locked.
+            inline void ClampedDrawSpan( int x0, int x1, int y, uint32_t colour, uint32_t *pixelPtr );
+            // internal function - clips the span to the draw target, and draws it using ClampedDrawSpan()
+            void DrawSpan( int x0, int x1, int y, uint32_t colour );
+            // internal functions - drawing of sprites using their run length encoded representation
+            bool UseRLE( Sprite *sprite );
+            void DrawSpriteRLE( int x, int y, Sprite* sprite, int ox, int oy, int w, int h );
+
+        private:
+            flc::Sprite     *pDrawTarget = nullptr;
+            flc::SpriteFont *pFont       = nullptr;
+
+            // alpha blending and pixel mode
+            Pixel::Mode m_PixelMode = Pixel::Mode::NORMAL;
+            std::function<flc::Pixel( const int x, const int y, const flc::Pixel& pSource, const flc::Pixel& pDest)> m_BlendFunc = nullptr;
+            float m_BlendFactor = 1.0f;
+
+            // clipping
+            bool     m_bClipRectSet = false;
+            SDL_Rect m_ClipRect     = { 0, 0, 0, 0 };
+    };
 
-// empty
+} // namespace flc
 
 //                                                                           //
 // ------------------------------------------------------------------------- //
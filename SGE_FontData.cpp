@@ -21,1482 +21,1629 @@
 
 #include "SGE_FontData.h"
 
-//                              +------------+                               //
-// -----------------------------+ FUNCTIONS  +------------------------------ //
-//                              +------------+                               //
-
-// this function contains and sets all info that is needed wrt the font sprites:
-//   * the nr of characters in the sprite, horizontal and vertical
-//   * the tile size of the characters, horizontal and vertical
-//   * an offset to compensate if the tiles can't be directly indexed by the ascii value (i.e. if tile 65 does not contain character 'A'
-// It also initalises the data string using one of the below InitDataStringN() functions
-void InitFontSprite(
-                int nFontIndex,
-                std::string &sFile,
-                int &nChrsH, int &nChrsV,
-                int &nTileSizeX, int &nTileSizeY,
-                int &nAsciiOffset, std::string &sData
-            ) {
-
-    // little lambda functions for better readability of the code in the switch
-    auto fill_arguments = [&]( std::string s, int ch, int cv, int th, int tv, int offset ) {
-        sFile        = s;
-        nChrsH       = ch;
-        nChrsV       = cv;
-        nTileSizeX   = th;
-        nTileSizeY   = tv;
-        nAsciiOffset = offset;
-    };
+//                              +-----------+                               //
+// -----------------------------+ FONT DATA +------------------------------ //
+//                              +-----------+                               //
 
-    switch (nFontIndex) {
-        case 0: fill_arguments(               "ascii 128x128.tpbg.png", 16, 16,  8,  8,  0 ); InitDataString0( sData ); break;
-        case 1: fill_arguments(                   "nesfont 128x48.png", 16,  6,  8,  8, 32 ); InitDataString1( sData ); break;
-        case 2: fill_arguments( "font - unknown 512x512.tpbg.mono.png", 16, 16, 32, 32,  0 ); InitDataString2( sData ); break;
-        case 3: fill_arguments(     "font cells 512x512.tpbg.mono.png", 16, 16, 32, 32,  0 ); InitDataString3( sData ); break;
-        case 4: fill_arguments(      "bitmapfont openGL.tpbg.mono.png", 25, 11, 20, 20,  0 ); InitDataString4( sData ); break;
-        case 5: fill_arguments(         "simple font 610x650.tpbg.png", 10, 10, 61, 65, 32 ); InitDataString5( sData ); break;
-    }
-}
-
-//                        +-------------------------+                        //
-// -----------------------+ INITIALIZER FUNCTION(S) +----------------------- //
-//                        +-------------------------+                        //
-
-// Below functions contain sprite data encoded in readable and printable characters. See the notes on how this data is encoded and
-// can be decoded. In the engine this data is used by function SpriteFont::LoadFontFromDataString() to build the sprite from a data string
+// Below arrays contain the sprite data of the fonts, encoded in readable and printable characters. Each character holds
+// 6 bits of pixel data (a set bit is a white pixel), with an offset of 48 to get a printable character, so only the
+// characters '0' upto and including 'o' are used. Each pixel row starts with a new character. The lines of the arrays
+// are concatenated to get the data for the complete sprite sheet. In the engine this data is decoded by function
+// SpriteFont::LoadFontFromData().
+//
+// The margins arrays contain the margins (left, right, top, bottom) per character tile, in the order of the tiles in
+// the sprite sheet. They were precomputed from the sprite data, see SpriteFont::InitFontSpriteMargins() for how.
 
 // NOTE: this data is associated with index: 0, file name: "ascii 128x128.tpbg.png"
-void  InitDataString0( std::string &sDataString ) {
-
-    sDataString.clear();
+static constexpr const char *const sFontData0[] = {
+    "?4A4I00l000H60l00?00o084Q8:112120l60L48>0lo0851@D02I0T1J60l>L?0l?0N2`\\;7bQoolH61dL>;P0<084ADE02QoolH63Rh7Aan<0H0PL712I0T0HFW3`3`",
+    "ko<0[1`41012120H?23P1`Co<00000000l000H603`3`3o<0ocll07h0O01l600?0?3`00?3ll?3`h?SPo?00?0?3`00?3`l?6Hl6c`OIP0?0?3`00?0`l06H07P0k90",
+    "0?0?3`00?0`lO^Lh73Wci`l0l00?o`00`lol=h67W3_@l0l00?o`00`l_L=l>=n0V@l0l00?o`00`lfl=o>=`0f`l0l00?o`010X:11P80P@4100000000010X:3aTD0",
+    "PP25@@000010010XO508D11013P@0000200100:3P@8010111l07`0400100O1@PE01013P@4000800000:7Q<B00P25@@4000@00100:10<=00@4100800@00000000",
+    "0000000000000000>10hO0Ql77`h>000200P>0A31411Q080A4A000400@A0C10422Qh@0Q4A10@87`820E10H64P4N10h?000@00440I10P17`4A214110@87`840A1",
+    "10A0Q4A214200@400@00>3Ql>0Ph>20hL00P200P400000000000000000000000>11h>7QlO3a4>0A4@4A4>0A2Q4A4A0@41440A8@6a4A0E4A4@4A0@41440A@@5AT",
+    "A0G4Ah@4AhN41l40AP@5ADA0F7a4@4A0@4a440A@@4A<A0@4A4A4A0@4A444A8@4A4A0?4Ah>7Ql@3a4>3Q4O4A4>00000000000000000000000N3Qh>7a4A4A4A7al",
+    "07`000A4A4A114A4A4A0AP@0`000A4A4@114A4@X:0QP80`@00N4Ah>114A5@@411P40`X00@5A@1114A5@X421P20a400@4Q8A114:6a4441P10`000@3A4>10h44A4",
+    "47al07`0O00000000000000000000000801000@0201040Q0<00000801000@04010001040000043AH73@h43Ah<0Q846ah>004aT84a4>4a440Q@4594A004A484Al",
+    "44A440Q`4594A004aT84a043a440Q84594A003AH73@h40A4>0Q4>594>00000000003P00300000000000001000000000<4600o`000001000000000@4100o`F3AH",
+    "?7a4A59497`@4104o`I4aP@114A58X90PP00Pho`A4A0>114:58@910@4110o`I4a01114:58X?20@4100o`F3A0N10l42a417`<4600o`@0H000000000>0000000o`",
+    "0800?P2PZP0001Pl03k060oh0LO01@EAP001PH7?c`60oh0lf02PZS`0occK??Sl?0oh00N01@EGh0ogko0=co?0oh0L>:ZPZWh0oomnW<ooOPoh0N65E@EC`0om\\lW\\",
+    "?lOPoh0n7:ZPZQSooaPHn`7`o`oh3n75E@E@3ooc`H>`30o`0?hl?:X:?<3Pn30<0003o`0?iBBUD5O\\3Pn3PLIQP?o`0?hl?:X:ol3Pn9`iO_loOP0?j00ED5ol3Pn?",
+    "oo@\\?oOP0?jl?@0:ol3Pn?oo`d;o?00?koo`05ol3Pn9`iogho?00?hm_00:O\\3Pn3PL66H?60oohm_005?<3Pn30<0003600?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3o",
+    "l0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`00000?3`l?0?3`l?ooooo`00000?3`l?0?3`l?ooooo`00000000000000000000000000000000000000000000000000",
+    "00000000000000000?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`00000?3`l?0?3`l?ooooo`00000?3`l?0?3`l?ooooo`l?",
+    "3`l?3`l?3`l?3`l?3`l0l?3`l?3`l?3`l?3`l?3`l0l?3`l?3`l?3`l?3`l?3`l00H3oo00H00lH004361P0600l3oo00l00lH008761P0601n1no3an00LH00@?61P0",
+    "603o0lo3co60?o00P?oaoh7`7oP0o3co603o`10?oaoh7`?o`0o3an000Hh20?01PH00Ooh0o00l000Hl40701PH00ool0o00H000Hl80301PH002E8006HH6021l830",
+    "01P06084@04?ll6012l43P01P06012d0;?lH600Th23`01P060P<@0>_m2600H`13`ooPOn04A4lG7kW60<H00S`ooPOn0@;An=3a260LT00C`61PH0022?o11PH60m2",
+    "00;P61PH000T[o01Pl60n1007061PH000?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`00000?3`l?0?3`l?ooooo`00000?3`",
+    "l?0?3`l?ooooo`3`l?3`l?3`l?3`l?3`l?3`3`l?3`l?3`l?3`l?3`l?3`3`l?3`l?3`l?3`l?3`l?3`0?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`0?0?",
+    "o`3`3ol0l0oo0?0?o`00000?3`l?0?3`l?ooooo`00000?3`l?0?3`l?ooooo`ooooooooooooooooooooo`ooooooooooooooooooooo`ooooooooooooooooooooo`",
+};
 
-    sDataString += "?4A4I00l000H60l00?00o084Q8:112120l60L48>0lo0851@D02I0T1J60l>L?0l?0N2`\\;7bQoolH61dL>;P0<084ADE02QoolH63Rh7Aan<0H0PL712I0T0HFW3`3`";
-    sDataString += "ko<0[1`41012120H?23P1`Co<00000000l000H603`3`3o<0ocll07h0O01l600?0?3`00?3ll?3`h?SPo?00?0?3`00?3`l?6Hl6c`OIP0?0?3`00?0`l06H07P0k90";
-    sDataString += "0?0?3`00?0`lO^Lh73Wci`l0l00?o`00`lol=h67W3_@l0l00?o`00`l_L=l>=n0V@l0l00?o`00`lfl=o>=`0f`l0l00?o`010X:11P80P@4100000000010X:3aTD0";
-    sDataString += "PP25@@000010010XO508D11013P@0000200100:3P@8010111l07`0400100O1@PE01013P@4000800000:7Q<B00P25@@4000@00100:10<=00@4100800@00000000";
-    sDataString += "0000000000000000>10hO0Ql77`h>000200P>0A31411Q080A4A000400@A0C10422Qh@0Q4A10@87`820E10H64P4N10h?000@00440I10P17`4A214110@87`840A1";
-    sDataString += "10A0Q4A214200@400@00>3Ql>0Ph>20hL00P200P400000000000000000000000>11h>7QlO3a4>0A4@4A4>0A2Q4A4A0@41440A8@6a4A0E4A4@4A0@41440A@@5AT";
-    sDataString += "A0G4Ah@4AhN41l40AP@5ADA0F7a4@4A0@4a440A@@4A<A0@4A4A4A0@4A444A8@4A4A0?4Ah>7Ql@3a4>3Q4O4A4>00000000000000000000000N3Qh>7a4A4A4A7al";
-    sDataString += "07`000A4A4A114A4A4A0AP@0`000A4A4@114A4@X:0QP80`@00N4Ah>114A5@@411P40`X00@5A@1114A5@X421P20a400@4Q8A114:6a4441P10`000@3A4>10h44A4";
-    sDataString += "47al07`0O00000000000000000000000801000@0201040Q0<00000801000@04010001040000043AH73@h43Ah<0Q846ah>004aT84a4>4a440Q@4594A004A484Al";
-    sDataString += "44A440Q`4594A004aT84a043a440Q84594A003AH73@h40A4>0Q4>594>00000000003P00300000000000001000000000<4600o`000001000000000@4100o`F3AH";
-    sDataString += "?7a4A59497`@4104o`I4aP@114A58X90PP00Pho`A4A0>114:58@910@4110o`I4a01114:58X?20@4100o`F3A0N10l42a417`<4600o`@0H000000000>0000000o`";
-    sDataString += "0800?P2PZP0001Pl03k060oh0LO01@EAP001PH7?c`60oh0lf02PZS`0occK??Sl?0oh00N01@EGh0ogko0=co?0oh0L>:ZPZWh0oomnW<ooOPoh0N65E@EC`0om\\lW\\";
-    sDataString += "?lOPoh0n7:ZPZQSooaPHn`7`o`oh3n75E@E@3ooc`H>`30o`0?hl?:X:?<3Pn30<0003o`0?iBBUD5O\\3Pn3PLIQP?o`0?hl?:X:ol3Pn9`iO_loOP0?j00ED5ol3Pn?";
-    sDataString += "oo@\\?oOP0?jl?@0:ol3Pn?oo`d;o?00?koo`05ol3Pn9`iogho?00?hm_00:O\\3Pn3PL66H?60oohm_005?<3Pn30<0003600?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3o";
-    sDataString += "l0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`00000?3`l?0?3`l?ooooo`00000?3`l?0?3`l?ooooo`00000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`00000?3`l?0?3`l?ooooo`00000?3`l?0?3`l?ooooo`l?";
-    sDataString += "3`l?3`l?3`l?3`l?3`l0l?3`l?3`l?3`l?3`l?3`l0l?3`l?3`l?3`l?3`l?3`l00H3oo00H00lH004361P0600l3oo00l00lH008761P0601n1no3an00LH00@?61P0";
-    sDataString += "603o0lo3co60?o00P?oaoh7`7oP0o3co603o`10?oaoh7`?o`0o3an000Hh20?01PH00Ooh0o00l000Hl40701PH00ool0o00H000Hl80301PH002E8006HH6021l830";
-    sDataString += "01P06084@04?ll6012l43P01P06012d0;?lH600Th23`01P060P<@0>_m2600H`13`ooPOn04A4lG7kW60<H00S`ooPOn0@;An=3a260LT00C`61PH0022?o11PH60m2";
-    sDataString += "00;P61PH000T[o01Pl60n1007061PH000?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`00000?3`l?0?3`l?ooooo`00000?3`";
-    sDataString += "l?0?3`l?ooooo`3`l?3`l?3`l?3`l?3`l?3`3`l?3`l?3`l?3`l?3`l?3`3`l?3`l?3`l?3`l?3`l?3`0?0?o`3`3ol0l0oo0?0?o`0?0?o`3`3ol0l0oo0?0?o`0?0?";
-    sDataString += "o`3`3ol0l0oo0?0?o`00000?3`l?0?3`l?ooooo`00000?3`l?0?3`l?ooooo`ooooooooooooooooooooo`ooooooooooooooooooooo`ooooooooooooooooooooo`";
-}
+static constexpr uint8_t nFontMargins0[] = {
+     0, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 1, 2,  0, 0, 0, 0,  0, 0, 1, 1,  0, 0, 1, 1,
+     1, 1, 0, 0,  1, 1, 0, 0,  1, 0, 0, 1,  0, 1, 1, 0,  1, 0, 1, 0,  0, 1, 0, 1,  0, 0, 1, 0,  0, 2, 0, 0,
+     0, 0, 0, 3,  2, 0, 0, 0,  2, 2, 0, 0,  0, 0, 1, 0,  0, 0, 0, 0,  1, 0, 1, 0,  1, 0, 0, 0,  0, 0, 1, 0,
+     0, 0, 0, 1,  0, 0, 0, 0,  4, 0, 4, 0,  4, 0, 0, 4,  0, 4, 4, 0,  0, 4, 0, 4,  0, 0, 0, 0,  0, 0, 4, 0,
+     8, 8, 8, 8,  3, 4, 0, 1,  2, 3, 0, 5,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  3, 3, 0, 5,
+     1, 4, 0, 1,  3, 2, 0, 1,  1, 2, 0, 1,  1, 2, 1, 2,  2, 4, 4, 1,  1, 2, 3, 4,  3, 4, 6, 1,  1, 2, 1, 2,
+     1, 2, 0, 1,  2, 3, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,
+     1, 2, 0, 1,  1, 2, 0, 1,  3, 4, 2, 3,  2, 4, 2, 1,  1, 3, 0, 1,  1, 2, 2, 3,  2, 2, 0, 1,  1, 2, 0, 1,
+     1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,
+     1, 2, 0, 1,  2, 3, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,
+     1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,
+     1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 0, 1,  1, 2, 1, 2,  1, 2, 0, 1,  1, 2, 2, 3,  1, 2, 6, 1,
+     2, 4, 0, 5,  1, 2, 2, 1,  1, 2, 0, 1,  2, 2, 2, 1,  1, 2, 0, 1,  1, 2, 2, 1,  2, 3, 0, 1,  1, 2, 2, 0,
+     1, 2, 0, 1,  2, 3, 0, 1,  2, 3, 0, 0,  1, 2, 0, 1,  2, 3, 0, 1,  1, 1, 2, 1,  1, 2, 2, 1,  1, 2, 2, 1,
+     1, 2, 2, 0,  1, 1, 2, 0,  1, 3, 2, 1,  1, 2, 2, 1,  1, 2, 0, 1,  1, 2, 2, 1,  1, 2, 2, 1,  1, 1, 2, 1,
+     1, 2, 2, 1,  2, 2, 2, 0,  1, 2, 2, 1,  2, 2, 0, 1,  3, 4, 0, 1,  1, 3, 0, 1,  1, 2, 2, 3,  0, 0, 0, 0,
+     0, 0, 1, 0,  0, 7, 0, 0,  0, 1, 1, 0,  0, 1, 0, 0,  0, 0, 4, 0,  0, 4, 0, 0,  0, 0, 0, 0,  1, 1, 1, 1,
+     0, 0, 6, 0,  0, 0, 2, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1,  0, 0, 0, 0,  0, 0, 0, 0,
+     0, 0, 7, 0,  0, 1, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 4,  4, 0, 0, 0,  0, 0, 0, 0,  0, 6, 0, 0,
+     0, 5, 0, 0,  0, 3, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 1, 1,  0, 0, 1, 1,  0, 0, 0, 0,  0, 0, 0, 0,
+     8, 8, 8, 8,  0, 4, 0, 5,  4, 0, 0, 5,  0, 0, 0, 5,  0, 4, 3, 3,  0, 4, 0, 3,  0, 0, 0, 3,  0, 0, 0, 3,
+     4, 0, 3, 3,  0, 0, 0, 3,  4, 0, 0, 3,  0, 0, 0, 3,  0, 0, 3, 3,  0, 0, 0, 3,  0, 0, 0, 3,  0, 0, 0, 3,
+     0, 4, 5, 0,  0, 4, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 4, 3, 0,  0, 4, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,
+     0, 0, 3, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 3, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 4,  0, 2, 0, 0,  2, 2, 2, 2,  0, 0, 0, 0,  3, 3, 3, 3,  4, 0, 0, 4,
+     0, 0, 0, 0,  0, 4, 4, 0,  0, 0, 0, 0,  4, 0, 0, 0,  0, 0, 0, 3,  3, 0, 0, 0,  0, 3, 3, 0,  3, 0, 0, 3,
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 4, 0,  1, 1, 1, 1,  0, 0, 0, 0,  0, 0, 0, 0,  3, 3, 0, 0,  4, 0, 4, 0,
+     0, 0, 0, 0,  0, 4, 0, 4,  0, 0, 0, 0,  0, 4, 0, 0,  0, 0, 3, 0,  0, 3, 0, 0,  3, 0, 3, 0,  0, 3, 0, 3,
+     4, 0, 5, 0,  0, 0, 0, 0,  4, 0, 0, 0,  0, 0, 0, 0,  0, 0, 3, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,
+     4, 0, 3, 0,  0, 0, 0, 0,  4, 0, 0, 0,  0, 0, 0, 0,  0, 0, 3, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,
+     0, 0, 5, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 3, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,
+     0, 0, 3, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 3, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,
+};
 
 // NOTE: this data is associated with index: 1, file name: "nesfont 128x48.png"
-void  InitDataString1( std::string &sDataString ) {
-
-    sDataString.clear();
+static constexpr const char *const sFontData1[] = {
+    "01Q\\K300>60HH00000001P03a\\K7c6K60`<6H`00003003a\\o\\3<><1P63``0000",
+    "6003`0K7PHMP1P6?ol0?`0<001P0oP``g01P63``0000H001P0K?QVc00`<6H`<0",
+    "0``00000K336MP0HH000<00`P001P0000000000000H00000>1QlOQcl??ilO000",
+    "601PN0C3S633c0H<K6aS0`<00`c0aQP>66cl`0c6aS0`H?`H30aQPl?<`6o1QlOP",
+    "00`00<60aQQh1_h6aS361P00H00H<0I1SPaPc6aS36330`<?``00>7knO0alO31l",
+    "N30`601P<0000000000000001P000000O3Sl??SnoSk6OQk6H<K6O0aVc6I\\c0`6",
+    "3660K<H>kVaPg\\K6`<K0`<3660KHH?kfaPg\\Kl`<Klo<kn60K`H?knaPg_k6`<K0",
+    "`<K66<KhH=KNaP`<K6I\\c0`6K66<KLH<K>aPN<Kl??Sn`3k6OWc>O\\K6O0000000",
+    "0000000000000000o7clN7k6a\\K6I_ih`7P@00a\\K6c1S6a\\K^IPiPH1Ph00a\\K6",
+    "`1S6a]IlIQaP<1Q\\00a\\K>O1S6k_hh?3QP61S600o=kh1QS6O?il671P31P000`<",
+    "cLaQS6>>k^6>1P1QP000`7[>O1Ql4<K66?ih0WP00000000000000000000000o`",
+    "<01P00H03P1P001P600000<01P00H0601P60IP60000063al?Shl63iP001R67Il",
+    "?006IVH6IVOVIl60IT66]VIP06IVH6In66IV60IX66]VIP06IVH6IP63iV60Il66",
+    "]VIP03]l?Shn60IV66IV66]V?00000000003`003`0000000000003000000000L",
+    "6>1f00000003000000000`633L40O3i^??aVIV=SIWh`6300>0IVI`@31VIV\\fIP",
+    "cP01`0K0IVIP?31VIV\\L;1P`6300aPO3iP1S1V96\\f630`6300aPH0IPO1`l63IS",
+    "<7hL6>00oPH0H000000000H000000000",
+};
 
-    sDataString += "01Q\\K300>60HH00000001P03a\\K7c6K60`<6H`00003003a\\o\\3<><1P63``0000";
-    sDataString += "6003`0K7PHMP1P6?ol0?`0<001P0oP``g01P63``0000H001P0K?QVc00`<6H`<0";
-    sDataString += "0``00000K336MP0HH000<00`P001P0000000000000H00000>1QlOQcl??ilO000";
-    sDataString += "601PN0C3S633c0H<K6aS0`<00`c0aQP>66cl`0c6aS0`H?`H30aQPl?<`6o1QlOP";
-    sDataString += "00`00<60aQQh1_h6aS361P00H00H<0I1SPaPc6aS36330`<?``00>7knO0alO31l";
-    sDataString += "N30`601P<0000000000000001P000000O3Sl??SnoSk6OQk6H<K6O0aVc6I\\c0`6";
-    sDataString += "3660K<H>kVaPg\\K6`<K0`<3660KHH?kfaPg\\Kl`<Klo<kn60K`H?knaPg_k6`<K0";
-    sDataString += "`<K66<KhH=KNaP`<K6I\\c0`6K66<KLH<K>aPN<Kl??Sn`3k6OWc>O\\K6O0000000";
-    sDataString += "0000000000000000o7clN7k6a\\K6I_ih`7P@00a\\K6c1S6a\\K^IPiPH1Ph00a\\K6";
-    sDataString += "`1S6a]IlIQaP<1Q\\00a\\K>O1S6k_hh?3QP61S600o=kh1QS6O?il671P31P000`<";
-    sDataString += "cLaQS6>>k^6>1P1QP000`7[>O1Ql4<K66?ih0WP00000000000000000000000o`";
-    sDataString += "<01P00H03P1P001P600000<01P00H0601P60IP60000063al?Shl63iP001R67Il";
-    sDataString += "?006IVH6IVOVIl60IT66]VIP06IVH6In66IV60IX66]VIP06IVH6IP63iV60Il66";
-    sDataString += "]VIP03]l?Shn60IV66IV66]V?00000000003`003`0000000000003000000000L";
-    sDataString += "6>1f00000003000000000`633L40O3i^??aVIV=SIWh`6300>0IVI`@31VIV\\fIP";
-    sDataString += "cP01`0K0IVIP?31VIV\\L;1P`6300aPO3iP1S1V96\\f630`6300aPH0IPO1`l63IS";
-    sDataString += "<7hL6>00oPH0H000000000H000000000";
-}
+static constexpr uint8_t nFontMargins1[] = {
+     8, 8, 8, 8,  2, 2, 0, 0,  1, 2, 0, 5,  0, 1, 0, 1,  0, 2, 0, 1,  0, 1, 1, 1,  0, 1, 0, 1,  0, 5, 0, 5,
+     1, 3, 0, 1,  1, 3, 0, 1,  0, 0, 1, 2,  0, 2, 1, 2,  1, 4, 5, 0,  0, 2, 3, 4,  2, 4, 5, 1,  0, 1, 0, 1,
+     0, 1, 0, 1,  1, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,
+     0, 1, 0, 1,  0, 1, 0, 1,  2, 4, 1, 1,  1, 4, 1, 0,  0, 3, 0, 1,  0, 2, 2, 2,  1, 2, 0, 1,  0, 2, 0, 1,
+     0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,
+     0, 1, 0, 1,  1, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  1, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,
+     0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  1, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,  0, 1, 0, 1,
+     0, 1, 0, 1,  1, 1, 0, 1,  0, 1, 0, 1,  1, 3, 0, 1,  0, 1, 0, 1,  1, 3, 0, 1,  0, 1, 0, 4,  0, 0, 7, 0,
+     2, 3, 0, 5,  1, 0, 2, 1,  1, 1, 0, 1,  1, 1, 2, 1,  1, 1, 0, 1,  1, 1, 2, 1,  1, 1, 0, 1,  1, 1, 2, 0,
+     1, 1, 0, 1,  3, 3, 1, 1,  1, 1, 1, 0,  1, 1, 0, 1,  3, 3, 0, 1,  1, 0, 2, 1,  1, 1, 2, 1,  1, 1, 2, 1,
+     1, 1, 2, 0,  1, 1, 2, 0,  1, 1, 2, 1,  1, 1, 2, 1,  0, 2, 0, 1,  1, 1, 2, 1,  1, 1, 2, 1,  1, 0, 2, 1,
+     1, 0, 2, 1,  1, 1, 2, 0,  1, 1, 2, 1,  0, 2, 0, 1,  3, 3, 0, 1,  0, 2, 0, 1,  0, 1, 0, 6,  0, 1, 1, 1,
+};
 
 // NOTE: this data is associated with index: 2, file name: "font - unknown 512x512.tpbg.mono.png"
-void  InitDataString2( std::string &sDataString ) {
-
-    sDataString.clear();
+static constexpr const char *const sFontData2[] = {
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`000000000000Ooo`07ool0000000Ooo`07o",
+    "ol007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`000000000000Ooo`07ool0000000Ooo`07ool00600<01P0300H00`0600<01P0300H00`0600<01",
+    "P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0",
+    "600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<",
+    "01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00",
+    "`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`060",
+    "0<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H",
+    "00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0",
+    "600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<000000",
+    "0H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00",
+    "`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000",
+    "000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<007ool01ooo00Ooo`07ool01ooo00O",
+    "oo`07ool01ooo00Ooo`000000000000Ooo`07ool0000000Ooo`07ool007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`000000000000Ooo`07ool00",
+    "00000Ooo`07ool000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007ool01ooo00Ooo`07o",
+    "ol01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00O",
+    "oo`07ool01ooo00Ooo`07ool00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0",
+    "600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P030",
+    "0H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00",
+    "`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0",
+    "300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H",
+    "00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01",
+    "P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P030",
+    "0H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<",
+    "01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0",
+    "300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`060",
+    "0<01P0300H00`0600<01P0300H00`0600<007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool007ool01",
+    "ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool00000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000600000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000600000000000000000000000000000000000000000000000000000000000000000000300001\\00001cP000oP000n3P001n0006",
+    "00000<0000H000006000000000000000000000000001P00000000300001\\00001S0001o`001o7P003o000600000L0000L0000060000000000000000000000000",
+    "03P00000000300001\\00003W0003gh001g70003W000600000H0000<000006000030000000000000000000003000000000300001\\00003W0003Vh001W>0003300",
+    "0600000h0000>00001fL00030000000000000000000007000000000300001\\00003W000360001S>00037000600000`0000600001ol0003000000000000000000",
+    "0006000000000300001\\0000?o`003V0001SL0003W000600001`0000700000oh0003000000000000000000000>000000000300001\\0000Oo`003n0001gL0003o",
+    "000600001`0000700000?P0003000000000000000000000<000000000300000000003W0001oP001oh0003n000000001`0000700000M`001on000000000000000",
+    "00000L00000000030000000000360000o`000oo`00?hL00000001P0000300000hh001on00000000000000000000H000000000300000000007>00007h0001oh00",
+    "?mL00000001P0000300000hh00030000000007P0000000000h00000000030000000000Oo`0006h0003^h00LLL00000001P00003000000000030000000007P000",
+    "0000000`00000000030000000000OoP0006H0003\\h00L>h00000001P0000300000000003000000000000000000001`000000000300000000007>00076h0007<H",
+    "00H7h00000001P0000300000000003000000000000000000001P000000000000000000007>0007gh0007<H00L7`00000001`0000700000000003000000000000",
+    "000000003P000000000000000000007>0003o`000>>h00O?`00000001`00007000000000000000000000000000000030000000000300000000006<0001o`000N",
+    "?h00?ol00000001`00007000000000000000<0000000000`00007000000000030000000000>L000060000L7`007ll00000000`00006000000000000000<00000",
+    "00000`00006000000000000000000000000000600000000000000000000h0000>000000000000000<000000000000000>0000000000000000000000000000000",
+    "00000000000000000H0000<000000000000000<000000000000000<000000000000000000000000000000000000000000000000L0000L0000000000000000000",
+    "000000000000L000000000000000000000000000000000000000000000000<0000H0000000000000000000000000000000H00000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000003n000060000?h0003n00007P000On0003o0003oh000?h0003n0000000000000000000000000000007l00007o0000>0000ol000",
+    "7o0000?P000on0007oP003oh000Ol000?o000000000000000000000000000000?n0000??P000n0000ln000?WP000?P000h0000?W`0000`000lN000??P0000000",
+    "0000000000000000000000??0000>3P003n0001`>000>3P000MP000h0000>1`0001`000h>000L3`000000000000003P00000000h0000L70000L1`003f0001`60",
+    "0001P000MP000h0000L000001P000`6000L1`00300000`00000?P00000000n0000L30000L1`00360001P600003P000iP000oh000L0000030000h>000H1`00300",
+    "000`00000o000000000OP000L30000L1`000600000>0000?P001aP000on000Mo000070000nl000L1`00000000000003l0003oh0007h000070000H0`000600000",
+    ">0001o0001aP000nN000OoP00060000Oh000L3`0000000000000?P0003oh0000n0000?0000H0`000600000L0001o0003QP000h7000OW`000>0000?n000O?`000",
+    "0000000000>00000000000>0000n0000H0`000600000h00007P007QP00007000N1`000>0000no000?o`0000000000000?P0000000000n0001h0000L1`0006000",
+    "01`00001`0071P00003000L1`000<0001`?0007m`00000000000003l0003oh0007h0001`0000L1`000600007P00000`007ol00003000L0`000L0001`700001`0",
+    "0000000000000o0003oh000OP0001P0000L1`00060000?0000L0`007ol001`7000L1`000L0001P300001`00000000000000?P00000000n00001P0000>3P00060",
+    "000n0000L1`0001P001`7000>1`000L0001`7000L3P000000000000003P00000000h0000000000?WP00060001h0000?7`0001P001lN000?WP000H0001lO000O?",
+    "P000000000000000000000000000000000007o0003ol001on000?oP0001P000ol0007oP000H0000on000?o000300000`000000000000000000001P00003n0003",
+    "ol001on0003o00001P000?h0003n0000H0000Ol0007l000300000`000000000000000000001P0000000000000000000000000000000000000000000000000000",
+    "00000000000`0000000000000000000000000000000000000000000000000000000000000000000000000000000000000`000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000o`000?P000ol0003l0003oP000on000?oP000",
+    "O`000`3000<00000<0000`3P00<00003`3`00l30001o00003ol000?P000on0007o0003oh000on000?oP001oh000`3000<00000<0000`7000<00003`3`00l3000",
+    "7oP0007an000?P000`N000??00031l000`0000<00003il000`3000<00000<0000`>000<00003h7`00n3000?W`000?0>000?`000`>000>3P0030L000`0000<000",
+    "03PL000`3000<00000<0000`L000<00003h7`00n3000>1`000>07000M`000`6000L3P0030>000`0000<000070L000`3000<00000<0000`l000<00003L7`00g30",
+    "00L0h000Log000M`000`>000L3P0030>000`0000<0000700000`3000<00000<0000ah000<00003L>`00g3000L0h000Moc000L`000`L000L000030>000`0000<0",
+    "000700000`3000<00000<0000ch000<00003L>`00cS000L0h000Ikc000hh000oh000H0000306000oh000?o000600000oo000<00000<0000gh000<00003>>`00c",
+    "S000H0H000Iag000hh000on000H0000306000oh000?o00063l000oo000<00000<0000oL000<00003><`00ac000H0H000IQW000hH000`?000H0000306000`0000",
+    "<000063l000`3000<00000<0000nL000<00003>L`00`k000H0H000Mc_001ol000`7000L000030>000`0000<000070<000`3000<00000<0000l>000<000037L`0",
+    "0`k000L0h000Mon001ol000`3000L3P0030>000`0000<000070<000`3000<00000<0000h>000<000037H`00`O000L0h000>nl001`L000`3000L3P0030>000`00",
+    "00<000070L000`3000<00000<0000`7000<000033h`00`O000L0h000?00003P>000`7000>3P0030L000`0000<00003PL000`3000<00000L0000`7000<000033h",
+    "`00`?000>1`0007hl003P>000`?000??00031l000`0000<00003il000`3000<00000l0000`3P00<000033``00`?000?W`0003ol003P>000on0007o0003oh000o",
+    "n000<00001ol000`3000<00007h0000`1`00?o00031``00`70007oP0000oh00707000ol0003l0003o`000on000<00000oT000`3000<00007`0000`1`00?o0003",
+    "1``00`70003n00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000?n0000OP000ol0003n0007oh000`6000L1`0070h>00h>000L0h007o`000n0000H00007`0000?P000000000?o0001oh000on000",
+    "7o0007oh000`6000L1`003Ph<00h>000N1h007o`000n0000L00007`0000?P000000000<7P003il000`?000??P000<0000`6000L1`003QlL00LL000>1`0001`00",
+    "0`0000<00000`0000O`000000000<3P003PL000`7000>3P000<0000`6000>3P003QlL00>h00073P0003P000`0000>00000`0000M`000000000<1P0070>000`30",
+    "00<3P000<0000`6000>3P001QlL00>h00073P0003P000`0000600000`0000hh000000000<1P0070>000`3000>00000<0000`6000>3P001alL007`0003W000070",
+    "000`0000700000`0000hh000000000<3P0070>000`7000?00000<0000`6000770001a\\H007`0003o0000>0000`0000300000`0001`L000000000<7P00606000`",
+    "?0007n0000<0000`6000770001c^h003P0001n0000>0000`00003P0000`0001`L000000000?o000606000on0003oP000<0000`6000770000c^h007`0000l0000",
+    "L0000`00001P0000`000000000000000?n000606000ol0000O`000<0000`6000360000k^h007`0000l0000h0000`00001`0000`000000000000000<000070>00",
+    "0`L00001`000<0000`60003^0000k^h00?h0000H0000h0000`00000`0000`000000000000000<000070>000`L00000`000<0000`60003^0000k6`00>h0000H00",
+    "01`0000`00000h0000`000000000000000<000070>000`>000L0`000<0000h>0001l0000O7`00LL0000H0003P0000`00000H0000`000000000000000<00003PL",
+    "000`>000L1`000<0000h>0001l0000O7`00LL0000H0003P0000`00000L0000`000000000000000<00003il000`>000?W`000<0000nn0001l0000O7`00h>0000H",
+    "000700000`00000<0000`000000000000000<00001oh000`70007oP000<0000Ol0001l0000O7`01h70000H0007o`000`00000>0000`000000000000000<00000",
+    "o`000`70003o0000<0000?h0000h0000>3P01`70000H0007o`000`0000060000`000000000000000000000300000000000000000000000000000000000000000",
+    "00000000000`0000070000`0000000000000000000003P000000000000000000000000000000000000000000000000000`0000030000`0000000000000000000",
+    "003l000000000000000000000000000000000000000000000000000n000003P007`000000000Oo`0000000001l00000000000000000000000000000000000000",
+    "0000000000000n000001P007`000000000Oo`0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000<0000000000000000000000000000000000000000000000000000000000000000000000000000000000000?0000000000`00000000001P000000003h0000",
+    "00000`0000<00000H0000`0000<0000000000000000000007`000000000`00000000001P000000007h000000000`0000<00000H0000`0000<000000000000000",
+    "0000001`000000000`00000000001P000000007000000L000`000000000000000`0000<00000000000000000000000000000000`00000000001P000000006000",
+    "000l000`000000000000000`0000<000000000000000000000000001o0000g`0007h0001mP000?`000O`0000o`000gh000<00000H0000`L000<00003O?P00gh0",
+    "007l0000000003oP000oh000?l0003oP000oh000O`0001oP000ol000<00000H0000`h000<00003oo`00ol000?n0000000007WP000ll000>N0007WP000lh00060",
+    "0003c`000nl000<00000H0000a`000<00003gk`00nl000?N00000000073P000hL000L>00073P001`L000600003Q`000hL000<00000H0000cP000<00003Sa`00h",
+    "L000L700000000001P000`L000L>00071P001P<0006000030`000h<000<00000H0000gP000<000031``00h<000L70000000001oP000`<000H000061P001ol000",
+    "600003c`000`<000<00000H0000oP000<000031P`00`<000H30000000003oP000`<000H000061P001ol000600003o`000`<000<00000H0000o`000<000031P`0",
+    "0`<000H30000000007QP000`<000H000061P001P0000600001o0000`<000<00000H0000m`000<000031P`00`<000H300000000073P000`L000L>00071P001`00",
+    "00600003P0000`<000<00000H0000h`000<000031P`00`<000L700000000063P000hL000L>00073P001`L000600003`0000`<000<00000H0000`h000<000031P",
+    "`00`<000L70000000007_P000ll000>N0007WP000ll000600003oh000`<000<00000H0000`h000<000031P`00`<000?N0000000007oP000oh000?l0003oP000o",
+    "h000600003ol000`<000<00000H0000`L000<000031P`00`<000?n0000000003mP000g`0007h0001mP000O`0006000070l000`<000<00000H0000`L000<00003",
+    "1P`00`<0007h0000000000000000000000000000000000000000060<00000000000000H000000000000000000000000000000000000000000000000000000000",
+    "000000000007al00000000000000h000000000000000000000000000000000000000000000000000000000000000000007ol00000000000007h0000000000000",
+    "00000000000000000000000000000000000000000000000000000003o`00000000000007`0000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000007ool00000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000007ool0000000000000000000000000000000000000000000000000000000000000>00001P00070000000000600<000000000000000000",
+    "000001P000000000000000000000000000000000000N00001P0007P000000000600<000000000000000000000001P00000000000000000000000000000000000",
+    "0L00001P0003P000000000600<000000000000000000000001P000000000000000000000000000000000000H00001P0001P000000000600<00=l0001mP000g00",
+    "00?`0007l0000`<000L>000773001`h000H60003o0000H00001P0001P000000000600<00?n0003oP000o0000Oh0007l0000`<000L>00077W000ih000L>0003o0",
+    "000H00001P0001P000000000600<00??0007WP000n0000Ll0001P0000`<000L>0007?W000i`000L>000070000H00001P0001P0000o3000600<00>700073P000h",
+    "0000HL0001P0000`<000>>0007?W000OP000><0000>0000H00001P0001P0000og000600<00>700071P000h0000L00001P0000`<000><0003_^000?P000>L0000",
+    "L0000h00001P0001`0001gn000600<00<300061P000`0000O`0001P0000`<000>L0003_^000?00006L0000L0000h00001P0001`0001Qn000600<00<300061P00",
+    "0`0000?l0001P0000`<0007L0003]^000?00007H0000h0000h00001P0001`000000000600<00<300061P000`00001n0001P0000`<0007L0003]\\000?P0007h00",
+    "01`0000h00001P0001`000000000600<00<700073P000`00000>0001P0000`L0007L0001ml000OP0003h0003P0000H00001P0001P000000000600<00>700073P",
+    "000`0000L60001P0000hL0003h0001ml000M`0003`0003P0000H00001P0001P000000000600<00??0007WP000`0000NN0001`0000ml0003h0001ml000hh0001`",
+    "000700000H00001P0001P000000000600<00?n0003oP000`0000?n0001n0000ol0003h0001ih001hh0001`0007o0000H00001P0001P0000000007ool00=l0001",
+    "mP000`00007l0000n0000O\\0003h0000hh001`L0001P0007o0000H00001P0001P0000000007ool00<000001P0000000000000000000000000000000000000000",
+    "3P000000000H00001P0001P000000000000000<000001P00000000000000000000000000000000000000007P000000000L00001P0003P000000000000000<000",
+    "001P0000000000000000000000000000000000000000O0000000000N00001P0007P000000000000000<000001P00000000000000000000000000000000000000",
+    "00N0000000000>00001P000700000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001a`0000000001P001a`000hh0000<00",
+    "00000000000000000000000000000000000000000000000000000000oP0000000007P000oP000O`0000l00000000000000000000000000000000000000000000",
+    "00000000000000O0000000000O0000O0000?P0003h0000000001ooo00000007ool00000000000000000000000Ooo`0000000>0000000000L0000>0000700003P",
+    "0000000001ooo00000007ool00000000000000000000000Ooo`0000000000000000000000000000000000000001o0001P030000000600<0000000000000`0000",
+    "<0000H00`0?Ph000oP000000003n0007oh001ol000Oo00003oP001P030000000600<0000000000000`0000<0000H00`0Oah001o`000000007o0007oh001ol000",
+    "Oo00007g`001P030000000600<0000000000000`0000<0000H00`0Ma`003ch00000000??P000<00000L00007000071`001P030000000600<0000000000000`00",
+    "00<0000H00`0IcP003Ph00000000>3P000<00000h0000>0000>1`001P030000000600<0000000000000`0000<0000H00`0HcP0030h00000000<3P000<00000h0",
+    "000>0000>00001P030000000600<000000000000OoP007oh000H00`0Hg0003P000000000>00000<00001`0000L0000oh0001P030000000600<000000000000Oo",
+    "P007oh000H00`0Mg0003`000000000?00000<00003P0000h0000oh0001P030000000600<0000000000000`0000<0000H00`0On0001oP000`00007n0000<00003",
+    "P0000h0000<00001P030000000600<0000000000000`0000<0000H00`0?ol?P0oh000`00003oP000<0000700001`0000<00001P030000000600<000000000000",
+    "0`0000<0000H00`00OnO`07l001`00000O`000<0000>00003P0000oh0001P030000000600<0000000000000`0000<0000H00`00k^M`00L001`000001`000<000",
+    "0>00003P0000oh0001P030000000600<0000000000000`0000<0000H00`00k>I`00<001`000000`000<0000L0000700000>1`001P030000000600<0000000000",
+    "000`0000<0000H00`01c6H`70<000`0000L0`000<0000h0000>00000>1`001P030000000600<0000000000000`0000<0000H00`01c6H`70L000`0000L1`000<0",
+    "000h0000>000007W`001P030000000600<0000000000000`0007oh000H00`03S^M`3il00000000?W`000<0001`0000L000003oP001ooo00`00007ool03H0000H",
+    "``000`0007oh000Ooo`07SnO`1oh000000007oP000<0001ol000Oo00001o0001ooo00`00007ool03H0000H``000`0000<0000Ooo`071l?P0o`000000003o0000",
+    "<0001ol000Oo000000000000000`0000000003H0000000000`0000<0000000000000000000000000000000000000000000000000000000000`0000000003H000",
+    "0000000`0000<00000000000000000000000000000000000000000000000000000000000000000000000000000000`0000<00000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000`0000<00000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007ool00000000000000",
+    "0000000000000000000000000Ooo`0000000000000000000000030000000000000007ool000000000000000000000000000000000000000Ooo`0000007700000",
+    "000006000070000hh000060000600<0300000`00006`0003H00000000000000000000H00`0Oka`03n0000000000N000070000O`0000N0000600<0300000`0000",
+    "6`0003H00000000000000000000H00`0Oka`01l0000000001l0001V0000?P0001l0000600<0300000`00006`0003H00000000000000000000H00`033c`00h000",
+    "0000001`0001V0000700001`0000600<0300000`00006`0003H00000000000000000000H00`033k`000000000000000001P000000000000000600<0000000000",
+    "00000000000000000000000000000H00`033k`03l000000000?`0007l0000o`000?l0000600<000000000000000000000003h00000000000000H00`033N`07n0",
+    "00000000Oh0007l0000o`000?l0000600<000000000000000000000007l00000000000000H00`033N`07?000000000Ll0001P00001`0000L0000600<00000000",
+    "0000000000000007l00000000000000H00`033N`0670001P0000HL0001P00003P0000h0000600<000000000000000000000007l00000000000000H00`033<`07",
+    "00001P0000L00001P0000700001`0000600<000000000000000000000007l000?oP00?ooP00H00`0000007l0001`0000O`0001P0000700001`0000600<000000",
+    "000000000000000007l000?oP00?ooP00H00`0000003o0001`0000?l0001P0000>00003P0000600<000000000000000000000003h00000000000000H00`00000",
+    "00OP001`00001n0001P0000L0000700000600<000000000000000000000000000000000000000H00`00000003P001P00000>0001P0000h0000>00000600<0000",
+    "00000000000000000000000000000000000H00`00000071P001P0000L60001P0000h0000>00000600<000000000000000000000000000000000000000H00`000",
+    "0007WP00000000NN0001`0001`0000L000007ool000000000000000000000000000000000000000Ooo`0000003oP00000000?n0001n0001o`000Ol00007ool00",
+    "0000000000000000000000000000000000000Ooo`0000001o0000000007l0000n0001o`000Ol0000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000`00000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000`00000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000003SP000H`0000000000000000000000000000000000000000000000000000000000000000000000000000001o0000M`000<00000000003h0001P0000",
+    "oP000K00000oP001o000000000000000000003n000Oo0000000000n0000O`000<000060>0003h0001P0003o`000K00003oh003oP0000000000000000000?oP00",
+    "Oo0000000000L0000?P000<00007On0003h0001P0003ch000000007al007W`0000000000000000000O7`000700000000000000000000<00007on0003h0001P00",
+    "030h00000000?0N0071`0000000000000000000l1h000>00000000000000000000<P0003il0007L0001P0003P000000000>O>0061`0000000000000000000inh",
+    "000>00000000000000000000=P0003PL0007L0001P0003h000000000LoW007000000000000000000001anL000L00000000000000000000?P0003PL0007L0001P",
+    "0001o000000000LkW007P00000000000000000001a^L000h00000000000000000000?P00030<000>>0001P0001o`00000000Hh3003o0000f000000000000001Q",
+    "^<000h00000000000000000000O000030<000>>000000003Wh00000000H`3001o`000f000000000000001Qn<001`00000000000000000000l00003PL000>>000",
+    "0000030h00000000HkS000?h001n0000000007P0001Qn<003P00000000000000000000l00003PL000Oo000000003PH00000000LkW0000h001n0000?oP007P000",
+    "1a^L003P00000000000000000000l00003il000Oo000000003`h00000000LoW0000H001n0000?oP00000001aVL007000000000000000000000\\00007on000L70",
+    "00000003o`00000000>O>00>0H000f000001P00000000iVh00>000000000000000000000<00007On000h3P001P0000o`00000000?0N00>0h000f000001P00000",
+    "000l1h00>000000000000000000000<000060>000h3P001P00007h000000007al007ch0000000001P00000000O7`00L000000000000000000000?o000000000h",
+    "3P001P00000h000000003oh003o`0000000001P00000000?oP00Oo00000000000000000000?o000000001`1`001P00000H000000000oP001oP0000000001P000",
+    "000003n000Oo000000000000000000000000000000003P001P00070h00000000000000H000000000000000000000000000000000000000000000000000000000",
+    "0030001P0007ch00000000000000O000000000000000000000000000000000000000000000000000000000003P001P0003o`0000000000000070000000000000",
+    "00000000000000000000000000000000000000000000003`001P0001oP0000000000000070000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000o0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001P000000000000000000000000000000000000",
+    "0000000000<`000000000000001l000000000000006000007P00000000?o`00000000000000000000000000000<H0000M`000c00001P00003n00000000000000",
+    "600000O000000000?o`00000000000000000000000000000<h0001oP000g00001P00003^0000<000000000600000L000000000Lc000000000000000000000000",
+    "000000<h0001V0000g0000000000360000<0000000006000000000000000Hc000000000000000000000000000000<`000000000f00000000003^0000<0000000",
+    "0060000000000`H000Hc000000000000007l0003l000000000<`000000000f0000?l00003n0000<0000000006P000000000`H000Hc00000000000000?n0007n0",
+    "00000000<0000000000`0000?l00001l0000<0000000007P000000000`H000Lc00000000000000NN0007?000000000<0000000000`00000L0000000007oh0000",
+    "00007P000000000`H000Oc00000000000000L>000670001\\0000<0000000000`00000h0000000007oh00000000?0000000000`H000?c00000000000000060007",
+    "00001\\0000<0000000000`00001`0000000000<000000000N0000000000`H0000c000000000000007n0007l0001n0000<0000000000`00001`0000000000<000",
+    "000000N0000000000`H0000c00060000000000?n0003o0001n0000<0000000000`00003P0000000000<000000000F0000000000`H0000c00060000000000N600",
+    "00OP001n0000<0000000000`0000700000000000<00000000060000000000`H0000c00000000000000L>00003P001\\0000<0000000000`0000>00000000000<0",
+    "0000000060000000000hh0000c00000000000000H>00071P001\\0000<0000000000`0000>00000000000000000000060000000000mh0000c00000000000000Nn",
+    "0007WP00000000<0000000000`0000L00000000007oh0000000060000000000oh0000c00000000000000On0007oP00000000?o000000000`0000Ol0000000007",
+    "oh0000000060000000000oH0000c00000000000000?f0003o000000000?o000000000`0000Ol0000000000000000h00000000000000`00000c000000000<0000",
+    "0>0000@0000000000000000000000000000000000000000000`00000000000000`00000c000000000?P0000<0000n00000000000000000000000000000000000",
+    "00000000h00000000000000`00000c0000000003P0000>0000>0000000000000000000000000000000000000000000n00000000000000`00000c0000000003P0",
+    "000?P000>00000000000000000000000000000000000000000000000000000000000000000000000000OP000000000n000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000600000H0001`0001S0000000003000003000000000LL0000300000000000000770000H0000>00007700",
+    "000N00001h0003h0001g0000=P000?00000?000000000?h0000?0000000006`0003n0001h0000O00003n00001l00007`0007l0001o0000=P000n00000n000000",
+    "0007`0000n0000000006`0001l0007`0000oP0001l00001`000070000>>0000n000000000h00000h0000000003P0000h000000000000000h000700001a`0000h",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000?o0000?P0003h0000n0000?P000`00003l0000",
+    "o0000?`000?oP003oh000on000?oP00300000<0000?n0000?oP000?P0003h0000n0000?P000`00007o0001o`000Ol000?oP003oh000on000?oP00300000<0000",
+    "?oP000<3`000?P0003h0000n0000?P000`0000??0003c`000ll000<0000300000`0000<0000300000<0000<7`000<1`000?`0003l0000o0000?`000`0000>3P0",
+    "03Ph000h>000<0000300000`0000<0000300000<0000<1`000<0`000M`0007L0001g0000M`000`0000L3P0070h001`>000<0000300000`0000<0000300000<00",
+    "00<0h000<0`000M`0007L0001g0000M`000`0000L3P0070h001`>000<0000300000`0000<0000300000<0000<0h000<1`000L`0007<0001c0000L`000`0000L0",
+    "000700001`0000<0000300000`0000<0000300000<0000<0h000<3`000hh000>>0003SP000hh000`0000H0000600001P0000?n0003oP000oh000?n000300000<",
+    "0000<0H000?oP000hh000>>0003SP000hh000`0000H0000600001P0000?n0003oP000oh000?n000300000<0000<0H000?o0000hH000>60003QP000hH000`0000",
+    "H0000600001P0000<0000300000`0000<0000300000<0000<0H000<70001ol000Oo0007o`001ol000`0000L0000700001`0000<0000300000`0000<000030000",
+    "0<0000<0h000<70001ol000Oo0007o`001ol000`0000L3P0070h001`>000<0000300000`0000<0000300000<0000<0h000<3P001`L000L700071`001`L000`00",
+    "00L3P0070h001`>000<0000300000`0000<0000300000<0000<0h000<3P003P>000h3P00>0h003P>000`0000>3P003Ph000h>000<0000300000`0000<0000300",
+    "000<0000<1`000<3P003P>000h3P00>0h003P>000`0000??0003c`000ll000<0000300000`0000<0000300000<0000<7`000<1`003P>000h3P00>0h003P>000o",
+    "l0007o0001oP000Ol000?oP003oh000on000?oP00300000<0000?oP000<1`00707001`1`00L0L00707000ol0003l0000o0000?`000?oP003oh000on000?oP003",
+    "00000<0000?o000000000000000000000000000000000000000000H0000000000000000h00000000000000000000000000000000000000000000000000000000",
+    "000000000000O0000000000000000`0000000000000000000000000000000000000000000000000000000000000000000070000000000000000h000000000000",
+    "0000000000000000000000000000000000000000000000000000000070000000000000000l000000000000000000000000000000000000000000000000000000",
+    "00000000000000o00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000H000>>0000600",
+    "00700003<00000000000000LL0000l00001P0003<0000000000H000000000000000000001h0007l0000N0000?P0007L0000f000000000?h0000l00007P0007L0",
+    "001\\00001h000000000000000000007`0003h0001l0000O`000Oh0000f0000000007`0000l0000O0000Oh0001\\00007`00000000000000000000700001`0001`",
+    "0000hh000IP000000000000003P0000l0000L0000IP0000000007000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000?n0003`<000l30001o0000O`0007l0001o000000000ol000<1P0030H000`6000<1P0070>003ol0003l0000?oP003`<000l3000",
+    "7oP001oh000On0007oP00000000on000<1P0030H000`6000<1P007PN003ol0007n0000<7`003h<000n3000?W`003il000nO000?W`00000000`?000<1P0030H00",
+    "0`6000<1P003PL00060000?>0000<1`003h<000n3000>1`003PL000h7000>1`00000000`7000<1P0030H000`6000<1P001`h00060000>60000<0h003L<000g30",
+    "00L0h0070>001`3P00L0h003Q`000`3000<1P0030H000`6000<1P001`h00060000>>0000<0h003L<000g3000L0h0070>001`3P00L0h003c`000`3000<1P0030H",
+    "000`6000<1P000i`00060000<N0000<0h003><000cS000L0h0070>001`3P00L0h001o`000`7000<1P0030H000`6000<1P000o`00060000Ml0000o`H003><000c",
+    "S000H0H00606001P1P00H0H000oP000`?000<1P0030H000`6000<1P000OP00060000M`0000o`H0037<000ac000H0H00606001P1P00H0H000O0000on000<1P003",
+    "0H000`6000<1P000?000060000=l0000<0H0033\\000`k000H0H00606001P1P00H0H000O0000ol000<1P0030H000`6000<1P000?000060000<o0000<0h0033\\00",
+    "0`k000L0h0070>001`3P00L0h000oP000`L000<1P0030H000`6000<1P0006000060000<?P000<0h0031l000`O000L0h0070>001`3P00L0h001o`000`L000<1P0",
+    "030H000`6000<1P0006000060000<3P000<0h0031l000`O000L0h0070>001`3P00L0h003c`000`>000>3P003Ph000h>000>3P0006000060000<3P000<1`0030l",
+    "000`?000>1`003PL000h7000>1`003Q`000`>000>3P003Ph000h>000>3P0006000060000<1P000<7`0030l000`?000?W`003il000nO000?W`00000000`>000?_",
+    "P003kh000nn000?_P0006000060000<3P000?oP0030L000`70007oP001oh000On0007oP00000000`70007o0001o`000Ol0007o00006000060000<7P000?o0003",
+    "0L000`70003n0000oP000?h0003n000000000`70003n0000oP000?h0003n00006000060000<o0000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000<n000000000000000000000000000000000000000000000000000000000000000000000000000000060000<000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000>00000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000<0000000000000000000000000000000000000000000000000000000000000000000000000000000000000<000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000300000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000?0000000000000000000000000000000000000000000000000000000000000000000000000000000000000n000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000h000000000000000000000000000000000000000000000000000000",
+    "00000<00001P000700006<0000000000000006000000000hh0000600000000000000>>0000<0000>00000000000l00007P000?P0007L0000f0000`00000N0000",
+    "00000O`0000N000000000=P0007l0000l0000O000006<0003h0000O0000O`0007l0000f0000`00001l000000000?P0001l000000000=P0003h0003h0000oP000",
+    "06L0003P0000L0000hh0003h000000000`00001`000000000700001`000000000000001`0003P0001a`00006L000000000000000000000000000000`00000000",
+    "0000000000000000000000000000000000000000000006H000=`0001o0000O`0007l0001o0000`00007h0001n0000OP0003l0000o0000?`0003l000300000<00",
+    "007fH000?`0003oP000oh000?n0003oP000`0000?l0003o0000o`000?n0003oP000oh000?n000300000<0000?n0000?P0007WP001ih000NN0007WP000`0000>N",
+    "0003WP000ih000?>0003cP000lh000?>000300000<0000NN0000>000073P001`h000L>00073P000`0000L>00073P001`h000L700071`001`L000L7000300000<",
+    "0000L>0000>000001P0000H0000600001P000`0000L>00073P001`h000H300060`001P<000H3000300000<0000L60000<00001oP000Oh0007n0001oP000`0000",
+    "H0000600001P0000Oo0007o`001ol000Oo000300000<0000H60000<00003oP000oh000?n0003oP000`0000H0000600001P0000Oo0007o`001ol000Oo00030000",
+    "0<0000H60000<00007QP001hH000N60007QP000`0000H0000600001P0000H0000600001P0000H0000300000<0000H60000<000073P001`h000L>00073P000`00",
+    "00L>00073P001`h000L0000700001`0000L0000300000<0000L60000<000063P001Ph000H>00063P000`0000L>00073P001`h000L700071`001`L000L7000300",
+    "000<0000L>0000<00007_P001kh000Nn0007_P000`0000>N0007WP000ih000??0003c`000ll000??000300000<0000NN0000<00007oP001oh000On0007oP000`",
+    "0000?l0003o0000o`000?n0003oP000oh000?n000300000<0000?n0000<00003mP000oH000?f0003mP000`00007h0001n0000OP0007l0001o0000O`0007l0003",
+    "00000<00007f000000000000000000000000000000000000000000`000000000000000>000000000000000000000000000000000000000000000000000000000",
+    "000000000000n000000000000000>000000000000000000000000000000000000000000000000000000000000000000000>000000000000000?P000000000000",
+    "00000000000000000000000000000000000000000000000000000000>00000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000001n00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000`000LL0000<0000L00006H00000000000001a`0001h00000`0001",
+    "V0000000001P000000000000000600003`000?h0000l0000n0000>h0003H000000000oP0001h00003`0003^0001\\00007P000000001P00000oP000?P0007`000",
+    "3h0001o0000o`0003H000000000O00001h0000?P000?l0001\\0000O0000H00001P00000oP000>00003P0003P0003SP000c000000000000000>00001h0000>000",
+    "0<`000000000L0000H000000000006000000000000000000000000000000000000<000000000000000000000000000000000000H00000000007f0003OP000gh0",
+    "007l0001o0000O`0007l0000<0000g0000<300030`000`<000<300061P001o0000000000?n0003o`000ol000?n0003oP000oh000?n000000000o0000<300030`",
+    "000`<000<300073P001o0000000000NN0003k`000nl000?N0003gP000mh000?N000000000n0000<300030`000`<000<300073P000H0000000000L>0003Q`000h",
+    "L000L700071`001`L000L70007oh000h0000<300030`000`<000<30003S0000H0000000000L60003P`000h<000L700071`001`L000L70007oh000h0000<30003",
+    "0`000`<000<30003W0000H0000000000H600030`000`<000H300060`001P<000H3000000000`0000<300030`000`<000<30001W0000H0000000000H600030`00",
+    "0`<000H300060`001P<000H3000000000`0000<300030`000`<000<30001f0000H0000000000H600030`000`<000H300060`001P<000H30000<0000`0000<300",
+    "030`000`<000<30001n0000H0000000000L600030`000`<000L700071`001`L000L70000<0000`0000<700031`000`L000<70000n0000H0000000000L>00030`",
+    "000`<000L700071`001`L000L7000000000`0000>70003Q`000hL000>70000l0000H0000000000NN00030`000`<000?N0003gP000mh000?N000000000`0000?O",
+    "0003g`000ml000?O0000L0000L0000000000?n00030`000`<000?n0003oP000oh000?n000000000`0000?o0003o`000ol000?o0000L0000OP0000000007f0003",
+    "0`000`<0007h0001n0000OP0007h000000000`00007k0001n`000O\\0007k0000H0000?P000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000h0000000000000000000000000000000000000000000000000000000000000000000000000000000000001h0000600000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000007`0000>00000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000007P0000<0000000000000000000000000000000000000000000000000000000000000000000000000000000000000<000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+};
 
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`000000000000Ooo`07ool0000000Ooo`07o";
-    sDataString += "ol007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`000000000000Ooo`07ool0000000Ooo`07ool00600<01P0300H00`0600<01P0300H00`0600<01";
-    sDataString += "P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0";
-    sDataString += "600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<";
-    sDataString += "01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00";
-    sDataString += "`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`060";
-    sDataString += "0<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H";
-    sDataString += "00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0";
-    sDataString += "600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<000000";
-    sDataString += "0H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00";
-    sDataString += "`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000";
-    sDataString += "000H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`000000000000H00`0600<0000000H00`0600<007ool01ooo00Ooo`07ool01ooo00O";
-    sDataString += "oo`07ool01ooo00Ooo`000000000000Ooo`07ool0000000Ooo`07ool007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`000000000000Ooo`07ool00";
-    sDataString += "00000Ooo`07ool000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007ool01ooo00Ooo`07o";
-    sDataString += "ol01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00O";
-    sDataString += "oo`07ool01ooo00Ooo`07ool00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0";
-    sDataString += "600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P030";
-    sDataString += "0H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00";
-    sDataString += "`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0";
-    sDataString += "300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H";
-    sDataString += "00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01";
-    sDataString += "P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P030";
-    sDataString += "0H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<";
-    sDataString += "01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0";
-    sDataString += "300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<01P0300H00`0600<00600<01P0300H00`0600<01P0300H00`0600<01P0300H00`060";
-    sDataString += "0<01P0300H00`0600<01P0300H00`0600<007ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool007ool01";
-    sDataString += "ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool01ooo00Ooo`07ool00000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000600000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000600000000000000000000000000000000000000000000000000000000000000000000300001\\00001cP000oP000n3P001n0006";
-    sDataString += "00000<0000H000006000000000000000000000000001P00000000300001\\00001S0001o`001o7P003o000600000L0000L0000060000000000000000000000000";
-    sDataString += "03P00000000300001\\00003W0003gh001g70003W000600000H0000<000006000030000000000000000000003000000000300001\\00003W0003Vh001W>0003300";
-    sDataString += "0600000h0000>00001fL00030000000000000000000007000000000300001\\00003W000360001S>00037000600000`0000600001ol0003000000000000000000";
-    sDataString += "0006000000000300001\\0000?o`003V0001SL0003W000600001`0000700000oh0003000000000000000000000>000000000300001\\0000Oo`003n0001gL0003o";
-    sDataString += "000600001`0000700000?P0003000000000000000000000<000000000300000000003W0001oP001oh0003n000000001`0000700000M`001on000000000000000";
-    sDataString += "00000L00000000030000000000360000o`000oo`00?hL00000001P0000300000hh001on00000000000000000000H000000000300000000007>00007h0001oh00";
-    sDataString += "?mL00000001P0000300000hh00030000000007P0000000000h00000000030000000000Oo`0006h0003^h00LLL00000001P00003000000000030000000007P000";
-    sDataString += "0000000`00000000030000000000OoP0006H0003\\h00L>h00000001P0000300000000003000000000000000000001`000000000300000000007>00076h0007<H";
-    sDataString += "00H7h00000001P0000300000000003000000000000000000001P000000000000000000007>0007gh0007<H00L7`00000001`0000700000000003000000000000";
-    sDataString += "000000003P000000000000000000007>0003o`000>>h00O?`00000001`00007000000000000000000000000000000030000000000300000000006<0001o`000N";
-    sDataString += "?h00?ol00000001`00007000000000000000<0000000000`00007000000000030000000000>L000060000L7`007ll00000000`00006000000000000000<00000";
-    sDataString += "00000`00006000000000000000000000000000600000000000000000000h0000>000000000000000<000000000000000>0000000000000000000000000000000";
-    sDataString += "00000000000000000H0000<000000000000000<000000000000000<000000000000000000000000000000000000000000000000L0000L0000000000000000000";
-    sDataString += "000000000000L000000000000000000000000000000000000000000000000<0000H0000000000000000000000000000000H00000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000003n000060000?h0003n00007P000On0003o0003oh000?h0003n0000000000000000000000000000007l00007o0000>0000ol000";
-    sDataString += "7o0000?P000on0007oP003oh000Ol000?o000000000000000000000000000000?n0000??P000n0000ln000?WP000?P000h0000?W`0000`000lN000??P0000000";
-    sDataString += "0000000000000000000000??0000>3P003n0001`>000>3P000MP000h0000>1`0001`000h>000L3`000000000000003P00000000h0000L70000L1`003f0001`60";
-    sDataString += "0001P000MP000h0000L000001P000`6000L1`00300000`00000?P00000000n0000L30000L1`00360001P600003P000iP000oh000L0000030000h>000H1`00300";
-    sDataString += "000`00000o000000000OP000L30000L1`000600000>0000?P001aP000on000Mo000070000nl000L1`00000000000003l0003oh0007h000070000H0`000600000";
-    sDataString += ">0001o0001aP000nN000OoP00060000Oh000L3`0000000000000?P0003oh0000n0000?0000H0`000600000L0001o0003QP000h7000OW`000>0000?n000O?`000";
-    sDataString += "0000000000>00000000000>0000n0000H0`000600000h00007P007QP00007000N1`000>0000no000?o`0000000000000?P0000000000n0001h0000L1`0006000";
-    sDataString += "01`00001`0071P00003000L1`000<0001`?0007m`00000000000003l0003oh0007h0001`0000L1`000600007P00000`007ol00003000L0`000L0001`700001`0";
-    sDataString += "0000000000000o0003oh000OP0001P0000L1`00060000?0000L0`007ol001`7000L1`000L0001P300001`00000000000000?P00000000n00001P0000>3P00060";
-    sDataString += "000n0000L1`0001P001`7000>1`000L0001`7000L3P000000000000003P00000000h0000000000?WP00060001h0000?7`0001P001lN000?WP000H0001lO000O?";
-    sDataString += "P000000000000000000000000000000000007o0003ol001on000?oP0001P000ol0007oP000H0000on000?o000300000`000000000000000000001P00003n0003";
-    sDataString += "ol001on0003o00001P000?h0003n0000H0000Ol0007l000300000`000000000000000000001P0000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000`0000000000000000000000000000000000000000000000000000000000000000000000000000000000000`000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000o`000?P000ol0003l0003oP000on000?oP000";
-    sDataString += "O`000`3000<00000<0000`3P00<00003`3`00l30001o00003ol000?P000on0007o0003oh000on000?oP001oh000`3000<00000<0000`7000<00003`3`00l3000";
-    sDataString += "7oP0007an000?P000`N000??00031l000`0000<00003il000`3000<00000<0000`>000<00003h7`00n3000?W`000?0>000?`000`>000>3P0030L000`0000<000";
-    sDataString += "03PL000`3000<00000<0000`L000<00003h7`00n3000>1`000>07000M`000`6000L3P0030>000`0000<000070L000`3000<00000<0000`l000<00003L7`00g30";
-    sDataString += "00L0h000Log000M`000`>000L3P0030>000`0000<0000700000`3000<00000<0000ah000<00003L>`00g3000L0h000Moc000L`000`L000L000030>000`0000<0";
-    sDataString += "000700000`3000<00000<0000ch000<00003L>`00cS000L0h000Ikc000hh000oh000H0000306000oh000?o000600000oo000<00000<0000gh000<00003>>`00c";
-    sDataString += "S000H0H000Iag000hh000on000H0000306000oh000?o00063l000oo000<00000<0000oL000<00003><`00ac000H0H000IQW000hH000`?000H0000306000`0000";
-    sDataString += "<000063l000`3000<00000<0000nL000<00003>L`00`k000H0H000Mc_001ol000`7000L000030>000`0000<000070<000`3000<00000<0000l>000<000037L`0";
-    sDataString += "0`k000L0h000Mon001ol000`3000L3P0030>000`0000<000070<000`3000<00000<0000h>000<000037H`00`O000L0h000>nl001`L000`3000L3P0030>000`00";
-    sDataString += "00<000070L000`3000<00000<0000`7000<000033h`00`O000L0h000?00003P>000`7000>3P0030L000`0000<00003PL000`3000<00000L0000`7000<000033h";
-    sDataString += "`00`?000>1`0007hl003P>000`?000??00031l000`0000<00003il000`3000<00000l0000`3P00<000033``00`?000?W`0003ol003P>000on0007o0003oh000o";
-    sDataString += "n000<00001ol000`3000<00007h0000`1`00?o00031``00`70007oP0000oh00707000ol0003l0003o`000on000<00000oT000`3000<00007`0000`1`00?o0003";
-    sDataString += "1``00`70003n00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000?n0000OP000ol0003n0007oh000`6000L1`0070h>00h>000L0h007o`000n0000H00007`0000?P000000000?o0001oh000on000";
-    sDataString += "7o0007oh000`6000L1`003Ph<00h>000N1h007o`000n0000L00007`0000?P000000000<7P003il000`?000??P000<0000`6000L1`003QlL00LL000>1`0001`00";
-    sDataString += "0`0000<00000`0000O`000000000<3P003PL000`7000>3P000<0000`6000>3P003QlL00>h00073P0003P000`0000>00000`0000M`000000000<1P0070>000`30";
-    sDataString += "00<3P000<0000`6000>3P001QlL00>h00073P0003P000`0000600000`0000hh000000000<1P0070>000`3000>00000<0000`6000>3P001alL007`0003W000070";
-    sDataString += "000`0000700000`0000hh000000000<3P0070>000`7000?00000<0000`6000770001a\\H007`0003o0000>0000`0000300000`0001`L000000000<7P00606000`";
-    sDataString += "?0007n0000<0000`6000770001c^h003P0001n0000>0000`00003P0000`0001`L000000000?o000606000on0003oP000<0000`6000770000c^h007`0000l0000";
-    sDataString += "L0000`00001P0000`000000000000000?n000606000ol0000O`000<0000`6000360000k^h007`0000l0000h0000`00001`0000`000000000000000<000070>00";
-    sDataString += "0`L00001`000<0000`60003^0000k^h00?h0000H0000h0000`00000`0000`000000000000000<000070>000`L00000`000<0000`60003^0000k6`00>h0000H00";
-    sDataString += "01`0000`00000h0000`000000000000000<000070>000`>000L0`000<0000h>0001l0000O7`00LL0000H0003P0000`00000H0000`000000000000000<00003PL";
-    sDataString += "000`>000L1`000<0000h>0001l0000O7`00LL0000H0003P0000`00000L0000`000000000000000<00003il000`>000?W`000<0000nn0001l0000O7`00h>0000H";
-    sDataString += "000700000`00000<0000`000000000000000<00001oh000`70007oP000<0000Ol0001l0000O7`01h70000H0007o`000`00000>0000`000000000000000<00000";
-    sDataString += "o`000`70003o0000<0000?h0000h0000>3P01`70000H0007o`000`0000060000`000000000000000000000300000000000000000000000000000000000000000";
-    sDataString += "00000000000`0000070000`0000000000000000000003P000000000000000000000000000000000000000000000000000`0000030000`0000000000000000000";
-    sDataString += "003l000000000000000000000000000000000000000000000000000n000003P007`000000000Oo`0000000001l00000000000000000000000000000000000000";
-    sDataString += "0000000000000n000001P007`000000000Oo`0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000<0000000000000000000000000000000000000000000000000000000000000000000000000000000000000?0000000000`00000000001P000000003h0000";
-    sDataString += "00000`0000<00000H0000`0000<0000000000000000000007`000000000`00000000001P000000007h000000000`0000<00000H0000`0000<000000000000000";
-    sDataString += "0000001`000000000`00000000001P000000007000000L000`000000000000000`0000<00000000000000000000000000000000`00000000001P000000006000";
-    sDataString += "000l000`000000000000000`0000<000000000000000000000000001o0000g`0007h0001mP000?`000O`0000o`000gh000<00000H0000`L000<00003O?P00gh0";
-    sDataString += "007l0000000003oP000oh000?l0003oP000oh000O`0001oP000ol000<00000H0000`h000<00003oo`00ol000?n0000000007WP000ll000>N0007WP000lh00060";
-    sDataString += "0003c`000nl000<00000H0000a`000<00003gk`00nl000?N00000000073P000hL000L>00073P001`L000600003Q`000hL000<00000H0000cP000<00003Sa`00h";
-    sDataString += "L000L700000000001P000`L000L>00071P001P<0006000030`000h<000<00000H0000gP000<000031``00h<000L70000000001oP000`<000H000061P001ol000";
-    sDataString += "600003c`000`<000<00000H0000oP000<000031P`00`<000H30000000003oP000`<000H000061P001ol000600003o`000`<000<00000H0000o`000<000031P`0";
-    sDataString += "0`<000H30000000007QP000`<000H000061P001P0000600001o0000`<000<00000H0000m`000<000031P`00`<000H300000000073P000`L000L>00071P001`00";
-    sDataString += "00600003P0000`<000<00000H0000h`000<000031P`00`<000L700000000063P000hL000L>00073P001`L000600003`0000`<000<00000H0000`h000<000031P";
-    sDataString += "`00`<000L70000000007_P000ll000>N0007WP000ll000600003oh000`<000<00000H0000`h000<000031P`00`<000?N0000000007oP000oh000?l0003oP000o";
-    sDataString += "h000600003ol000`<000<00000H0000`L000<000031P`00`<000?n0000000003mP000g`0007h0001mP000O`0006000070l000`<000<00000H0000`L000<00003";
-    sDataString += "1P`00`<0007h0000000000000000000000000000000000000000060<00000000000000H000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000007al00000000000000h000000000000000000000000000000000000000000000000000000000000000000007ol00000000000007h0000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000003o`00000000000007`0000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000007ool00000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000007ool0000000000000000000000000000000000000000000000000000000000000>00001P00070000000000600<000000000000000000";
-    sDataString += "000001P000000000000000000000000000000000000N00001P0007P000000000600<000000000000000000000001P00000000000000000000000000000000000";
-    sDataString += "0L00001P0003P000000000600<000000000000000000000001P000000000000000000000000000000000000H00001P0001P000000000600<00=l0001mP000g00";
-    sDataString += "00?`0007l0000`<000L>000773001`h000H60003o0000H00001P0001P000000000600<00?n0003oP000o0000Oh0007l0000`<000L>00077W000ih000L>0003o0";
-    sDataString += "000H00001P0001P000000000600<00??0007WP000n0000Ll0001P0000`<000L>0007?W000i`000L>000070000H00001P0001P0000o3000600<00>700073P000h";
-    sDataString += "0000HL0001P0000`<000>>0007?W000OP000><0000>0000H00001P0001P0000og000600<00>700071P000h0000L00001P0000`<000><0003_^000?P000>L0000";
-    sDataString += "L0000h00001P0001`0001gn000600<00<300061P000`0000O`0001P0000`<000>L0003_^000?00006L0000L0000h00001P0001`0001Qn000600<00<300061P00";
-    sDataString += "0`0000?l0001P0000`<0007L0003]^000?00007H0000h0000h00001P0001`000000000600<00<300061P000`00001n0001P0000`<0007L0003]\\000?P0007h00";
-    sDataString += "01`0000h00001P0001`000000000600<00<700073P000`00000>0001P0000`L0007L0001ml000OP0003h0003P0000H00001P0001P000000000600<00>700073P";
-    sDataString += "000`0000L60001P0000hL0003h0001ml000M`0003`0003P0000H00001P0001P000000000600<00??0007WP000`0000NN0001`0000ml0003h0001ml000hh0001`";
-    sDataString += "000700000H00001P0001P000000000600<00?n0003oP000`0000?n0001n0000ol0003h0001ih001hh0001`0007o0000H00001P0001P0000000007ool00=l0001";
-    sDataString += "mP000`00007l0000n0000O\\0003h0000hh001`L0001P0007o0000H00001P0001P0000000007ool00<000001P0000000000000000000000000000000000000000";
-    sDataString += "3P000000000H00001P0001P000000000000000<000001P00000000000000000000000000000000000000007P000000000L00001P0003P000000000000000<000";
-    sDataString += "001P0000000000000000000000000000000000000000O0000000000N00001P0007P000000000000000<000001P00000000000000000000000000000000000000";
-    sDataString += "00N0000000000>00001P000700000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001a`0000000001P001a`000hh0000<00";
-    sDataString += "00000000000000000000000000000000000000000000000000000000oP0000000007P000oP000O`0000l00000000000000000000000000000000000000000000";
-    sDataString += "00000000000000O0000000000O0000O0000?P0003h0000000001ooo00000007ool00000000000000000000000Ooo`0000000>0000000000L0000>0000700003P";
-    sDataString += "0000000001ooo00000007ool00000000000000000000000Ooo`0000000000000000000000000000000000000001o0001P030000000600<0000000000000`0000";
-    sDataString += "<0000H00`0?Ph000oP000000003n0007oh001ol000Oo00003oP001P030000000600<0000000000000`0000<0000H00`0Oah001o`000000007o0007oh001ol000";
-    sDataString += "Oo00007g`001P030000000600<0000000000000`0000<0000H00`0Ma`003ch00000000??P000<00000L00007000071`001P030000000600<0000000000000`00";
-    sDataString += "00<0000H00`0IcP003Ph00000000>3P000<00000h0000>0000>1`001P030000000600<0000000000000`0000<0000H00`0HcP0030h00000000<3P000<00000h0";
-    sDataString += "000>0000>00001P030000000600<000000000000OoP007oh000H00`0Hg0003P000000000>00000<00001`0000L0000oh0001P030000000600<000000000000Oo";
-    sDataString += "P007oh000H00`0Mg0003`000000000?00000<00003P0000h0000oh0001P030000000600<0000000000000`0000<0000H00`0On0001oP000`00007n0000<00003";
-    sDataString += "P0000h0000<00001P030000000600<0000000000000`0000<0000H00`0?ol?P0oh000`00003oP000<0000700001`0000<00001P030000000600<000000000000";
-    sDataString += "0`0000<0000H00`00OnO`07l001`00000O`000<0000>00003P0000oh0001P030000000600<0000000000000`0000<0000H00`00k^M`00L001`000001`000<000";
-    sDataString += "0>00003P0000oh0001P030000000600<0000000000000`0000<0000H00`00k>I`00<001`000000`000<0000L0000700000>1`001P030000000600<0000000000";
-    sDataString += "000`0000<0000H00`01c6H`70<000`0000L0`000<0000h0000>00000>1`001P030000000600<0000000000000`0000<0000H00`01c6H`70L000`0000L1`000<0";
-    sDataString += "000h0000>000007W`001P030000000600<0000000000000`0007oh000H00`03S^M`3il00000000?W`000<0001`0000L000003oP001ooo00`00007ool03H0000H";
-    sDataString += "``000`0007oh000Ooo`07SnO`1oh000000007oP000<0001ol000Oo00001o0001ooo00`00007ool03H0000H``000`0000<0000Ooo`071l?P0o`000000003o0000";
-    sDataString += "<0001ol000Oo000000000000000`0000000003H0000000000`0000<0000000000000000000000000000000000000000000000000000000000`0000000003H000";
-    sDataString += "0000000`0000<00000000000000000000000000000000000000000000000000000000000000000000000000000000`0000<00000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000`0000<00000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007ool00000000000000";
-    sDataString += "0000000000000000000000000Ooo`0000000000000000000000030000000000000007ool000000000000000000000000000000000000000Ooo`0000007700000";
-    sDataString += "000006000070000hh000060000600<0300000`00006`0003H00000000000000000000H00`0Oka`03n0000000000N000070000O`0000N0000600<0300000`0000";
-    sDataString += "6`0003H00000000000000000000H00`0Oka`01l0000000001l0001V0000?P0001l0000600<0300000`00006`0003H00000000000000000000H00`033c`00h000";
-    sDataString += "0000001`0001V0000700001`0000600<0300000`00006`0003H00000000000000000000H00`033k`000000000000000001P000000000000000600<0000000000";
-    sDataString += "00000000000000000000000000000H00`033k`03l000000000?`0007l0000o`000?l0000600<000000000000000000000003h00000000000000H00`033N`07n0";
-    sDataString += "00000000Oh0007l0000o`000?l0000600<000000000000000000000007l00000000000000H00`033N`07?000000000Ll0001P00001`0000L0000600<00000000";
-    sDataString += "0000000000000007l00000000000000H00`033N`0670001P0000HL0001P00003P0000h0000600<000000000000000000000007l00000000000000H00`033<`07";
-    sDataString += "00001P0000L00001P0000700001`0000600<000000000000000000000007l000?oP00?ooP00H00`0000007l0001`0000O`0001P0000700001`0000600<000000";
-    sDataString += "000000000000000007l000?oP00?ooP00H00`0000003o0001`0000?l0001P0000>00003P0000600<000000000000000000000003h00000000000000H00`00000";
-    sDataString += "00OP001`00001n0001P0000L0000700000600<000000000000000000000000000000000000000H00`00000003P001P00000>0001P0000h0000>00000600<0000";
-    sDataString += "00000000000000000000000000000000000H00`00000071P001P0000L60001P0000h0000>00000600<000000000000000000000000000000000000000H00`000";
-    sDataString += "0007WP00000000NN0001`0001`0000L000007ool000000000000000000000000000000000000000Ooo`0000003oP00000000?n0001n0001o`000Ol00007ool00";
-    sDataString += "0000000000000000000000000000000000000Ooo`0000001o0000000007l0000n0001o`000Ol0000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000`00000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000`00000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000003SP000H`0000000000000000000000000000000000000000000000000000000000000000000000000000001o0000M`000<00000000003h0001P0000";
-    sDataString += "oP000K00000oP001o000000000000000000003n000Oo0000000000n0000O`000<000060>0003h0001P0003o`000K00003oh003oP0000000000000000000?oP00";
-    sDataString += "Oo0000000000L0000?P000<00007On0003h0001P0003ch000000007al007W`0000000000000000000O7`000700000000000000000000<00007on0003h0001P00";
-    sDataString += "030h00000000?0N0071`0000000000000000000l1h000>00000000000000000000<P0003il0007L0001P0003P000000000>O>0061`0000000000000000000inh";
-    sDataString += "000>00000000000000000000=P0003PL0007L0001P0003h000000000LoW007000000000000000000001anL000L00000000000000000000?P0003PL0007L0001P";
-    sDataString += "0001o000000000LkW007P00000000000000000001a^L000h00000000000000000000?P00030<000>>0001P0001o`00000000Hh3003o0000f000000000000001Q";
-    sDataString += "^<000h00000000000000000000O000030<000>>000000003Wh00000000H`3001o`000f000000000000001Qn<001`00000000000000000000l00003PL000>>000";
-    sDataString += "0000030h00000000HkS000?h001n0000000007P0001Qn<003P00000000000000000000l00003PL000Oo000000003PH00000000LkW0000h001n0000?oP007P000";
-    sDataString += "1a^L003P00000000000000000000l00003il000Oo000000003`h00000000LoW0000H001n0000?oP00000001aVL007000000000000000000000\\00007on000L70";
-    sDataString += "00000003o`00000000>O>00>0H000f000001P00000000iVh00>000000000000000000000<00007On000h3P001P0000o`00000000?0N00>0h000f000001P00000";
-    sDataString += "000l1h00>000000000000000000000<000060>000h3P001P00007h000000007al007ch0000000001P00000000O7`00L000000000000000000000?o000000000h";
-    sDataString += "3P001P00000h000000003oh003o`0000000001P00000000?oP00Oo00000000000000000000?o000000001`1`001P00000H000000000oP001oP0000000001P000";
-    sDataString += "000003n000Oo000000000000000000000000000000003P001P00070h00000000000000H000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0030001P0007ch00000000000000O000000000000000000000000000000000000000000000000000000000003P001P0003o`0000000000000070000000000000";
-    sDataString += "00000000000000000000000000000000000000000000003`001P0001oP0000000000000070000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000o0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001P000000000000000000000000000000000000";
-    sDataString += "0000000000<`000000000000001l000000000000006000007P00000000?o`00000000000000000000000000000<H0000M`000c00001P00003n00000000000000";
-    sDataString += "600000O000000000?o`00000000000000000000000000000<h0001oP000g00001P00003^0000<000000000600000L000000000Lc000000000000000000000000";
-    sDataString += "000000<h0001V0000g0000000000360000<0000000006000000000000000Hc000000000000000000000000000000<`000000000f00000000003^0000<0000000";
-    sDataString += "0060000000000`H000Hc000000000000007l0003l000000000<`000000000f0000?l00003n0000<0000000006P000000000`H000Hc00000000000000?n0007n0";
-    sDataString += "00000000<0000000000`0000?l00001l0000<0000000007P000000000`H000Lc00000000000000NN0007?000000000<0000000000`00000L0000000007oh0000";
-    sDataString += "00007P000000000`H000Oc00000000000000L>000670001\\0000<0000000000`00000h0000000007oh00000000?0000000000`H000?c00000000000000060007";
-    sDataString += "00001\\0000<0000000000`00001`0000000000<000000000N0000000000`H0000c000000000000007n0007l0001n0000<0000000000`00001`0000000000<000";
-    sDataString += "000000N0000000000`H0000c00060000000000?n0003o0001n0000<0000000000`00003P0000000000<000000000F0000000000`H0000c00060000000000N600";
-    sDataString += "00OP001n0000<0000000000`0000700000000000<00000000060000000000`H0000c00000000000000L>00003P001\\0000<0000000000`0000>00000000000<0";
-    sDataString += "0000000060000000000hh0000c00000000000000H>00071P001\\0000<0000000000`0000>00000000000000000000060000000000mh0000c00000000000000Nn";
-    sDataString += "0007WP00000000<0000000000`0000L00000000007oh0000000060000000000oh0000c00000000000000On0007oP00000000?o000000000`0000Ol0000000007";
-    sDataString += "oh0000000060000000000oH0000c00000000000000?f0003o000000000?o000000000`0000Ol0000000000000000h00000000000000`00000c000000000<0000";
-    sDataString += "0>0000@0000000000000000000000000000000000000000000`00000000000000`00000c000000000?P0000<0000n00000000000000000000000000000000000";
-    sDataString += "00000000h00000000000000`00000c0000000003P0000>0000>0000000000000000000000000000000000000000000n00000000000000`00000c0000000003P0";
-    sDataString += "000?P000>00000000000000000000000000000000000000000000000000000000000000000000000000OP000000000n000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000600000H0001`0001S0000000003000003000000000LL0000300000000000000770000H0000>00007700";
-    sDataString += "000N00001h0003h0001g0000=P000?00000?000000000?h0000?0000000006`0003n0001h0000O00003n00001l00007`0007l0001o0000=P000n00000n000000";
-    sDataString += "0007`0000n0000000006`0001l0007`0000oP0001l00001`000070000>>0000n000000000h00000h0000000003P0000h000000000000000h000700001a`0000h";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000?o0000?P0003h0000n0000?P000`00003l0000";
-    sDataString += "o0000?`000?oP003oh000on000?oP00300000<0000?n0000?oP000?P0003h0000n0000?P000`00007o0001o`000Ol000?oP003oh000on000?oP00300000<0000";
-    sDataString += "?oP000<3`000?P0003h0000n0000?P000`0000??0003c`000ll000<0000300000`0000<0000300000<0000<7`000<1`000?`0003l0000o0000?`000`0000>3P0";
-    sDataString += "03Ph000h>000<0000300000`0000<0000300000<0000<1`000<0`000M`0007L0001g0000M`000`0000L3P0070h001`>000<0000300000`0000<0000300000<00";
-    sDataString += "00<0h000<0`000M`0007L0001g0000M`000`0000L3P0070h001`>000<0000300000`0000<0000300000<0000<0h000<1`000L`0007<0001c0000L`000`0000L0";
-    sDataString += "000700001`0000<0000300000`0000<0000300000<0000<0h000<3`000hh000>>0003SP000hh000`0000H0000600001P0000?n0003oP000oh000?n000300000<";
-    sDataString += "0000<0H000?oP000hh000>>0003SP000hh000`0000H0000600001P0000?n0003oP000oh000?n000300000<0000<0H000?o0000hH000>60003QP000hH000`0000";
-    sDataString += "H0000600001P0000<0000300000`0000<0000300000<0000<0H000<70001ol000Oo0007o`001ol000`0000L0000700001`0000<0000300000`0000<000030000";
-    sDataString += "0<0000<0h000<70001ol000Oo0007o`001ol000`0000L3P0070h001`>000<0000300000`0000<0000300000<0000<0h000<3P001`L000L700071`001`L000`00";
-    sDataString += "00L3P0070h001`>000<0000300000`0000<0000300000<0000<0h000<3P003P>000h3P00>0h003P>000`0000>3P003Ph000h>000<0000300000`0000<0000300";
-    sDataString += "000<0000<1`000<3P003P>000h3P00>0h003P>000`0000??0003c`000ll000<0000300000`0000<0000300000<0000<7`000<1`003P>000h3P00>0h003P>000o";
-    sDataString += "l0007o0001oP000Ol000?oP003oh000on000?oP00300000<0000?oP000<1`00707001`1`00L0L00707000ol0003l0000o0000?`000?oP003oh000on000?oP003";
-    sDataString += "00000<0000?o000000000000000000000000000000000000000000H0000000000000000h00000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000O0000000000000000`0000000000000000000000000000000000000000000000000000000000000000000070000000000000000h000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000070000000000000000l000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000o00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000H000>>0000600";
-    sDataString += "00700003<00000000000000LL0000l00001P0003<0000000000H000000000000000000001h0007l0000N0000?P0007L0000f000000000?h0000l00007P0007L0";
-    sDataString += "001\\00001h000000000000000000007`0003h0001l0000O`000Oh0000f0000000007`0000l0000O0000Oh0001\\00007`00000000000000000000700001`0001`";
-    sDataString += "0000hh000IP000000000000003P0000l0000L0000IP0000000007000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000?n0003`<000l30001o0000O`0007l0001o000000000ol000<1P0030H000`6000<1P0070>003ol0003l0000?oP003`<000l3000";
-    sDataString += "7oP001oh000On0007oP00000000on000<1P0030H000`6000<1P007PN003ol0007n0000<7`003h<000n3000?W`003il000nO000?W`00000000`?000<1P0030H00";
-    sDataString += "0`6000<1P003PL00060000?>0000<1`003h<000n3000>1`003PL000h7000>1`00000000`7000<1P0030H000`6000<1P001`h00060000>60000<0h003L<000g30";
-    sDataString += "00L0h0070>001`3P00L0h003Q`000`3000<1P0030H000`6000<1P001`h00060000>>0000<0h003L<000g3000L0h0070>001`3P00L0h003c`000`3000<1P0030H";
-    sDataString += "000`6000<1P000i`00060000<N0000<0h003><000cS000L0h0070>001`3P00L0h001o`000`7000<1P0030H000`6000<1P000o`00060000Ml0000o`H003><000c";
-    sDataString += "S000H0H00606001P1P00H0H000oP000`?000<1P0030H000`6000<1P000OP00060000M`0000o`H0037<000ac000H0H00606001P1P00H0H000O0000on000<1P003";
-    sDataString += "0H000`6000<1P000?000060000=l0000<0H0033\\000`k000H0H00606001P1P00H0H000O0000ol000<1P0030H000`6000<1P000?000060000<o0000<0h0033\\00";
-    sDataString += "0`k000L0h0070>001`3P00L0h000oP000`L000<1P0030H000`6000<1P0006000060000<?P000<0h0031l000`O000L0h0070>001`3P00L0h001o`000`L000<1P0";
-    sDataString += "030H000`6000<1P0006000060000<3P000<0h0031l000`O000L0h0070>001`3P00L0h003c`000`>000>3P003Ph000h>000>3P0006000060000<3P000<1`0030l";
-    sDataString += "000`?000>1`003PL000h7000>1`003Q`000`>000>3P003Ph000h>000>3P0006000060000<1P000<7`0030l000`?000?W`003il000nO000?W`00000000`>000?_";
-    sDataString += "P003kh000nn000?_P0006000060000<3P000?oP0030L000`70007oP001oh000On0007oP00000000`70007o0001o`000Ol0007o00006000060000<7P000?o0003";
-    sDataString += "0L000`70003n0000oP000?h0003n000000000`70003n0000oP000?h0003n00006000060000<o0000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000<n000000000000000000000000000000000000000000000000000000000000000000000000000000060000<000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000>00000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000<0000000000000000000000000000000000000000000000000000000000000000000000000000000000000<000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000300000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000?0000000000000000000000000000000000000000000000000000000000000000000000000000000000000n000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000h000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000<00001P000700006<0000000000000006000000000hh0000600000000000000>>0000<0000>00000000000l00007P000?P0007L0000f0000`00000N0000";
-    sDataString += "00000O`0000N000000000=P0007l0000l0000O000006<0003h0000O0000O`0007l0000f0000`00001l000000000?P0001l000000000=P0003h0003h0000oP000";
-    sDataString += "06L0003P0000L0000hh0003h000000000`00001`000000000700001`000000000000001`0003P0001a`00006L000000000000000000000000000000`00000000";
-    sDataString += "0000000000000000000000000000000000000000000006H000=`0001o0000O`0007l0001o0000`00007h0001n0000OP0003l0000o0000?`0003l000300000<00";
-    sDataString += "007fH000?`0003oP000oh000?n0003oP000`0000?l0003o0000o`000?n0003oP000oh000?n000300000<0000?n0000?P0007WP001ih000NN0007WP000`0000>N";
-    sDataString += "0003WP000ih000?>0003cP000lh000?>000300000<0000NN0000>000073P001`h000L>00073P000`0000L>00073P001`h000L700071`001`L000L7000300000<";
-    sDataString += "0000L>0000>000001P0000H0000600001P000`0000L>00073P001`h000H300060`001P<000H3000300000<0000L60000<00001oP000Oh0007n0001oP000`0000";
-    sDataString += "H0000600001P0000Oo0007o`001ol000Oo000300000<0000H60000<00003oP000oh000?n0003oP000`0000H0000600001P0000Oo0007o`001ol000Oo00030000";
-    sDataString += "0<0000H60000<00007QP001hH000N60007QP000`0000H0000600001P0000H0000600001P0000H0000300000<0000H60000<000073P001`h000L>00073P000`00";
-    sDataString += "00L>00073P001`h000L0000700001`0000L0000300000<0000L60000<000063P001Ph000H>00063P000`0000L>00073P001`h000L700071`001`L000L7000300";
-    sDataString += "000<0000L>0000<00007_P001kh000Nn0007_P000`0000>N0007WP000ih000??0003c`000ll000??000300000<0000NN0000<00007oP001oh000On0007oP000`";
-    sDataString += "0000?l0003o0000o`000?n0003oP000oh000?n000300000<0000?n0000<00003mP000oH000?f0003mP000`00007h0001n0000OP0007l0001o0000O`0007l0003";
-    sDataString += "00000<00007f000000000000000000000000000000000000000000`000000000000000>000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000n000000000000000>000000000000000000000000000000000000000000000000000000000000000000000>000000000000000?P000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000>00000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000001n00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000`000LL0000<0000L00006H00000000000001a`0001h00000`0001";
-    sDataString += "V0000000001P000000000000000600003`000?h0000l0000n0000>h0003H000000000oP0001h00003`0003^0001\\00007P000000001P00000oP000?P0007`000";
-    sDataString += "3h0001o0000o`0003H000000000O00001h0000?P000?l0001\\0000O0000H00001P00000oP000>00003P0003P0003SP000c000000000000000>00001h0000>000";
-    sDataString += "0<`000000000L0000H000000000006000000000000000000000000000000000000<000000000000000000000000000000000000H00000000007f0003OP000gh0";
-    sDataString += "007l0001o0000O`0007l0000<0000g0000<300030`000`<000<300061P001o0000000000?n0003o`000ol000?n0003oP000oh000?n000000000o0000<300030`";
-    sDataString += "000`<000<300073P001o0000000000NN0003k`000nl000?N0003gP000mh000?N000000000n0000<300030`000`<000<300073P000H0000000000L>0003Q`000h";
-    sDataString += "L000L700071`001`L000L70007oh000h0000<300030`000`<000<30003S0000H0000000000L60003P`000h<000L700071`001`L000L70007oh000h0000<30003";
-    sDataString += "0`000`<000<30003W0000H0000000000H600030`000`<000H300060`001P<000H3000000000`0000<300030`000`<000<30001W0000H0000000000H600030`00";
-    sDataString += "0`<000H300060`001P<000H3000000000`0000<300030`000`<000<30001f0000H0000000000H600030`000`<000H300060`001P<000H30000<0000`0000<300";
-    sDataString += "030`000`<000<30001n0000H0000000000L600030`000`<000L700071`001`L000L70000<0000`0000<700031`000`L000<70000n0000H0000000000L>00030`";
-    sDataString += "000`<000L700071`001`L000L7000000000`0000>70003Q`000hL000>70000l0000H0000000000NN00030`000`<000?N0003gP000mh000?N000000000`0000?O";
-    sDataString += "0003g`000ml000?O0000L0000L0000000000?n00030`000`<000?n0003oP000oh000?n000000000`0000?o0003o`000ol000?o0000L0000OP0000000007f0003";
-    sDataString += "0`000`<0007h0001n0000OP0007h000000000`00007k0001n`000O\\0007k0000H0000?P000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000h0000000000000000000000000000000000000000000000000000000000000000000000000000000000001h0000600000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000007`0000>00000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000007P0000<0000000000000000000000000000000000000000000000000000000000000000000000000000000000000<000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-
-}
+static constexpr uint8_t nFontMargins2[] = {
+     3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,
+     3,10, 5, 8, 32,32,32,32, 32,32,32,32,  3,10, 5, 8,  3,10, 5, 8, 32,32,32,32,  3,10, 5, 8,  3,10, 5, 8,
+     3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,
+     3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,  3,10, 5, 8,
+    32,32,32,32,  2,28, 7, 8,  1,26, 7,18,  1,18, 7, 8,  1,19, 5, 7,  1,15, 7, 8,  1,16, 7, 8,  1,29, 7,18,
+     1,26, 7, 4,  1,26, 7, 4,  3,18, 7,15,  1,19, 9,11,  2,28,22, 6,  1,27,16,14,  2,28,22, 8,  1,19, 7, 4,
+     1,18, 7, 8,  2,18, 7, 8,  1,19, 7, 8,  1,18, 7, 8,  1,18, 7, 8,  1,18, 7, 8,  1,18, 7, 8,  2,19, 7, 8,
+     1,18, 7, 8,  1,18, 7, 8,  2,28,11, 8,  2,28,11, 6,  2,19,10,11,  2,19,13,13,  2,19,10,11,  1,20, 7, 8,
+     1,14, 7, 8,  1,16, 7, 8,  2,18, 7, 8,  1,19, 7, 8,  2,17, 7, 8,  2,19, 7, 8,  2,19, 7, 8,  1,18, 7, 8,
+     2,18, 7, 8,  2,28, 7, 8,  1,24, 7, 8,  2,16, 7, 8,  2,20, 7, 8,  2,14, 7, 8,  2,18, 7, 8,  1,17, 7, 8,
+     2,19, 7, 8,  1,17, 7, 4,  2,18, 7, 8,  1,18, 7, 8,  1,19, 7, 8,  2,19, 7, 8,  1,18, 7, 8,  1,11, 7, 8,
+     1,18, 7, 8,  1,17, 7, 8,  1,20, 7, 8,  2,25, 7, 4,  1,19, 7, 4,  1,26, 7, 4,  1,20, 7,17,  1,18,26, 4,
+     2,24, 6,22,  1,21,11, 8,  2,20, 7, 8,  1,21,11, 8,  1,21, 7, 8,  1,20,11, 8,  1,23, 7, 8,  1,18, 9, 4,
+     2,20, 7, 8,  2,28, 7, 8,  1,25, 7, 4,  2,20, 7, 8,  2,28, 7, 8,  2,14,11, 8,  2,20,11, 8,  1,20,11, 8,
+     2,20,11, 4,  1,21,11, 4,  2,24,11, 8,  1,21,11, 8,  1,23, 8, 8,  2,20,11, 8,  1,21,11, 8,  1,16,11, 8,
+     1,20,11, 8,  1,21,11, 4,  1,22,11, 8,  2,25, 7, 4,  5,25, 7, 4,  1,26, 7, 4,  1,18,13,15,  3,10, 5, 8,
+     0,18, 7, 8,  3,10, 5, 8,  2,28,22, 6,  3,10, 5, 8,  2,25,22, 6,  3,16,22, 8,  1,19, 7, 4,  1,19, 7, 4,
+     3,10, 5, 8,  1, 6, 7, 8,  1,18, 2, 8,  1,28,14,11,  1,18, 2, 8,  1,19, 2, 8,  1,20, 2, 8,  1,20, 2, 8,
+     3,10, 5, 8,  2,28, 7,21,  2,28, 7,21,  3,24, 7,21,  2,25, 7,21,  5,20,12,13,  2,19,16,14,  0,15,16,14,
+     3,10, 5, 8,  1,12, 7,16,  1,21, 6, 8,  1,28,14,11,  1,21, 6, 8,  1,22, 5, 8,  1,21, 6, 8,  1,21, 6, 8,
+    32,32,32,32,  2,21, 6,22,  3,22, 6,22,  0,20, 7, 8,  1,17, 8,10,  1,16, 7, 4,  5,25, 7, 4,  1,19, 7, 4,
+     3,24, 7,23,  1,14, 7, 8,  0,19, 7, 3,  1,25,14,11,  2,19,17, 8,  1,27,16,14,  1,14, 7, 8,  1,20, 3, 8,
+     4,21, 7,18,  1,19, 9, 8,  8,19,24, 4,  1,25, 7, 8,  5,21, 6,22,  2,21,11, 4,  1,18, 7, 4,  1,29,17,13,
+     3,23,24, 3,  1,19,11, 4,  1,21,11, 3,  1,25,14,11,  2,20, 7, 8,  3,20, 6,22,  2,24, 7, 8,  1,22, 7, 8,
+     2,18, 2, 8,  1,16, 2, 8,  1,16, 2, 8,  1,16, 2, 8,  1,16, 3, 8,  2,20, 2, 8,  1,19, 2, 8,  1,19, 7, 3,
+     1,19, 2, 8,  2,19, 2, 8,  2,18, 7, 4,  2,19, 3, 8,  2,19, 2, 8,  1,25, 2, 8,  1,22, 2, 8,  2,17, 2, 8,
+     0,17, 7, 8,  2,18, 2, 8,  2,18, 2, 8,  1,17, 2, 8,  1,17, 2, 8,  1,17, 2, 8,  1,17, 3, 8,  2,20,11,11,
+     2,18, 2, 8,  2,19, 2, 8,  2,19, 2, 8,  2,19, 2, 8,  2,19, 3, 8,  1,17, 2, 8,  0,20, 7, 3,  1,19, 7, 6,
+     2,22, 6, 8,  1,21, 6, 8,  1,21, 6, 8,  1,21, 6, 8,  1,21, 7, 8,  2,24, 2, 8,  1,21, 6, 8,  1,21,11, 3,
+     1,21, 6, 8,  1,20, 6, 8,  1,20,11, 5,  1,20, 7, 8,  1,20, 6, 8,  2,24, 6, 8,  1,22, 6, 8,  1,16, 7, 8,
+     1,19, 7, 8,  2,20, 6, 8,  2,20, 6, 8,  1,20, 6, 8,  1,20, 6, 8,  1,20, 6, 8,  1,20, 7, 8,  1,19,10,12,
+     1,22, 6, 8,  2,20, 6, 8,  2,20, 6, 8,  2,19, 6, 8,  2,20, 7, 8,  1,21, 6, 4,  1,23, 8, 3,  5,25, 7,23,
+};
 
 // NOTE: this data is associated with index: 3, file name: "font cells 512x512.tpbg.mono.png"
-void  InitDataString3( std::string &sDataString ) {
-
-    sDataString.clear();
-
-    sDataString += "P0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000700001`00000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000700001`00000000000000000000000000000000000000000000000000000000070";
-    sDataString += "00000000000000000000700001`00000000000000000000000000000000000000000000000000000L0007000000000000000000000700001`0003P`000000000";
-    sDataString += "00000O00000000000000000000000000000003l0007000000000000000000000700001`0003a`00000000000000oP0000000000000000000lL000000000Ol003";
-    sDataString += "7600000000000000000000700001`0003a`0003`000000001o`0000000000000000000nl000000003ol007W>00000000000000000000700001`0001k`0003`00";
-    sDataString += "0000001ih0000000000000000000?l000000003ol003oo00000000000000000000700001`0000o`0001`000000001oh00000000000000000007h000000003ol0";
-    sDataString += "03ol00000000000000000000700001`0000oP00000000000000o`00000000000000000003`000000003ol001ih00000000000000000000700001`00000000000";
-    sDataString += "000?l0000?0000000000000000000000000000003ol001`h00000000000000000000700001`00000000000000On000000000000000000000000000000000003o";
-    sDataString += "l001`l00000000000000000000700001`00000000000000oo000000000000000000000000000000000003ol001`L00000000000000000000700001`000000000";
-    sDataString += "00000ooP00000000000000000000000000000000003nL003`L00000000000000ol00007o003o`00000000000000ooP0000000000000000000000000000000000";
-    sDataString += "3`L00?PO00000000000000ol00007o003o`00000000000000ooP00000000000000000000000000000000003PL00?PO000000000000000L000000000000000000";
-    sDataString += "0000000ooP00000000000000000000000000000000003PL003PL000000000000000L0000000000000000000000000ooP00000000000000000000000000000000";
-    sDataString += "003PL001`L000000000000000L0000000000000000000000000oo000000000000000000000000000000000003Pl001`L000000000000000L0000000000000000";
-    sDataString += "000000000Oo000000000000000000000000000000000003Sl001`l000000000000000L0000000000000000000000000?n0000000000000000000000000000000";
-    sDataString += "00003Sl001`h000000000000000L00000000000000000000000007h000000000000000000000000000000000003Sh001ih000000000000000L00000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000?Sh003ol000000000000000L00000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000OS`003on000000000000000L00000000000000000000000000000000000000000000000000000000000000OSP007W>000000000000000L000000000000";
-    sDataString += "00000000000000000000000000000000000N00000000000000O000037>000000000000000L00000000000000000000000000000000000000000000000N000000";
-    sDataString += "00000000N0000070000000000000000L00000000000000000000000000000000000000000000000l00000000000000L0000070000000000000000L0000000000";
-    sDataString += "0000000000000000000000000000000000000n0000000000000000000070000000000000000000000000000000000000000000000000000000000000000o0000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000?0000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000700000000000000000000000000L0000000001`00000000070000000000000000000000000000000000000700000000000000000";
-    sDataString += "000000000L0000000001`0000H00007000000000000000000000000000000000000070000000000l0000m`0007o`000L0000000001`0000l0000700000000000";
-    sDataString += "000000000000000000000000007000001`000n0000m`000Oo`000L0000000001`0000l0000700000000000000000000000000000000000007000003`001n0000";
-    sDataString += "m`000oo`000L0000000001`0001n0000700000000000000000000000000000000000007000007`003o0000m`001mk`000L0000000001`0003o00007000000000";
-    sDataString += "0000000000000000000000000000700000?`007oP000m`001ik`000L0000000001`0003o000070000000000000000000000000000000000000700000o`006L00";
-    sDataString += "00m`001ak`000L0000000001`0007oP00070000000000000000000000000000000000000700001o`000L0000m`001ak`000L0000000001`0006MP00070000000";
-    sDataString += "000000000000000000000000000000700003o`000L0000m`001ik`000L0000000001`0000L000070000000000000000000000000000000000000700007o`000L";
-    sDataString += "0000m`001ik`000L0000000001`0000L0000700000H0001`0000000000000000000000000070000Oo`000L0000m`001ok`000L0000000001`0000L0000700000";
-    sDataString += "N0003`0000000000000000000000000070000oo`000L0000m`000ok`000L0000000001`0000L0000700000O000?P0000000000000000000000000?oo001oo`00";
-    sDataString += "0L0000m`000?k`00ool00?oo003o`0000L00007o001ooP00Ool000000000000000000000000?oo001oo`000L0000m`0001k`00ool00?oo003o`0000L00007o00";
-    sDataString += "1oo`00Ool000000000000000000000000070001oo`000L0000i`0001k`00000000700001`0000L0000700000?P00?00000000000000000000000000070000Oo`";
-    sDataString += "000L0000i`0001k`00000000700001`0000L0000700000N0007P0000000000000000000000000070000?o`000L0000I`0001k`00000000700001`0000L000070";
-    sDataString += "0000l0003P00000000000000000000000000700007o`000L0000000001k`00000000700001`0000L000070000000000`00000000000000000000000000700003";
-    sDataString += "o`000L0000m`0001k`00000000700001`0000L000070000000000000000000000000000000000000700000o`000L0000m`0001k`00000000700001`0000L0000";
-    sDataString += "70000000000000000000000000000000000000700000O`000L0000m`0001k`00000000700001`0000L0000700000000000000000000000000000000000007000";
-    sDataString += "00?`007oP000m`0001k`00000000700001`0000L0000700000000000000000000000000000000000007000007`003o0000000001k`00000000700001`0000L00";
-    sDataString += "00700000000000000000000000000000000000007000001`001n0000000001k`00000000700001`0000L00007000000000000000000000000000000000000070";
-    sDataString += "000000000n0000000001k`00000000700001`0000L00007000000000000000000000000000000000000070000000000l0000000001k`00000000700001`0000L";
-    sDataString += "00007000000000000000000000000000000000000070000000000000000000000000000000700001`00000000070000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000h0000000000000000000000000L00000L000000000000000000000000000000000000000000h0000Mh0000h000000000000000";
-    sDataString += "N00000h000N00000L0000000000000000000000000000000000000l0000i`000Mh0000h000n07000?h0000N00003h000O00000L0000000000000000000000000";
-    sDataString += "0>0000000000l0000i`000Mh0007o000o0?000Ol0000L00007`0007P000?mh000>000000000000000000000N0000000000l0000i`000Mh000?oP01oPN000nl00";
-    sDataString += "00L0000?P0003`000?oh000>000000000000000000000L0000000000l0000i`000Mh000>o`01cPl000lL0000L0000?00001`0003o`000>000000000000000000";
-    sDataString += "000l0000000000l0000i`000Mh000?kh01c`h000ll0000L0000>00001h0001n0000>000000000000000000001h0000000000l0000i`007oo`00?ih01aah000ll";
-    sDataString += "0000L0000N00000l0001o`000>000000000000000000001h0000000000l0000i`007oo`00>h001cc`000ih0000L0000N00000L0007oh000>0000000000000000";
-    sDataString += "00001h0000000000l0000i`000Mh000?h001cS`000ooo000L0000L00000L0007mh000>000000000000000000001`0000000000l00001`000Mh0007h001oWP000";
-    sDataString += "o_o000L0000L00000L0000L000ooo00000000000000000003`0000000000l000000007mh0007o001o_o`01l3P00000000L00000L0000L000ooo0000000000000";
-    sDataString += "0000003`0000000000l000000007oo`000o`000No`07o7P00000000L00000L000000000>000000000000000000003P0000000000l000000007oo`000o`000Nml";
-    sDataString += "0?oWP00000000L00000L000000000>0000000007oP000000003P0000000000l000000000Mh0000i`000lhl0?7g000000000L00000L000000000>0000000007oP";
-    sDataString += "000000007P0000000000l000000000Mh0000i`001lhL0>3o000000000L00000L000000000>000000000000000000007P0000000000l000000000Mh0000i`003h";
-    sDataString += "lL0>1n000000000N00000L000000000>00000000000000000000?00000000000l000000000Mh0000i`007`LL0>1n000000000N00000L000000000>0000000000";
-    sDataString += "0000000000>000000000000000000000Mh000>i`007PNL0?1oP00000000N00000L000000000>00000000000000000000>00000000000H000000000L`000?k`00";
-    sDataString += "?0?l07ooo00000000N00000L000000000>00000000000000000000>00000000000l000000000L0000?o`00?0?h07oSo00000000?00000l000000000000003P00";
-    sDataString += "0000000?0000N00000000000l000000000000007oP00>01P03P0N000000007P0001h000000000000003P000000000?0000L000000000000000000000000000h0";
-    sDataString += "00000000000000000007P0003`000000000000003P000000000600000000000000000000000000000000000000000000000000000700003`000000000000003P";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000007`0007P000000000000007P000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000003h000OP00000000000000?P0000000000000000000000000000000000000000000000000000000000000001l000o000000000000000";
-    sDataString += "?00000000000000000000000000000000000000000000000000000000000000000L000L000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000OP00000000h000000000000000000000000000000000000000000000000L000000000";
-    sDataString += "00000000000000000oP00Ooh001ol000?h000000000000000000000000000000?l0000?n0000L0000O`001o`000070001oh0007l000Ooh003ol000On00000000";
-    sDataString += "0000000000000000000000On0000Oo0000L0001oh001ol0000?0001oh000O`00001`007PL000nO000000000000000000000000000000NN0000l?0000L0007hh0";
-    sDataString += "01al0000O0001`0000N000001`007PL001l7000000000000000000000000?00000L>0000l70000L0007Ph0000L0000o0001`0000L000001`003PL001h7000000";
-    sDataString += "0000000003`0000000?`0000L>0000h70000L00070h0000L0000o0001h0000l000003`003`L001h7P00000000000000O`03oon007o0000L>0000h70000L00000";
-    sDataString += "h0001l0001o0001o0000l00000?P003il000h3P000L0000L00001oP03oon001o`0000N0000h70000L00000h0003h0001g0001oP000h00000?0001ol000h3P000";
-    sDataString += "L0000N0000oh000000000?n0000N0000h70000L00001h0007l0003g00007`000l00000>0000O`000l3P000L0000>0001o`0000000000oP000L0000h70000L000";
-    sDataString += "01`0003l0003W00001h001on0000>0000?`000n7P0000000000007h00000000000?`000l0000h70000L00003`0000N0007W00000h001ooP000>0000Oh000OoP0";
-    sDataString += "00000000000?`000000300003`001l0000h70000L00007P0000N000?W00000h001h?P000N0000oh000?o00000000000007oP003ooo0000o`001h0000h70000L0";
-    sDataString += "000?P0000>000O700000h001h3P000N0001lh0003o00000000000003ol003ooo0003o`003`0000h70000L0000N00000>000Oo00000h001h3P000L0007hH0000N";
-    sDataString += "000000000000003o000000000?h0003`0000l70000L0000N00000>000Oo00000h000h3P000l0007`L0000N000000000000000Oh00000001o00003P0000L?0000";
-    sDataString += "L0000l00000N0000700001h000h3P000h0007Pl0000l0000000000000003h0000000?n00003P0000N?0000L0001l00000n0000700003`000h3P001h0003`h000";
-    sDataString += "1h000000000000000000000000O`0000000000?n0000L0003ol001ol000070007o`000n7P001h0003kh0003h0000l0000300000000000000N000003`00007l00";
-    sDataString += "00L0003ol001oh000070007oP000Oo0001`0001o`000O`0000l00003P00000000000000000003`00001h0000H000000000o`000000003n0000?n0001`0000O00";
-    sDataString += "00O00000l00003P000000000000000000000000000000000000000000000000000000000000001`000000000000000000003P000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000007P000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000?P000000000000000000000000000000000000000000000000000000000000000000000000000000000000O00000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000N00000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000?o000000000000000000000000000000000000000000000000000000000000000000000000000000000000Oo`0000000000000O`000000001l0000000006";
-    sDataString += "00000000000000000000600000H0003P0000<0>000?h0003l3l00000007oh000ooP00Oh0001oo000Ooh00?o`00>0L000Oo0001o`00?0L000l0003`0?00N0>000";
-    sDataString += "on0007h0l000`0007on000ooh00Oo`001oo000ooh00?ol00>0L000Oo0001o`00?0l000l0003`0O00O0>001on000OP0>003h00070n000h3h00LOh001`0000l000";
-    sDataString += "0n3l00>0L0003`0000>000?0l000l0003`0o00OP>003h?000n00>003h00070>003h0000L1l001`0000L0001l0L00>0L0003`0000>000?1h000L0003h0o00OP>0";
-    sDataString += "07`7h00l0n?003l00070>003h0000L0N001`0000L0001h0000>0L0003`0000>000?1h000L0003h1n00O`>007P7h00h7o?007n00070>003P0000L0>001`0000L0";
-    sDataString += "001h0000>0L0003`0000>000?1`000L0003l1n00Mh>00?00h00h?o?00?>00070N003P0000L0>001`0000L0001h0000>0L0003`0000>000?1`000L0003l3n00Ml";
-    sDataString += ">00>00h01hN7700>>00073n003`0000L0>001`0000L0001`0000>0L0003`0000>000?o`000L0003n3^00Ll>00>00h03hL?700N>0007ol003`0000L0>001oo000";
-    sDataString += "Ol001`7l00?ol0001`0000>000?o`000L0003^7^00LL>00>00h03`L?700L>0007ol003`0000L0>001oo000Ol001`7n00?ol0001`0000>000?`0000L0003^7^00";
-    sDataString += "LN>00N00h01`L>?00L?00073o003`0000L0>001`0000L0001`0>00>0L0001`0000>000?h0000L0003_7>00L?^00N00h01`l>>00L?00070?003P0000L0>001`00";
-    sDataString += "00L0001`0>00>0L0001`0000>000?o0000L0003W7>00L?^00>00h01`l>>00OoP00707003P0000L0>001`0000L0001`0N00>0L0001`0000>000?o`000L0003W_>";
-    sDataString += "00L3n00?01h03`hNN00ooP00707P03P0000l0>001`0000L0001`0N00>0L0001`0000>000?3`000L0003Sn>00L1n007P3h03`hnL01l3`00707P03P01P0L0>001`";
-    sDataString += "0000L0001`0L00>0L0001`0000>000?1h000L0003Sn>00L0n003`3`03`lll03`1`00707P03P07`0L0>001`0000L0001h0L00>0L0001`0000>000?1l000L0003Q";
-    sDataString += "l>00N0n001`7P01`Ool03`1l00707003`07`0L0>001`0000L0001h0L00?0L0001`0003n000?0n000L0003Ql>00N0n001hO001`OokP3P1n007oo001h0?00L0N00";
-    sDataString += "1`0000L0000o`L0070L0001`0003n000?0?000L0L03Pl>00>0N001nn001h??WP3P0>007oo001oon00OhN001oo000L0000ool0070L000Oo0003n000?0?000ool0";
-    sDataString += "3Pl?00>0>000Ol001l00?03P00003on000oon00Ool000oo000L00000ol0000L000Oo0003n000007000ool03P0?000000003h000n00N0000000000000000000oh";
-    sDataString += "00000000000000?P000000001`0001n000000000000000000000000000000O`0n000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000007h1l00000000000000000000000000000000000000000000000000000000000000000000000000000000001o3h0000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000oo`0000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000007oP0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000L00003h000000000000000?`000000003n000000001aon00L00000000000000000000000000000000ol000N00007l000000000000000Oo0000O0003o`000";
-    sDataString += "O0001oon00L0N00701`0000000?07001`0000ooh000ol000N00001l0000N0000000000LoP00?oP003oh001oh000oh000L0N00701`03PL0@0?P?001h3`00ool00";
-    sDataString += "0L0000?00000L0000n0000000000L3P00Oo`003Qh001ol0000h000L0N007P3`03PL0h07PO000l3`0000l000L0000?00000L0001o0000000000L3P01l1l003Pl0";
-    sDataString += "01`l0000h000L0N007P3`03PL1h03Pl000L7P0001l000L0000?00000L0003oP000000000L3P01h1l003PL003`L0000h000L0N003P7P03PL1`03hl000L?P0003h";
-    sDataString += "000L0000?00000L0003g`000000000L3P03`0L003PL003l00000h000L0L003`7003PN3`01mh000LN0000?`000L0000700000L0007S`000000000L3P03P0L003P";
-    sDataString += "L000n00000h000L0L003`7003`N7P00o`000Nn0000O0000L00007P0000L0007Qh000000000L3P03P0L003Pl000O00000h000L0L001h?001ho7P00OP000?l0000";
-    sDataString += "N0000L00003P0000L00070l000000000MoP07P0L003Qh0007`0000h000L0L001hO001ho7000OP0007h0000l0000L00003P0000L000?0L000000000OoP0700L00";
-    sDataString += "3oh0003h0000h000L0L000lL000ho7000O00007`0000l0000L00003`0000L000>0L000000000On00700L003oP0001l0000h000L0L000ll000mo?000?00003`00";
-    sDataString += "03h0000L00003h0000L000>00000000000N0007P0l003SP0000N0000h000L0L000Nh000Oo_000O`0003P0007`0000L00001h0000L000000000000000L0003`0l";
-    sDataString += "003S`0000N0000h000L0L000?h000Ogn000o`0003P0007P0000L00000h0000L000000000000000L0001`7l003Qh0000>0000h000L0L000?h000OSn001mh0003P";
-    sDataString += "000?00000L00000l0000L000000000000000L0001`7l003Ql0000>0000h000L0L000?`000OSl003hh0003P000?00000L00000l0000L000000000000000L0001h";
-    sDataString += "1ol03Pl003`>0000l000N0L000?`000?Pl007`l0003P000>00000L00000L0000L000000000000000L0001n3ol03PN003`>0000l000N0l0007P0007PL0070l000";
-    sDataString += "3P000N00000L00000N0000L000000000000000L0000N7h003P?001oN0000l000?ol0003P0007P00070N0003P000N00000L00000?0000L000000000000000L000";
-    sDataString += "0?oP003P7P00ol0000H0007o`0000000000000?0>0003P000Oon000L000007P000L000000000000000000007o000003P007h000000000000000000000000>000";
-    sDataString += "0000000Oon000L0000030000L00000000000000000000000000000000000000000000000000000000000000000000000000L0000000000L00000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000L0000000000L00000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000L0000000000L00000000000000000000000000000000000000000000000000000000000000000000000000L0000000001n000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000L0000000007n000000007ool000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000Oh000000007l000000007ool00000000000000000000000000000000000000000000000000000000000000Oh0000000000000000000000@";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000@000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000oP00000001`00001`000000001`0000000000000000000000000000000000003`00000000003P000000001o`000";
-    sDataString += "00001`00001`0000l0001`00003P00000000000000000000>0000000003`00000000003P000000001ih00000001`00001`0000l0001`00003P00000000000000";
-    sDataString += "000000?0000000003`00000000003P000000003`h00000001`000000000000001`00003P0000000000000000000070000000003P00000000003P000000003P00";
-    sDataString += "0000001`000000000000001`00003P000000000000000000007P000000003P00000000003P000000003P000000001`000000000000001`00003P000000000000";
-    sDataString += "000000003P000000003P00000000003P000000003P000000001`00001`000000001`00003P0000000000000000000000000000003P00000000003P00000000?`";
-    sDataString += "000000001`00001`0000h0001`00003P000000001`000000000000000000003W00000000003P00000000?n0001n0001o`0001`0000h0001`L0003P001`3`001o";
-    sDataString += "`0007l000000000000003ol0007n000?oP000?`000?n0007o0001oh0001`0000h0001`l0003P001ool001o`000on0000000007`0003on000Oo000?oP000O`000";
-    sDataString += "3P000?_0001mh0001`0000h0001al0003P001ool001il000oO000000000?o0003`>000O?P00>3P000mh0003P000>?0001`h0001`0000h0001ch0003P001olN00";
-    sDataString += "1`l000h7000000000?o0003`>000O3P00>3P001hl0003P000N70001`h0001`0000h0001o`0003P001hlN001`L000h7P00000000>70001`>000L0000>3P003ol0";
-    sDataString += "003P000N70001`h0001`0000h0001o00003P001hl>001`L000h7P00000000>7P001h>000L0000>3P003o`0003P000N70001`h0001`0000h0001n00003P001hl>";
-    sDataString += "001`N000h3P00000000>3P000h>000L0000>3P001`00003P000?o0001`h0001`0000h0001o00003P001hl>001`L000h7P00000000>3P000hN000L0000>3P001h";
-    sDataString += "00003P000?o0001`h0001`0000h0001g00003P001hl>001`L000h7P00000000>3P000hn000L3P00>3P001l00003P0003g0001`h0001`0000h0001g`0003P001h";
-    sDataString += "l>001`L000l?P00000000>7P000hl000N7P00>3P000on0003P000070001`h0001`000<h0001ch0003P001hlN001`L000n?000000000?o`000oh000OoP00?oP00";
-    sDataString += "0?n0003P000070001`h0001h000>h0001al0003P001hlN001`L000On000000000?oh000Oh000?o0007oP000000003P0000?0001`h0001h000>h0001`o0003P00";
-    sDataString += "1`lN001`L0007l00000000000h00030000000000n0000000003P000On00000000000000>h00000?0001P000000000000000h0000000000000000000000000000";
-    sDataString += "000000003P000On00000000000000?h00000000000000000000000000000000000000000000000000000000000000000000?h00000000000000?h00000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "h0001`00070000000000000000000000000000000000000000000000000000000000000000000000000003l0001`000700000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000003l0001`0007`000000000o`00000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "07P0001`0003h000000000o`000000000000000000000000000000000000000000000000000000000000000700001`0001h000000000i`000000000000000000";
-    sDataString += "00000000h000000000000000000000000000000000000?00001`0000h000000000i`00000000000000000000000000h000000000000000000000000000000000";
-    sDataString += "000?00001`0000l000000000i`0000L000000000000000000000h00000000000000000000000000000001`000700001`0000l000000000i`0000L0000000000O";
-    sDataString += "l000Oh0007n0001`h00000001`00003P0000h3P00?o`000?00001`0000l000000000i`0000Ol0003oP000Ol000Oh0007n0001`h000h?001`hL003`h000l3P00?";
-    sDataString += "o`000?00001`0000L000000000i`0000Oo0007oP000O0000Ll0000h0003`h000l?001`hL001ah000l7P0003`000>00001`0000L000000000i`0000OO0007SP00";
-    sDataString += "0L0000LL0000h0003`h000NN001`hl001k`000L?00003P000N00001`0000L0007h3P00i`0000L700073P000L0000N00000h0003`h000>L001klh000oP000N?00";
-    sDataString += "00?P000n00001h0000O000?oSP00i`0000L7000?3P000L0000?P0000h0003Ph000>L000olh000OP000>N0000O0000l00001h0000O000?OoP00i`0000L7000>3P";
-    sDataString += "000L0000?n0000h0003Ph000?L000ooh000OP000?l0000N0000n00001h00007000>3oP00i`0000L7000>3P000L00003n0000h0003ah000?l000o?`000oP0007l";
-    sDataString += "0003l0000n00001h0000?000>00000i`0000L7000>3P000L00000>0000h0003ah0007l000O?`000k`0003h0007h0000>00001h0000O000000000i`0000L7000>";
-    sDataString += "3P000L0000Nn0000h0003a`0003h000O7P000k`0003`0007P0000>00001h0000N000000000i`0000Oo000?3P000L0000On0000h0001a`0001h000?7P001ih000";
-    sDataString += "3`000700000>00001h0000L000000000i`0000Oo000?o`000L0000?h0000h0001o`0001`000?3P003al0003P000?00000>00001h0000L000000000i`0000LN00";
-    sDataString += "07o`000N0000000000h0001o`00000000000007Pl0007P000Oo`000>00001h0000L000000000o`0000L00003oP000<000000000000000o0000000000000070L0";
-    sDataString += "007P000Oo`000>00001h0000L000000000o`0000L000003P0000000000000000000000000000000000000000?0000000000?00001h0000l000000000o`0000L0";
-    sDataString += "00003P0000000000000000000000000000000000000000N0000000000700001h0000h000000000000000L000003P000000000000000000000000000000000000";
-    sDataString += "0000L00000000007P0001h0000h000000000000000L000003P0000000000000000000000000000000000000000L00000000007`0001h0003h000000000000000";
-    sDataString += "L000003P0000000000000000000000000000000000000000L00000000003n0001h000?h000000000000000L000003P0000000000000000000000000000000000";
-    sDataString += "000000000000000001n0000h000?000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000@";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000@000000000000000000000000000000000000000000";
-    sDataString += "00000000000003^00000000000000000007oP000000000000000000000000000000000000000000000000000000000000003n00000000000000000007oP00000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000001n00000000000000000003o0000000000000000000000000000000000000000003`0000";
-    sDataString += "0000000000000001l000000000n0000000001n00000000000n0000000000000000000000000000003`0000L0000?P01n700003o000000003oon00000000l0000";
-    sDataString += "0000001oP00000000000000O000000000000003`0000N0000o`03ooP0007_P0000000?gon0000000ool0000000007oP00000000000000o000000000000003`00";
-    sDataString += "00N0001oh03oo0000?7`0000000O1`00000000ool000000000?SP00000000000000l000000000000003`0000N0003ih07WN0000?3`0000000l1`00000000ool0";
-    sDataString += "00000000?3P00000000000001h000000000000003_000N?`003Ph077l000071`0000001h1`0000000003h000000000N0000000000000001`00000000000001oo";
-    sDataString += "000Oo`003P0077l000071`0000001h1`0000000007`000000000L000000000000000Oo00000000000001ol000?oP00000077L00007P00000001`1`000000000?";
-    sDataString += "`000000000l000000000000000Oo00000000000000?h0001n00000007_l00003`00000001`1`000000000OP000000003oo000000000000001h00000000000000";
-    sDataString += "3P0000>00000007ooP0003h00003P01`1oh00000000o0000000003oo000000000000001`000000000000003P0000>00000007ool?`00n00007P01`1oh0000000";
-    sDataString += "0n0000000003oo000000000000001`000000000000007P0000>00000003konOl00O0000?001`1`000000001n0000000003oo000000000000001`000000000000";
-    sDataString += "007P0000>000000007nNnl00?P000N001h1`000000003l0000000003oP000000000000001`000000000000007P0000>000000007L>lL007`000l000h1`000000";
-    sDataString += "007h0000000000>0000000000000001h000000000000007P0000>00000000?l?hL003`000n000l1`000000007`0000000000?0000000000000000h0000000000";
-    sDataString += "00007P0000N00000000>lOhL0H1`000O000L1`00000000?P00000000007P000000000000000h00000000000000700000L00000000>hOhl0l1`0007P00N1`0000";
-    sDataString += "0000OP00000000007`000000000000000h00000000000000700003oh0000000Nhlmh0N3`0003P00>1`00000000o000000000003h000000000L00000h0007P003";
-    sDataString += "`?0l0070000Ooh0000000lmlo`0OoP0003P00?1coP000001n000000000001oP00000000N00000h0007c`03`?0l007P000OL00000001lOhO`0?o000000007gooP";
-    sDataString += "000001ool0000000000oP00000000>00000h0003c`03P?0l007P0000L00000001`?`OP01n000000003ooP0000001ool00000000000000000000>00000h0001a`";
-    sDataString += "000000007P0000L00000001P00<0000000000001n000000001ool00000000000000000000N00000h0007c`000000007P0000L000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000l0000?h0007S`000000007P0000N0000000000000000000000000000000000000000000000000000000000l0001o`0000";
-    sDataString += "00000000007P0000>000000000000000000000000000000000000000000000000000000000000001n000000000000000000000>0000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000ll0000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000nn0000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000LN000000000000000000000000000000000000000000000000003ml000000000000000000000000000000003P000000000L0000N0000";
-    sDataString += "?700003`00000000000000000000003on0>00?3P00000000000000000000000707P000000000l0000N0000O?0001ch0000000000000000001o^01ol0O00?WP00";
-    sDataString += "00000000000000007oP007P?0000000001h0000?0000NN0001ah0000000000000000003on00>0`O007o00000000000000000003oP003`?0000000001h0000?00";
-    sDataString += "00NL0001hh0000000000000000003al00>1loP03n00000000000000000001o0001hN0000000001`0000?0000>L0001ih00000000000000000000000>1nkP00l0";
-    sDataString += "0000000000000000001n0000hl0000000001h0000>0000?N0007k`00000000000000000000000>3okP0000000000000000000000000000ll0000000001l0000>";
-    sDataString += "0000?^000?g`00000000000000000000000?3ocP01l000000007hoP0000000Ooh000Oh0000000000l0000000003P00077P001o`000000000000000000?3gcP03";
-    sDataString += "n00000000Omo`0000000Ooh000Oh0000000000000000000000000000001oh000000000000000000?3gSP03_0001h000Ook`0000000Ooh000?`00000000000000";
-    sDataString += "00000000000000001oh00000000000000000071cSP03W0001l000L?Q`00000000?h0007P0000000000000000000000000000001oh00000000000000000071`3`";
-    sDataString += "03`0000L000l73`00000000?`0007P0000000000000000000000000000001oh00000000000000000071`3P01h0000O000l7W`00000000OP00070000000000000";
-    sDataString += "0000000000000000001oh003oo`3ooooo00000001`0001l0000?P00l7oP00000000o0000700000000000000000000000000000001oh003oo`3ooooo000000000";
-    sDataString += "0000n00007P00l7n000000001n0000700000000000000000000000000000000o`0000000000000000000000000N0000?000N7P000000003l0000700000000000";
-    sDataString += "0000000000000000000007P0000000000000000000000000>0000O000N?`000000007h0000700000000000000000000000000000000000000000000000000000";
-    sDataString += "000000?0000n000??hh0000000?`0000700000000000000000000000000000000000000000000000000000000000?0001l000?ooh0000000OP00007000000000";
-    sDataString += "00000000000000000000000000000000000000000000000003o0001h0003noh0000000Ooh0007000000000000000000000000000000000000000000000000000";
-    sDataString += "00000003n0000000000?P0000000Ooh00000000000000000000000000000000000000000000000000000000000000000000000000000000000Ooh00000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007oo";
-    sDataString += "`000000000000000000000000000000000001`0000000000000000000000000000000000000000000007oo`000000000000000000000000000000000001`0000";
-    sDataString += "00000000007`00000000000000000000000000000000000000000000000000000o000000001P>0001`0000o000000000On0001l00000000000000000001oh000";
-    sDataString += "00000000000000000000001o000000001`N0001`0001oP000m`001ooP007n00000000000000000007on000000000000000000000h0003`000N1h001hL0001`00";
-    sDataString += "01o`001oh003l?`007_0000000000000000000?Po000000000000000000000h0003`000Ooh000lL0001`0001c`001oh007gol000O0000000000000000000OOo`";
-    sDataString += "00000000000000000001h0003P0007o`000ll0001`0001a`0001h007_nl003o0000000000000000000NOkh00000000000000000001`0003P0007oP000Oh0001`";
-    sDataString += "0001l00000000?ONN003g0000000000000000000llmh00000000000000N0000?`0003P000?7`000?h0001`0000o00000000?l0>003o0000>N00?ooP0000001hh";
-    sDataString += "Ll00000000000000n0000o`0003P000>1`000?`0001`0001oP0000000>l0?003oP000NN00?ooh0000001hill00000000000000l0000oh000oP000>1h000?P000";
-    sDataString += "1`0003oP0000000>h0?000oP000ll000?ah0000001`khL0000000000000000001ol000on000>1h0007o0001`0007S`0000000>h0700000000mh00000h0000001";
-    sDataString += "`o`L00000000000000<0001ol0007n000>0h00?oo0001`00071`0000000>h0700000001i`00000h0000001`oPL00000000000000>0003g00003P000?1h00?o`0";
-    sDataString += "000000071`0000000>h0?00000003c`00000h01oon01`o`L00000000000000>0003o00003P000?1`000700000000071`0000000>n0>00000003cP00000h01oon";
-    sDataString += "01hkhl00000000000000>0003n00007P0007g`00?7OP00000007Q`0000000>N<N00000003c`00000h0000000hill00000000000000>0003n00007P000?oh00Oo";
-    sDataString += "oP000h0003a`0000000??nL00000003ch0000000000000lhnh00000000000000>0001ll000O0h00Ool003ol0000h0003m`000000077nl00000001hl000000000";
-    sDataString += "0000nhNh00000000000000>0001ml000o1h00N0L000700000h0000o`00000007S1h00000001ln0000000000000Oh3h00000000000000>0001oh000og`00L0000";
-    sDataString += "0700000h0000o`00000003l3`00000000lN0000000000000?`?`00000000000000?0001o`000ooP00000000700000h0000oP00000001ooP00000000N?0000000";
-    sDataString += "0000003ooP0000000000000070001`0000lo000000000000001h00007P00000000?oP00000000>700000000000000on000000000000000?0003`000000000000";
-    sDataString += "000000001h00007P000000000H000000000000000000000000000000000000000000>0003`000000000000000000001`00003P00000000000000000000000000";
-    sDataString += "00000000000000000000000000N0007P000000000000000000001`00077P0000000000000000000000000000000000000000000000000000N0007P0000000000";
-    sDataString += "00000000003`0007_P0000000000000000000000000000000000000000000000000000L00070000000000000000000001`0003o0000000000000000000000000";
-    sDataString += "0000000000000000000000000000L00070000000000000000000001`0003n0000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000001`000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000?P0003`00000000000000?oh0000000000000000001h0000000000000000000>00000000000?l000000000o`000";
-    sDataString += "Oh0000N000000000ooh00000000000003P0003n000000007P1`00h0?01oP7P00000000On0000h0003oh000ol0000n000000001ocP00000000000007P0007o000";
-    sDataString += "000007P3`00h0?03o`?P00000000NN0000h0003ah000ol0000l000000001ocP00000000000007P0007_P00000007P7`00h0N03c`?000000000l>0000h0003Sh0";
-    sDataString += "007h0000h000000001ocP00000000000003P000?7P00000007P7P00h0l00O`N000000000h>0000h00007`0007h0000h000000001ocP00000000000003P000?7P";
-    sDataString += "00000007P?000h1h00O`l000000000l>0000h0000?00000l0000h000000001ocP00000000000003P000?7P00000007PN000h3`003`l000000000nN0000h0000N";
-    sDataString += "00000L00000000000000ocP00000000000007P000??0003SP007Pl000h7`001ah0001`0000Ol0000h0000n00000L000000003PL000ocP001l0000000007P0007";
-    sDataString += "o0003SP007Pl000h?P001c`0003`0000?h003ohn001oh000?l000000003PL000ocP001l0000000007`0003l0003c`007Qh000hO0007gP0003`000030003oon00";
-    sDataString += "1oh000Oh000000003PL000ocP001l0000000007`000000001c`0003`000hOh01o_0000000000000000o`00000000N0000000003PL000?cP001l0000000007P00";
-    sDataString += "0000001ih0003`l00`ol01n?3`001h0000000000h00000000000000000003PL0003cP000000000000000000000000mh0007Sl001on000>7`001h0000000000h0";
-    sDataString += "0000000000000000003`L0001cP000000000000000000000000Lh000?7l001oN000N?`003`0000000000h00000000000000000003`L0001cP000000000000000";
-    sDataString += "000000000Lh000??l003`N000lO`003`0000000000h00000000000000000003`L0001cP000000000000000000000000lh000NNL003al001lO`007P000000003o";
-    sDataString += "on0000000000000000003`L0001cP000000000000000000000000hh000lNn007Sh003hOl0070000000003oon0000000000000000003hl0001cP0000000000000";
-    sDataString += "00000000001ih001lOn00?3`007`Ol00?00000000000n00000000000000000003in0001cP000000000000000000000003ch003`7n00N7P007P3`00N000000000";
-    sDataString += "00000000000000000000003on0001cP000000000000000000000007c`003`0l00l7oP0?01`00N00000000000000000000000000000003o_0001gP00000000300";
-    sDataString += "0000000000007WP003P0l00h3oP0?01`00L>0000000000000000000000000000003o?0001gP000000007P000000000000007000000000h0?00001`00L>000000";
-    sDataString += "0000000000000000000000007n00001g0000000003`00000000000000000000000000000000000L?0000000000000000000000000000007P00001g0000000001";
-    sDataString += "h00000000000000000000000000000000000N7000000000000000000000000000000?000001g0000000001h00000000000000000000000000000000000Oo0000";
-    sDataString += "00000000000000000000000000O000001g000000000O`00000000000000000000000000000000000?n000000000000000000000000000000N000001g00000000";
-    sDataString += "0O`000000000000000000000000000000000003l0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000L00000000000000000000L000000000000000?00000h0000o`000O>0007N0000o000000000000";
-    sDataString += "000?00000L0001o0000i`0003P0000L0000m`0006L0000?00001h0001oh000on000?N0000o000000000000000?00000l0003oP000ih0003`0000l0001ml000?L";
-    sDataString += "00007P0003`0001al000on000?N0001o0000000000000007P0000l0007S`000ih0001`0000h0001in000>L00003P0003`0003`L000kl0000>0001o000001P000";
-    sDataString += "000003P001oh00073h000`00001h0003o`001`N0000000003`0003`0003^L000Oh000000000n00003on000o`00?coP03ooh00oOl007oo0007n0003o`001on000";
-    sDataString += "?n00007h0003h0000N0000OP000000000N00007on003ol00?ooP01ooh00ool007oo0007n0001o`001oh000?n00007h0007l0000o0000o`0001h0000N0000?`70";
-    sDataString += "0?`n001oh000L0000?n0001`00001`0000L0000?h0001h00007h0007l0001oP000o`0003l0000o0000?`700O0O001`0000l0000700001`00001`0000L0000?00";
-    sDataString += "001h00007l000?N0001kP001ih0007n0000o0000O`000N0?001`0000l0000700001`00001`0000L0000?00001h00007L000O?0003c`001`h000?O0001oP000M`";
-    sDataString += "000l07001`0000h0000700001`00001`0000L0000?00001`0000?N000N?0003a`001`h000N?0001k`000m`000l00001`0000h0000700001`00001`0000L0000?";
-    sDataString += "00001`0000?>000l7P007Q`003`l000L7P003c`001i`000h00001`0000h0000700001`00001`0000L0000700001`0000>>000l3P007Q`003PL000l7P007ah001";
-    sDataString += "ilh00h00003ol000ooP007o0001ol0001`0000L0000700001`0000N?000h3`007Qh003PL000h3`007Qh003aoh00h00003ol000ooP007o0001ol0001`0000L000";
-    sDataString += "0700001`0000N7001h1`0070h003PN001h3`00?0h007QoP00h00003`0000h0000700001`00001`0000L0000700001`0000l7001`oh00?7l007PO001`1h00N0h0";
-    sDataString += "07o`000h00003P0000h0000700001`00001`0000L0000700001`0001ooP01ooh00?ol007oo001nOh00Ool00?o`000l00003P0000h0000700001`00001`0000L0";
-    sDataString += "000700001`0003ooP01olh00OnN007ooP01ooh00Ool00?1`000L00003P0000h0000700001`00001`0000L0000700001`0007`3`03`0l00L0>00703P03oll00L0";
-    sDataString += "L00N1`000N00003P0000h0000700001`00001`0000L0000700003`0007P3`03P0l00L0?00?03`03P0L00l0L00l1`000?0>003P0000l0000700001`00001`0000";
-    sDataString += "L0000700003`000?01`03P0l00L0?00?03`03P0L00l0N01h1`0007PN003`0000l0000?00001`00001`0000L0000700003P000>01`03P0L00l0700>01`03P0N00";
-    sDataString += "h0>01h3`7003hn003`0000N0000>00001`00001`0000L0000700003`000N01`07P0L01h0700>01`03P0N00h0>01`3`o001ol001`?`03oo`00Ooh007l?P007l00";
-    sDataString += "07oP000ol000On000N01`0700N01h0700N00003P0>00h0>01`3oo000o`00?oo`03oo`00Ooh007ooP007l0007oP000ol000On00000000300N0000000<00000000";
-    sDataString += "000000000oh000>000?ol00000000000000Ol00000000000000?`0000000000000000>000000000000000000000000000000>000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000N000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000n0000000000000000000000000000000000000000000000000000000000000000000000000000000000001l0000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000001h0000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000001`00000000000000000000000000000000000000000h00";
-    sDataString += "000000000000000000000000000007cP000L00001`0007n00000L000NL00000000000000700000L0000i`000Mh0000>00000000000000000000?kP000N00003`";
-    sDataString += "0007o0001nl000NL000000000000007P0000l0001ih000Ml0000N00000000000000000000?oP000N00003P000??P003oh000>L000000000000003`0000h0001h";
-    sDataString += "l000Ll0000N00000000000000?`0007^On000>00003P000>7P003_h00000000000000070033`0000h0001`l00001P000L0000000007h000Ool007n7n001oP000";
-    sDataString += "3P000?oP0003h00000000000000oo007QcP01`hh00?`>00001`000L<001`0000?l000?oo007o1n003ol0007h000?o`001o0000on000000007on007P3`01`hl00";
-    sDataString += ">0N00701`00L0N001`0000?n0003POP00O0L007Qn000Ol000O3h003oh001ooP0000000?`n00703`01`0l00>0N00701`00L0n001`0000>N0003P7`00O0L00?0?0";
-    sDataString += "00nO000l1l007gn003hO`0000000O1n00701`01`0l00>0>00701`00N0l001`0000>>0003P1h00OPL00O07001h?P01l0l00?Po003`1`0000000N3o00701`01`0l";
-    sDataString += "00>0>00701`00?1h001h0000N?0003P0h00O`L00N07P03`7P01h0L00?0?P07P1h00N3`00l3W00701`01`0l00>0>00701`00?1`001oh000N?0003P0h00O`L00l0";
-    sDataString += "3P07`3`03`0N00N07P0700h00O7`00l7WP0701`01`0l00>0>00701`007S`001on000Lo0003P0l00M`L00h03P0?01`03P0>00N03P0700h00?_P00h73P0701`01`";
-    sDataString += "0h00?0>00701`003gP001`O000Ll000OkhL00MhL00h03P0?01`03P0>00L03P0?00h003o001h?3P0701`01h0h0070>00701`001oP001h7000Ln000OohL00LhL00";
-    sDataString += "h03P0>01`03P0>00l03P0>00h001n001`N3P0701`00h0h007PN00701`001o0000h7000L?0003o0L00llL00h03P0>01`03P0>00l03P0>00l003n001`n3P0701`0";
-    sDataString += "0h0h003PN00701`000n0000h7000L70003P0l00llL00h03P0>01`03P0>00h03P0>00L003o001`l3P0701`00h0h003PL007P1`000L0000hO000L70003P0l00hLL";
-    sDataString += "00h07P0>01`03`0>00l03P0>00L007_P01hh3P07P1`00h1h003PL007P1`000L0000on000L70003P0l00hNL00l0700?01`01`0>00l03P0?00L00?7`00mh7P07P3";
-    sDataString += "`00l1h003PL003P1`000l0000ol000L70003P0h00hOL00n0?00?03`01h0>00N03P07P0L00?3`00mh?003P3P00l3`003Pl003`1`000l0000n0000l70003P1h00h";
-    sDataString += "?l00O0?007P3P01h0>00?03P03h0l00N1`00o`?003P3P00L7`003Ph001h7`000l0001h0000l70007P3h00h7h00?PN003h7P00l0>007P3P01l1l00L0000O`N003";
-    sDataString += "`7P00NOP003ch001lOP000l0001h0000h?0007P3`00h00007ol001o?000O0N003`oP00o7h0000000Oal001hO000?o0003g`000no0000l0001`0000ln000OooP0";
-    sDataString += "7n00001ol000oo000?`l001mo000?oP0000000ool001on000?l0001oP000Ol0000h0001`0000On000Ooo007o00000?`000?n0007ol000oh0003n00000000oo`0";
-    sDataString += "00ol0007P0001n00007h0000h0001h0000O`000?on00000000000000000001oh000?P0000h0000000000000000000000000l0000000000h0001h0000L0000000";
-    sDataString += "00000000000000000000600000000000000000000000000000000000000000000000h00000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000070000030000000000000000000000000000000";
-    sDataString += "00000000000>00000000000000700000>0000000000000007P00007P000?`00000000000000OP000000000000007P0000N0000o0000000007`0000>0000oP000";
-    sDataString += "0000007`0000?0000Oh00063000000000o`000000000000007P0000N0001oP000000003`0000N0000oP0000000003`0000N0000ol000?gP003g0000m`0000000";
-    sDataString += "00000003`0000l0003oP000<L0001`0000l0001k`0007>00001`0000N0001ll000OoP003gP000o`000000000000001`0000h0003ch000Nn0001h0000l0003a`0";
-    sDataString += "007_00001`0000L0001hL000No0003gP000?P000000000000001`0000h0007Qh000>n0000h0000h0003``0007_0000000000L0000oP000<000000000000000N0";
-    sDataString += "000000000000000000030h000>L000000000h0003P00000h0000?h0001oP000oh0007n0001o0000?P001ooP00000000?`000000001o00007`0003P0000h00007";
-    sDataString += "00000h0000On0003o`001ol000?n0003o0000oh003ooh000o0000ol000?n0003oP000Ol000OP0007l0001o0000?h0000nN0007c`001hl000N?0007gP001mh007";
-    sDataString += "Soh001o`001ln000OoP007g`000nn000O`0007l0001oP000?h0000h>0007Q`003al000L?0007S`001hl0071`h003kh001`?000N7P007S`001l>0001`0000l000";
-    sDataString += "07P0001h0000ho00073h003Wl000LO00077`001al0073gh003`h001`?000l7P0071`001hN0001`0000L00003P0001h0000io0007?h001_l000Mo0007O`0007l0";
-    sDataString += "00?o`003P0001oo000oo000?o`003on0001`0000L00003P0001h00007o0000oh000oL0003o0000o`000Ol000oo0003P0001on000on000?oP003oh0003`0000L0";
-    sDataString += "0007P0001h0000?_0001mh000lL0007g0001m`000nL001o`0003P0001h0000o`0007P0001h00003`0000L0000700000h0000O?0003ih001hL000??0001i`000l";
-    sDataString += "L003k`0003`0000h?000l00003Ph001h70003P0000L0000700000h0000L>0003Ph001hL000??0003a`001hl003S`L003ah000l?000N3P003ah000n?0003P0000";
-    sDataString += "L0000700000h0000L>0003Qh001hL000?>0003S`001ih003Shl001oh000NN000?7P001kh000On0003P0000L0000700000h0000L>0003Q`001hL000?n0003oP00";
-    sDataString += "1kh003goh000oP000?l0007o0000o`000?n0003P0000o0000700000n0000ON0003o`000ol0007l0003o0000o`003oo`000O00007h0003n0000OP0003h0007n00";
-    sDataString += "03o0000o`000On0000?n0001oP000Oh000000001n0000oP001oOP000N00001P0000000000000000000On0003o0000oh000On00007l0000000000000000000000";
-    sDataString += "000>0000000000>0000000000000000000000000OP000000000000000h000000000000000000000000000000000000000000N000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000l000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000003l0000000000000000000000000000000000000000000000000000000000000000000000000000000000003h0000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000>00000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000?000000000000000000000<00000000000000000000000003P0000700000000000000000001`0000000000?o000000000L0000";
-    sDataString += "0h0001o00000000000000000000000003P0000?00007P00000000070001`00000000007o0001i`000N00001h0003oP000nL00000000000000000003`0000O000";
-    sDataString += "0O`000000000?0001`0000000000?h0003o`000?00003`0007g`000ol000?N000000000000001h0000n0000oh000>L0000O0003`0000>L0000oh0007o`000?P0";
-    sDataString += "003`0007Sh001ol000?N0000`0000000000h0000h0000ml000?N0000N0003`0000?L0000ll0007WP0007P0003P00071h001kl000?N0001h0000000000h0000h0";
-    sDataString += "000hl000?N0000L0003`0000?N0000hl000000000000003h000700000700006L0001h000001P00000000h00000L000H00000L0003o000003P0000n0000?P000o";
-    sDataString += "P000?l0003o0000?P0007h000000000oW`00L700071`001`H000L?00001`003o`000h3P000?n0007oP001oh000on0007o`000O`000Ol000000001ooP00L?0007";
-    sDataString += "3`001`h000L?00071`003oh000l7P000Oo0007o`003kl000l?000?W`000m`000nn003o1l001ko000L?0007S`001`l000L?00071`003hl000l70000L70007S`00";
-    sDataString += "3Pl000h?000>1h001ih000lN003ool003al000L?0007S`001`l000L?0007S`003`N000N?0000L700071`007PL001h7000>1h003hh000h?0003oP003al000L?00";
-    sDataString += "03S`001`l000L?0007SP003P>000NN0000L7P0071`007PL001h7000>1h007`l001h7000000003Sn000L?0003S`001hl000L>0003SP003P>000>N0000L3P0071`";
-    sDataString += "007PL001`7000>1`007PL000h7P001`0003W^000L?0003c`001hl000L>0003cP003PN000?l0000L7P0071`007PL001h7000>1`007PL000h7P001h0003_^000L?";
-    sDataString += "0003c`000hl000L>0003gP003PN000?h0000L700071`003Pl001h7000?3`007PL000h3P001`0003oN000L>0003cP000hl000N>0001oP00?Pl0007h0000N70007";
-    sDataString += "1`003Pl000h7000?3`003`l000h7P00000003nn000NN0003cP000ll000NO0001o000?kh0007h0000O_00071`003ah000n?0007SP003ih000l7000000003il000";
-    sDataString += ">n0003cP000Ll000?O0000n0007o`0003`0000?o00071`001ih000On0003oP001oh000N?000000007oh000?n0003gP000Ol000?o0000N0003oP0003`00001n00";
-    sDataString += "071`001o`0007n0001oP000O`000On000000007oP0007o0001oP000Ol0007oP000L0003P00001`00000000071`000o`0001`0000o000070000?l000000007000";
-    sDataString += "003W0001oP000?l00007P000L0003P00001`00000000000000000000000000N0000000003h00000000000000000000OP0007l000000000l0003`00003`000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000L000000000l0003`00007P000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000L000000001h0001`0000?P0000000000000000000000000000000000000000000000000000000000000000000000000?`0001`0003o00000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000O`0001`0003l00000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000N0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
+static constexpr const char *const sFontData3[] = {
+    "P0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000700001`00000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000700001`00000000000000000000000000000000000000000000000000000000070",
+    "00000000000000000000700001`00000000000000000000000000000000000000000000000000000L0007000000000000000000000700001`0003P`000000000",
+    "00000O00000000000000000000000000000003l0007000000000000000000000700001`0003a`00000000000000oP0000000000000000000lL000000000Ol003",
+    "7600000000000000000000700001`0003a`0003`000000001o`0000000000000000000nl000000003ol007W>00000000000000000000700001`0001k`0003`00",
+    "0000001ih0000000000000000000?l000000003ol003oo00000000000000000000700001`0000o`0001`000000001oh00000000000000000007h000000003ol0",
+    "03ol00000000000000000000700001`0000oP00000000000000o`00000000000000000003`000000003ol001ih00000000000000000000700001`00000000000",
+    "000?l0000?0000000000000000000000000000003ol001`h00000000000000000000700001`00000000000000On000000000000000000000000000000000003o",
+    "l001`l00000000000000000000700001`00000000000000oo000000000000000000000000000000000003ol001`L00000000000000000000700001`000000000",
+    "00000ooP00000000000000000000000000000000003nL003`L00000000000000ol00007o003o`00000000000000ooP0000000000000000000000000000000000",
+    "3`L00?PO00000000000000ol00007o003o`00000000000000ooP00000000000000000000000000000000003PL00?PO000000000000000L000000000000000000",
+    "0000000ooP00000000000000000000000000000000003PL003PL000000000000000L0000000000000000000000000ooP00000000000000000000000000000000",
+    "003PL001`L000000000000000L0000000000000000000000000oo000000000000000000000000000000000003Pl001`L000000000000000L0000000000000000",
+    "000000000Oo000000000000000000000000000000000003Sl001`l000000000000000L0000000000000000000000000?n0000000000000000000000000000000",
+    "00003Sl001`h000000000000000L00000000000000000000000007h000000000000000000000000000000000003Sh001ih000000000000000L00000000000000",
+    "000000000000000000000000000000000000000000000000?Sh003ol000000000000000L00000000000000000000000000000000000000000000000000000000",
+    "000000OS`003on000000000000000L00000000000000000000000000000000000000000000000000000000000000OSP007W>000000000000000L000000000000",
+    "00000000000000000000000000000000000N00000000000000O000037>000000000000000L00000000000000000000000000000000000000000000000N000000",
+    "00000000N0000070000000000000000L00000000000000000000000000000000000000000000000l00000000000000L0000070000000000000000L0000000000",
+    "0000000000000000000000000000000000000n0000000000000000000070000000000000000000000000000000000000000000000000000000000000000o0000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000?0000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000700000000000000000000000000L0000000001`00000000070000000000000000000000000000000000000700000000000000000",
+    "000000000L0000000001`0000H00007000000000000000000000000000000000000070000000000l0000m`0007o`000L0000000001`0000l0000700000000000",
+    "000000000000000000000000007000001`000n0000m`000Oo`000L0000000001`0000l0000700000000000000000000000000000000000007000003`001n0000",
+    "m`000oo`000L0000000001`0001n0000700000000000000000000000000000000000007000007`003o0000m`001mk`000L0000000001`0003o00007000000000",
+    "0000000000000000000000000000700000?`007oP000m`001ik`000L0000000001`0003o000070000000000000000000000000000000000000700000o`006L00",
+    "00m`001ak`000L0000000001`0007oP00070000000000000000000000000000000000000700001o`000L0000m`001ak`000L0000000001`0006MP00070000000",
+    "000000000000000000000000000000700003o`000L0000m`001ik`000L0000000001`0000L000070000000000000000000000000000000000000700007o`000L",
+    "0000m`001ik`000L0000000001`0000L0000700000H0001`0000000000000000000000000070000Oo`000L0000m`001ok`000L0000000001`0000L0000700000",
+    "N0003`0000000000000000000000000070000oo`000L0000m`000ok`000L0000000001`0000L0000700000O000?P0000000000000000000000000?oo001oo`00",
+    "0L0000m`000?k`00ool00?oo003o`0000L00007o001ooP00Ool000000000000000000000000?oo001oo`000L0000m`0001k`00ool00?oo003o`0000L00007o00",
+    "1oo`00Ool000000000000000000000000070001oo`000L0000i`0001k`00000000700001`0000L0000700000?P00?00000000000000000000000000070000Oo`",
+    "000L0000i`0001k`00000000700001`0000L0000700000N0007P0000000000000000000000000070000?o`000L0000I`0001k`00000000700001`0000L000070",
+    "0000l0003P00000000000000000000000000700007o`000L0000000001k`00000000700001`0000L000070000000000`00000000000000000000000000700003",
+    "o`000L0000m`0001k`00000000700001`0000L000070000000000000000000000000000000000000700000o`000L0000m`0001k`00000000700001`0000L0000",
+    "70000000000000000000000000000000000000700000O`000L0000m`0001k`00000000700001`0000L0000700000000000000000000000000000000000007000",
+    "00?`007oP000m`0001k`00000000700001`0000L0000700000000000000000000000000000000000007000007`003o0000000001k`00000000700001`0000L00",
+    "00700000000000000000000000000000000000007000001`001n0000000001k`00000000700001`0000L00007000000000000000000000000000000000000070",
+    "000000000n0000000001k`00000000700001`0000L00007000000000000000000000000000000000000070000000000l0000000001k`00000000700001`0000L",
+    "00007000000000000000000000000000000000000070000000000000000000000000000000700001`00000000070000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000h0000000000000000000000000L00000L000000000000000000000000000000000000000000h0000Mh0000h000000000000000",
+    "N00000h000N00000L0000000000000000000000000000000000000l0000i`000Mh0000h000n07000?h0000N00003h000O00000L0000000000000000000000000",
+    "0>0000000000l0000i`000Mh0007o000o0?000Ol0000L00007`0007P000?mh000>000000000000000000000N0000000000l0000i`000Mh000?oP01oPN000nl00",
+    "00L0000?P0003`000?oh000>000000000000000000000L0000000000l0000i`000Mh000>o`01cPl000lL0000L0000?00001`0003o`000>000000000000000000",
+    "000l0000000000l0000i`000Mh000?kh01c`h000ll0000L0000>00001h0001n0000>000000000000000000001h0000000000l0000i`007oo`00?ih01aah000ll",
+    "0000L0000N00000l0001o`000>000000000000000000001h0000000000l0000i`007oo`00>h001cc`000ih0000L0000N00000L0007oh000>0000000000000000",
+    "00001h0000000000l0000i`000Mh000?h001cS`000ooo000L0000L00000L0007mh000>000000000000000000001`0000000000l00001`000Mh0007h001oWP000",
+    "o_o000L0000L00000L0000L000ooo00000000000000000003`0000000000l000000007mh0007o001o_o`01l3P00000000L00000L0000L000ooo0000000000000",
+    "0000003`0000000000l000000007oo`000o`000No`07o7P00000000L00000L000000000>000000000000000000003P0000000000l000000007oo`000o`000Nml",
+    "0?oWP00000000L00000L000000000>0000000007oP000000003P0000000000l000000000Mh0000i`000lhl0?7g000000000L00000L000000000>0000000007oP",
+    "000000007P0000000000l000000000Mh0000i`001lhL0>3o000000000L00000L000000000>000000000000000000007P0000000000l000000000Mh0000i`003h",
+    "lL0>1n000000000N00000L000000000>00000000000000000000?00000000000l000000000Mh0000i`007`LL0>1n000000000N00000L000000000>0000000000",
+    "0000000000>000000000000000000000Mh000>i`007PNL0?1oP00000000N00000L000000000>00000000000000000000>00000000000H000000000L`000?k`00",
+    "?0?l07ooo00000000N00000L000000000>00000000000000000000>00000000000l000000000L0000?o`00?0?h07oSo00000000?00000l000000000000003P00",
+    "0000000?0000N00000000000l000000000000007oP00>01P03P0N000000007P0001h000000000000003P000000000?0000L000000000000000000000000000h0",
+    "00000000000000000007P0003`000000000000003P000000000600000000000000000000000000000000000000000000000000000700003`000000000000003P",
+    "0000000000000000000000000000000000000000000000000000000000000007`0007P000000000000007P000000000000000000000000000000000000000000",
+    "0000000000000000000003h000OP00000000000000?P0000000000000000000000000000000000000000000000000000000000000001l000o000000000000000",
+    "?00000000000000000000000000000000000000000000000000000000000000000L000L000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000OP00000000h000000000000000000000000000000000000000000000000L000000000",
+    "00000000000000000oP00Ooh001ol000?h000000000000000000000000000000?l0000?n0000L0000O`001o`000070001oh0007l000Ooh003ol000On00000000",
+    "0000000000000000000000On0000Oo0000L0001oh001ol0000?0001oh000O`00001`007PL000nO000000000000000000000000000000NN0000l?0000L0007hh0",
+    "01al0000O0001`0000N000001`007PL001l7000000000000000000000000?00000L>0000l70000L0007Ph0000L0000o0001`0000L000001`003PL001h7000000",
+    "0000000003`0000000?`0000L>0000h70000L00070h0000L0000o0001h0000l000003`003`L001h7P00000000000000O`03oon007o0000L>0000h70000L00000",
+    "h0001l0001o0001o0000l00000?P003il000h3P000L0000L00001oP03oon001o`0000N0000h70000L00000h0003h0001g0001oP000h00000?0001ol000h3P000",
+    "L0000N0000oh000000000?n0000N0000h70000L00001h0007l0003g00007`000l00000>0000O`000l3P000L0000>0001o`0000000000oP000L0000h70000L000",
+    "01`0003l0003W00001h001on0000>0000?`000n7P0000000000007h00000000000?`000l0000h70000L00003`0000N0007W00000h001ooP000>0000Oh000OoP0",
+    "00000000000?`000000300003`001l0000h70000L00007P0000N000?W00000h001h?P000N0000oh000?o00000000000007oP003ooo0000o`001h0000h70000L0",
+    "000?P0000>000O700000h001h3P000N0001lh0003o00000000000003ol003ooo0003o`003`0000h70000L0000N00000>000Oo00000h001h3P000L0007hH0000N",
+    "000000000000003o000000000?h0003`0000l70000L0000N00000>000Oo00000h000h3P000l0007`L0000N000000000000000Oh00000001o00003P0000L?0000",
+    "L0000l00000N0000700001h000h3P000h0007Pl0000l0000000000000003h0000000?n00003P0000N?0000L0001l00000n0000700003`000h3P001h0003`h000",
+    "1h000000000000000000000000O`0000000000?n0000L0003ol001ol000070007o`000n7P001h0003kh0003h0000l0000300000000000000N000003`00007l00",
+    "00L0003ol001oh000070007oP000Oo0001`0001o`000O`0000l00003P00000000000000000003`00001h0000H000000000o`000000003n0000?n0001`0000O00",
+    "00O00000l00003P000000000000000000000000000000000000000000000000000000000000001`000000000000000000003P000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000007P000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000?P000000000000000000000000000000000000000000000000000000000000000000000000000000000000O00000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000N00000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000?o000000000000000000000000000000000000000000000000000000000000000000000000000000000000Oo`0000000000000O`000000001l0000000006",
+    "00000000000000000000600000H0003P0000<0>000?h0003l3l00000007oh000ooP00Oh0001oo000Ooh00?o`00>0L000Oo0001o`00?0L000l0003`0?00N0>000",
+    "on0007h0l000`0007on000ooh00Oo`001oo000ooh00?ol00>0L000Oo0001o`00?0l000l0003`0O00O0>001on000OP0>003h00070n000h3h00LOh001`0000l000",
+    "0n3l00>0L0003`0000>000?0l000l0003`0o00OP>003h?000n00>003h00070>003h0000L1l001`0000L0001l0L00>0L0003`0000>000?1h000L0003h0o00OP>0",
+    "07`7h00l0n?003l00070>003h0000L0N001`0000L0001h0000>0L0003`0000>000?1h000L0003h1n00O`>007P7h00h7o?007n00070>003P0000L0>001`0000L0",
+    "001h0000>0L0003`0000>000?1`000L0003l1n00Mh>00?00h00h?o?00?>00070N003P0000L0>001`0000L0001h0000>0L0003`0000>000?1`000L0003l3n00Ml",
+    ">00>00h01hN7700>>00073n003`0000L0>001`0000L0001`0000>0L0003`0000>000?o`000L0003n3^00Ll>00>00h03hL?700N>0007ol003`0000L0>001oo000",
+    "Ol001`7l00?ol0001`0000>000?o`000L0003^7^00LL>00>00h03`L?700L>0007ol003`0000L0>001oo000Ol001`7n00?ol0001`0000>000?`0000L0003^7^00",
+    "LN>00N00h01`L>?00L?00073o003`0000L0>001`0000L0001`0>00>0L0001`0000>000?h0000L0003_7>00L?^00N00h01`l>>00L?00070?003P0000L0>001`00",
+    "00L0001`0>00>0L0001`0000>000?o0000L0003W7>00L?^00>00h01`l>>00OoP00707003P0000L0>001`0000L0001`0N00>0L0001`0000>000?o`000L0003W_>",
+    "00L3n00?01h03`hNN00ooP00707P03P0000l0>001`0000L0001`0N00>0L0001`0000>000?3`000L0003Sn>00L1n007P3h03`hnL01l3`00707P03P01P0L0>001`",
+    "0000L0001`0L00>0L0001`0000>000?1h000L0003Sn>00L0n003`3`03`lll03`1`00707P03P07`0L0>001`0000L0001h0L00>0L0001`0000>000?1l000L0003Q",
+    "l>00N0n001`7P01`Ool03`1l00707003`07`0L0>001`0000L0001h0L00?0L0001`0003n000?0n000L0003Ql>00N0n001hO001`OokP3P1n007oo001h0?00L0N00",
+    "1`0000L0000o`L0070L0001`0003n000?0?000L0L03Pl>00>0N001nn001h??WP3P0>007oo001oon00OhN001oo000L0000ool0070L000Oo0003n000?0?000ool0",
+    "3Pl?00>0>000Ol001l00?03P00003on000oon00Ool000oo000L00000ol0000L000Oo0003n000007000ool03P0?000000003h000n00N0000000000000000000oh",
+    "00000000000000?P000000001`0001n000000000000000000000000000000O`0n000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000007h1l00000000000000000000000000000000000000000000000000000000000000000000000000000000001o3h0000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000oo`0000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000007oP0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000L00003h000000000000000?`000000003n000000001aon00L00000000000000000000000000000000ol000N00007l000000000000000Oo0000O0003o`000",
+    "O0001oon00L0N00701`0000000?07001`0000ooh000ol000N00001l0000N0000000000LoP00?oP003oh001oh000oh000L0N00701`03PL0@0?P?001h3`00ool00",
+    "0L0000?00000L0000n0000000000L3P00Oo`003Qh001ol0000h000L0N007P3`03PL0h07PO000l3`0000l000L0000?00000L0001o0000000000L3P01l1l003Pl0",
+    "01`l0000h000L0N007P3`03PL1h03Pl000L7P0001l000L0000?00000L0003oP000000000L3P01h1l003PL003`L0000h000L0N003P7P03PL1`03hl000L?P0003h",
+    "000L0000?00000L0003g`000000000L3P03`0L003PL003l00000h000L0L003`7003PN3`01mh000LN0000?`000L0000700000L0007S`000000000L3P03P0L003P",
+    "L000n00000h000L0L003`7003`N7P00o`000Nn0000O0000L00007P0000L0007Qh000000000L3P03P0L003Pl000O00000h000L0L001h?001ho7P00OP000?l0000",
+    "N0000L00003P0000L00070l000000000MoP07P0L003Qh0007`0000h000L0L001hO001ho7000OP0007h0000l0000L00003P0000L000?0L000000000OoP0700L00",
+    "3oh0003h0000h000L0L000lL000ho7000O00007`0000l0000L00003`0000L000>0L000000000On00700L003oP0001l0000h000L0L000ll000mo?000?00003`00",
+    "03h0000L00003h0000L000>00000000000N0007P0l003SP0000N0000h000L0L000Nh000Oo_000O`0003P0007`0000L00001h0000L000000000000000L0003`0l",
+    "003S`0000N0000h000L0L000?h000Ogn000o`0003P0007P0000L00000h0000L000000000000000L0001`7l003Qh0000>0000h000L0L000?h000OSn001mh0003P",
+    "000?00000L00000l0000L000000000000000L0001`7l003Ql0000>0000h000L0L000?`000OSl003hh0003P000?00000L00000l0000L000000000000000L0001h",
+    "1ol03Pl003`>0000l000N0L000?`000?Pl007`l0003P000>00000L00000L0000L000000000000000L0001n3ol03PN003`>0000l000N0l0007P0007PL0070l000",
+    "3P000N00000L00000N0000L000000000000000L0000N7h003P?001oN0000l000?ol0003P0007P00070N0003P000N00000L00000?0000L000000000000000L000",
+    "0?oP003P7P00ol0000H0007o`0000000000000?0>0003P000Oon000L000007P000L000000000000000000007o000003P007h000000000000000000000000>000",
+    "0000000Oon000L0000030000L00000000000000000000000000000000000000000000000000000000000000000000000000L0000000000L00000000000000000",
+    "000000000000000000000000000000000000000000000000000000000L0000000000L00000000000000000000000000000000000000000000000000000000000",
+    "000000000000000L0000000000L00000000000000000000000000000000000000000000000000000000000000000000000000L0000000001n000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000L0000000007n000000007ool000000000000000000000000000000000000000000000",
+    "00000000000000000Oh000000007l000000007ool00000000000000000000000000000000000000000000000000000000000000Oh0000000000000000000000@",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000@000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000oP00000001`00001`000000001`0000000000000000000000000000000000003`00000000003P000000001o`000",
+    "00001`00001`0000l0001`00003P00000000000000000000>0000000003`00000000003P000000001ih00000001`00001`0000l0001`00003P00000000000000",
+    "000000?0000000003`00000000003P000000003`h00000001`000000000000001`00003P0000000000000000000070000000003P00000000003P000000003P00",
+    "0000001`000000000000001`00003P000000000000000000007P000000003P00000000003P000000003P000000001`000000000000001`00003P000000000000",
+    "000000003P000000003P00000000003P000000003P000000001`00001`000000001`00003P0000000000000000000000000000003P00000000003P00000000?`",
+    "000000001`00001`0000h0001`00003P000000001`000000000000000000003W00000000003P00000000?n0001n0001o`0001`0000h0001`L0003P001`3`001o",
+    "`0007l000000000000003ol0007n000?oP000?`000?n0007o0001oh0001`0000h0001`l0003P001ool001o`000on0000000007`0003on000Oo000?oP000O`000",
+    "3P000?_0001mh0001`0000h0001al0003P001ool001il000oO000000000?o0003`>000O?P00>3P000mh0003P000>?0001`h0001`0000h0001ch0003P001olN00",
+    "1`l000h7000000000?o0003`>000O3P00>3P001hl0003P000N70001`h0001`0000h0001o`0003P001hlN001`L000h7P00000000>70001`>000L0000>3P003ol0",
+    "003P000N70001`h0001`0000h0001o00003P001hl>001`L000h7P00000000>7P001h>000L0000>3P003o`0003P000N70001`h0001`0000h0001n00003P001hl>",
+    "001`N000h3P00000000>3P000h>000L0000>3P001`00003P000?o0001`h0001`0000h0001o00003P001hl>001`L000h7P00000000>3P000hN000L0000>3P001h",
+    "00003P000?o0001`h0001`0000h0001g00003P001hl>001`L000h7P00000000>3P000hn000L3P00>3P001l00003P0003g0001`h0001`0000h0001g`0003P001h",
+    "l>001`L000l?P00000000>7P000hl000N7P00>3P000on0003P000070001`h0001`000<h0001ch0003P001hlN001`L000n?000000000?o`000oh000OoP00?oP00",
+    "0?n0003P000070001`h0001h000>h0001al0003P001hlN001`L000On000000000?oh000Oh000?o0007oP000000003P0000?0001`h0001h000>h0001`o0003P00",
+    "1`lN001`L0007l00000000000h00030000000000n0000000003P000On00000000000000>h00000?0001P000000000000000h0000000000000000000000000000",
+    "000000003P000On00000000000000?h00000000000000000000000000000000000000000000000000000000000000000000?h00000000000000?h00000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "h0001`00070000000000000000000000000000000000000000000000000000000000000000000000000003l0001`000700000000000000000000000000000000",
+    "00000000000000000000000000000000000000000003l0001`0007`000000000o`00000000000000000000000000000000000000000000000000000000000000",
+    "07P0001`0003h000000000o`000000000000000000000000000000000000000000000000000000000000000700001`0001h000000000i`000000000000000000",
+    "00000000h000000000000000000000000000000000000?00001`0000h000000000i`00000000000000000000000000h000000000000000000000000000000000",
+    "000?00001`0000l000000000i`0000L000000000000000000000h00000000000000000000000000000001`000700001`0000l000000000i`0000L0000000000O",
+    "l000Oh0007n0001`h00000001`00003P0000h3P00?o`000?00001`0000l000000000i`0000Ol0003oP000Ol000Oh0007n0001`h000h?001`hL003`h000l3P00?",
+    "o`000?00001`0000L000000000i`0000Oo0007oP000O0000Ll0000h0003`h000l?001`hL001ah000l7P0003`000>00001`0000L000000000i`0000OO0007SP00",
+    "0L0000LL0000h0003`h000NN001`hl001k`000L?00003P000N00001`0000L0007h3P00i`0000L700073P000L0000N00000h0003`h000>L001klh000oP000N?00",
+    "00?P000n00001h0000O000?oSP00i`0000L7000?3P000L0000?P0000h0003Ph000>L000olh000OP000>N0000O0000l00001h0000O000?OoP00i`0000L7000>3P",
+    "000L0000?n0000h0003Ph000?L000ooh000OP000?l0000N0000n00001h00007000>3oP00i`0000L7000>3P000L00003n0000h0003ah000?l000o?`000oP0007l",
+    "0003l0000n00001h0000?000>00000i`0000L7000>3P000L00000>0000h0003ah0007l000O?`000k`0003h0007h0000>00001h0000O000000000i`0000L7000>",
+    "3P000L0000Nn0000h0003a`0003h000O7P000k`0003`0007P0000>00001h0000N000000000i`0000Oo000?3P000L0000On0000h0001a`0001h000?7P001ih000",
+    "3`000700000>00001h0000L000000000i`0000Oo000?o`000L0000?h0000h0001o`0001`000?3P003al0003P000?00000>00001h0000L000000000i`0000LN00",
+    "07o`000N0000000000h0001o`00000000000007Pl0007P000Oo`000>00001h0000L000000000o`0000L00003oP000<000000000000000o0000000000000070L0",
+    "007P000Oo`000>00001h0000L000000000o`0000L000003P0000000000000000000000000000000000000000?0000000000?00001h0000l000000000o`0000L0",
+    "00003P0000000000000000000000000000000000000000N0000000000700001h0000h000000000000000L000003P000000000000000000000000000000000000",
+    "0000L00000000007P0001h0000h000000000000000L000003P0000000000000000000000000000000000000000L00000000007`0001h0003h000000000000000",
+    "L000003P0000000000000000000000000000000000000000L00000000003n0001h000?h000000000000000L000003P0000000000000000000000000000000000",
+    "000000000000000001n0000h000?000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000@",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000@000000000000000000000000000000000000000000",
+    "00000000000003^00000000000000000007oP000000000000000000000000000000000000000000000000000000000000003n00000000000000000007oP00000",
+    "0000000000000000000000000000000000000000000000000000000001n00000000000000000003o0000000000000000000000000000000000000000003`0000",
+    "0000000000000001l000000000n0000000001n00000000000n0000000000000000000000000000003`0000L0000?P01n700003o000000003oon00000000l0000",
+    "0000001oP00000000000000O000000000000003`0000N0000o`03ooP0007_P0000000?gon0000000ool0000000007oP00000000000000o000000000000003`00",
+    "00N0001oh03oo0000?7`0000000O1`00000000ool000000000?SP00000000000000l000000000000003`0000N0003ih07WN0000?3`0000000l1`00000000ool0",
+    "00000000?3P00000000000001h000000000000003_000N?`003Ph077l000071`0000001h1`0000000003h000000000N0000000000000001`00000000000001oo",
+    "000Oo`003P0077l000071`0000001h1`0000000007`000000000L000000000000000Oo00000000000001ol000?oP00000077L00007P00000001`1`000000000?",
+    "`000000000l000000000000000Oo00000000000000?h0001n00000007_l00003`00000001`1`000000000OP000000003oo000000000000001h00000000000000",
+    "3P0000>00000007ooP0003h00003P01`1oh00000000o0000000003oo000000000000001`000000000000003P0000>00000007ool?`00n00007P01`1oh0000000",
+    "0n0000000003oo000000000000001`000000000000007P0000>00000003konOl00O0000?001`1`000000001n0000000003oo000000000000001`000000000000",
+    "007P0000>000000007nNnl00?P000N001h1`000000003l0000000003oP000000000000001`000000000000007P0000>000000007L>lL007`000l000h1`000000",
+    "007h0000000000>0000000000000001h000000000000007P0000>00000000?l?hL003`000n000l1`000000007`0000000000?0000000000000000h0000000000",
+    "00007P0000N00000000>lOhL0H1`000O000L1`00000000?P00000000007P000000000000000h00000000000000700000L00000000>hOhl0l1`0007P00N1`0000",
+    "0000OP00000000007`000000000000000h00000000000000700003oh0000000Nhlmh0N3`0003P00>1`00000000o000000000003h000000000L00000h0007P003",
+    "`?0l0070000Ooh0000000lmlo`0OoP0003P00?1coP000001n000000000001oP00000000N00000h0007c`03`?0l007P000OL00000001lOhO`0?o000000007gooP",
+    "000001ool0000000000oP00000000>00000h0003c`03P?0l007P0000L00000001`?`OP01n000000003ooP0000001ool00000000000000000000>00000h0001a`",
+    "000000007P0000L00000001P00<0000000000001n000000001ool00000000000000000000N00000h0007c`000000007P0000L000000000000000000000000000",
+    "0000000000000000000000000000000l0000?h0007S`000000007P0000N0000000000000000000000000000000000000000000000000000000000l0001o`0000",
+    "00000000007P0000>000000000000000000000000000000000000000000000000000000000000001n000000000000000000000>0000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000ll0000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000nn0000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000LN000000000000000000000000000000000000000000000000003ml000000000000000000000000000000003P000000000L0000N0000",
+    "?700003`00000000000000000000003on0>00?3P00000000000000000000000707P000000000l0000N0000O?0001ch0000000000000000001o^01ol0O00?WP00",
+    "00000000000000007oP007P?0000000001h0000?0000NN0001ah0000000000000000003on00>0`O007o00000000000000000003oP003`?0000000001h0000?00",
+    "00NL0001hh0000000000000000003al00>1loP03n00000000000000000001o0001hN0000000001`0000?0000>L0001ih00000000000000000000000>1nkP00l0",
+    "0000000000000000001n0000hl0000000001h0000>0000?N0007k`00000000000000000000000>3okP0000000000000000000000000000ll0000000001l0000>",
+    "0000?^000?g`00000000000000000000000?3ocP01l000000007hoP0000000Ooh000Oh0000000000l0000000003P00077P001o`000000000000000000?3gcP03",
+    "n00000000Omo`0000000Ooh000Oh0000000000000000000000000000001oh000000000000000000?3gSP03_0001h000Ook`0000000Ooh000?`00000000000000",
+    "00000000000000001oh00000000000000000071cSP03W0001l000L?Q`00000000?h0007P0000000000000000000000000000001oh00000000000000000071`3`",
+    "03`0000L000l73`00000000?`0007P0000000000000000000000000000001oh00000000000000000071`3P01h0000O000l7W`00000000OP00070000000000000",
+    "0000000000000000001oh003oo`3ooooo00000001`0001l0000?P00l7oP00000000o0000700000000000000000000000000000001oh003oo`3ooooo000000000",
+    "0000n00007P00l7n000000001n0000700000000000000000000000000000000o`0000000000000000000000000N0000?000N7P000000003l0000700000000000",
+    "0000000000000000000007P0000000000000000000000000>0000O000N?`000000007h0000700000000000000000000000000000000000000000000000000000",
+    "000000?0000n000??hh0000000?`0000700000000000000000000000000000000000000000000000000000000000?0001l000?ooh0000000OP00007000000000",
+    "00000000000000000000000000000000000000000000000003o0001h0003noh0000000Ooh0007000000000000000000000000000000000000000000000000000",
+    "00000003n0000000000?P0000000Ooh00000000000000000000000000000000000000000000000000000000000000000000000000000000000Ooh00000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007oo",
+    "`000000000000000000000000000000000001`0000000000000000000000000000000000000000000007oo`000000000000000000000000000000000001`0000",
+    "00000000007`00000000000000000000000000000000000000000000000000000o000000001P>0001`0000o000000000On0001l00000000000000000001oh000",
+    "00000000000000000000001o000000001`N0001`0001oP000m`001ooP007n00000000000000000007on000000000000000000000h0003`000N1h001hL0001`00",
+    "01o`001oh003l?`007_0000000000000000000?Po000000000000000000000h0003`000Ooh000lL0001`0001c`001oh007gol000O0000000000000000000OOo`",
+    "00000000000000000001h0003P0007o`000ll0001`0001a`0001h007_nl003o0000000000000000000NOkh00000000000000000001`0003P0007oP000Oh0001`",
+    "0001l00000000?ONN003g0000000000000000000llmh00000000000000N0000?`0003P000?7`000?h0001`0000o00000000?l0>003o0000>N00?ooP0000001hh",
+    "Ll00000000000000n0000o`0003P000>1`000?`0001`0001oP0000000>l0?003oP000NN00?ooh0000001hill00000000000000l0000oh000oP000>1h000?P000",
+    "1`0003oP0000000>h0?000oP000ll000?ah0000001`khL0000000000000000001ol000on000>1h0007o0001`0007S`0000000>h0700000000mh00000h0000001",
+    "`o`L00000000000000<0001ol0007n000>0h00?oo0001`00071`0000000>h0700000001i`00000h0000001`oPL00000000000000>0003g00003P000?1h00?o`0",
+    "000000071`0000000>h0?00000003c`00000h01oon01`o`L00000000000000>0003o00003P000?1`000700000000071`0000000>n0>00000003cP00000h01oon",
+    "01hkhl00000000000000>0003n00007P0007g`00?7OP00000007Q`0000000>N<N00000003c`00000h0000000hill00000000000000>0003n00007P000?oh00Oo",
+    "oP000h0003a`0000000??nL00000003ch0000000000000lhnh00000000000000>0001ll000O0h00Ool003ol0000h0003m`000000077nl00000001hl000000000",
+    "0000nhNh00000000000000>0001ml000o1h00N0L000700000h0000o`00000007S1h00000001ln0000000000000Oh3h00000000000000>0001oh000og`00L0000",
+    "0700000h0000o`00000003l3`00000000lN0000000000000?`?`00000000000000?0001o`000ooP00000000700000h0000oP00000001ooP00000000N?0000000",
+    "0000003ooP0000000000000070001`0000lo000000000000001h00007P00000000?oP00000000>700000000000000on000000000000000?0003`000000000000",
+    "000000001h00007P000000000H000000000000000000000000000000000000000000>0003`000000000000000000001`00003P00000000000000000000000000",
+    "00000000000000000000000000N0007P000000000000000000001`00077P0000000000000000000000000000000000000000000000000000N0007P0000000000",
+    "00000000003`0007_P0000000000000000000000000000000000000000000000000000L00070000000000000000000001`0003o0000000000000000000000000",
+    "0000000000000000000000000000L00070000000000000000000001`0003n0000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000001`000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000?P0003`00000000000000?oh0000000000000000001h0000000000000000000>00000000000?l000000000o`000",
+    "Oh0000N000000000ooh00000000000003P0003n000000007P1`00h0?01oP7P00000000On0000h0003oh000ol0000n000000001ocP00000000000007P0007o000",
+    "000007P3`00h0?03o`?P00000000NN0000h0003ah000ol0000l000000001ocP00000000000007P0007_P00000007P7`00h0N03c`?000000000l>0000h0003Sh0",
+    "007h0000h000000001ocP00000000000003P000?7P00000007P7P00h0l00O`N000000000h>0000h00007`0007h0000h000000001ocP00000000000003P000?7P",
+    "00000007P?000h1h00O`l000000000l>0000h0000?00000l0000h000000001ocP00000000000003P000?7P00000007PN000h3`003`l000000000nN0000h0000N",
+    "00000L00000000000000ocP00000000000007P000??0003SP007Pl000h7`001ah0001`0000Ol0000h0000n00000L000000003PL000ocP001l0000000007P0007",
+    "o0003SP007Pl000h?P001c`0003`0000?h003ohn001oh000?l000000003PL000ocP001l0000000007`0003l0003c`007Qh000hO0007gP0003`000030003oon00",
+    "1oh000Oh000000003PL000ocP001l0000000007`000000001c`0003`000hOh01o_0000000000000000o`00000000N0000000003PL000?cP001l0000000007P00",
+    "0000001ih0003`l00`ol01n?3`001h0000000000h00000000000000000003PL0003cP000000000000000000000000mh0007Sl001on000>7`001h0000000000h0",
+    "0000000000000000003`L0001cP000000000000000000000000Lh000?7l001oN000N?`003`0000000000h00000000000000000003`L0001cP000000000000000",
+    "000000000Lh000??l003`N000lO`003`0000000000h00000000000000000003`L0001cP000000000000000000000000lh000NNL003al001lO`007P000000003o",
+    "on0000000000000000003`L0001cP000000000000000000000000hh000lNn007Sh003hOl0070000000003oon0000000000000000003hl0001cP0000000000000",
+    "00000000001ih001lOn00?3`007`Ol00?00000000000n00000000000000000003in0001cP000000000000000000000003ch003`7n00N7P007P3`00N000000000",
+    "00000000000000000000003on0001cP000000000000000000000007c`003`0l00l7oP0?01`00N00000000000000000000000000000003o_0001gP00000000300",
+    "0000000000007WP003P0l00h3oP0?01`00L>0000000000000000000000000000003o?0001gP000000007P000000000000007000000000h0?00001`00L>000000",
+    "0000000000000000000000007n00001g0000000003`00000000000000000000000000000000000L?0000000000000000000000000000007P00001g0000000001",
+    "h00000000000000000000000000000000000N7000000000000000000000000000000?000001g0000000001h00000000000000000000000000000000000Oo0000",
+    "00000000000000000000000000O000001g000000000O`00000000000000000000000000000000000?n000000000000000000000000000000N000001g00000000",
+    "0O`000000000000000000000000000000000003l0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000L00000000000000000000L000000000000000?00000h0000o`000O>0007N0000o000000000000",
+    "000?00000L0001o0000i`0003P0000L0000m`0006L0000?00001h0001oh000on000?N0000o000000000000000?00000l0003oP000ih0003`0000l0001ml000?L",
+    "00007P0003`0001al000on000?N0001o0000000000000007P0000l0007S`000ih0001`0000h0001in000>L00003P0003`0003`L000kl0000>0001o000001P000",
+    "000003P001oh00073h000`00001h0003o`001`N0000000003`0003`0003^L000Oh000000000n00003on000o`00?coP03ooh00oOl007oo0007n0003o`001on000",
+    "?n00007h0003h0000N0000OP000000000N00007on003ol00?ooP01ooh00ool007oo0007n0001o`001oh000?n00007h0007l0000o0000o`0001h0000N0000?`70",
+    "0?`n001oh000L0000?n0001`00001`0000L0000?h0001h00007h0007l0001oP000o`0003l0000o0000?`700O0O001`0000l0000700001`00001`0000L0000?00",
+    "001h00007l000?N0001kP001ih0007n0000o0000O`000N0?001`0000l0000700001`00001`0000L0000?00001h00007L000O?0003c`001`h000?O0001oP000M`",
+    "000l07001`0000h0000700001`00001`0000L0000?00001`0000?N000N?0003a`001`h000N?0001k`000m`000l00001`0000h0000700001`00001`0000L0000?",
+    "00001`0000?>000l7P007Q`003`l000L7P003c`001i`000h00001`0000h0000700001`00001`0000L0000700001`0000>>000l3P007Q`003PL000l7P007ah001",
+    "ilh00h00003ol000ooP007o0001ol0001`0000L0000700001`0000N?000h3`007Qh003PL000h3`007Qh003aoh00h00003ol000ooP007o0001ol0001`0000L000",
+    "0700001`0000N7001h1`0070h003PN001h3`00?0h007QoP00h00003`0000h0000700001`00001`0000L0000700001`0000l7001`oh00?7l007PO001`1h00N0h0",
+    "07o`000h00003P0000h0000700001`00001`0000L0000700001`0001ooP01ooh00?ol007oo001nOh00Ool00?o`000l00003P0000h0000700001`00001`0000L0",
+    "000700001`0003ooP01olh00OnN007ooP01ooh00Ool00?1`000L00003P0000h0000700001`00001`0000L0000700001`0007`3`03`0l00L0>00703P03oll00L0",
+    "L00N1`000N00003P0000h0000700001`00001`0000L0000700003`0007P3`03P0l00L0?00?03`03P0L00l0L00l1`000?0>003P0000l0000700001`00001`0000",
+    "L0000700003`000?01`03P0l00L0?00?03`03P0L00l0N01h1`0007PN003`0000l0000?00001`00001`0000L0000700003P000>01`03P0L00l0700>01`03P0N00",
+    "h0>01h3`7003hn003`0000N0000>00001`00001`0000L0000700003`000N01`07P0L01h0700>01`03P0N00h0>01`3`o001ol001`?`03oo`00Ooh007l?P007l00",
+    "07oP000ol000On000N01`0700N01h0700N00003P0>00h0>01`3oo000o`00?oo`03oo`00Ooh007ooP007l0007oP000ol000On00000000300N0000000<00000000",
+    "000000000oh000>000?ol00000000000000Ol00000000000000?`0000000000000000>000000000000000000000000000000>000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000N000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000n0000000000000000000000000000000000000000000000000000000000000000000000000000000000001l0000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000001h0000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000001`00000000000000000000000000000000000000000h00",
+    "000000000000000000000000000007cP000L00001`0007n00000L000NL00000000000000700000L0000i`000Mh0000>00000000000000000000?kP000N00003`",
+    "0007o0001nl000NL000000000000007P0000l0001ih000Ml0000N00000000000000000000?oP000N00003P000??P003oh000>L000000000000003`0000h0001h",
+    "l000Ll0000N00000000000000?`0007^On000>00003P000>7P003_h00000000000000070033`0000h0001`l00001P000L0000000007h000Ool007n7n001oP000",
+    "3P000?oP0003h00000000000000oo007QcP01`hh00?`>00001`000L<001`0000?l000?oo007o1n003ol0007h000?o`001o0000on000000007on007P3`01`hl00",
+    ">0N00701`00L0N001`0000?n0003POP00O0L007Qn000Ol000O3h003oh001ooP0000000?`n00703`01`0l00>0N00701`00L0n001`0000>N0003P7`00O0L00?0?0",
+    "00nO000l1l007gn003hO`0000000O1n00701`01`0l00>0>00701`00N0l001`0000>>0003P1h00OPL00O07001h?P01l0l00?Po003`1`0000000N3o00701`01`0l",
+    "00>0>00701`00?1h001h0000N?0003P0h00O`L00N07P03`7P01h0L00?0?P07P1h00N3`00l3W00701`01`0l00>0>00701`00?1`001oh000N?0003P0h00O`L00l0",
+    "3P07`3`03`0N00N07P0700h00O7`00l7WP0701`01`0l00>0>00701`007S`001on000Lo0003P0l00M`L00h03P0?01`03P0>00N03P0700h00?_P00h73P0701`01`",
+    "0h00?0>00701`003gP001`O000Ll000OkhL00MhL00h03P0?01`03P0>00L03P0?00h003o001h?3P0701`01h0h0070>00701`001oP001h7000Ln000OohL00LhL00",
+    "h03P0>01`03P0>00l03P0>00h001n001`N3P0701`00h0h007PN00701`001o0000h7000L?0003o0L00llL00h03P0>01`03P0>00l03P0>00l003n001`n3P0701`0",
+    "0h0h003PN00701`000n0000h7000L70003P0l00llL00h03P0>01`03P0>00h03P0>00L003o001`l3P0701`00h0h003PL007P1`000L0000hO000L70003P0l00hLL",
+    "00h07P0>01`03`0>00l03P0>00L007_P01hh3P07P1`00h1h003PL007P1`000L0000on000L70003P0l00hNL00l0700?01`01`0>00l03P0?00L00?7`00mh7P07P3",
+    "`00l1h003PL003P1`000l0000ol000L70003P0h00hOL00n0?00?03`01h0>00N03P07P0L00?3`00mh?003P3P00l3`003Pl003`1`000l0000n0000l70003P1h00h",
+    "?l00O0?007P3P01h0>00?03P03h0l00N1`00o`?003P3P00L7`003Ph001h7`000l0001h0000l70007P3h00h7h00?PN003h7P00l0>007P3P01l1l00L0000O`N003",
+    "`7P00NOP003ch001lOP000l0001h0000h?0007P3`00h00007ol001o?000O0N003`oP00o7h0000000Oal001hO000?o0003g`000no0000l0001`0000ln000OooP0",
+    "7n00001ol000oo000?`l001mo000?oP0000000ool001on000?l0001oP000Ol0000h0001`0000On000Ooo007o00000?`000?n0007ol000oh0003n00000000oo`0",
+    "00ol0007P0001n00007h0000h0001h0000O`000?on00000000000000000001oh000?P0000h0000000000000000000000000l0000000000h0001h0000L0000000",
+    "00000000000000000000600000000000000000000000000000000000000000000000h00000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000070000030000000000000000000000000000000",
+    "00000000000>00000000000000700000>0000000000000007P00007P000?`00000000000000OP000000000000007P0000N0000o0000000007`0000>0000oP000",
+    "0000007`0000?0000Oh00063000000000o`000000000000007P0000N0001oP000000003`0000N0000oP0000000003`0000N0000ol000?gP003g0000m`0000000",
+    "00000003`0000l0003oP000<L0001`0000l0001k`0007>00001`0000N0001ll000OoP003gP000o`000000000000001`0000h0003ch000Nn0001h0000l0003a`0",
+    "007_00001`0000L0001hL000No0003gP000?P000000000000001`0000h0007Qh000>n0000h0000h0003``0007_0000000000L0000oP000<000000000000000N0",
+    "000000000000000000030h000>L000000000h0003P00000h0000?h0001oP000oh0007n0001o0000?P001ooP00000000?`000000001o00007`0003P0000h00007",
+    "00000h0000On0003o`001ol000?n0003o0000oh003ooh000o0000ol000?n0003oP000Ol000OP0007l0001o0000?h0000nN0007c`001hl000N?0007gP001mh007",
+    "Soh001o`001ln000OoP007g`000nn000O`0007l0001oP000?h0000h>0007Q`003al000L?0007S`001hl0071`h003kh001`?000N7P007S`001l>0001`0000l000",
+    "07P0001h0000ho00073h003Wl000LO00077`001al0073gh003`h001`?000l7P0071`001hN0001`0000L00003P0001h0000io0007?h001_l000Mo0007O`0007l0",
+    "00?o`003P0001oo000oo000?o`003on0001`0000L00003P0001h00007o0000oh000oL0003o0000o`000Ol000oo0003P0001on000on000?oP003oh0003`0000L0",
+    "0007P0001h0000?_0001mh000lL0007g0001m`000nL001o`0003P0001h0000o`0007P0001h00003`0000L0000700000h0000O?0003ih001hL000??0001i`000l",
+    "L003k`0003`0000h?000l00003Ph001h70003P0000L0000700000h0000L>0003Ph001hL000??0003a`001hl003S`L003ah000l?000N3P003ah000n?0003P0000",
+    "L0000700000h0000L>0003Qh001hL000?>0003S`001ih003Shl001oh000NN000?7P001kh000On0003P0000L0000700000h0000L>0003Q`001hL000?n0003oP00",
+    "1kh003goh000oP000?l0007o0000o`000?n0003P0000o0000700000n0000ON0003o`000ol0007l0003o0000o`003oo`000O00007h0003n0000OP0003h0007n00",
+    "03o0000o`000On0000?n0001oP000Oh000000001n0000oP001oOP000N00001P0000000000000000000On0003o0000oh000On00007l0000000000000000000000",
+    "000>0000000000>0000000000000000000000000OP000000000000000h000000000000000000000000000000000000000000N000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000l000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000003l0000000000000000000000000000000000000000000000000000000000000000000000000000000000003h0000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000>00000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000?000000000000000000000<00000000000000000000000003P0000700000000000000000001`0000000000?o000000000L0000",
+    "0h0001o00000000000000000000000003P0000?00007P00000000070001`00000000007o0001i`000N00001h0003oP000nL00000000000000000003`0000O000",
+    "0O`000000000?0001`0000000000?h0003o`000?00003`0007g`000ol000?N000000000000001h0000n0000oh000>L0000O0003`0000>L0000oh0007o`000?P0",
+    "003`0007Sh001ol000?N0000`0000000000h0000h0000ml000?N0000N0003`0000?L0000ll0007WP0007P0003P00071h001kl000?N0001h0000000000h0000h0",
+    "000hl000?N0000L0003`0000?N0000hl000000000000003h000700000700006L0001h000001P00000000h00000L000H00000L0003o000003P0000n0000?P000o",
+    "P000?l0003o0000?P0007h000000000oW`00L700071`001`H000L?00001`003o`000h3P000?n0007oP001oh000on0007o`000O`000Ol000000001ooP00L?0007",
+    "3`001`h000L?00071`003oh000l7P000Oo0007o`003kl000l?000?W`000m`000nn003o1l001ko000L?0007S`001`l000L?00071`003hl000l70000L70007S`00",
+    "3Pl000h?000>1h001ih000lN003ool003al000L?0007S`001`l000L?0007S`003`N000N?0000L700071`007PL001h7000>1h003hh000h?0003oP003al000L?00",
+    "03S`001`l000L?0007SP003P>000NN0000L7P0071`007PL001h7000>1h007`l001h7000000003Sn000L?0003S`001hl000L>0003SP003P>000>N0000L3P0071`",
+    "007PL001`7000>1`007PL000h7P001`0003W^000L?0003c`001hl000L>0003cP003PN000?l0000L7P0071`007PL001h7000>1`007PL000h7P001h0003_^000L?",
+    "0003c`000hl000L>0003gP003PN000?h0000L700071`003Pl001h7000?3`007PL000h3P001`0003oN000L>0003cP000hl000N>0001oP00?Pl0007h0000N70007",
+    "1`003Pl000h7000?3`003`l000h7P00000003nn000NN0003cP000ll000NO0001o000?kh0007h0000O_00071`003ah000n?0007SP003ih000l7000000003il000",
+    ">n0003cP000Ll000?O0000n0007o`0003`0000?o00071`001ih000On0003oP001oh000N?000000007oh000?n0003gP000Ol000?o0000N0003oP0003`00001n00",
+    "071`001o`0007n0001oP000O`000On000000007oP0007o0001oP000Ol0007oP000L0003P00001`00000000071`000o`0001`0000o000070000?l000000007000",
+    "003W0001oP000?l00007P000L0003P00001`00000000000000000000000000N0000000003h00000000000000000000OP0007l000000000l0003`00003`000000",
+    "0000000000000000000000000000000000000000000000000000000000L000000000l0003`00007P000000000000000000000000000000000000000000000000",
+    "0000000000000000L000000001h0001`0000?P0000000000000000000000000000000000000000000000000000000000000000000000000?`0001`0003o00000",
+    "000000000000000000000000000000000000000000000000000000000000000000000O`0001`0003l00000000000000000000000000000000000000000000000",
+    "000000000000000000000000000N0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+};
 
-}
+static constexpr uint8_t nFontMargins3[] = {
+     0,31, 0,31, 32,32,32,32,  8,14,14, 3, 15, 8, 1,16,  8,14, 1,16, 12,10, 4,22, 16,12, 6,23, 10, 9,10,10,
+    13, 9, 4,21, 32,32,32,32, 32,32,32,32, 14,12,25, 1, 12,10, 5,22, 32,32,32,32,  9, 8, 3, 4,  8, 8, 2, 3,
+     8, 8, 1, 3,  9, 8, 4, 6, 11,11, 3, 4, 12,12, 3, 8,  9, 8, 3, 4,  8, 8, 1,16,  8, 8,14, 3,  8,14, 1, 3,
+    11,11, 2, 4, 15, 8, 1, 3,  9, 8,11,13,  9, 8,11,12, 32,32,32,32, 32,32,32,32, 32,32,32,32, 32,32,32,32,
+    32,32,32,32, 16,12, 5, 7, 14,10, 4,18,  9, 6, 4, 8, 12, 7, 3, 6,  7, 2, 5, 7,  8, 2, 5, 7, 17,11, 4,18,
+    15, 8, 4, 1, 12,10, 3, 1, 12, 7, 3,17,  8, 6, 6, 9, 14,13,23, 2, 13, 9,16,14, 16,12,23, 6, 13, 9, 5, 7,
+    12, 8, 6, 7, 17,12, 5, 7, 11, 8, 6, 8, 11, 9, 6, 7, 11,10, 6, 8, 11, 9, 6, 7, 11, 7, 4, 7, 11, 7, 5, 6,
+    11, 8, 4, 7, 11, 7, 5, 7, 16,12,11, 7, 15,11,11, 2,  8, 5, 9,11,  8, 4,10,14,  9, 4, 8, 9, 13, 9, 5, 8,
+     4, 1, 3, 1,  8, 5, 6, 7, 11, 5, 5, 7, 10, 0, 4, 7, 10, 5, 5, 6, 13, 6, 4, 7, 12, 5, 5, 7,  9, 5, 4, 6,
+    10, 8, 5, 7, 13, 8, 5, 6, 14, 8, 5, 6, 10, 6, 4, 7, 12, 4, 4, 7,  8, 4, 4, 7,  9, 7, 4, 8,  7, 5, 4, 7,
+    13, 7, 4, 8,  7, 0, 5, 7, 12, 5, 4, 7, 10, 9, 5, 7,  9, 5, 4, 8,  9, 7, 4, 8,  9, 6, 5, 9,  8, 1, 6, 9,
+    10, 6, 5, 7, 11, 6, 5, 8, 10, 5, 5, 7, 14, 8, 4, 0, 13, 7, 3, 7, 13,11, 3, 1, 10, 8, 5,16,  9, 0,29, 0,
+    14,13, 5,22, 12, 7,13, 7, 12, 7, 4, 7, 13, 7,12, 8, 12, 9, 4, 7, 12, 7,12, 9, 14, 5, 3, 6, 11,10,11, 5,
+    13, 9, 3, 8, 17,11, 3, 8, 12,12, 4, 5, 13, 6, 3, 7, 16,13, 4, 7,  9, 5,11, 8, 13, 7,10, 8, 12, 0, 0, 7,
+    13, 8,10, 1, 12, 8,12, 1, 15, 8,11, 7, 13, 9,11, 9, 13,11, 8, 8, 12, 9,11, 7, 12, 8,12, 9,  9, 6,11, 9,
+    11, 8,11, 7, 12, 7,11, 2, 11, 8,10, 7, 14, 7, 3, 1, 17,11, 3, 1, 12,10, 3, 1, 10, 5,14,13, 12, 0, 5, 0,
+    10, 7, 5, 7, 32,32,32,32, 14,13,22, 3, 11, 8, 6, 2, 13, 8,22, 4,  6, 2,22, 7, 11, 8, 4, 3, 11, 7, 5, 2,
+    12, 9, 5,21,  3, 0, 5, 6,  0, 8, 1, 7, 14,11,13, 9,  5, 1, 4, 6, 32,32,32,32,  7, 8, 1, 6, 31, 0, 0,31,
+    32,32,32,32, 15,12, 5,19, 15,12, 5,20, 13, 8, 5,19, 12, 7, 5,19, 13, 9,12,11, 10, 6,17,13,  2, 0,17,13,
+     0, 7, 6,13,  4, 0, 4,14, 12, 9, 5, 7, 13,11,13, 8,  6, 5,11, 7, 32,32,32,32,  9, 9, 6, 6,  9, 7, 1, 8,
+    32,32,32,32, 16,10,11, 1, 11, 8, 7, 1, 12, 5, 5, 7, 11, 6, 7, 9,  9, 5, 5, 8, 16,11, 3, 0, 13, 8, 5, 1,
+    13, 9, 6,22,  8, 2, 4, 6, 13, 9, 5,18, 12, 6,11, 7,  8, 5,11,13,  9, 5,16,14,  7, 2, 5, 7,  9, 6, 2,28,
+    12, 9, 5,17,  8, 5, 6, 9, 12, 9, 4,17, 12,10, 4,16, 16,11, 5,21,  9, 6,12, 1, 11, 5, 4, 1, 15,12,12,16,
+    15, 9,24, 1, 15,12, 5,16, 12, 9, 4,18, 11, 9,11, 6,  9, 3, 5, 7, 10, 3, 5, 6,  6, 2, 4, 6, 13, 8,11, 1,
+     7, 6, 1, 7,  7, 5, 1, 5,  7, 6, 1, 7,  7, 6, 1, 6,  8, 5, 1, 7,  8, 7, 1, 7,  5, 2, 4, 6, 10, 4, 5, 1,
+    10, 4, 1, 6, 10, 5, 0, 7, 10, 6, 1, 7, 11, 5, 1, 6, 15, 9, 1, 7, 13, 8, 0, 7, 13, 7, 1, 6, 13, 9, 1, 7,
+     7, 4, 4, 6,  7, 5, 1, 7,  8, 5, 1, 7,  8, 6, 0, 7,  8, 5, 1, 5,  8, 5, 1, 6,  8, 4, 1, 6, 11, 8,10,10,
+     7, 5, 4, 7,  9, 6, 1, 7,  9, 6, 1, 7, 10, 7, 0, 6,  9, 6, 1, 7, 11, 5, 1, 5, 13, 6, 5, 6, 12, 8, 4, 6,
+    12, 8, 4, 6, 13, 7, 4, 7, 12, 8, 5, 7, 13, 7, 6, 8, 13, 8, 7, 7, 13, 8, 5, 6,  9, 4,10, 7, 14, 7,12, 2,
+    13, 6, 5, 7, 12, 7, 4, 8, 12, 7, 5, 8, 12, 6, 7, 8, 13, 9, 4, 6, 13,10, 4, 7, 12, 9, 5, 7, 13, 8, 7, 6,
+    12, 7, 3, 8, 13, 8, 6, 7, 11, 8, 5, 7, 11, 8, 5, 7, 12, 7, 4, 6, 11, 8, 6, 7, 11, 7, 7, 6,  8, 6, 8,12,
+    11, 4,10, 7, 13, 8, 4, 7, 13, 8, 4, 6, 13, 8, 5, 4, 13, 7, 7, 7, 11, 8, 5, 1, 10, 7, 4, 2, 10, 7, 7, 2,
+};
 
 // NOTE: this data is associated with index: 4, file name: "bitmapfont openGL.tpbg.mono.png"
-void  InitDataString4( std::string &sDataString ) {
-
-    sDataString.clear();
+static constexpr const char *const sFontData4[] = {
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000002000P008000000003o00000000000000000000000000P000000000000000200000080000000000",
+    "0000002000P008000000003o00000000000000000003002000P0000020000000002000000800200000000000002000P008000000003o000000000O007000000M",
+    "002000P001007002@00O002000000800700000000000002000P008000000003o0000000005008P00000A00G@00P00300:P02@00U002000000800:P0000000000",
+    "002000P008000001P03W0000000005008P00000C008P00P007002002@015002000000800200000000000002000P008000003`0330000000009008P00000M008P",
+    "00P00?002002@015002000000800200000000000002000P008000007h0210000000009007000000A008P00P00O002002@0150020000008002000000000000020",
+    "00P008000007h021000000000@002000000A00H`00P00o002002@00U00200000080020000000003h003`0?P00800o`07h021000000000@002000000A008P0?l0",
+    "1o002002@00M00o`0?l03h002000000000080000000008000003`033000000000h00O`00000C008P00P00o002002@005000000P0080020000000000800000000",
+    "08000001P03W0000000014002000000G008P00P00O002002@005000000P008002000000000080000000008000000003o0000000014002000000f00G@00P00?00",
+    "20000005000000P008002000000000080000000008000000003o0000000014002000001`002000P00700:P000005000000P00800200000000008000000000800",
+    "0000003o000000000h002000001P002000P003007002@005000000P008002000000000080000000008000000003o00000000000000000000000000P001002002",
+    "@000000000P008002000000000080000000008000000003o00000000000000000000000000P0000000000000000000P008000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000200000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000000020000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000200000000000000000000000000<00Oh01800400H000000>000`01P000000000000000000020",
+    "1oP0?000200000000000000000000000000<00Lh01800400H807h00>001P00`00400000000000000006010P01000200000000000000000000000000<00Lh0180",
+    "04000H06H00>003000H00TP000000000000000<010P010002000@00@0000000000000000000<00Lh07n00oP00`04800<002000800eP010000000000000<010P0",
+    "10002000800P0000000000000000000<00Lh01800P001P04800<002000800O0010000000000000H010P010003`07l01o0000000000000000000<008@01800oP0",
+    "3007H00<002000800>0010000000000000`010P010002000800P0000000000000000000<000007n000P03003`008002000800>00?h01h01oP00000`010P01000",
+    "2000@00@000000000000000000080000018000P06007`000002000800O0010008000000001P010P018002000000000000000000000000000000001800oP0<004",
+    "J000002000800eP0100080000030030010P018002000000000000000000000000000000001800400H004>000003000H00TP0100080000030030010P018002000",
+    "00000000000000000000000<000000000400@H06N000001P00`00400000080000000060010P01800200000000000000000000000000<0000000004000H07j000",
+    "000`01P0000000008000000004001oP0?h0020000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000Oh07n00P007h06000oP0?`07n0000000000000000000<01o003007l00oP0",
+    "OP07n01oP07h04201o0008000800200Q004004000PP08@042000000000>00000L000n01QP03004>00`004`04001000600420080008000800200Q0040040000P0",
+    "8@042000006000L00000>001R000P07P04600P004@04001000<00420080008000800200Q0040040000P08@04200<006001h01oP07P072000P07P04601P004H04",
+    "001000H00420080008000800600Q0040040000P08@07n00<000003P000001`06>000P07P04>01P004H04001n00@0042008000800Oh01n00Q007h040001P0Oh00",
+    "20000000070000000h04L01hP0<`07l010004807`01000@007n008000800@000600Q000804000300@8002000007P03P01oP01`00`01XP0<`04>0100048040010",
+    "00@0042008000800@000200oP00807n00600@800200<000P00`000007P01P018P08@04601P004H04001000Ah042008004800@0002001000804200400@800200<",
+    "000P00L00000>0010018P0Oh04601P004H04001000@8042008004800@0002001000804200400@8002000000P00600000H0010018P0HH04600`004`04001000@8",
+    "042008004800@000200100L804200400@8002000000P000000000000001mP0@804>00`004`04001000HH042008006H00Oh07n00100Oh07n00400Oh006000000P",
+    "000000000001001oP0`<07l00OP0OP07n01000Oh04201o007h000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000030000000000000@H04001P`0H801h01oP01h07n01oP0?h042010P0@@04",
+    "200PP0Oh07n00P00Oh000000001P000010000000@`04001a`0L803l011P03X046011P098042010P0@@06600PP00H05000`000X000000000`000010000000AP04",
+    "001O@0L803<010P0>804201P0010042010P0@@03400aP00`05000H000X00`0000000000010000000G004001>@0F8066010P0L804600`0010042010P0@@03<00k",
+    "P00`05000H000X01h000000003n01o007h00N0040014@0F8066010P0@807n00H001004201QP0B@01h00O001P05000<000X01h000000000601aP0<000L0040010",
+    "@0C8042011P0@804@00<001004201QP0B@00`00>0030050006000X03l0000000002010P0H000L0040010@0C804201oP0@804H00<001004200c00B@00`0040030",
+    "050006000X03l000000003n010P0@000F0040010@0AX06601000B804<006001004200c00B@01h0040060050003000X07>0000000066010P0@000C0040010@0AX",
+    "06601000Ch04<003001004200N00B@03<00400<0050001P00X0660000000042010P0@000AP040010@0@h03<01000C`046001P01004200N00B@03<00400<00500",
+    "01P00X0660000000042010P0H000@`040010@0@h03l01000KP046010P01006600<00O`06600400H0050000`00X000000000006>01aP0<000@H07n010@0@H01h0",
+    "1000Nh04201oP01007n00<00O`04200400Oh07n000@0Oh000000000003n01o007h00000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003oh00000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000<000H0000000000000000000000000000000000000000000000000000000000000008000007`00004000<000H04000L",
+    "00000000000000000000000001000000000000000000000007P010000800000<0000040000000004000400000000000000000000000001000000000000000000",
+    "000004001000080000080000040000000004000400000000000000000000000001000000000000000000000004001000?h03l00o00?h07n00L001h04<00400?h",
+    "07n00o00OP03n01oP0Oh07l010P0@8022010P0@807n004001000Hh06600800Hh07V004000804h00400=X07V01QP0L`06>01iP0@H010010P0@802201QP0@80060",
+    "04001000@804200800@8042004000805`0040098042010P0@H042010P0H0010010P0@802200c00HH00<00l001000@804200800@8042004000807000400980420",
+    "10P0@804201000O0010010P0HH02B00N00HH00H00<001000@807n00800@804200400080700040098042010P0@8042010007`010010P0<`02B00<00<`00`00400",
+    "1000@804000800@8042004000805P0040098042010P0@8042010000H010010P0<`02B00N004`01P004001000@806000800Hh042004000804h0040098042010P0",
+    "@H0420100008010010P07P02n00c007P030004001000Hh06000800?h042004000804L004009804201QP0L`06>01000HH01V01WP07P03n01QP03P060004001000",
+    "?h03n008000804200O000804600O009804200o00OP03n01000Oh01n00oP03003^010P03007n007P010000000000000080000000048000000000000000000@000",
+    "200000000000000000000000003000000000000000000000000H000000006H000000000000000000@00020000000000000000000000000600000000000000000",
+    "000000O`000000007h000000000000000000@00020000000000000000000000000N0000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000036000000000000aP000000000000000000000000000000000",
+    "000000000000000000000000000000000001\\000000000000K0000000000000000000000000000000000000000000000000000000000000000000000h0000000",
+    "00000>000000000000000000000000000000003`00000000000000000000000000000>0000000000000000000000000000000000000000000000?000002@007h",
+    "000000000n000000001000@00K00H`07n000007h00001oP00000000@007`02401cP000001000002@0040000000001P000000001000@00aP0HP04600000=00000",
+    "01P00000000@000@02400@P000001000002@00<0000000001P000000001000@000001P06000000=0000003000000000@000@02400@P000001000002@00H00000",
+    "00007h00000000?h03n000003003000200I0000003000000000@000@02400@P07h001000002@00o`0000000010000000001000@000002001P00600I000000600",
+    "0000000@000@02400@P07h001h03k02@00@00000000030000000001000@000006000`00<00Ah00000<000000000O000@03W00@P07h001P03O02@00@000000N00",
+    "3007>000001000@00000<000`00<00A000000<00000000000000000000007h001000002@00o`0000020030012000001000@000008000H00<00I000000H000000",
+    "00000000000000007h001000002@00H00000020030012000001003n00000H000<00600I000000`00000000000000000000007h001000002@00<0000002002001",
+    "2000001000@000000000600200=000000`000000000000000000000000001000003`00<0000002006001200f`01000@00000H`04200000=000001P0000000000",
+    "0000000000000000?0000000007h000002006001200f`01000@00000H`07n000007h00001oP00000000000000000000000000000000000000000000060000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000006000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000400000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000008400000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000840000000000000000000000000000000000000000000000000000000000000000000000000000000000840000",
+    "000000000000000000000000000000000000000000000000000000000000036000000000000aP000000000000000000000000000000084000000000000000000",
+    "00000000000n`0OK01\\000000000000K0088000000002000700000<H00@01oP08403l00oP00000000000?`000000000g`04O00h000000000000>008800000000",
+    "2000400000<H00@01PP084066001P00000000000HH0000000000004O000000000000000000<H000000002000<000006`00@01`P00004j000P00000000000GX00",
+    "00000000004A07n00800?h00001oP0>h00000<007h00<00o`03P00@00h000005R00oP02400000000EX0000000000004A04600<00K\\000001P07`00000<00<000",
+    "800H`03P00@01l000005R01QP06<00000000DX007`0?oP00004A06000600A4000003003P00000000H003o00@@0100000160000052010P0<H03o00000EX000000",
+    "0000000007`00600A4000006001000000000@000H00@@0?h00001V0000052010P0<H00101oP0GX0000000000000001l00600Al00000<001000000800@000@00@",
+    "@01000@01c000005R01SP0<H00100000EX0000000000000000600<00A000000H001000000<00@000`00H`01000@00iP00005R00oP06<00100000EX0000000000",
+    "000000200800A000000`001000000<00H000`00oh01000@00HP00004j000002400100000DX0000000000000006600000KP00001P001000000<00<000P00@@010",
+    "00@00?P000066000000000000000HH0000000000000007n00000?l00001oP01000000<007h03o000001000@007000003l000000000000000?`00000000000000",
+    "0000000000000000000000000<00200000000000000013P00000000000000000000000000000000000000000000000000000000000000<002000000000000000",
+    "1QP00000000000000000000000000000000000000000000000000000000000000<0020000000000000001oP00000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000001h000000000000000000000000000000000000000000000000000000000000000000<00",
+    "0`00h00000@801h0000000000000000000000000000000000000000000000000000000000000000006001P01\\01mP0@801h000000000on000000000000000000",
+    "00000000000000000000000000000000000003003003601_P0@801h0000000000000000000000000030000000000000000000000000000000000000000000000",
+    "000000000000000000000001l000003h00n006000003n000000000h00o00000>0P3P80n200000<003000`00<003000`001`07h0000036000000800200<000003",
+    "b000000000801QP000021P0PH02600000<003000`00<003000`00200<00000022000003h00>000000003b0000000008010P00002300P`0><00000N007P01h00N",
+    "007P01h00200800000022004002000200000@803b0000000008010P08@02600QP02H00800N007P01h00N007P01h00600H00000022004002000200000@803b000",
+    "0000008010P0<H02<00S002`00000N007P01h00N007P01h00600H00000036004003h00n00000@803b010000000n010P06<0?h03n00oP00800c00<`03<00c00<`",
+    "03<00>00@0000001l00oP00000000000@803b0000000000010P06<00d@0=l03A00800c00<`03<00c00<`03<00?`0@00000000004000000000000@800B0000000",
+    "00001QP06<01T@0H406A00H00Q008@02400Q008@02400J00H00000000004000000000000@800B000000000000o00<H034@0al0<A00`01oP0Oh07n01oP0Oh07n0",
+    "0N00H00000000004000000000000@H00B0000000000000008@064@1Q00HA01P01QP0HH06601QP0HH06600b00<00000000000000000000000Ih00B00000000000",
+    "0000000<7h3100`OP32010P0@8042010P0@804200b00<0000000000oP00000000000OX00B00000000000000000080@21l0P1026030`0`<0<3030`0`<0<300S`0",
+    "7h0000000000000000000000@0000000000@0000000000000000000002L00000000000000000000000000P0000000000000000000000@0000000000@00000000",
+    "00000000000003h00000000000000000000000000P0000000000000000000000@0000000007`0000000000000000000003P0000000000000000000000000?P00",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000003000H00>00@801P0030070042000000001P006003P00",
+    "0010P00000000H001P00h010P00`0000000000001P00`00K00@800`00600=P04200000OH00`00<006`07f010P00000000<003001\\010P01P0000000000000`01",
+    "P00aP0@800H00<00H`04200000Kh00H00H00<H06n010P0000000060060036010P030000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000003000Oh07n01oP0Oh07l01o00O`07l01n00H801h00N007P01h00N000001j010P0@8042010P08804000o001P00@0040010",
+    "00@000P008002000P00C00L803l00o00?`03l00o000003>010P0@8042010P08804001QP00`00@004001000@000P008002000P00A00L803<00c00<`03<00c00<H",
+    "03<010P0@8042010P0<H040010P00000@004001000@000P008002000P00AP0F806601QP0HH06601QP0>h06>010P0@8042010P0>h07n013P0?h00@004001000@0",
+    "00P008002000P00AP0F806601QP0HH06601QP07`06N010P0@8042010P07`04601?000H00O007`01l00O000P008002000P01lP0C8042010P0@8042010P03P04b0",
+    "10P0@8042010P03P04201<000800@004001000@000P008002000P00@P0C8042010P0@8042010P07`04b010P0@8042010P01004201>00?h00@004001000@000P0",
+    "08002000P00AP0AX06601QP0HH06601QP0>h07V010P0@8042010P01004601700HH00@004001000@000P008002000P00AP0AX06601QP0HH06601QP0<H076010P0",
+    "@8042010P01007n013P0@800@004001000@000P008002000P00C00@h03<00c00<`03<00c000003<010P0@8042010P010040010P0@800@004001000@000P00800",
+    "2000P00C00@h03l00o00?`03l00o000007801QP0HH06601QP01004001=P0Hh00Oh07n01oP0Oh07l01o00O`07l01n00@H01h00N007P01h00N000005h01oP0Oh07",
+    "n01oP01004001?P0?h00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000001h0000000000000000000000000000000000000000000000000000000000000000000000`00h00000@801h000000001P003003P",
+    "04200H000H00h00P@00000000H000`00h00000@80000000030001P01\\01mP0@801h000000000`006006`04200<000`01\\00P@0I007f00<001P01\\01mP0@80000",
+    "00001P003003601_P0@801h000000000H00<00<H042006001P03600P@0?P06n006003003601_P0@8000000P00`00000000000000000000000000000000000000",
+    "00000000000000>000000000000000000000000000P00000?h03n00oP0?h03n00oP07h03l00o00?`03l00L007001`00L00K007n00o00?`03l00o00?`00@00o00",
+    "@8000H006001P00H00600>`0<006601QP0HH066004001000@00400AP07V01QP0HH06601QP0HH00001cP0@80008002000P008002004@0H0042010P0@804200400",
+    "1000@00400?`042010P0@8042010P0@8000013P0@800?h03n00oP0?h03n01l@0@0042010P0@8042004001000@00400HH042010P0@8042010P0@803n016P0@800",
+    "HH06601QP0HH06601_`0@007n01oP0Oh07n004001000@00400@8042010P0@8042010P0@800001<P0@800@8042010P0@804201400@004001000@0040004001000",
+    "@00400@8042010P0@8042010P0@8000018P0@800@8042010P0@804201600H006001P00H0060004001000@00400@8042010P0@8042010P0@800@01`P0@800Hh06",
+    ">01SP0Hh06>01^00<006001P00H0060004001000@00400HH04201QP0HH06601QP0HH00001cP0Ih00?h03n00oP0?h03n01k`07h03n00oP0?h03n00O007`01l00O",
+    "00?`04200o00?`03l00o00?`00000o00?h00000000000000000000000P0000000000000000000000000000000000000000000000000000001P00000000000000",
+    "0000000000000P0000000000000000000000000000000000000000000000000000001000000000000000000000000000?P000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000H00h010P00`0000",
+    "10P000000000000000000000000000000000000000000000000000000000000000000`01\\010P01P040010P00000000000000000000000000000000000000000",
+    "0000000000000000000000001P036010P030040010P0000000000000000000000000000000000000000000000000000000000000000000000000000004000000",
+    "0000000000000000000000000000000000000000000000000000000000000000@8042010P0@807h010P000000000000000000000000000000000000000000000",
+    "00000000000000000000@8042010P0@807<010P00000000000000000000000000000000000000000000000000000000000000000@8042010P0HH04601QP00000",
+    "000000000000000000000000000000000000000000000000000000000000@8042010P0HH04201QP0000000000000000000000000000000000000000000000000",
+    "0000000000000000@8042010P0<`04200c000000000000000000000000000000000000000000000000000000000000000000@8042010P04`04200C0000000000",
+    "00000000000000000000000000000000000000000000000000000000@8042010P07P04600N000000000000000000000000000000000000000000000000000000",
+    "000000000000Ih06N01WP03P07<00>000000000000000000000000000000000000000000000000000000000000000000?h03n00oP03007h00<00000000000000",
+    "000000000000000000000000000000000000000000000000000000000000003004000<0000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000006004000H0000000000000000000000000000000000000000000000000000000000000000000000000000N004001h000000000000000000",
+    "000000000000000000000000000000000000000000000000",
+};
 
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000002000P008000000003o00000000000000000000000000P000000000000000200000080000000000";
-    sDataString += "0000002000P008000000003o00000000000000000003002000P0000020000000002000000800200000000000002000P008000000003o000000000O007000000M";
-    sDataString += "002000P001007002@00O002000000800700000000000002000P008000000003o0000000005008P00000A00G@00P00300:P02@00U002000000800:P0000000000";
-    sDataString += "002000P008000001P03W0000000005008P00000C008P00P007002002@015002000000800200000000000002000P008000003`0330000000009008P00000M008P";
-    sDataString += "00P00?002002@015002000000800200000000000002000P008000007h0210000000009007000000A008P00P00O002002@0150020000008002000000000000020";
-    sDataString += "00P008000007h021000000000@002000000A00H`00P00o002002@00U00200000080020000000003h003`0?P00800o`07h021000000000@002000000A008P0?l0";
-    sDataString += "1o002002@00M00o`0?l03h002000000000080000000008000003`033000000000h00O`00000C008P00P00o002002@005000000P0080020000000000800000000";
-    sDataString += "08000001P03W0000000014002000000G008P00P00O002002@005000000P008002000000000080000000008000000003o0000000014002000000f00G@00P00?00";
-    sDataString += "20000005000000P008002000000000080000000008000000003o0000000014002000001`002000P00700:P000005000000P00800200000000008000000000800";
-    sDataString += "0000003o000000000h002000001P002000P003007002@005000000P008002000000000080000000008000000003o00000000000000000000000000P001002002";
-    sDataString += "@000000000P008002000000000080000000008000000003o00000000000000000000000000P0000000000000000000P008000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000200000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000000020000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000200000000000000000000000000<00Oh01800400H000000>000`01P000000000000000000020";
-    sDataString += "1oP0?000200000000000000000000000000<00Lh01800400H807h00>001P00`00400000000000000006010P01000200000000000000000000000000<00Lh0180";
-    sDataString += "04000H06H00>003000H00TP000000000000000<010P010002000@00@0000000000000000000<00Lh07n00oP00`04800<002000800eP010000000000000<010P0";
-    sDataString += "10002000800P0000000000000000000<00Lh01800P001P04800<002000800O0010000000000000H010P010003`07l01o0000000000000000000<008@01800oP0";
-    sDataString += "3007H00<002000800>0010000000000000`010P010002000800P0000000000000000000<000007n000P03003`008002000800>00?h01h01oP00000`010P01000";
-    sDataString += "2000@00@000000000000000000080000018000P06007`000002000800O0010008000000001P010P018002000000000000000000000000000000001800oP0<004";
-    sDataString += "J000002000800eP0100080000030030010P018002000000000000000000000000000000001800400H004>000003000H00TP0100080000030030010P018002000";
-    sDataString += "00000000000000000000000<000000000400@H06N000001P00`00400000080000000060010P01800200000000000000000000000000<0000000004000H07j000";
-    sDataString += "000`01P0000000008000000004001oP0?h0020000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000Oh07n00P007h06000oP0?`07n0000000000000000000<01o003007l00oP0";
-    sDataString += "OP07n01oP07h04201o0008000800200Q004004000PP08@042000000000>00000L000n01QP03004>00`004`04001000600420080008000800200Q0040040000P0";
-    sDataString += "8@042000006000L00000>001R000P07P04600P004@04001000<00420080008000800200Q0040040000P08@04200<006001h01oP07P072000P07P04601P004H04";
-    sDataString += "001000H00420080008000800600Q0040040000P08@07n00<000003P000001`06>000P07P04>01P004H04001n00@0042008000800Oh01n00Q007h040001P0Oh00";
-    sDataString += "20000000070000000h04L01hP0<`07l010004807`01000@007n008000800@000600Q000804000300@8002000007P03P01oP01`00`01XP0<`04>0100048040010";
-    sDataString += "00@0042008000800@000200oP00807n00600@800200<000P00`000007P01P018P08@04601P004H04001000Ah042008004800@0002001000804200400@800200<";
-    sDataString += "000P00L00000>0010018P0Oh04601P004H04001000@8042008004800@0002001000804200400@8002000000P00600000H0010018P0HH04600`004`04001000@8";
-    sDataString += "042008004800@000200100L804200400@8002000000P000000000000001mP0@804>00`004`04001000HH042008006H00Oh07n00100Oh07n00400Oh006000000P";
-    sDataString += "000000000001001oP0`<07l00OP0OP07n01000Oh04201o007h000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000030000000000000@H04001P`0H801h01oP01h07n01oP0?h042010P0@@04";
-    sDataString += "200PP0Oh07n00P00Oh000000001P000010000000@`04001a`0L803l011P03X046011P098042010P0@@06600PP00H05000`000X000000000`000010000000AP04";
-    sDataString += "001O@0L803<010P0>804201P0010042010P0@@03400aP00`05000H000X00`0000000000010000000G004001>@0F8066010P0L804600`0010042010P0@@03<00k";
-    sDataString += "P00`05000H000X01h000000003n01o007h00N0040014@0F8066010P0@807n00H001004201QP0B@01h00O001P05000<000X01h000000000601aP0<000L0040010";
-    sDataString += "@0C8042011P0@804@00<001004201QP0B@00`00>0030050006000X03l0000000002010P0H000L0040010@0C804201oP0@804H00<001004200c00B@00`0040030";
-    sDataString += "050006000X03l000000003n010P0@000F0040010@0AX06601000B804<006001004200c00B@01h0040060050003000X07>0000000066010P0@000C0040010@0AX";
-    sDataString += "06601000Ch04<003001004200N00B@03<00400<0050001P00X0660000000042010P0@000AP040010@0@h03<01000C`046001P01004200N00B@03<00400<00500";
-    sDataString += "01P00X0660000000042010P0H000@`040010@0@h03l01000KP046010P01006600<00O`06600400H0050000`00X000000000006>01aP0<000@H07n010@0@H01h0";
-    sDataString += "1000Nh04201oP01007n00<00O`04200400Oh07n000@0Oh000000000003n01o007h00000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003oh00000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000<000H0000000000000000000000000000000000000000000000000000000000000008000007`00004000<000H04000L";
-    sDataString += "00000000000000000000000001000000000000000000000007P010000800000<0000040000000004000400000000000000000000000001000000000000000000";
-    sDataString += "000004001000080000080000040000000004000400000000000000000000000001000000000000000000000004001000?h03l00o00?h07n00L001h04<00400?h";
-    sDataString += "07n00o00OP03n01oP0Oh07l010P0@8022010P0@807n004001000Hh06600800Hh07V004000804h00400=X07V01QP0L`06>01iP0@H010010P0@802201QP0@80060";
-    sDataString += "04001000@804200800@8042004000805`0040098042010P0@H042010P0H0010010P0@802200c00HH00<00l001000@804200800@8042004000807000400980420";
-    sDataString += "10P0@804201000O0010010P0HH02B00N00HH00H00<001000@807n00800@804200400080700040098042010P0@8042010007`010010P0<`02B00<00<`00`00400";
-    sDataString += "1000@804000800@8042004000805P0040098042010P0@8042010000H010010P0<`02B00N004`01P004001000@806000800Hh042004000804h0040098042010P0";
-    sDataString += "@H0420100008010010P07P02n00c007P030004001000Hh06000800?h042004000804L004009804201QP0L`06>01000HH01V01WP07P03n01QP03P060004001000";
-    sDataString += "?h03n008000804200O000804600O009804200o00OP03n01000Oh01n00oP03003^010P03007n007P010000000000000080000000048000000000000000000@000";
-    sDataString += "200000000000000000000000003000000000000000000000000H000000006H000000000000000000@00020000000000000000000000000600000000000000000";
-    sDataString += "000000O`000000007h000000000000000000@00020000000000000000000000000N0000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000036000000000000aP000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000001\\000000000000K0000000000000000000000000000000000000000000000000000000000000000000000h0000000";
-    sDataString += "00000>000000000000000000000000000000003`00000000000000000000000000000>0000000000000000000000000000000000000000000000?000002@007h";
-    sDataString += "000000000n000000001000@00K00H`07n000007h00001oP00000000@007`02401cP000001000002@0040000000001P000000001000@00aP0HP04600000=00000";
-    sDataString += "01P00000000@000@02400@P000001000002@00<0000000001P000000001000@000001P06000000=0000003000000000@000@02400@P000001000002@00H00000";
-    sDataString += "00007h00000000?h03n000003003000200I0000003000000000@000@02400@P07h001000002@00o`0000000010000000001000@000002001P00600I000000600";
-    sDataString += "0000000@000@02400@P07h001h03k02@00@00000000030000000001000@000006000`00<00Ah00000<000000000O000@03W00@P07h001P03O02@00@000000N00";
-    sDataString += "3007>000001000@00000<000`00<00A000000<00000000000000000000007h001000002@00o`0000020030012000001000@000008000H00<00I000000H000000";
-    sDataString += "00000000000000007h001000002@00H00000020030012000001003n00000H000<00600I000000`00000000000000000000007h001000002@00<0000002002001";
-    sDataString += "2000001000@000000000600200=000000`000000000000000000000000001000003`00<0000002006001200f`01000@00000H`04200000=000001P0000000000";
-    sDataString += "0000000000000000?0000000007h000002006001200f`01000@00000H`07n000007h00001oP00000000000000000000000000000000000000000000060000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000006000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000400000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000008400000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000840000000000000000000000000000000000000000000000000000000000000000000000000000000000840000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000036000000000000aP000000000000000000000000000000084000000000000000000";
-    sDataString += "00000000000n`0OK01\\000000000000K0088000000002000700000<H00@01oP08403l00oP00000000000?`000000000g`04O00h000000000000>008800000000";
-    sDataString += "2000400000<H00@01PP084066001P00000000000HH0000000000004O000000000000000000<H000000002000<000006`00@01`P00004j000P00000000000GX00";
-    sDataString += "00000000004A07n00800?h00001oP0>h00000<007h00<00o`03P00@00h000005R00oP02400000000EX0000000000004A04600<00K\\000001P07`00000<00<000";
-    sDataString += "800H`03P00@01l000005R01QP06<00000000DX007`0?oP00004A06000600A4000003003P00000000H003o00@@0100000160000052010P0<H03o00000EX000000";
-    sDataString += "0000000007`00600A4000006001000000000@000H00@@0?h00001V0000052010P0<H00101oP0GX0000000000000001l00600Al00000<001000000800@000@00@";
-    sDataString += "@01000@01c000005R01SP0<H00100000EX0000000000000000600<00A000000H001000000<00@000`00H`01000@00iP00005R00oP06<00100000EX0000000000";
-    sDataString += "000000200800A000000`001000000<00H000`00oh01000@00HP00004j000002400100000DX0000000000000006600000KP00001P001000000<00<000P00@@010";
-    sDataString += "00@00?P000066000000000000000HH0000000000000007n00000?l00001oP01000000<007h03o000001000@007000003l000000000000000?`00000000000000";
-    sDataString += "0000000000000000000000000<00200000000000000013P00000000000000000000000000000000000000000000000000000000000000<002000000000000000";
-    sDataString += "1QP00000000000000000000000000000000000000000000000000000000000000<0020000000000000001oP00000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000001h000000000000000000000000000000000000000000000000000000000000000000<00";
-    sDataString += "0`00h00000@801h0000000000000000000000000000000000000000000000000000000000000000006001P01\\01mP0@801h000000000on000000000000000000";
-    sDataString += "00000000000000000000000000000000000003003003601_P0@801h0000000000000000000000000030000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000001l000003h00n006000003n000000000h00o00000>0P3P80n200000<003000`00<003000`001`07h0000036000000800200<000003";
-    sDataString += "b000000000801QP000021P0PH02600000<003000`00<003000`00200<00000022000003h00>000000003b0000000008010P00002300P`0><00000N007P01h00N";
-    sDataString += "007P01h00200800000022004002000200000@803b0000000008010P08@02600QP02H00800N007P01h00N007P01h00600H00000022004002000200000@803b000";
-    sDataString += "0000008010P0<H02<00S002`00000N007P01h00N007P01h00600H00000036004003h00n00000@803b010000000n010P06<0?h03n00oP00800c00<`03<00c00<`";
-    sDataString += "03<00>00@0000001l00oP00000000000@803b0000000000010P06<00d@0=l03A00800c00<`03<00c00<`03<00?`0@00000000004000000000000@800B0000000";
-    sDataString += "00001QP06<01T@0H406A00H00Q008@02400Q008@02400J00H00000000004000000000000@800B000000000000o00<H034@0al0<A00`01oP0Oh07n01oP0Oh07n0";
-    sDataString += "0N00H00000000004000000000000@H00B0000000000000008@064@1Q00HA01P01QP0HH06601QP0HH06600b00<00000000000000000000000Ih00B00000000000";
-    sDataString += "0000000<7h3100`OP32010P0@8042010P0@804200b00<0000000000oP00000000000OX00B00000000000000000080@21l0P1026030`0`<0<3030`0`<0<300S`0";
-    sDataString += "7h0000000000000000000000@0000000000@0000000000000000000002L00000000000000000000000000P0000000000000000000000@0000000000@00000000";
-    sDataString += "00000000000003h00000000000000000000000000P0000000000000000000000@0000000007`0000000000000000000003P0000000000000000000000000?P00";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000003000H00>00@801P0030070042000000001P006003P00";
-    sDataString += "0010P00000000H001P00h010P00`0000000000001P00`00K00@800`00600=P04200000OH00`00<006`07f010P00000000<003001\\010P01P0000000000000`01";
-    sDataString += "P00aP0@800H00<00H`04200000Kh00H00H00<H06n010P0000000060060036010P030000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000003000Oh07n01oP0Oh07l01o00O`07l01n00H801h00N007P01h00N000001j010P0@8042010P08804000o001P00@0040010";
-    sDataString += "00@000P008002000P00C00L803l00o00?`03l00o000003>010P0@8042010P08804001QP00`00@004001000@000P008002000P00A00L803<00c00<`03<00c00<H";
-    sDataString += "03<010P0@8042010P0<H040010P00000@004001000@000P008002000P00AP0F806601QP0HH06601QP0>h06>010P0@8042010P0>h07n013P0?h00@004001000@0";
-    sDataString += "00P008002000P00AP0F806601QP0HH06601QP07`06N010P0@8042010P07`04601?000H00O007`01l00O000P008002000P01lP0C8042010P0@8042010P03P04b0";
-    sDataString += "10P0@8042010P03P04201<000800@004001000@000P008002000P00@P0C8042010P0@8042010P07`04b010P0@8042010P01004201>00?h00@004001000@000P0";
-    sDataString += "08002000P00AP0AX06601QP0HH06601QP0>h07V010P0@8042010P01004601700HH00@004001000@000P008002000P00AP0AX06601QP0HH06601QP0<H076010P0";
-    sDataString += "@8042010P01007n013P0@800@004001000@000P008002000P00C00@h03<00c00<`03<00c000003<010P0@8042010P010040010P0@800@004001000@000P00800";
-    sDataString += "2000P00C00@h03l00o00?`03l00o000007801QP0HH06601QP01004001=P0Hh00Oh07n01oP0Oh07l01o00O`07l01n00@H01h00N007P01h00N000005h01oP0Oh07";
-    sDataString += "n01oP01004001?P0?h00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000001h0000000000000000000000000000000000000000000000000000000000000000000000`00h00000@801h000000001P003003P";
-    sDataString += "04200H000H00h00P@00000000H000`00h00000@80000000030001P01\\01mP0@801h000000000`006006`04200<000`01\\00P@0I007f00<001P01\\01mP0@80000";
-    sDataString += "00001P003003601_P0@801h000000000H00<00<H042006001P03600P@0?P06n006003003601_P0@8000000P00`00000000000000000000000000000000000000";
-    sDataString += "00000000000000>000000000000000000000000000P00000?h03n00oP0?h03n00oP07h03l00o00?`03l00L007001`00L00K007n00o00?`03l00o00?`00@00o00";
-    sDataString += "@8000H006001P00H00600>`0<006601QP0HH066004001000@00400AP07V01QP0HH06601QP0HH00001cP0@80008002000P008002004@0H0042010P0@804200400";
-    sDataString += "1000@00400?`042010P0@8042010P0@8000013P0@800?h03n00oP0?h03n01l@0@0042010P0@8042004001000@00400HH042010P0@8042010P0@803n016P0@800";
-    sDataString += "HH06601QP0HH06601_`0@007n01oP0Oh07n004001000@00400@8042010P0@8042010P0@800001<P0@800@8042010P0@804201400@004001000@0040004001000";
-    sDataString += "@00400@8042010P0@8042010P0@8000018P0@800@8042010P0@804201600H006001P00H0060004001000@00400@8042010P0@8042010P0@800@01`P0@800Hh06";
-    sDataString += ">01SP0Hh06>01^00<006001P00H0060004001000@00400HH04201QP0HH06601QP0HH00001cP0Ih00?h03n00oP0?h03n01k`07h03n00oP0?h03n00O007`01l00O";
-    sDataString += "00?`04200o00?`03l00o00?`00000o00?h00000000000000000000000P0000000000000000000000000000000000000000000000000000001P00000000000000";
-    sDataString += "0000000000000P0000000000000000000000000000000000000000000000000000001000000000000000000000000000?P000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000H00h010P00`0000";
-    sDataString += "10P000000000000000000000000000000000000000000000000000000000000000000`01\\010P01P040010P00000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000001P036010P030040010P0000000000000000000000000000000000000000000000000000000000000000000000000000004000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000@8042010P0@807h010P000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000@8042010P0@807<010P00000000000000000000000000000000000000000000000000000000000000000@8042010P0HH04601QP00000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000@8042010P0HH04201QP0000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000@8042010P0<`04200c000000000000000000000000000000000000000000000000000000000000000000@8042010P04`04200C0000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000@8042010P07P04600N000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000Ih06N01WP03P07<00>000000000000000000000000000000000000000000000000000000000000000000?h03n00oP03007h00<00000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000003004000<0000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000006004000H0000000000000000000000000000000000000000000000000000000000000000000000000000N004001h000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000";
-}
+static constexpr uint8_t nFontMargins4[] = {
+    20,20,20,20, 20,20,20,20,  0,15,10, 2,  4,12, 2, 9,  0,15, 2, 9,  4,15, 2, 2,  0,12,10, 9,  1,13, 6, 7,
+     0,12, 2, 2, 20,20,20,20, 20,20,20,20,  1,12, 4, 4,  1,12, 4, 4, 20,20,20,20,  1,12, 3, 4,  1,12, 3, 4,
+     0,12, 2, 2,  1,12, 4, 3,  2,13, 3, 3,  2,14, 4, 3,  1,12, 4, 4,  0,12, 2, 9,  0,12,10, 2,  0,15, 2, 2,
+     2,13, 3, 3,  4,12, 2, 2,  1,12, 8, 7,  1,12, 8, 7, 20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20,
+    20,20,20,20,  4,14, 5, 3,  1,11, 5, 9,  1,11, 5, 5,  2,11, 5, 3,  1,11, 5, 3,  1,11, 6, 3,  4,13, 5, 8,
+     4,12, 5, 3,  3,13, 5, 3,  2,11, 6, 4,  2,11, 8, 5,  3,13,11, 3,  1,11,11, 8,  4,14,13, 5,  1,11, 5, 3,
+     1,11, 5, 3,  2,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  2,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  2,11, 5, 3,
+     1,11, 5, 3,  1,11, 5, 3,  4,14, 8, 6,  3,13, 7, 3,  1,11, 6, 5,  1,11, 8, 8,  1,11, 6, 5,  1,11, 5, 3,
+     1,11, 5, 3,  0,10, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,
+     1,11, 5, 3,  1,12, 5, 3,  3,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  1,10, 5, 3,  1,11, 5, 3,  1,11, 5, 3,
+     1,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  2,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  1,12, 5, 3,
+     1,11, 5, 3,  2,11, 5, 3,  1,11, 5, 3,  1,11, 5, 3,  2,10, 5, 3,  1,11, 5, 3,  1,11, 7, 5,  0, 9,18, 1,
+     4,12, 4,13,  1,11, 8, 3,  1,11, 5, 3,  1,11, 8, 3,  1,11, 5, 3,  1,11, 8, 3,  2,10, 5, 3,  1,11, 8, 0,
+     1,11, 5, 3,  3,12, 4, 3,  3,11, 4, 0,  1,11, 5, 3,  3,12, 5, 3,  2,11, 8, 3,  1,11, 8, 3,  1,11, 8, 3,
+     1,11, 8, 0,  1,11, 8, 0,  1,11, 8, 3,  1,11, 8, 3,  1,11, 5, 3,  1,11, 8, 3,  1,11, 8, 3,  2,11, 8, 3,
+     1,11, 8, 3,  1,11, 8, 0,  1,11, 8, 3,  2,11, 5, 3,  5,14, 5, 3,  2,11, 5, 3,  2,10,10, 8,  0,16, 4, 4,
+     0,11, 5, 3, 20,20,20,20,  3,13,11, 3,  3, 9, 5, 0,  1,11,11, 3,  2,10,15, 3,  2,11, 5, 3,  2,11, 5, 3,
+     2,11, 4,13,  1,12, 5, 3,  1,11, 1, 3,  4,13, 8, 5,  1,11, 5, 3, 20,20,20,20,  1,11, 1, 3, 20,20,20,20,
+    20,20,20,20,  3,12, 5, 9,  3,12, 5, 9,  2,10, 5, 9,  1,11, 5, 9,  3,11, 8, 6,  3,12,10, 9,  0, 9,10, 9,
+     2,10, 5,13,  1, 8, 5, 9,  1,11, 4, 3,  4,13, 8, 5,  1,10, 8, 3, 20,20,20,20,  1,11, 4, 3,  2,10, 1, 3,
+    20,20,20,20,  4,14, 8, 0,  1,11, 5, 0,  2,10, 5, 3,  2, 9, 8, 4,  2,11, 5, 3,  5,14, 5, 3,  1,11, 5, 0,
+     2,10, 4,13,  1,11, 5, 3,  1,11, 5, 6,  2,10, 8, 5,  2,10,10, 5,  1,11,11, 8,  1,11, 5, 3,  0, 9, 3,16,
+     2,11, 5, 8,  2,11, 8, 3,  4,11, 5, 9,  4,11, 5, 9,  4,12, 4,13,  1,11, 8, 0,  2,11, 5, 3,  1,18,10, 9,
+     3,12,17, 0,  4,11, 5, 9,  1,11, 5, 6,  2,10, 8, 5,  0, 7, 5, 3,  0, 8, 5, 3,  0, 7, 5, 3,  2,11, 8, 0,
+     0,10, 1, 3,  0,10, 1, 3,  0,10, 1, 3,  0,10, 2, 3,  0,10, 1, 3,  0,10, 0, 3,  2,10, 5, 3,  1,11, 5, 0,
+     1,11, 1, 3,  1,11, 1, 3,  1,11, 1, 3,  1,11, 1, 3,  1,12, 1, 3,  1,12, 1, 3,  1,12, 1, 3,  1,11, 1, 3,
+     1,11, 5, 3,  1,11, 2, 3,  1,11, 1, 3,  1,11, 1, 3,  1,11, 1, 3,  1,11, 2, 3,  1,11, 1, 3,  2,11, 7, 6,
+     1,11, 5, 3,  1,11, 1, 3,  1,11, 1, 3,  1,11, 1, 3,  1,11, 1, 3,  2,11, 1, 3,  1,11, 5, 3,  1,11, 5, 3,
+     1,11, 4, 3,  1,11, 4, 3,  1,11, 4, 3,  1,11, 5, 3,  1,11, 4, 3,  1,11, 3, 3,  1,10, 8, 3,  1,11, 8, 0,
+     1,11, 4, 3,  1,11, 4, 3,  1,11, 4, 3,  1,11, 4, 3,  3,12, 4, 3,  3,11, 4, 3,  2,11, 4, 3,  2,10, 4, 3,
+     1,11, 5, 3,  1,11, 5, 3,  1,11, 4, 3,  1,11, 4, 3,  1,11, 4, 3,  1,11, 5, 3,  1,11, 4, 3,  2,11, 8, 5,
+     1,11, 6, 1,  1,11, 4, 3,  1,11, 4, 3,  1,11, 4, 3,  1,11, 4, 3,  1,11, 4, 0,  1,11, 5, 0,  1,11, 4, 0,
+    20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20,
+    20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20, 20,20,20,20,
+    20,20,20,20, 20,20,20,20, 20,20,20,20,
+};
 
 // NOTE: this data is associated with index: 5, file name: "simple font 610x650.tpbg.png"
-void  InitDataString5( std::string &sDataString ) {
+static constexpr const char *const sFontData5[] = {
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000N0000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000N00000000n000000000000000000003`00000",
+    "00000000000000000000000000000000001h00000000>00000000000000000000N00000001oP7P000000000000000003h0000000003`00000003`00000000000",
+    "000000001h00000000N7P00000007`1h0000000N00000007o`?P00000003n000000003h0000000007`00000007h00000000000000000001h00000000N7P00000",
+    "007`3h0000000O00000007oh?P00000007n000000003h000000000?`00000007l00000000000000000001h00000000N7P00000007`3h0000000ol0000007ohOP",
+    "00000007o000000003`000000000O`00000007n00000000000000000001h00000000N7P0000000?`3h0000007oo0000007ShO00000000?o000000003h0000000",
+    "00O`00000003n00000000000000000001h00000000N7P0000000?P3h000000?oo0000007Qho00000000?o000000003h000000000oP00000001o0000000000000",
+    "0000001h00000000N7P0000000?P7`000000Ooo0000007Qhn00000000?_000000003h000000000o000000000o00000000000000000001h00000000N7P0000000",
+    "?P7`000000ooO0000007ghn00000000?O000000003h000000001n000000000OP0000000000000000001h00000000N7P0000000OP?`000001on00000007oil000",
+    "00000?O000000003h000000001l000000000?P0000000000000000001h00000000N7P000000oooooP00001nN00000007oil00000000?o000000001`000000003",
+    "l000000000?`0000000000000000001h00000000O7P000000oooooP00001lN00000003och00000000?n0000000000000000003h0000000007`00000000000000",
+    "00001h00000000O7P000000oooooP00001lN00000000o3h00000000?n0000000000000000003h0000000007`0000000000000000001h00000000O7P000000ooo",
+    "ooP00001lN0000000007`00000000?l0000000000000000007`0000000007h0000000000000000001h00000000>7P0000000n0O0000001on0000000007`00000",
+    "000oh0000000000000000007`0000000003h0000000000000000001h000000000000000000n0O0000001ooP00000000?`00000001o`0000000000000000007`0",
+    "000000003h0000000000000000001h000000000000000001l0O0000001ool00000000?P00000003oh0000000000000000007`0000000003h0000000000000000",
+    "001h000000000000000001l0N0000000ooo00000000OP00000007ohl000000000000000007P0000000003h0000000000000000001h000000000000000001l0n0",
+    "000000?ooP0000000O00000000?kll00000000000000000?P0000000003h0000000000000000001h000000000000000001l0n00000000ooP0000000O00000000",
+    "Oall00000000000000000?P0000000001h0000000000000000001h000000000000000003h0n00000000Oo`0000000n7l000000oQnl00000000000000000?P000",
+    "0000001h0000000000000000001h00000000000000003oooon0000000NO`0000000n?o000000o0ol00000000000000000?P0000000001h000000000000000000",
+    "1h00000000000000003oooon0000000N?`0000001lOoP00000n0ol00000000000000000?P0000000001h0000000000000000001h00000000000000003oooon00",
+    "00000N7`0000001loo`00000l0Ol00000000000000000?P0000000001h0000000000000000001h00000000000000003oooon0000000N7`0000003ho?`00000l0",
+    "?l00000000000000000?P0000000001h0000000000000000001h00000000000000000?`7l00000000N7`0000003hn7`00000l0?h00000000000000000?P00000",
+    "00001h0000000000000000001h00000000000000000?P3h00000000N?`0000007`l3`00000l07h000000000000000007P0000000003h00000000000000000000",
+    "00000000000000000?P3h0000007`NO`0000007`l7`00000n0?h000000000000000007`0000000003h0000000000000000000000000000000000000?P7h00000",
+    "07hOoP000000?Pn7`00000o0ol000000000000000007`0000000003h0000000000000000003`00000000000000000OP7`0000007oooP000000?PooP00000ocon",
+    "000000000000000007`0000000003h0000000000000000003h00000000000000000O07`0000007ooo0000000OPooP00000Ooon000000000000000007`0000000",
+    "007h0000000000000000003h00000000000000000O07`0000003oon0000000O0Oo000000?ono000000000000000007h0000000007`0000000000000000003h00",
+    "000000000000000O07P0000001ool0000000O0?n0000007oho000000000000000003h000000000?`0000000000000000003h00000000000000000007P0000000",
+    "OoP0000000>0000000001oPO000000000000000003l000000000?`0000000000000000000000000000000000000000000000000n000000000000000000000>00",
+    "0000000000000003n000000000OP0000000000000000000000000000000000000000000000000N0000000000000000000000000000000000000001n000000000",
+    "oP0000000000000000000000000000000000000000000000000N0000000000000000000000000000000000000001oP00000001o0000000000000000000000000",
+    "0000000000000000000000000N0000000000000000000000000000000000000000o`00000003o00000000000000000000000000000000000000000000000000N",
+    "0000000000000000000000000000000000000000O`00000007n00000000000000000000000000000000000000000000000000N00000000000000000000000000",
+    "00000000000000?`00000007l00000000000000000000000000000000000000000000000000N00000000000000000000000000000000000000007`00000007h0",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001`00000003P000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000070",
+    "000000000000000000000000000000000000000000000000003`000000000000000000000000000000000000000000000000?P00000000000000000000000000",
+    "0000000000000000000000007`0000000?l000000000n000000000n0000000000000000000?P000000000000000000000000000000000000000000000000007`",
+    "0000000oo000000001n000000007o`00000007o`00000000?P00000000000000000000000000000000000000000000000000?`0000001ooP00000003n0000000",
+    "0Ooh0000000Ooh0000000?_P00000000000000000000000000000000000000000000000000?P0000003oo`0000000?l00000000ool0000000ool0000000?oo`0",
+    "000000000000000000000000000000000000000000000000?P0000007ooh0000000Ol00000001oon0000000oon0000000?oo`000000000000000000000000000",
+    "0000000000000000000000O0000000?l7h0000000Ol00000003o3n0000000oSn0000000?oo`0000000000000000000000000000000000000000000000000O000",
+    "0000?`3l0000000Ol00000003n1n0000000n0n00000003oo`0000000000000000000000000000000000000000000000000o0000000OP1l0000000Ol00000003l",
+    "0n000000000N00000000ol00000000000000000000000000000000000000000000000000n0000000OP1l0000000Nl00000001`0n000000000N00000001ol0000",
+    "0000000000000000000000000000000000000000000000n0000000O01n00000000l0000000000n000000000N00000003on000000003`00000000000000000000",
+    "00000000000000000001l0000000O00n00000000l0000000001n000000000n00000007oo000000003`0000000000000000000000000000000000000001l00000",
+    "00n00n00000000l0000000003n000000003n00000007lo000000003`0000000000000000000000000000000000000003l0000000n00n00000001l0000000007l",
+    "00000000on00000007ho000000003`0000000000000000000000000000000000000003h0000000n00n00000001l000000000?l00000003ol00000007`O000000",
+    "003`0000000000000000000000000000000000000007h0000000n00n00000001l000000000Oh00000003oh000000000?000000007h0000000000000000000000",
+    "000000000000000007`0000000n00n00000001l000000001o`00000003oh000000000000000003ooh00000000000000000000000000000000000000?`0000000",
+    "n00n00000001l000000003oP00000003on000000000000000003ooh00000000000000000000000000000000000000OP0000000n00n00000001l00000000?o000",
+    "000000?n000000000000000003ooh000000000000000007ol000000000000000000OP0000000n00n00000001l00000000Ol0000000003o000000000000000003",
+    "ooh00000000000000000?ol000000000000000000o00000000n00n00000001l00000000oh0000000001o0000000000000000007h000000000000000000?ol000",
+    "000000000000000o00000000N00n00000001l00000000oP0000000000o0000000000000000003`000000000000000000?ol000000000000000001n00000000O0",
+    "1l00000001l00000001o00000000000O0000000000000000003`000000000000000000000000000000000000001l00000000O01l00000001l00000001n000000",
+    "00000O0000000000000000003`000000000000000000000000000000000000003l00000000OP3l00000001l00000001l00000000000O0000000000000000003`",
+    "000000000000000000000000000000000000003h00000000OP3l00000001l00000003l000000001l0O0000000000000000003`00000000000000000000000000",
+    "0000000000007h00000000?`7h00000001l00000003h000000001l0o0000000000000000003`000000000000000000000000000000000000007h00000000?h?h",
+    "00000001l00000003ool0000001n1n0000000000000000000000000000000000000000000000000?000000007`000000007oo`0000000Oo`0000003oon000000",
+    "1oon00000000000000000000000000000?0000000000000000000OP0000000?`000000007oo`0000000Oo`0000003oon0000000ool0000000000000000000000",
+    "0000000?0000000000000000000OP0000000?P000000003ooP0000000Oo`0000003oon0000000ool00000000000000000000000000000O000000000000000000",
+    "0OP0000000?P000000001oo00000000Oo`0000001oon0000000?o`00000000000000000000000000000O0000000000000000000OP0000000?0000000000?h000",
+    "00000000000000000000000003o000000000000000000000000000000O0000000000000000000?00000000?00000000000000000000000000000000000000000",
+    "0000000000000000000000000000000n000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000n00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000l00000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000l0000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000h000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000OP0000003Qol00000000N000000000000000000000000000007`0",
+    "0000000000000000000000000000000000000000000000000oP0000007ool00000000o00000003ooo`0000001oh00000001on000000000000000000000000000",
+    "00000000000000000000000oP0000007ool00000001o00000003ooo`0000007on00000007oo00000000000000000000000000000000000000000000000001oP0",
+    "000007ool00000003o00000003ooo`000000?on0000000?ooP0000000000000000000000000000000000000000000000003oP0000003ool00000007n00000003",
+    "ooo`000000Ooo0000000?oo`0000000000000000000000000000000000000000000000007oP0000003h000000000?l00000000?oo`000000O`o0000000O`O`00",
+    "00000000000000000000000000000000000000000000007oP0000003`000000000?h0000000000oP000000O0O0000000OP?h0000000000000000000000000000",
+    "00000000000000000000?oP0000003`000000000O`0000000001o0000000O0O0000000O07h000000000000000000000000000000000000000000000000OoP000",
+    "0003`000000000oP0000000001n0000000n0?0000000n03h00000003P000000001`00000000000000000000000000000O_P0000007goP0000000o00000000003",
+    "n0000000n0?0000000n03h00000007`000000003h00000000000000000000000000000o?P0000007ooh0000001n00000000007l0000000o0O0000000n01h0000",
+    "0007`000000003h000000000?P000000000000000001o?P0000007ooh0000001l00000000007h0000000OPo0000000n01h00000007`000000003h000000000OP",
+    "0000000ool00000001n?P0000007ool0000003ooP00000000?h0000000Oko0000000n01h00000007`000000003h000000000oP0000000ool00000003l?P00000",
+    "07oWl0000003ooh00000000?`0000000Oon0000000o03h00000007`000000003h000000001o00000000ool00000007l?P0000007n1n0000003ool00000000OP0",
+    "000000?ol0000000OP7h000000000000000001`000000003o00000000ool00000007h?P0000007l0n0000003ool00000000OP00000007on0000000O`Oh000000",
+    "0000000000000000000007n000000000000000000?h?P0000007h0n0000007oon00000000O00000000Ooo0000000Oooh000000000000000000000000000?h000",
+    "000000000000000O`?P0000007`0n0000007l3n00000000o00000000OooP000000?ooh000000000000000000000000000o`000000000000000000ooon0000000",
+    "00N0000007h0n00000000o00000000o`oP0000007ooh000000000000000000000000000oP000000000000000000ooon000000000N0000007`0n00000001n0000",
+    "0000o0O`0000003oo`000000000000000000000000000o`000000000000000000ooon000000000N0000007`0O00000001n00000000n0?`0000000O_`00000000",
+    "0000000000000000000oh000000000000000000ooon000000000n0000007`0O00000003l00000000n07`00000000?`000000000000000000000000000?l00000",
+    "000Ooh000000000Ol000000000n0000007`0O00000003l00000000l07`00000000OP00000007`0000000000000000003n00000000ool000000000?P000000000",
+    "n0000007`0N00000003h00000000l07`00000000oP00000007`0000000000000000001o00000000ool000000000?P000000001n0000003h0n00000007h000000",
+    "00l07`00000001o000000007`0000000000000000000o00000000ool000000000?P0000007P3n0000003h0n00000007h00000000n0?`00000003o000000007`0",
+    "000000000000000000O00000000Ool000000000?P0000007`7l0000003l1n0000000?`00000000o0O`0000000?n000000007`000000001h000000000?0000000",
+    "0000000000000?P0000007lOl0000003n3n0000000?`00000000o`oP0000000ol000000007`000000003h000000000000000000000000000000?P0000007ooh0",
+    "000001ool0000000?P00000000oooP0000007oh000000003`000000007h000000000000000000000000000000?P0000007oo`0000001ooh0000000?P00000000",
+    "Ooo0000000?o`0000000000000000007h000000000000000000000000000000?P0000003ooP0000000oo`0000000?P00000000?on0000000?o00000000000000",
+    "00000?`000000000000000000000000000000700000000on00000000?oP0000000?0000000003oh0000000?l0000000000000000000?`0000000000000000000",
+    "0000000000000000000000000000001h0000000000000000000000000000?P0000000000000000000?P000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000?000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000?00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000oo`0000000000000000000000000000000",
+    "000000000000000007oh000000000000000000000000000000000000000000000003ool00000000000000000?oP00000000000000000O0000000007ooo000000",
+    "1oon00000000oh0000000000000000000000000007ooo00000000000000000Ooh000000000ol000000o`000000007ooo0000001oooP0000001on000000000000",
+    "000000ol0000000OoooP00000003h0000000Ool000000003ol000000ol000000007ooo0000001oooP0000003ooP00000000000000003on0000000On?o`000000",
+    "03h0000000Oon00000000?ol000000oo000000007ooo0000001oooP0000007ooP00000000000000007ooP000000o`0oh00000007h0000000OWo00000000Ool00",
+    "0000oo`00000007l0O0000001oioP000000?ooP00000000000000007ooP000001oP0Oh0000000?h0000000O1oP0000000ool000000ool00000007`000000001l",
+    "000000000OhOP00000000000000007mo`000001o007l0000000?l0000000O0oP0000001oal000000ooo00000007`000000001h000000000o`700000000000000",
+    "0007`Oh000003n7l3l0000000Ol0000000O0OP0000001o1l000000n?oP0000007`000000001h000000000oP000000000h000000007P7h000003l?l1n0000000o",
+    "l0000000O0?P0000003n0l000000n3o`0000007`000000001h000000001o0000000000l00000000003h000007hol1n0000000ol0000000O0?P0000007l000000",
+    "00n0oh0000007`000000001h000000001n0000000000n00000000003h000007hol0n0000001ol0000000O0?P0000007l00000000n0Ol0000007`000000001h00",
+    "0000003l0000000000o00000000001h000007ao`0n0000003on0000000O0OP000000?h00000000N07l0000007`000000001h000000003l0000000000oP000000",
+    "0003h000007an?0n0000003ln0000000O0OP000000?`00000000N03n0000007`000000001oon0000003h0000000000Oh0000000003h000007clO0N0000007ln0",
+    "000000N1o0000000OP00000000N01n0000007gon0000001oon0000007h0000000000?l0000000007h000007chO0n0000007hn0000000O3o0000000OP00000000",
+    "N00o0000007oon0000001oon0000007`00000000007n000000000?h000007Sho0n000000?`n0000000Oon0000000O000000000N00o000000?oon0000001oon00",
+    "00007`7ol00000003oP00000000o`000007Sho0n000000?co0000000Oon0000000o000000000N00O000000?oon0000001oon0000007`ool00000001oP0000000",
+    "1o`000007Smo1n000000Ooo0000000Oon0000000n000000000N00O000000?ooP0000001n00000000?Sool00000000oP00000003oP000007cooon000000ooo000",
+    "0000oooP000000n000000000N00O000000?`000000001h00000000?Sool00000003o000000007o0000007coool000001ooo0000000ooo`000000n000000000n0",
+    "0?000000?P000000001h00000000?Sooh00000007n00000000?l0000007aoool000001oooP000000n1oh000000n000000000n00O000000?P000000001h000000",
+    "00?Sn7h0000000?l00000000Oh0000007`oooh000001ooOP000000n0?h000000n000000000n00O000000?P000000001h00000000?S`7`0000000oh00000000O`",
+    "0000007h?3oP000001oP?P000000n07h000000n000000000n00O000000?P000000001h00000000?P0?`0000001o`00000000OP0000003l0000000003l0?P0000",
+    "00n07h000000n03h000000n00o000000?P000000001h00000000?P0O`0000001oP00000000O00000003l0000000003l0?`000000n0?h000000o07h000000n00o",
+    "000000?P000000001h00000000?P0oP0000001n000000000000000003n0000000007h0?`000000n0Oh000000oPOh000000n01n000000?P000000001h00000000",
+    "?`1oP0000001l000000000000000001o0000000007h07`000000n3o`000000Oioh000000n03n000000?P000000001h000000007h3o000000000000000000n000",
+    "00000o`0O000000?`07h000000oooP000000Oooh000000o0?l0000007`000000001h000000007nOn000000000000000000n00000000Ol1o000000?`07h000000",
+    "ooo0000000?ooP000000oooh0000007ool0000001h000000007oon000000000000000000n00000000?ooo000000?P03h000000oon00000007oo0000000oooh00",
+    "00007ool0000001h000000003ooh000000000000000000n000000007ooo000000?P03h000000ooh00000001ol0000000ooo`0000007ool0000001h000000001o",
+    "o`000000000000000000n000000003ooo0000007001`000000On000000000?00000000?oo00000003ool0000001h000000000oo0000000000000000000L00000",
+    "0000ool00000000000000000000000000000000000001oh00000000ool0000001h00000000000000000000000000000000000000007o00000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000l007P000000000000000000000000000000000000N000000000001`000003`00700000000000000000oo000000000000000000l007P",
+    "000007on00000000Ooo`000000N07`000000O000000000O03h000003h00?P0000007o`0000000ooP00000003oh0000000l007P000007oon0000000Ooo`000000",
+    "N07`000000O000000000o03h000003l00?P000000Oon0000000ooh0000000Ooo0000000l00?P000007oon0000000Ooo`000000N0?`000000O000000000o07l00",
+    "0003l00?P000001ooo0000000ool0000001oooP000000l00?P000007oon0000000Ooo`000000N0O`000000O000000000o07l000003n00?`000003oooP000000l",
+    "?l0000003ooo`000000l00?P000007oon0000000Ooo`000000N0oP000000O000000000oP7l000003o00?`000007ooo`000000l3n0000007oooh000000l00?P00",
+    "00007kl000000007`0000000N1oP000000O000000001oP7l000003oP0?`00000?n0o`000000l1n000000?o0Ol000001l00?P0000003`0000000007P0000000N3",
+    "o0000000O000000001oP7l000003oP07`00000?h0?`000000l0n000000Ol07l000001l00?P0000003`0000000007P0000000N7n0000000O000000001oP?l0000",
+    "03o`07`00000O`07h000000l0N000000o`03n000001l00?P0000003`0000000007P0000000N?l0000000O000000001oP?n000003oh07`00000OP07h000000l0N",
+    "000000oP01n000001l00?P0000003`0000000007P0000000N?h0000000O000000001o`?n000003oh07`00000o003h000001l0n000001o001n000001l00?P0000",
+    "007`0000000007P0000000NO`0000000O000000003o`On000003kl07`00000o003h000001l0n000001n000o000001l00?P0000007`0000000007P0000000Oo`0",
+    "000000O000000003o`On000003kn07`00001n003h000001l1n000001n000o000001l00?P0000007`0000000007P0000000OoP0000000O000000003o`On000003",
+    "io07`00001n003h000001l3n000003l000O000001l0ooP0000007`0000000007P0000000Oo00000000N000000003o`On000003hoP7`00001l003h000001l?l00",
+    "0003l000O000001lOooP0000007`0000000007P0000000On00000000N000000007ohoO000003hOP7`00001l003h000001ool000003h000O000001oooo0000000",
+    "7`000000000?P0000000Ol00000000N000000007khnO000003hO`7`00003l003h000001ooh000003h000O000000oooo00000007`000000000?P0000000Oh0000",
+    "0000N000000007chnO000003h?h7`00003h003h000001oo`000003h000?000000oonO00000007`000000000?P0000000Ol00000000N000000007cinO000003h7",
+    "l7`00003h007h000001oo0000003h000?000001on0?00000007`000000000?P0000000on00000000N00000000?cmlO000003h3n7`00003h007h000001o`00000",
+    "03h000O000001o00?00000007`000000000?P0000000oo00000000N00000000?cml?P00003h1o7`00003h007`000001h00000003l000O000001l00?00000007`",
+    "000000000?P0000000ooP0000000n00000000?Qol?P00003h1oW`00003l00?`000001h00000003l0l0O000001l00?00000003`0000000?0?P0000000oo`00000",
+    "00n00000000?Qoh?P00003h0og`00001l00O`000001h00000001n0n0o000001l00?00000003`0000000?0?P0000000nOh0000000n00000000OQoh?P00003h0Oo",
+    "`00001n00OP000001h00000001n0o1o000001l00?00000003`0000000?P?00000000nOl0000000n00000000OPoh?`00003h0?o`00001o00oP000001h00000001",
+    "o0oSn000001l00?00000007`0000000?P?00000000n?n0000000n00000000O0o`7`00003h07o`00001oP1o0000001h00000000oPogn000001l00?P0000007ol0",
+    "00000?`O00000000n7oP000000n0?`00000O0o`7`00003h03o`00000o`7o0000001h00000000o`Ool000001l00?P000003ool000000?lO00000000n1oh000000",
+    "n3o`00000O0o`7h00003h01o`00000Ooon0000001h00000000Ol?oh000001h00?P000007ool0000007oo00000000n0oh000000ooo`00000O0OP7h00003h00o`0",
+    "0000Oool0000001h00000000?o_o`000001h00?P000007ool0000007on00000000n0Oh000000ooo`00000O0OP7h00003h00O`000007ooh0000001h000000007o",
+    "ooP000001h00?P000007ool0000003on00000000n0?h000000oooP00000N0OP3h00003h00?`000003oo`0000001h000000003ooo`000001h00?0000003l00000",
+    "0000on00000000n03h000000ool000000N0?03h00003`007P000000oo000000000000000000oooh000001h00000000000000000000Ol00000000N000000000Ol",
+    "000000000001`00001`000000000000000000000000000000?ool000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000007n00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003",
+    "o00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001oP000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000o`00000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000O`0000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000?`00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003P",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000?P000",
+    "000000000000000000000000000000000000000L000000000000000000000000000000000000000000000000000000000?oP00000000000000000?oon0000007",
+    "P01h000001l00n00003h03P0?P0001l00?P00000n00?000000Oooo`0000001oh0000000Ooh000000001oh000000?ooon000007P01h000001l01n00003h07`0?P",
+    "0001n00OP00000n00O000000Ooooh0000001oh0000000Oon00000000?on000000?ooon000007P03h000001l01n00003h0?`0OP0001o00oP00000o00O000000Oo",
+    "ooh0000001oh0000000Ooo00000000Oon000000?ooon000007P03h000001l03n00003l0?`0OP0001oP0oP00000oP0o000000Ooooh0000001oh0000000OooP000",
+    "0000oon0000007ooon00000?P03h000001l03l00003l0O`0O00000oP1o000000OP0o000000?oooh0000001l00000000O1o`0000001oan00000001n0000000?P0",
+    "3h000001n03h00001l0Oh0o00000O`3n000000O`1n000000003o`0000001h00000000?0Oh0000003o0000000000n0000000?P03h000000n07h00001n0Oh0o000",
+    "00?h3n000000?h1n000000003o00000001h00000000?0?h0000003l0000000000n0000000?P03h000000n07`00001n0oh0n000007l7l0000007h3l000000007n",
+    "00000001h00000000?07l0000003h0000000000n0000000?P03h000000o07`00000n0oh1n000007l?h0000007l3l00000000?h00000001h00000000?03l00000",
+    "03h0000000000n0000000?P03h000000o0?`00000n0oh1n000003nO`0000003l3h00000000O`00000001h00000000?01l0000003h0000000000n0000000?P03h",
+    "000000O0?P00000o1oh1l000001oO`0000001n7h00000000oP00000001h00000000O01l0000003n0000000000n0000000?P03h000000O0OP00000O1oh3l00000",
+    "0ooP0000001n7h00000001o000000001h00000000O03l0000003oo000000000n0000000?P03h000000OPOP00000O1ol3h000000oo00000000o?`00000001o000",
+    "000001h00000000O07l0000003ooh00000000N0000000?P03h000000?PO000000O3ml3h000000Oo00000000o?`00000003n000000001h00000000O0?l0000001",
+    "ool00000000N0000000?P03h000000?Po000000?Sml7h000000?n00000000O_P00000007l000000001h00000000O0oh0000000Oon00000000N0000000?P03h00",
+    "0000?Po000000?Sml7`000000?l00000000OoP0000000?h000000001h00000000Ooo`00000000oo00000000N00000007P03h000000?`n000000?Whl?`000000?",
+    "l00000000?oP0000000?`000000001h00000000OooP000000003o00000000O00000007P03h0000007an000000?Whn?P000000On00000000?o00000000O`00000",
+    "0001h00000000Ooo0000000000oP0000000O00000007P07h0000007al0000007ghn?P000000oo000000007o00000000oP000000001h00000000Ool0000000000",
+    "OP0000000O00000007`07`0000007il0000007o`nOP000001oo000000003n00000000o0000000001h00000000Ool0000000000?P0000000O00000007`07`0000",
+    "003kl0000007o`nO0000003ooP00000001n00000001o0000000001h00000000Ooo0000000000?P0000000O00000007`0?`0000003kh0000007oPnO0000007nO`",
+    "00000003l00000003n0000000001h00000000O?oP000000000?P0000000O00000007h0?`0000003oh0000007oPOn000000?l?`00000003l00000007l00000000",
+    "01h00000000O3oh000000O00OP0000000O00000007h0OP0000003oh0000003o0On000000Oh?h00000007h00000007l0000000001h00000000O0ol000000O00oP",
+    "0000000O00000003l0OP0000001o`0000003o0On000000O`7l00000007h0000000?h0000000001h00000000O0?n000000OP3o00000000O00000003n0o0000000",
+    "1o`0000003o0Ol000000oP3n0000000?`0000000O`0000000003h00000000O07n000000Oh?o00000000O00000001oco00000001o`0000003n0Ol000001o03n00",
+    "00000?`0000000O`7oP0000003h00000000O03n000000Ooon00000000O00000001oon00000000oP0000001n0?h000003o01o0000000OP0000000Ooooh0000003",
+    "h00000000O01n000000?ool00000000O00000000ool00000000oP0000001n0?h000003n00oP000000OP0000000Ooooh0000003h00000000O00N0000007oo`000",
+    "00000N00000000?oh00000000o00000001n0?h000003l00oP000000O00000000Ooooh0000003h00000000>0000000000oo0000000000000000001oP00000000O",
+    "00000001n07`000003h00OP000000O00000000Ooooh0000003h00000000000000000000000000000000000000000000000000>00000000007`000000000?0000",
+    "000000000000000000000003h00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003h0",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003h000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000003oh0000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000003oh000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000003oh0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003oh00",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000l000000000000000000N00000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000001n000000000000000000O000000000000000000000000000000000000000000>000000000000000000000000000000000000003o00000000",
+    "0000000000OP0000000000000000007P000000000000000000000O000000000000000003`0000000007oP00000007oP00000000000000000O`00000000000000",
+    "0000?P000000000000000000000O000000000000000003h0000000007oP0000000?o`00000000000000000?h000000000000000000?P00000000000000000000",
+    "0O000000000000000003h0000000007oP0000000Ooh000000000000000007l000000000000000000?P000000000000000000000O000000000000000003l00000",
+    "00007oP0000000ogl000000000000000003l000000000000000000?P000000000000000000000O000000000000000001n0000000000?P0000000oWl000000000",
+    "000000001l000000000000000000?P000000000000000000000N000000000000000001n00000000007P0000000o3l000000000000000001l0000000000000000",
+    "00?P000000000000000000000N000000000000000000n00000000007P0000000n1l000000000000000000l000000000000000000?P000000000000000000000N",
+    "000000000000000000o00000000007P0000000l0l0000000000000000000000000000000000000?P000000000000000000000N000000000000000000O0000000",
+    "0007P00000000000000000000000000000000000000000000000?P000000000000000000000N000000000000000000OP0000000007P000000000000000000000",
+    "00000000000000000?l0000000?_n000000003oP00000003on00000001o`00000000?P0000000007P00000000000000000000000000000000000000oo0000000",
+    "?oo000000007oh0000000?on00000007ol00000000?`0000000007P00000000000000000000000000000000000001ooP000000?ooP0000000?oh0000000oon00",
+    "00000?on000000007`0000000007P00000000000000000000000000000000000003ooP000000?oo`0000000Ooh0000001oon0000000Oon000000007`00000000",
+    "07P00000000000000000000000000000000000007oOP000000?oOh0000000oSh0000001o_n0000000Ocn000000007h0000000007P00000000000000000000000",
+    "00000000000000?l?P000000?h7h0000000o1h0000003n3n0000000oPn000000003h0000000007P0000000000000000000000000000000000000?h?P000000?`",
+    "3l0000001n000000003l1n0000000o1n000000003l0000000007P0000000000000000000000000000000000000?`?P000000?P1l0000001n000000003h0n0000",
+    "000n7n000000001l0000000007P0000000000000000000000000000000000000OP?P000000?P1l0000001l000000003`0n0000001lOn000000001l0000000007",
+    "P0000000000000000000000000000000000000O0?P000000?P1l0000003l000000007`0n0000001mol000000001n0000000007P0000000000000000000000000",
+    "000000000000O0?P000000?P0l0000003h000000007`0n0000001oo`000000000n0000000007P0000000000000000000000000000000000000O0?P000000?P0l",
+    "0000003h000000007`0n0000001oo0000000000o0000000007P0000000000000000000000000000000000000O0?P0000007P1l0000003h000000007`0n000000",
+    "1ol0000000000O0000000007P0000000000000000000000000000000000000O0?P0000007P1l0000003h000000007`0n0000001o`0000000000O0000000007P0",
+    "000000000000000000000000000000000000O0?P0000007P3l0000003h000000003h0n0000001n00000000000OP000000007P000000000000000000000000000",
+    "0000000000OP?P0000007P7h0000003l000000003l1n0000001n07P00000000?P000000007P0000000000000000000000000000000000000OPO`0000007`?h00",
+    "00001n1l0000003n3n0000001o0?P00000000?`000000007P0000000000000000000000000000000000000?ho`0000007oo`0000001o7l0000003oon0000000o",
+    "aoP00000000?`000000007P0000000000000000000000000000000000000?oo`000000?oo`0000001ool0000001oon0000000oooP000000007h000000007P000",
+    "00000000000000000000000000000000007ooh000000?ooP0000000ool0000000oon0000000Ooo0000000007h000000007P00000000000000000000000000000",
+    "000000007ooh000000?oo00000000Ooh0000000Oon00000007on0000000003h000000007P00000000000000000000000000000000000001och0000007Ol00000",
+    "0007oP00000007nN00000001o`0000000003h000000007P000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000001h000000007P0000000000000000Oon0000000000000000000000000000000000000000000000000000000000000000000000000000000007P00000",
+    "00000000000Ooool000000000000000000000000000000000000000000000000000000000000000000000000000000?oP0000000000000000Ooool0000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000?oP0000000000000000Ooool000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000?oP0000000000000000Ooool00000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000?oP0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000O`00000000000000001h000000000",
+    "000000000000000000007P0000000003`0000000000000000000000000000000000000001o`00000000000000001h000000000000000000000000000007`0000",
+    "000003`0000000000000000000000000000000000000003o`00000000000000001h0000000000?0000000007P00000007`0000000003`0000000000000000000",
+    "000000000000000000007o`00000000000000001l0000000000O000000000?`00000007`0000000003`0000000000000000000000000000000000000007oP000",
+    "00000000000001l0000000000O000000000?`00000007`0000000003`0000000000000000000000000000000000000007h000000000000000001l0000000000O",
+    "000000000?`00000007`0000000003`000000000000000000000000000000000000000?`000000000000000001l0000000000O000000000?P00000007`000000",
+    "0003`000000000000000000000000000000000000000?`000000000000000001l000000000000000000000000000007`0000000003`000000000000000000000",
+    "000000000000000000?P000000000000000001l000000000000000000000000000007`0000000003`000000000000000000000000000000000000000?P000000",
+    "000000000001l000000000000000000000000000007`0000000003`000000000000000000000000000000000000000?P000000000000000001h0000000000000",
+    "00000000000000007`3`00000003`0000001l0000000000l00000000000000000000?_000000000n00000001hOP00000000N0000000007`00000007`7`000000",
+    "03`0000001lOSn0000000lOh00000000oP00000007oo`0000000?o`0000001ioh00000000N0000000007`00000007`?`00000003`0000001mooo0000000moh00",
+    "000003oh00000007oo`0000000Ool0000001ooh00000000N0000000007`00000007`O`00000003`0000001oooo0000000ool00000007ol00000007oo`0000000",
+    "ool0000001ool00000000N0000000007`00000007`o`00000003`0000001ooooP000000ool0000000?ol00000007oo`0000001oWl0000001ool00000000N0000",
+    "000007`00000007aoP00000003`0000001ooooP000000oml0000000Oon00000007oP00000003n1l0000001oil00000000N0000000007`00000007co000000003",
+    "`0000001ooo?P000000ohl0000000Oan00000000?000000003l1l0000001oQl00000000N0000000007`00000007gn000000003`0000001ocl?P000000o`l0000",
+    "000oPn00000000?000000007h1l0000001o0l00000000n0000000007`00000007ol000000003`0000001oSh?P000000oPl0000000o0n00000000?000000007`1",
+    "l0000001o0l00000000n0000000007`00000007oh000000003`0000001o3`7P000000o0l0000000n0O00000000?000000007`1l0000001n0l00000000n000000",
+    "0007`00000007oh000000003`0000001n3`7`000000o0l0000000n0O00000000?000000007`1l0000001l0l00000000n0000000007`00000007ol000000003`0",
+    "000001l3h7`000000n0l0000001l0O00000000?000000007P1h0000001l0l00000000n0000000007`00000007on000000007`0000001l3h7`000001n0l000000",
+    "1l0O00000000?000000007P3h0000001l0l00000000n0000000003`00000007mn000000007`0000001l3h7`000001l0n0000001l0O00000000?000000007`3h0",
+    "000001l0n00000000n0000000003`00000007io000000007`0000001l3h7`000001l0n0000000l0N00000000?000000007`7h0000001l0n00000000n00000000",
+    "03h00000007PoP00000007`0000001l3h7`000001l0n0000000n0n00000000?000000007`?h0000001l0n00000000n0000000003h00000007PO`00000007`000",
+    "0001l3h3`000001l0n0000000n1n00000000?000000007hOh0000001h0n00000000n0000000003h00000007P?`00000007`0000001l1h3`000001l0n0000000o",
+    "3n00000000?000000003ooh0000001h0n00000000n0000000003h00000007P?h00000007`0000001l1h3h000001l0n0000000ool00000000?000000003ooh000",
+    "0003h0n00000000N0000000003h00000007P7h00000007`0000001l1h3h000001l0n0000000Ool00000000O000000001ooh0000003h0n00000000N0000000003",
+    "h00000007P3h00000007`0000001l1h3h000001l0n0000000?oh00000000O000000000ooh0000003h0N00000000N0000000003h00000007P3h00000007`00000",
+    "01l1h3h000000l0N0000000?o`00000000O0000000007Sh0000001`0N0000000000000000003h00000007P1h00000007`0000000l1h3h000000l0N00000003oP",
+    "00000000O00000000003h00000000000000000000000000003h00000000000000000000000000001h1`000000000000000000000000000O00000000003`00000",
+    "0000000000000000000000N3h00000000000000000000000000000000000000000000000000000000000000000000007`000000000000000000000000000O3h0",
+    "0000000000000000000000000000000000000000000000000000000000000000000007`000000000000000000000000000OSh000000000000000000000000000",
+    "0000000000000000000000000000000000000000000?`000000000000000000000000000OSh00000000000000000000000000000000000000000000000000000",
+    "0000000000000007`oP000000000000000000000000000?gh000000000000000000000000000000000000000000000000000000000000000000007ooP0000000",
+    "00000000000000000000?oh000000000000000000000000000000000000000000000000000000000000000000007oo00000000000000000000000000007o`000",
+    "000000000000000000000000000000000000000000000000000000000000000007on00000000000000000000000000007o`00000000000000000000000000000",
+    "0000000000000000000000000000000000000003oh00000000000000000000000000003oP0000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000n0000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000N00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000O0000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000O000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000O00000000000000000000000000000000000000000000000000000000000000000000",
+    "000000000000000000000000000000000O00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000l0",
+    "0000000O000000000000000000000000000000000000000000000000000000000007`0000000000000000000000000000007n00000000O000000000000000000",
+    "000000000000000000001h0?000000000000000007cl000000003oh0000000L?l00000001on0000000Ooo00000007P7`0000007P1h000000l1h7P000001l0O00",
+    "00003`0?00000007oo00000000?oh0000000nol00000007on0000000Ooo0000000?P7`0000007`3h000000n3h7`000001n0o0000003h0?P0000007ooP0000000",
+    "ooh0000000ool0000000?on0000000Ooo0000000?P7`0000007`3h000000n3h7`000001n1o0000003h0OP0000007oo`0000000ooh0000000ool0000000?on000",
+    "0000Ooo0000000?P7`0000007`3h000000n3l7`000001o3o0000003l0OP0000007oo`0000001oQh0000000ool0000000OlN00000007o`0000000?P7`0000007h",
+    "7h000000n7l?P000000oWn0000003n0o00000007n?`0000003n3h0000000ohl0000000O`N00000000O00000000?P7`0000003h7h000000n7l?P000000Ool0000",
+    "001n0o00000007l7h0000003l3h0000000oPl0000000O0000000000O00000000?P7P0000003h7`000000n7l?P000000?oh0000001o1n00000007h3h0000003h3",
+    "h0000000o0l0000000O`000000000O00000000?P7P0000003l?`000000N7l?P0000007o`0000000o1n00000007`3h0000007h3h0000000o0l0000000Oo000000",
+    "000O00000000?P7P0000001l?P000000O?nO00000007oP0000000oSl00000007`3h0000007`3h0000000n000000000Oo`00000000O00000000?P7P0000001nOP",
+    "000000O?nO00000003o00000000OSl00000007`3h0000007`3h0000000n000000000?oh00000000O00000000?P7P0000000nO0000000O?nO00000007n0000000",
+    "0Och00000007`3h0000007`3h0000000n0000000003ol00000000O00000000?P7P0000000nO0000000OOnO0000000?o00000000?gh00000007`3h0000007`3h0",
+    "000000n0000000000?l00000000O00000000?P7P0000000oo0000000OONn0000000OoP0000000?oh00000003`3h0000007`3h0000000n00000000003l0000000",
+    "0?00000000?P7P0000000On0000000OnNn0000000oo`00000007o`00000003`3h0000007`3`0000000n00000000001n00000000?00000000?P7P0000000On000",
+    "0000?nOn0000001o_`00000007o`00000003`7h0000007h7`0000000n00000000000n00000000?00000000?P7P0000000?l0000000?lOl0000003o?h00000003",
+    "oP00000003h?`0000007l?`0000000n000000000l1n00000000?000000007`?P0000000?l0000000?lOl0000007n7l00000001oP00000003oo`0000003oO`000",
+    "0000n000000000o_n00000000?000000007ooP0000000?h0000000?l?l0000007l3n00000001o000000003ooP0000003oo`0000000n000000000ool00000000?",
+    "000000007ooP00000007h00000007h?h0000007h1n00000000o000000003ooP0000001oo`0000000n000000000ool00000000?000000007ooP00000007h00000",
+    "007h?h0000007`1n00000000n000000003oo00000000Oo`0000000n000000000ooh00000000?000000003ooP00000007`00000007h7h0000007P0n00000001n0",
+    "00000003oh000000007o`0000000n000000000?oP00000000?000000001ooP00000003`00000003`7`000000000N00000001l000000003`00000000007`00000",
+    "00000000000000000000000000000000007P00000000000000003P3P000000000000000003l000000003`00000000007P0000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000003h000000003`00000000007P000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000007h000000003`00000000007P0000000000000000000000000000000000000000000000000000000000000000000000000000007h000",
+    "000003`00000000007P0000000000000000000000000000000000000000000000000000000000000000000000000000007`000000007`0000000000?P0000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000?`000000007`0000000000?P000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000?`000000007`0000000000?P00000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000?P000000007`0000000000?P000000000000000000000000000000000000000000000000000000000000000000000000000000?P00000",
+    "0003`00000000007P000000000000000000000000000000000000000000000000000000000000000000000000000000?P0000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000l00000000",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000l0000000000000000000000000000000000",
+    "000000000000000000000000000000000000000000000000000000000oP00000000l00000000Oh00000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000001oP00000000l00000000Ol0000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00003oP00000000l00000000On000000000000000000000000000000000000000000000000000000000000000000000000000000003oP00000000l00000000On",
+    "000000000000000000000000000000000000000000000000000000000000000000000000000000007h000000000l000000001n00000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000007`000000000l000000000n0000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000007`000000000l000000000O000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "007P000000000l000000000O000000000000000000000000000000000000000000000000000000000000000000000000000000007P000000000l000000000O00",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000007P000000000l000000000O0000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000007`000000000l000000000O000000000000000000000000000000000000000000000000000000",
+    "0000000000000003ool00000007`000000000l000000000O0000000000000000000000000000000000000000000000000000000000000000000003ool0000000",
+    "7`000000000l000000000O0000000000000000000000000000000000000000000000000000000000000000000003ool00000007`000000000l000000000O0000",
+    "00003h000000000000000000000000000000000000000000000000000000000003ool00000007`000000000l000000000O00000000?n1`000000000000000000",
+    "0000000000000000000000000000000000000001ooh00000007`000000000l000000000N00000000Oo3`00000000000000000000000000000000000000000000",
+    "000000000000000?`0000000?`000000000l000000000O00000000Oo3`00000000000000000000000000000000000000000000000000000000000O`0000000O`",
+    "000000000l000000000O`0000000ooW`00000000000000000000000000000000000000000000000000000000000oP0000000oP000000000l000000000Oh00000",
+    "01oOo`00000000000000000000000000000000000000000000000000000000000o00000001oP000000000l000000000?h0000001n?o`00000000000000000000",
+    "000000000000000000000000000000000000001n00000001o0000000000l0000000007h0000001l7o`0000000000000000000000000000000000000000000000",
+    "0000000000003n00000001o0000000000l0000000007h0000001h3oP00000000000000000000000000000000000000000000000000000000003l00000000oP00",
+    "0000000l000000000?h000000001o000000000000000000000000000000000000000000000000000000000007h00000000OP000000000l000000000?`0000000",
+    "00000000000000000000000000000000000000000000000000000000000000?h00000000?P000000000l000000000OP000000000000000000000000000000000",
+    "000000000000000000000000000000000000O`000000007P000000000l000000000O000000000000000000000000000000000000000000000000000000000000",
+    "0000000000oP000000007P000000000l000000000O0000000000000000000000000000000000000000000000000000000000000000000001oP000000007P0000",
+    "00000l000000000O0000000000000000000000000000000000000000000000000000000000000000000003oo000000007P000000000l000000000?0000000000",
+    "000000000000000000000000000000000000000000000000000000000007ooh00000007P000000000l000000000?000000000000000000000000000000000000",
+    "0000000000000000000000000000000007ooh00000007P000000000l000000000O00000000000000000000000000000000000000000000000000000000000000",
+    "00000007ooh00000007`000000000l000000000O0000000000000000000000000000000000000000000000000000000000000000000007ooh00000007`000000",
+    "000l000000000O0000000000000000000000000000000000000000000000000000000000000000000003P0000000007`000000000l000000000o000000000000",
+    "000000000000000000000000000000000000000000000000000000000000000000007h000000000l000000001n00000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000003oP00000000l00000000?n0000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000003oP00000000l00000000?n000000000000000000000000000000000000000000000000000000000000000000000000000000001oP0000000",
+    "0l00000000?l000000000000000000000000000000000000000000000000000000000000000000000000000000000oP00000000l00000000?h00000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000?000000000000000000?P0000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+};
+
+static constexpr uint8_t nFontMargins5[] = {
+    61,61,65,65, 27,29,14,18, 23,26,14,37, 13,15,15,18, 17,21,12,11, 16,16,13,18, 18,19,15,17, 27,29,13,41,
+    24,25,14,10, 24,25,14,10, 20,23,14,34, 21,23,25,23, 28,27,43,12, 23,24,33,28, 27,28,42,17, 21,22,14,17,
+    18,20,15,18, 24,24,15,19, 20,22,15,19, 20,22,16,18, 18,20,15,18, 20,21,15,18, 19,21,15,17, 19,20,16,18,
+    20,21,16,18, 19,21,15,17, 27,29,23,21, 25,29,23,15, 22,26,25,23, 21,24,26,24, 23,24,23,23, 20,23,17,17,
+    13,16,14,16, 17,19,17,18, 20,20,15,18, 19,20,16,18, 18,19,15,17, 19,20,14,17, 21,20,15,17, 17,18,15,18,
+    17,18,15,17, 20,21,16,18, 18,19,16,17, 21,19,16,17, 20,21,15,17, 14,15,15,17, 16,17,15,17, 15,17,16,18,
+    21,22,15,19, 13,14,16,10, 19,20,15,18, 18,19,17,18, 18,16,16,19, 17,19,16,18, 19,18,15,17, 11,11,16,17,
+    16,18,16,17, 17,20,16,18, 17,18,16,18, 25,25,16,11, 22,22,16,16, 25,25,16,11, 22,23,13,41, 16,18,48,12,
+    21,31,13,42, 20,21,25,18, 20,21,15,18, 21,22,25,18, 19,21,14,18, 20,21,25,18, 21,23,14,16, 20,22,25, 8,
+    20,22,14,18, 27,28,16,19, 21,26,16, 7, 22,21,14,18, 27,29,14,18, 16,17,24,17, 21,22,24,18, 20,22,25,18,
+    21,22,24, 8, 20,23,25, 8, 22,23,25,18, 21,23,23,18, 21,23,18,18, 21,22,25,17, 21,22,25,18, 17,18,25,17,
+    19,21,24,18, 19,21,25, 8, 21,21,25,17, 22,25,14,11, 28,29,12,12, 22,25,14,11, 19,21,27,28, 61,61,65,65,
+    61,61,65,65, 61,61,65,65, 61,61,65,65, 61,61,65,65,
+};
 
-    sDataString.clear();
+//                              +------------+                               //
+// -----------------------------+ FUNCTIONS  +------------------------------ //
+//                              +------------+                               //
+
+// this table contains all info that is needed wrt the font sprites:
+//   * the name of the file the sprite data was taken from
+//   * the nr of characters in the sprite, horizontal and vertical
+//   * the tile size of the characters, horizontal and vertical
+//   * an offset to compensate if the tiles can't be directly indexed by the ascii value (i.e. if tile 65 does not contain character 'A'
+//   * the sprite data and the margins per character
+static constexpr FontData glbFontData[NR_OF_SPRITE_FONTS] = {
+    { "ascii 128x128.tpbg.png",                16, 16,  8,  8,  0, sFontData0, int( sizeof( sFontData0 ) / sizeof( sFontData0[0] )), nFontMargins0 },
+    { "nesfont 128x48.png",                    16,  6,  8,  8, 32, sFontData1, int( sizeof( sFontData1 ) / sizeof( sFontData1[0] )), nFontMargins1 },
+    { "font - unknown 512x512.tpbg.mono.png",  16, 16, 32, 32,  0, sFontData2, int( sizeof( sFontData2 ) / sizeof( sFontData2[0] )), nFontMargins2 },
+    { "font cells 512x512.tpbg.mono.png",      16, 16, 32, 32,  0, sFontData3, int( sizeof( sFontData3 ) / sizeof( sFontData3[0] )), nFontMargins3 },
+    { "bitmapfont openGL.tpbg.mono.png",       25, 11, 20, 20,  0, sFontData4, int( sizeof( sFontData4 ) / sizeof( sFontData4[0] )), nFontMargins4 },
+    { "simple font 610x650.tpbg.png",          10, 10, 61, 65, 32, sFontData5, int( sizeof( sFontData5 ) / sizeof( sFontData5[0] )), nFontMargins5 },
+};
 
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000N0000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000N00000000n000000000000000000003`00000";
-    sDataString += "00000000000000000000000000000000001h00000000>00000000000000000000N00000001oP7P000000000000000003h0000000003`00000003`00000000000";
-    sDataString += "000000001h00000000N7P00000007`1h0000000N00000007o`?P00000003n000000003h0000000007`00000007h00000000000000000001h00000000N7P00000";
-    sDataString += "007`3h0000000O00000007oh?P00000007n000000003h000000000?`00000007l00000000000000000001h00000000N7P00000007`3h0000000ol0000007ohOP";
-    sDataString += "00000007o000000003`000000000O`00000007n00000000000000000001h00000000N7P0000000?`3h0000007oo0000007ShO00000000?o000000003h0000000";
-    sDataString += "00O`00000003n00000000000000000001h00000000N7P0000000?P3h000000?oo0000007Qho00000000?o000000003h000000000oP00000001o0000000000000";
-    sDataString += "0000001h00000000N7P0000000?P7`000000Ooo0000007Qhn00000000?_000000003h000000000o000000000o00000000000000000001h00000000N7P0000000";
-    sDataString += "?P7`000000ooO0000007ghn00000000?O000000003h000000001n000000000OP0000000000000000001h00000000N7P0000000OP?`000001on00000007oil000";
-    sDataString += "00000?O000000003h000000001l000000000?P0000000000000000001h00000000N7P000000oooooP00001nN00000007oil00000000?o000000001`000000003";
-    sDataString += "l000000000?`0000000000000000001h00000000O7P000000oooooP00001lN00000003och00000000?n0000000000000000003h0000000007`00000000000000";
-    sDataString += "00001h00000000O7P000000oooooP00001lN00000000o3h00000000?n0000000000000000003h0000000007`0000000000000000001h00000000O7P000000ooo";
-    sDataString += "ooP00001lN0000000007`00000000?l0000000000000000007`0000000007h0000000000000000001h00000000>7P0000000n0O0000001on0000000007`00000";
-    sDataString += "000oh0000000000000000007`0000000003h0000000000000000001h000000000000000000n0O0000001ooP00000000?`00000001o`0000000000000000007`0";
-    sDataString += "000000003h0000000000000000001h000000000000000001l0O0000001ool00000000?P00000003oh0000000000000000007`0000000003h0000000000000000";
-    sDataString += "001h000000000000000001l0N0000000ooo00000000OP00000007ohl000000000000000007P0000000003h0000000000000000001h000000000000000001l0n0";
-    sDataString += "000000?ooP0000000O00000000?kll00000000000000000?P0000000003h0000000000000000001h000000000000000001l0n00000000ooP0000000O00000000";
-    sDataString += "Oall00000000000000000?P0000000001h0000000000000000001h000000000000000003h0n00000000Oo`0000000n7l000000oQnl00000000000000000?P000";
-    sDataString += "0000001h0000000000000000001h00000000000000003oooon0000000NO`0000000n?o000000o0ol00000000000000000?P0000000001h000000000000000000";
-    sDataString += "1h00000000000000003oooon0000000N?`0000001lOoP00000n0ol00000000000000000?P0000000001h0000000000000000001h00000000000000003oooon00";
-    sDataString += "00000N7`0000001loo`00000l0Ol00000000000000000?P0000000001h0000000000000000001h00000000000000003oooon0000000N7`0000003ho?`00000l0";
-    sDataString += "?l00000000000000000?P0000000001h0000000000000000001h00000000000000000?`7l00000000N7`0000003hn7`00000l0?h00000000000000000?P00000";
-    sDataString += "00001h0000000000000000001h00000000000000000?P3h00000000N?`0000007`l3`00000l07h000000000000000007P0000000003h00000000000000000000";
-    sDataString += "00000000000000000?P3h0000007`NO`0000007`l7`00000n0?h000000000000000007`0000000003h0000000000000000000000000000000000000?P7h00000";
-    sDataString += "07hOoP000000?Pn7`00000o0ol000000000000000007`0000000003h0000000000000000003`00000000000000000OP7`0000007oooP000000?PooP00000ocon";
-    sDataString += "000000000000000007`0000000003h0000000000000000003h00000000000000000O07`0000007ooo0000000OPooP00000Ooon000000000000000007`0000000";
-    sDataString += "007h0000000000000000003h00000000000000000O07`0000003oon0000000O0Oo000000?ono000000000000000007h0000000007`0000000000000000003h00";
-    sDataString += "000000000000000O07P0000001ool0000000O0?n0000007oho000000000000000003h000000000?`0000000000000000003h00000000000000000007P0000000";
-    sDataString += "OoP0000000>0000000001oPO000000000000000003l000000000?`0000000000000000000000000000000000000000000000000n000000000000000000000>00";
-    sDataString += "0000000000000003n000000000OP0000000000000000000000000000000000000000000000000N0000000000000000000000000000000000000001n000000000";
-    sDataString += "oP0000000000000000000000000000000000000000000000000N0000000000000000000000000000000000000001oP00000001o0000000000000000000000000";
-    sDataString += "0000000000000000000000000N0000000000000000000000000000000000000000o`00000003o00000000000000000000000000000000000000000000000000N";
-    sDataString += "0000000000000000000000000000000000000000O`00000007n00000000000000000000000000000000000000000000000000N00000000000000000000000000";
-    sDataString += "00000000000000?`00000007l00000000000000000000000000000000000000000000000000N00000000000000000000000000000000000000007`00000007h0";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001`00000003P000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000070";
-    sDataString += "000000000000000000000000000000000000000000000000003`000000000000000000000000000000000000000000000000?P00000000000000000000000000";
-    sDataString += "0000000000000000000000007`0000000?l000000000n000000000n0000000000000000000?P000000000000000000000000000000000000000000000000007`";
-    sDataString += "0000000oo000000001n000000007o`00000007o`00000000?P00000000000000000000000000000000000000000000000000?`0000001ooP00000003n0000000";
-    sDataString += "0Ooh0000000Ooh0000000?_P00000000000000000000000000000000000000000000000000?P0000003oo`0000000?l00000000ool0000000ool0000000?oo`0";
-    sDataString += "000000000000000000000000000000000000000000000000?P0000007ooh0000000Ol00000001oon0000000oon0000000?oo`000000000000000000000000000";
-    sDataString += "0000000000000000000000O0000000?l7h0000000Ol00000003o3n0000000oSn0000000?oo`0000000000000000000000000000000000000000000000000O000";
-    sDataString += "0000?`3l0000000Ol00000003n1n0000000n0n00000003oo`0000000000000000000000000000000000000000000000000o0000000OP1l0000000Ol00000003l";
-    sDataString += "0n000000000N00000000ol00000000000000000000000000000000000000000000000000n0000000OP1l0000000Nl00000001`0n000000000N00000001ol0000";
-    sDataString += "0000000000000000000000000000000000000000000000n0000000O01n00000000l0000000000n000000000N00000003on000000003`00000000000000000000";
-    sDataString += "00000000000000000001l0000000O00n00000000l0000000001n000000000n00000007oo000000003`0000000000000000000000000000000000000001l00000";
-    sDataString += "00n00n00000000l0000000003n000000003n00000007lo000000003`0000000000000000000000000000000000000003l0000000n00n00000001l0000000007l";
-    sDataString += "00000000on00000007ho000000003`0000000000000000000000000000000000000003h0000000n00n00000001l000000000?l00000003ol00000007`O000000";
-    sDataString += "003`0000000000000000000000000000000000000007h0000000n00n00000001l000000000Oh00000003oh000000000?000000007h0000000000000000000000";
-    sDataString += "000000000000000007`0000000n00n00000001l000000001o`00000003oh000000000000000003ooh00000000000000000000000000000000000000?`0000000";
-    sDataString += "n00n00000001l000000003oP00000003on000000000000000003ooh00000000000000000000000000000000000000OP0000000n00n00000001l00000000?o000";
-    sDataString += "000000?n000000000000000003ooh000000000000000007ol000000000000000000OP0000000n00n00000001l00000000Ol0000000003o000000000000000003";
-    sDataString += "ooh00000000000000000?ol000000000000000000o00000000n00n00000001l00000000oh0000000001o0000000000000000007h000000000000000000?ol000";
-    sDataString += "000000000000000o00000000N00n00000001l00000000oP0000000000o0000000000000000003`000000000000000000?ol000000000000000001n00000000O0";
-    sDataString += "1l00000001l00000001o00000000000O0000000000000000003`000000000000000000000000000000000000001l00000000O01l00000001l00000001n000000";
-    sDataString += "00000O0000000000000000003`000000000000000000000000000000000000003l00000000OP3l00000001l00000001l00000000000O0000000000000000003`";
-    sDataString += "000000000000000000000000000000000000003h00000000OP3l00000001l00000003l000000001l0O0000000000000000003`00000000000000000000000000";
-    sDataString += "0000000000007h00000000?`7h00000001l00000003h000000001l0o0000000000000000003`000000000000000000000000000000000000007h00000000?h?h";
-    sDataString += "00000001l00000003ool0000001n1n0000000000000000000000000000000000000000000000000?000000007`000000007oo`0000000Oo`0000003oon000000";
-    sDataString += "1oon00000000000000000000000000000?0000000000000000000OP0000000?`000000007oo`0000000Oo`0000003oon0000000ool0000000000000000000000";
-    sDataString += "0000000?0000000000000000000OP0000000?P000000003ooP0000000Oo`0000003oon0000000ool00000000000000000000000000000O000000000000000000";
-    sDataString += "0OP0000000?P000000001oo00000000Oo`0000001oon0000000?o`00000000000000000000000000000O0000000000000000000OP0000000?0000000000?h000";
-    sDataString += "00000000000000000000000003o000000000000000000000000000000O0000000000000000000?00000000?00000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000n000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000n00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000l00000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000l0000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000h000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000OP0000003Qol00000000N000000000000000000000000000007`0";
-    sDataString += "0000000000000000000000000000000000000000000000000oP0000007ool00000000o00000003ooo`0000001oh00000001on000000000000000000000000000";
-    sDataString += "00000000000000000000000oP0000007ool00000001o00000003ooo`0000007on00000007oo00000000000000000000000000000000000000000000000001oP0";
-    sDataString += "000007ool00000003o00000003ooo`000000?on0000000?ooP0000000000000000000000000000000000000000000000003oP0000003ool00000007n00000003";
-    sDataString += "ooo`000000Ooo0000000?oo`0000000000000000000000000000000000000000000000007oP0000003h000000000?l00000000?oo`000000O`o0000000O`O`00";
-    sDataString += "00000000000000000000000000000000000000000000007oP0000003`000000000?h0000000000oP000000O0O0000000OP?h0000000000000000000000000000";
-    sDataString += "00000000000000000000?oP0000003`000000000O`0000000001o0000000O0O0000000O07h000000000000000000000000000000000000000000000000OoP000";
-    sDataString += "0003`000000000oP0000000001n0000000n0?0000000n03h00000003P000000001`00000000000000000000000000000O_P0000007goP0000000o00000000003";
-    sDataString += "n0000000n0?0000000n03h00000007`000000003h00000000000000000000000000000o?P0000007ooh0000001n00000000007l0000000o0O0000000n01h0000";
-    sDataString += "0007`000000003h000000000?P000000000000000001o?P0000007ooh0000001l00000000007h0000000OPo0000000n01h00000007`000000003h000000000OP";
-    sDataString += "0000000ool00000001n?P0000007ool0000003ooP00000000?h0000000Oko0000000n01h00000007`000000003h000000000oP0000000ool00000003l?P00000";
-    sDataString += "07oWl0000003ooh00000000?`0000000Oon0000000o03h00000007`000000003h000000001o00000000ool00000007l?P0000007n1n0000003ool00000000OP0";
-    sDataString += "000000?ol0000000OP7h000000000000000001`000000003o00000000ool00000007h?P0000007l0n0000003ool00000000OP00000007on0000000O`Oh000000";
-    sDataString += "0000000000000000000007n000000000000000000?h?P0000007h0n0000007oon00000000O00000000Ooo0000000Oooh000000000000000000000000000?h000";
-    sDataString += "000000000000000O`?P0000007`0n0000007l3n00000000o00000000OooP000000?ooh000000000000000000000000000o`000000000000000000ooon0000000";
-    sDataString += "00N0000007h0n00000000o00000000o`oP0000007ooh000000000000000000000000000oP000000000000000000ooon000000000N0000007`0n00000001n0000";
-    sDataString += "0000o0O`0000003oo`000000000000000000000000000o`000000000000000000ooon000000000N0000007`0O00000001n00000000n0?`0000000O_`00000000";
-    sDataString += "0000000000000000000oh000000000000000000ooon000000000n0000007`0O00000003l00000000n07`00000000?`000000000000000000000000000?l00000";
-    sDataString += "000Ooh000000000Ol000000000n0000007`0O00000003l00000000l07`00000000OP00000007`0000000000000000003n00000000ool000000000?P000000000";
-    sDataString += "n0000007`0N00000003h00000000l07`00000000oP00000007`0000000000000000001o00000000ool000000000?P000000001n0000003h0n00000007h000000";
-    sDataString += "00l07`00000001o000000007`0000000000000000000o00000000ool000000000?P0000007P3n0000003h0n00000007h00000000n0?`00000003o000000007`0";
-    sDataString += "000000000000000000O00000000Ool000000000?P0000007`7l0000003l1n0000000?`00000000o0O`0000000?n000000007`000000001h000000000?0000000";
-    sDataString += "0000000000000?P0000007lOl0000003n3n0000000?`00000000o`oP0000000ol000000007`000000003h000000000000000000000000000000?P0000007ooh0";
-    sDataString += "000001ool0000000?P00000000oooP0000007oh000000003`000000007h000000000000000000000000000000?P0000007oo`0000001ooh0000000?P00000000";
-    sDataString += "Ooo0000000?o`0000000000000000007h000000000000000000000000000000?P0000003ooP0000000oo`0000000?P00000000?on0000000?o00000000000000";
-    sDataString += "00000?`000000000000000000000000000000700000000on00000000?oP0000000?0000000003oh0000000?l0000000000000000000?`0000000000000000000";
-    sDataString += "0000000000000000000000000000001h0000000000000000000000000000?P0000000000000000000?P000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000?000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000?00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000oo`0000000000000000000000000000000";
-    sDataString += "000000000000000007oh000000000000000000000000000000000000000000000003ool00000000000000000?oP00000000000000000O0000000007ooo000000";
-    sDataString += "1oon00000000oh0000000000000000000000000007ooo00000000000000000Ooh000000000ol000000o`000000007ooo0000001oooP0000001on000000000000";
-    sDataString += "000000ol0000000OoooP00000003h0000000Ool000000003ol000000ol000000007ooo0000001oooP0000003ooP00000000000000003on0000000On?o`000000";
-    sDataString += "03h0000000Oon00000000?ol000000oo000000007ooo0000001oooP0000007ooP00000000000000007ooP000000o`0oh00000007h0000000OWo00000000Ool00";
-    sDataString += "0000oo`00000007l0O0000001oioP000000?ooP00000000000000007ooP000001oP0Oh0000000?h0000000O1oP0000000ool000000ool00000007`000000001l";
-    sDataString += "000000000OhOP00000000000000007mo`000001o007l0000000?l0000000O0oP0000001oal000000ooo00000007`000000001h000000000o`700000000000000";
-    sDataString += "0007`Oh000003n7l3l0000000Ol0000000O0OP0000001o1l000000n?oP0000007`000000001h000000000oP000000000h000000007P7h000003l?l1n0000000o";
-    sDataString += "l0000000O0?P0000003n0l000000n3o`0000007`000000001h000000001o0000000000l00000000003h000007hol1n0000000ol0000000O0?P0000007l000000";
-    sDataString += "00n0oh0000007`000000001h000000001n0000000000n00000000003h000007hol0n0000001ol0000000O0?P0000007l00000000n0Ol0000007`000000001h00";
-    sDataString += "0000003l0000000000o00000000001h000007ao`0n0000003on0000000O0OP000000?h00000000N07l0000007`000000001h000000003l0000000000oP000000";
-    sDataString += "0003h000007an?0n0000003ln0000000O0OP000000?`00000000N03n0000007`000000001oon0000003h0000000000Oh0000000003h000007clO0N0000007ln0";
-    sDataString += "000000N1o0000000OP00000000N01n0000007gon0000001oon0000007h0000000000?l0000000007h000007chO0n0000007hn0000000O3o0000000OP00000000";
-    sDataString += "N00o0000007oon0000001oon0000007`00000000007n000000000?h000007Sho0n000000?`n0000000Oon0000000O000000000N00o000000?oon0000001oon00";
-    sDataString += "00007`7ol00000003oP00000000o`000007Sho0n000000?co0000000Oon0000000o000000000N00O000000?oon0000001oon0000007`ool00000001oP0000000";
-    sDataString += "1o`000007Smo1n000000Ooo0000000Oon0000000n000000000N00O000000?ooP0000001n00000000?Sool00000000oP00000003oP000007cooon000000ooo000";
-    sDataString += "0000oooP000000n000000000N00O000000?`000000001h00000000?Sool00000003o000000007o0000007coool000001ooo0000000ooo`000000n000000000n0";
-    sDataString += "0?000000?P000000001h00000000?Sooh00000007n00000000?l0000007aoool000001oooP000000n1oh000000n000000000n00O000000?P000000001h000000";
-    sDataString += "00?Sn7h0000000?l00000000Oh0000007`oooh000001ooOP000000n0?h000000n000000000n00O000000?P000000001h00000000?S`7`0000000oh00000000O`";
-    sDataString += "0000007h?3oP000001oP?P000000n07h000000n000000000n00O000000?P000000001h00000000?P0?`0000001o`00000000OP0000003l0000000003l0?P0000";
-    sDataString += "00n07h000000n03h000000n00o000000?P000000001h00000000?P0O`0000001oP00000000O00000003l0000000003l0?`000000n0?h000000o07h000000n00o";
-    sDataString += "000000?P000000001h00000000?P0oP0000001n000000000000000003n0000000007h0?`000000n0Oh000000oPOh000000n01n000000?P000000001h00000000";
-    sDataString += "?`1oP0000001l000000000000000001o0000000007h07`000000n3o`000000Oioh000000n03n000000?P000000001h000000007h3o000000000000000000n000";
-    sDataString += "00000o`0O000000?`07h000000oooP000000Oooh000000o0?l0000007`000000001h000000007nOn000000000000000000n00000000Ol1o000000?`07h000000";
-    sDataString += "ooo0000000?ooP000000oooh0000007ool0000001h000000007oon000000000000000000n00000000?ooo000000?P03h000000oon00000007oo0000000oooh00";
-    sDataString += "00007ool0000001h000000003ooh000000000000000000n000000007ooo000000?P03h000000ooh00000001ol0000000ooo`0000007ool0000001h000000001o";
-    sDataString += "o`000000000000000000n000000003ooo0000007001`000000On000000000?00000000?oo00000003ool0000001h000000000oo0000000000000000000L00000";
-    sDataString += "0000ool00000000000000000000000000000000000001oh00000000ool0000001h00000000000000000000000000000000000000007o00000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000l007P000000000000000000000000000000000000N000000000001`000003`00700000000000000000oo000000000000000000l007P";
-    sDataString += "000007on00000000Ooo`000000N07`000000O000000000O03h000003h00?P0000007o`0000000ooP00000003oh0000000l007P000007oon0000000Ooo`000000";
-    sDataString += "N07`000000O000000000o03h000003l00?P000000Oon0000000ooh0000000Ooo0000000l00?P000007oon0000000Ooo`000000N0?`000000O000000000o07l00";
-    sDataString += "0003l00?P000001ooo0000000ool0000001oooP000000l00?P000007oon0000000Ooo`000000N0O`000000O000000000o07l000003n00?`000003oooP000000l";
-    sDataString += "?l0000003ooo`000000l00?P000007oon0000000Ooo`000000N0oP000000O000000000oP7l000003o00?`000007ooo`000000l3n0000007oooh000000l00?P00";
-    sDataString += "00007kl000000007`0000000N1oP000000O000000001oP7l000003oP0?`00000?n0o`000000l1n000000?o0Ol000001l00?P0000003`0000000007P0000000N3";
-    sDataString += "o0000000O000000001oP7l000003oP07`00000?h0?`000000l0n000000Ol07l000001l00?P0000003`0000000007P0000000N7n0000000O000000001oP?l0000";
-    sDataString += "03o`07`00000O`07h000000l0N000000o`03n000001l00?P0000003`0000000007P0000000N?l0000000O000000001oP?n000003oh07`00000OP07h000000l0N";
-    sDataString += "000000oP01n000001l00?P0000003`0000000007P0000000N?h0000000O000000001o`?n000003oh07`00000o003h000001l0n000001o001n000001l00?P0000";
-    sDataString += "007`0000000007P0000000NO`0000000O000000003o`On000003kl07`00000o003h000001l0n000001n000o000001l00?P0000007`0000000007P0000000Oo`0";
-    sDataString += "000000O000000003o`On000003kn07`00001n003h000001l1n000001n000o000001l00?P0000007`0000000007P0000000OoP0000000O000000003o`On000003";
-    sDataString += "io07`00001n003h000001l3n000003l000O000001l0ooP0000007`0000000007P0000000Oo00000000N000000003o`On000003hoP7`00001l003h000001l?l00";
-    sDataString += "0003l000O000001lOooP0000007`0000000007P0000000On00000000N000000007ohoO000003hOP7`00001l003h000001ool000003h000O000001oooo0000000";
-    sDataString += "7`000000000?P0000000Ol00000000N000000007khnO000003hO`7`00003l003h000001ooh000003h000O000000oooo00000007`000000000?P0000000Oh0000";
-    sDataString += "0000N000000007chnO000003h?h7`00003h003h000001oo`000003h000?000000oonO00000007`000000000?P0000000Ol00000000N000000007cinO000003h7";
-    sDataString += "l7`00003h007h000001oo0000003h000?000001on0?00000007`000000000?P0000000on00000000N00000000?cmlO000003h3n7`00003h007h000001o`00000";
-    sDataString += "03h000O000001o00?00000007`000000000?P0000000oo00000000N00000000?cml?P00003h1o7`00003h007`000001h00000003l000O000001l00?00000007`";
-    sDataString += "000000000?P0000000ooP0000000n00000000?Qol?P00003h1oW`00003l00?`000001h00000003l0l0O000001l00?00000003`0000000?0?P0000000oo`00000";
-    sDataString += "00n00000000?Qoh?P00003h0og`00001l00O`000001h00000001n0n0o000001l00?00000003`0000000?0?P0000000nOh0000000n00000000OQoh?P00003h0Oo";
-    sDataString += "`00001n00OP000001h00000001n0o1o000001l00?00000003`0000000?P?00000000nOl0000000n00000000OPoh?`00003h0?o`00001o00oP000001h00000001";
-    sDataString += "o0oSn000001l00?00000007`0000000?P?00000000n?n0000000n00000000O0o`7`00003h07o`00001oP1o0000001h00000000oPogn000001l00?P0000007ol0";
-    sDataString += "00000?`O00000000n7oP000000n0?`00000O0o`7`00003h03o`00000o`7o0000001h00000000o`Ool000001l00?P000003ool000000?lO00000000n1oh000000";
-    sDataString += "n3o`00000O0o`7h00003h01o`00000Ooon0000001h00000000Ol?oh000001h00?P000007ool0000007oo00000000n0oh000000ooo`00000O0OP7h00003h00o`0";
-    sDataString += "0000Oool0000001h00000000?o_o`000001h00?P000007ool0000007on00000000n0Oh000000ooo`00000O0OP7h00003h00O`000007ooh0000001h000000007o";
-    sDataString += "ooP000001h00?P000007ool0000003on00000000n0?h000000oooP00000N0OP3h00003h00?`000003oo`0000001h000000003ooo`000001h00?0000003l00000";
-    sDataString += "0000on00000000n03h000000ool000000N0?03h00003`007P000000oo000000000000000000oooh000001h00000000000000000000Ol00000000N000000000Ol";
-    sDataString += "000000000001`00001`000000000000000000000000000000?ool000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000007n00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003";
-    sDataString += "o00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001oP000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000o`00000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000O`0000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000?`00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003P";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000?P000";
-    sDataString += "000000000000000000000000000000000000000L000000000000000000000000000000000000000000000000000000000?oP00000000000000000?oon0000007";
-    sDataString += "P01h000001l00n00003h03P0?P0001l00?P00000n00?000000Oooo`0000001oh0000000Ooh000000001oh000000?ooon000007P01h000001l01n00003h07`0?P";
-    sDataString += "0001n00OP00000n00O000000Ooooh0000001oh0000000Oon00000000?on000000?ooon000007P03h000001l01n00003h0?`0OP0001o00oP00000o00O000000Oo";
-    sDataString += "ooh0000001oh0000000Ooo00000000Oon000000?ooon000007P03h000001l03n00003l0?`0OP0001oP0oP00000oP0o000000Ooooh0000001oh0000000OooP000";
-    sDataString += "0000oon0000007ooon00000?P03h000001l03l00003l0O`0O00000oP1o000000OP0o000000?oooh0000001l00000000O1o`0000001oan00000001n0000000?P0";
-    sDataString += "3h000001n03h00001l0Oh0o00000O`3n000000O`1n000000003o`0000001h00000000?0Oh0000003o0000000000n0000000?P03h000000n07h00001n0Oh0o000";
-    sDataString += "00?h3n000000?h1n000000003o00000001h00000000?0?h0000003l0000000000n0000000?P03h000000n07`00001n0oh0n000007l7l0000007h3l000000007n";
-    sDataString += "00000001h00000000?07l0000003h0000000000n0000000?P03h000000o07`00000n0oh1n000007l?h0000007l3l00000000?h00000001h00000000?03l00000";
-    sDataString += "03h0000000000n0000000?P03h000000o0?`00000n0oh1n000003nO`0000003l3h00000000O`00000001h00000000?01l0000003h0000000000n0000000?P03h";
-    sDataString += "000000O0?P00000o1oh1l000001oO`0000001n7h00000000oP00000001h00000000O01l0000003n0000000000n0000000?P03h000000O0OP00000O1oh3l00000";
-    sDataString += "0ooP0000001n7h00000001o000000001h00000000O03l0000003oo000000000n0000000?P03h000000OPOP00000O1ol3h000000oo00000000o?`00000001o000";
-    sDataString += "000001h00000000O07l0000003ooh00000000N0000000?P03h000000?PO000000O3ml3h000000Oo00000000o?`00000003n000000001h00000000O0?l0000001";
-    sDataString += "ool00000000N0000000?P03h000000?Po000000?Sml7h000000?n00000000O_P00000007l000000001h00000000O0oh0000000Oon00000000N0000000?P03h00";
-    sDataString += "0000?Po000000?Sml7`000000?l00000000OoP0000000?h000000001h00000000Ooo`00000000oo00000000N00000007P03h000000?`n000000?Whl?`000000?";
-    sDataString += "l00000000?oP0000000?`000000001h00000000OooP000000003o00000000O00000007P03h0000007an000000?Whn?P000000On00000000?o00000000O`00000";
-    sDataString += "0001h00000000Ooo0000000000oP0000000O00000007P07h0000007al0000007ghn?P000000oo000000007o00000000oP000000001h00000000Ool0000000000";
-    sDataString += "OP0000000O00000007`07`0000007il0000007o`nOP000001oo000000003n00000000o0000000001h00000000Ool0000000000?P0000000O00000007`07`0000";
-    sDataString += "003kl0000007o`nO0000003ooP00000001n00000001o0000000001h00000000Ooo0000000000?P0000000O00000007`0?`0000003kh0000007oPnO0000007nO`";
-    sDataString += "00000003l00000003n0000000001h00000000O?oP000000000?P0000000O00000007h0?`0000003oh0000007oPOn000000?l?`00000003l00000007l00000000";
-    sDataString += "01h00000000O3oh000000O00OP0000000O00000007h0OP0000003oh0000003o0On000000Oh?h00000007h00000007l0000000001h00000000O0ol000000O00oP";
-    sDataString += "0000000O00000003l0OP0000001o`0000003o0On000000O`7l00000007h0000000?h0000000001h00000000O0?n000000OP3o00000000O00000003n0o0000000";
-    sDataString += "1o`0000003o0Ol000000oP3n0000000?`0000000O`0000000003h00000000O07n000000Oh?o00000000O00000001oco00000001o`0000003n0Ol000001o03n00";
-    sDataString += "00000?`0000000O`7oP0000003h00000000O03n000000Ooon00000000O00000001oon00000000oP0000001n0?h000003o01o0000000OP0000000Ooooh0000003";
-    sDataString += "h00000000O01n000000?ool00000000O00000000ool00000000oP0000001n0?h000003n00oP000000OP0000000Ooooh0000003h00000000O00N0000007oo`000";
-    sDataString += "00000N00000000?oh00000000o00000001n0?h000003l00oP000000O00000000Ooooh0000003h00000000>0000000000oo0000000000000000001oP00000000O";
-    sDataString += "00000001n07`000003h00OP000000O00000000Ooooh0000003h00000000000000000000000000000000000000000000000000>00000000007`000000000?0000";
-    sDataString += "000000000000000000000003h00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003h0";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003h000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000003oh0000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000003oh000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000003oh0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003oh00";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000l000000000000000000N00000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000001n000000000000000000O000000000000000000000000000000000000000000>000000000000000000000000000000000000003o00000000";
-    sDataString += "0000000000OP0000000000000000007P000000000000000000000O000000000000000003`0000000007oP00000007oP00000000000000000O`00000000000000";
-    sDataString += "0000?P000000000000000000000O000000000000000003h0000000007oP0000000?o`00000000000000000?h000000000000000000?P00000000000000000000";
-    sDataString += "0O000000000000000003h0000000007oP0000000Ooh000000000000000007l000000000000000000?P000000000000000000000O000000000000000003l00000";
-    sDataString += "00007oP0000000ogl000000000000000003l000000000000000000?P000000000000000000000O000000000000000001n0000000000?P0000000oWl000000000";
-    sDataString += "000000001l000000000000000000?P000000000000000000000N000000000000000001n00000000007P0000000o3l000000000000000001l0000000000000000";
-    sDataString += "00?P000000000000000000000N000000000000000000n00000000007P0000000n1l000000000000000000l000000000000000000?P000000000000000000000N";
-    sDataString += "000000000000000000o00000000007P0000000l0l0000000000000000000000000000000000000?P000000000000000000000N000000000000000000O0000000";
-    sDataString += "0007P00000000000000000000000000000000000000000000000?P000000000000000000000N000000000000000000OP0000000007P000000000000000000000";
-    sDataString += "00000000000000000?l0000000?_n000000003oP00000003on00000001o`00000000?P0000000007P00000000000000000000000000000000000000oo0000000";
-    sDataString += "?oo000000007oh0000000?on00000007ol00000000?`0000000007P00000000000000000000000000000000000001ooP000000?ooP0000000?oh0000000oon00";
-    sDataString += "00000?on000000007`0000000007P00000000000000000000000000000000000003ooP000000?oo`0000000Ooh0000001oon0000000Oon000000007`00000000";
-    sDataString += "07P00000000000000000000000000000000000007oOP000000?oOh0000000oSh0000001o_n0000000Ocn000000007h0000000007P00000000000000000000000";
-    sDataString += "00000000000000?l?P000000?h7h0000000o1h0000003n3n0000000oPn000000003h0000000007P0000000000000000000000000000000000000?h?P000000?`";
-    sDataString += "3l0000001n000000003l1n0000000o1n000000003l0000000007P0000000000000000000000000000000000000?`?P000000?P1l0000001n000000003h0n0000";
-    sDataString += "000n7n000000001l0000000007P0000000000000000000000000000000000000OP?P000000?P1l0000001l000000003`0n0000001lOn000000001l0000000007";
-    sDataString += "P0000000000000000000000000000000000000O0?P000000?P1l0000003l000000007`0n0000001mol000000001n0000000007P0000000000000000000000000";
-    sDataString += "000000000000O0?P000000?P0l0000003h000000007`0n0000001oo`000000000n0000000007P0000000000000000000000000000000000000O0?P000000?P0l";
-    sDataString += "0000003h000000007`0n0000001oo0000000000o0000000007P0000000000000000000000000000000000000O0?P0000007P1l0000003h000000007`0n000000";
-    sDataString += "1ol0000000000O0000000007P0000000000000000000000000000000000000O0?P0000007P1l0000003h000000007`0n0000001o`0000000000O0000000007P0";
-    sDataString += "000000000000000000000000000000000000O0?P0000007P3l0000003h000000003h0n0000001n00000000000OP000000007P000000000000000000000000000";
-    sDataString += "0000000000OP?P0000007P7h0000003l000000003l1n0000001n07P00000000?P000000007P0000000000000000000000000000000000000OPO`0000007`?h00";
-    sDataString += "00001n1l0000003n3n0000001o0?P00000000?`000000007P0000000000000000000000000000000000000?ho`0000007oo`0000001o7l0000003oon0000000o";
-    sDataString += "aoP00000000?`000000007P0000000000000000000000000000000000000?oo`000000?oo`0000001ool0000001oon0000000oooP000000007h000000007P000";
-    sDataString += "00000000000000000000000000000000007ooh000000?ooP0000000ool0000000oon0000000Ooo0000000007h000000007P00000000000000000000000000000";
-    sDataString += "000000007ooh000000?oo00000000Ooh0000000Oon00000007on0000000003h000000007P00000000000000000000000000000000000001och0000007Ol00000";
-    sDataString += "0007oP00000007nN00000001o`0000000003h000000007P000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000001h000000007P0000000000000000Oon0000000000000000000000000000000000000000000000000000000000000000000000000000000007P00000";
-    sDataString += "00000000000Ooool000000000000000000000000000000000000000000000000000000000000000000000000000000?oP0000000000000000Ooool0000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000?oP0000000000000000Ooool000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000?oP0000000000000000Ooool00000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000?oP0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000O`00000000000000001h000000000";
-    sDataString += "000000000000000000007P0000000003`0000000000000000000000000000000000000001o`00000000000000001h000000000000000000000000000007`0000";
-    sDataString += "000003`0000000000000000000000000000000000000003o`00000000000000001h0000000000?0000000007P00000007`0000000003`0000000000000000000";
-    sDataString += "000000000000000000007o`00000000000000001l0000000000O000000000?`00000007`0000000003`0000000000000000000000000000000000000007oP000";
-    sDataString += "00000000000001l0000000000O000000000?`00000007`0000000003`0000000000000000000000000000000000000007h000000000000000001l0000000000O";
-    sDataString += "000000000?`00000007`0000000003`000000000000000000000000000000000000000?`000000000000000001l0000000000O000000000?P00000007`000000";
-    sDataString += "0003`000000000000000000000000000000000000000?`000000000000000001l000000000000000000000000000007`0000000003`000000000000000000000";
-    sDataString += "000000000000000000?P000000000000000001l000000000000000000000000000007`0000000003`000000000000000000000000000000000000000?P000000";
-    sDataString += "000000000001l000000000000000000000000000007`0000000003`000000000000000000000000000000000000000?P000000000000000001h0000000000000";
-    sDataString += "00000000000000007`3`00000003`0000001l0000000000l00000000000000000000?_000000000n00000001hOP00000000N0000000007`00000007`7`000000";
-    sDataString += "03`0000001lOSn0000000lOh00000000oP00000007oo`0000000?o`0000001ioh00000000N0000000007`00000007`?`00000003`0000001mooo0000000moh00";
-    sDataString += "000003oh00000007oo`0000000Ool0000001ooh00000000N0000000007`00000007`O`00000003`0000001oooo0000000ool00000007ol00000007oo`0000000";
-    sDataString += "ool0000001ool00000000N0000000007`00000007`o`00000003`0000001ooooP000000ool0000000?ol00000007oo`0000001oWl0000001ool00000000N0000";
-    sDataString += "000007`00000007aoP00000003`0000001ooooP000000oml0000000Oon00000007oP00000003n1l0000001oil00000000N0000000007`00000007co000000003";
-    sDataString += "`0000001ooo?P000000ohl0000000Oan00000000?000000003l1l0000001oQl00000000N0000000007`00000007gn000000003`0000001ocl?P000000o`l0000";
-    sDataString += "000oPn00000000?000000007h1l0000001o0l00000000n0000000007`00000007ol000000003`0000001oSh?P000000oPl0000000o0n00000000?000000007`1";
-    sDataString += "l0000001o0l00000000n0000000007`00000007oh000000003`0000001o3`7P000000o0l0000000n0O00000000?000000007`1l0000001n0l00000000n000000";
-    sDataString += "0007`00000007oh000000003`0000001n3`7`000000o0l0000000n0O00000000?000000007`1l0000001l0l00000000n0000000007`00000007ol000000003`0";
-    sDataString += "000001l3h7`000000n0l0000001l0O00000000?000000007P1h0000001l0l00000000n0000000007`00000007on000000007`0000001l3h7`000001n0l000000";
-    sDataString += "1l0O00000000?000000007P3h0000001l0l00000000n0000000003`00000007mn000000007`0000001l3h7`000001l0n0000001l0O00000000?000000007`3h0";
-    sDataString += "000001l0n00000000n0000000003`00000007io000000007`0000001l3h7`000001l0n0000000l0N00000000?000000007`7h0000001l0n00000000n00000000";
-    sDataString += "03h00000007PoP00000007`0000001l3h7`000001l0n0000000n0n00000000?000000007`?h0000001l0n00000000n0000000003h00000007PO`00000007`000";
-    sDataString += "0001l3h3`000001l0n0000000n1n00000000?000000007hOh0000001h0n00000000n0000000003h00000007P?`00000007`0000001l1h3`000001l0n0000000o";
-    sDataString += "3n00000000?000000003ooh0000001h0n00000000n0000000003h00000007P?h00000007`0000001l1h3h000001l0n0000000ool00000000?000000003ooh000";
-    sDataString += "0003h0n00000000N0000000003h00000007P7h00000007`0000001l1h3h000001l0n0000000Ool00000000O000000001ooh0000003h0n00000000N0000000003";
-    sDataString += "h00000007P3h00000007`0000001l1h3h000001l0n0000000?oh00000000O000000000ooh0000003h0N00000000N0000000003h00000007P3h00000007`00000";
-    sDataString += "01l1h3h000000l0N0000000?o`00000000O0000000007Sh0000001`0N0000000000000000003h00000007P1h00000007`0000000l1h3h000000l0N00000003oP";
-    sDataString += "00000000O00000000003h00000000000000000000000000003h00000000000000000000000000001h1`000000000000000000000000000O00000000003`00000";
-    sDataString += "0000000000000000000000N3h00000000000000000000000000000000000000000000000000000000000000000000007`000000000000000000000000000O3h0";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000007`000000000000000000000000000OSh000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000?`000000000000000000000000000OSh00000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000007`oP000000000000000000000000000?gh000000000000000000000000000000000000000000000000000000000000000000007ooP0000000";
-    sDataString += "00000000000000000000?oh000000000000000000000000000000000000000000000000000000000000000000007oo00000000000000000000000000007o`000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000007on00000000000000000000000000007o`00000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000003oh00000000000000000000000000003oP0000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000n0000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000N00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000O0000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000O000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000O00000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000O00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000l0";
-    sDataString += "0000000O000000000000000000000000000000000000000000000000000000000007`0000000000000000000000000000007n00000000O000000000000000000";
-    sDataString += "000000000000000000001h0?000000000000000007cl000000003oh0000000L?l00000001on0000000Ooo00000007P7`0000007P1h000000l1h7P000001l0O00";
-    sDataString += "00003`0?00000007oo00000000?oh0000000nol00000007on0000000Ooo0000000?P7`0000007`3h000000n3h7`000001n0o0000003h0?P0000007ooP0000000";
-    sDataString += "ooh0000000ool0000000?on0000000Ooo0000000?P7`0000007`3h000000n3h7`000001n1o0000003h0OP0000007oo`0000000ooh0000000ool0000000?on000";
-    sDataString += "0000Ooo0000000?P7`0000007`3h000000n3l7`000001o3o0000003l0OP0000007oo`0000001oQh0000000ool0000000OlN00000007o`0000000?P7`0000007h";
-    sDataString += "7h000000n7l?P000000oWn0000003n0o00000007n?`0000003n3h0000000ohl0000000O`N00000000O00000000?P7`0000003h7h000000n7l?P000000Ool0000";
-    sDataString += "001n0o00000007l7h0000003l3h0000000oPl0000000O0000000000O00000000?P7P0000003h7`000000n7l?P000000?oh0000001o1n00000007h3h0000003h3";
-    sDataString += "h0000000o0l0000000O`000000000O00000000?P7P0000003l?`000000N7l?P0000007o`0000000o1n00000007`3h0000007h3h0000000o0l0000000Oo000000";
-    sDataString += "000O00000000?P7P0000001l?P000000O?nO00000007oP0000000oSl00000007`3h0000007`3h0000000n000000000Oo`00000000O00000000?P7P0000001nOP";
-    sDataString += "000000O?nO00000003o00000000OSl00000007`3h0000007`3h0000000n000000000?oh00000000O00000000?P7P0000000nO0000000O?nO00000007n0000000";
-    sDataString += "0Och00000007`3h0000007`3h0000000n0000000003ol00000000O00000000?P7P0000000nO0000000OOnO0000000?o00000000?gh00000007`3h0000007`3h0";
-    sDataString += "000000n0000000000?l00000000O00000000?P7P0000000oo0000000OONn0000000OoP0000000?oh00000003`3h0000007`3h0000000n00000000003l0000000";
-    sDataString += "0?00000000?P7P0000000On0000000OnNn0000000oo`00000007o`00000003`3h0000007`3`0000000n00000000001n00000000?00000000?P7P0000000On000";
-    sDataString += "0000?nOn0000001o_`00000007o`00000003`7h0000007h7`0000000n00000000000n00000000?00000000?P7P0000000?l0000000?lOl0000003o?h00000003";
-    sDataString += "oP00000003h?`0000007l?`0000000n000000000l1n00000000?000000007`?P0000000?l0000000?lOl0000007n7l00000001oP00000003oo`0000003oO`000";
-    sDataString += "0000n000000000o_n00000000?000000007ooP0000000?h0000000?l?l0000007l3n00000001o000000003ooP0000003oo`0000000n000000000ool00000000?";
-    sDataString += "000000007ooP00000007h00000007h?h0000007h1n00000000o000000003ooP0000001oo`0000000n000000000ool00000000?000000007ooP00000007h00000";
-    sDataString += "007h?h0000007`1n00000000n000000003oo00000000Oo`0000000n000000000ooh00000000?000000003ooP00000007`00000007h7h0000007P0n00000001n0";
-    sDataString += "00000003oh000000007o`0000000n000000000?oP00000000?000000001ooP00000003`00000003`7`000000000N00000001l000000003`00000000007`00000";
-    sDataString += "00000000000000000000000000000000007P00000000000000003P3P000000000000000003l000000003`00000000007P0000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000003h000000003`00000000007P000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000007h000000003`00000000007P0000000000000000000000000000000000000000000000000000000000000000000000000000007h000";
-    sDataString += "000003`00000000007P0000000000000000000000000000000000000000000000000000000000000000000000000000007`000000007`0000000000?P0000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000?`000000007`0000000000?P000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000?`000000007`0000000000?P00000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000?P000000007`0000000000?P000000000000000000000000000000000000000000000000000000000000000000000000000000?P00000";
-    sDataString += "0003`00000000007P000000000000000000000000000000000000000000000000000000000000000000000000000000?P0000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000l00000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000l0000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000oP00000000l00000000Oh00000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000001oP00000000l00000000Ol0000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00003oP00000000l00000000On000000000000000000000000000000000000000000000000000000000000000000000000000000003oP00000000l00000000On";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000000000000000007h000000000l000000001n00000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000007`000000000l000000000n0000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000007`000000000l000000000O000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "007P000000000l000000000O000000000000000000000000000000000000000000000000000000000000000000000000000000007P000000000l000000000O00";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000007P000000000l000000000O0000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000007`000000000l000000000O000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000003ool00000007`000000000l000000000O0000000000000000000000000000000000000000000000000000000000000000000003ool0000000";
-    sDataString += "7`000000000l000000000O0000000000000000000000000000000000000000000000000000000000000000000003ool00000007`000000000l000000000O0000";
-    sDataString += "00003h000000000000000000000000000000000000000000000000000000000003ool00000007`000000000l000000000O00000000?n1`000000000000000000";
-    sDataString += "0000000000000000000000000000000000000001ooh00000007`000000000l000000000N00000000Oo3`00000000000000000000000000000000000000000000";
-    sDataString += "000000000000000?`0000000?`000000000l000000000O00000000Oo3`00000000000000000000000000000000000000000000000000000000000O`0000000O`";
-    sDataString += "000000000l000000000O`0000000ooW`00000000000000000000000000000000000000000000000000000000000oP0000000oP000000000l000000000Oh00000";
-    sDataString += "01oOo`00000000000000000000000000000000000000000000000000000000000o00000001oP000000000l000000000?h0000001n?o`00000000000000000000";
-    sDataString += "000000000000000000000000000000000000001n00000001o0000000000l0000000007h0000001l7o`0000000000000000000000000000000000000000000000";
-    sDataString += "0000000000003n00000001o0000000000l0000000007h0000001h3oP00000000000000000000000000000000000000000000000000000000003l00000000oP00";
-    sDataString += "0000000l000000000?h000000001o000000000000000000000000000000000000000000000000000000000007h00000000OP000000000l000000000?`0000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000?h00000000?P000000000l000000000OP000000000000000000000000000000000";
-    sDataString += "000000000000000000000000000000000000O`000000007P000000000l000000000O000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000oP000000007P000000000l000000000O0000000000000000000000000000000000000000000000000000000000000000000001oP000000007P0000";
-    sDataString += "00000l000000000O0000000000000000000000000000000000000000000000000000000000000000000003oo000000007P000000000l000000000?0000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000007ooh00000007P000000000l000000000?000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000007ooh00000007P000000000l000000000O00000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000007ooh00000007`000000000l000000000O0000000000000000000000000000000000000000000000000000000000000000000007ooh00000007`000000";
-    sDataString += "000l000000000O0000000000000000000000000000000000000000000000000000000000000000000003P0000000007`000000000l000000000o000000000000";
-    sDataString += "000000000000000000000000000000000000000000000000000000000000000000007h000000000l000000001n00000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000003oP00000000l00000000?n0000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000003oP00000000l00000000?n000000000000000000000000000000000000000000000000000000000000000000000000000000001oP0000000";
-    sDataString += "0l00000000?l000000000000000000000000000000000000000000000000000000000000000000000000000000000oP00000000l00000000?h00000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000?000000000000000000?P0000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
-    sDataString += "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
+// returns the data for font nFontIndex, which must be in [ 0, NR_OF_SPRITE_FONTS )
+const FontData &GetFontData( int nFontIndex ) {
+    return glbFontData[nFontIndex];
 }
 
 //                                                                           //
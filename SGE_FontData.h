@@ -22,12 +22,17 @@
  * december 4, 2022
  */
 
-#include <iostream>
+#include <cstdint>
 
 //                          +--------------------+                           //
 // -------------------------+ MODULE DESCRIPTION +-------------------------- //
 //                          +--------------------+                           //
 
+/*
+ * This module contains the data of the built in sprite fonts. The data is compiled into the program as constant
+ * tables, so there's no work at all to get it at runtime - it's only decoded when a font is first used. Next to the
+ * encoded sprite data each font has a table with precomputed margins per character tile.
+ */
 
 //                               +-----------+                               //
 // ------------------------------+ CONSTANTS +------------------------------ //
@@ -36,29 +41,27 @@
 // nr of fonts implemented in data strings
 #define NR_OF_SPRITE_FONTS  6
 
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+// all info that is needed wrt a built in font
+struct FontData {
+    const char *sFileName;              // the name of the file the data was taken from (for testing)
+    int nCharsHor, nCharsVer;           // characters in the sprite - horizontally and vertically
+    int nTileSizeX, nTileSizeY;         // character tile sizes - horizontally and vertically
+    int nAsciiOffset;                   // not all fonts have the 'A' nicely at tile address 65
+    const char *const *pDataLines;      // the encoded sprite data - the lines must be concatenated
+    int nDataLines;
+    const uint8_t *pMargins;            // margins per character tile: left, right, top, bottom
+};
+
 //                              +------------+                               //
 // -----------------------------+ PROTOTYPES +------------------------------ //
 //                              +------------+                               //
 
-// This function loads all the info for the specified (nFontIndex) sprite font. It calls one of the
-// InitDataStringN() functions to populate the data string.
-void InitFontSprite(
-                int nFontIndex,                   // Input:  the index number for each font
-                std::string &sFontFileName,       // Output: the name of the file it was loaded from (for testing)
-                int &nCharsHor, int &nCharsVer,   //         characters in the sprite - horizontally and vertically
-                int &nTileSizeX, int &nTileSizeY, //         character tile sizes - horizontally and vertically
-                int &nAsciiOffset,                //         not all fonts have the 'A' nicely at tile address 65
-                std::string &sDataString          //         string to hold the data that normally a sprite file would
-            );
-
-// these functions load the data from a code string. The original data (sprite file) was transformed into such a
-// code string for this purpose. After completion, the data is put in sDataString.
-void InitDataString0( std::string &sDataString );    // font index: 0, file name:               ascii 128x128.tpbg.png
-void InitDataString1( std::string &sDataString );    // font index: 1, file name:                   nesfont 128x48.png
-void InitDataString2( std::string &sDataString );    // font index: 2, file name: font - unknown 512x512.tpbg.mono.png
-void InitDataString3( std::string &sDataString );    // font index: 3, file name:     font cells 512x512.tpbg.mono.png
-void InitDataString4( std::string &sDataString );    // font index: 4, file name:      bitmapfont openGL.tpbg.mono.png
-void InitDataString5( std::string &sDataString );    // font index: 5, file name:         simple font 610x650.tpbg.png
+// returns the data for the specified (nFontIndex) sprite font. The index must be in [ 0, NR_OF_SPRITE_FONTS )
+const FontData &GetFontData( int nFontIndex );
 
 //                                                                           //
 // ------------------------------------------------------------------------- //
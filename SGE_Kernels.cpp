@@ -0,0 +1,507 @@
+/* SGE_Kernels.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =====================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include    <cstdlib>
+#include     <cctype>
+#include    <cstring>
+#include     <string>
+#include  <algorithm>
+
+#include "SGE_Kernels.h"
+
+// The SIMD versions are only compiled for the architecture they belong to. With gcc and clang each of them gets a
+// target attribute, so that the whole file can be compiled without any -m flags (the kernels are only called after
+// the CPU was checked). Msvc doesn't need this, it accepts all intrinsics.
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ ) || defined( _M_IX86 )
+    #define SGE_X86_KERNELS
+    #include <immintrin.h>
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ ) || defined( _M_ARM64 )
+    #define SGE_NEON_KERNELS
+    #include <arm_neon.h>
+#endif
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+    #define SGE_TARGET( isa ) __attribute__(( target( isa ) ))
+#else
+    #define SGE_TARGET( isa )
+#endif
+
+// ==============================/ scalar kernels /==============================
+
+static void fill_scalar( uint32_t *pDst, uint32_t nColour, int n ) {
+    std::fill( pDst, pDst + n, nColour );
+}
+
+static void copy_scalar( uint32_t *pDst, const uint32_t *pSrc, int n ) {
+    std::memcpy( pDst, pSrc, size_t( n ) * sizeof( uint32_t ));
+}
+
+static void blend_scalar( uint32_t *pDst, const uint32_t *pSrc, int nSrcStep, int n, float fBlend ) {
+    for (int i = 0; i < n; i++, pSrc += nSrcStep)
+        pDst[i] = flc::blend_alpha( *pSrc, pDst[i], fBlend );
+}
+
+static void scale_scalar( uint32_t *pDst, const uint32_t *pSrc, const int *pIndex, int n ) {
+    for (int i = 0; i < n; i++)
+        pDst[i] = pSrc[ pIndex[i] ];
+}
+
+static void convert_scalar( uint32_t *pDst, const uint32_t *pSrc, int n ) {
+    for (int i = 0; i < n; i++) {
+        uint32_t c = pSrc[i];
+        pDst[i] = (c & 0xFF00FF00) | ((c >> 16) & 0x000000FF) | ((c & 0x000000FF) << 16);
+    }
+}
+
+static void expand_scalar( uint32_t *pDst, const uint8_t *pBits, int nBit, int n, uint32_t nColour ) {
+    for (int i = 0; i < n; i++, nBit++) {
+        if (pBits[ nBit >> 3 ] & (0x80 >> (nBit & 7)))
+            pDst[i] = nColour;
+    }
+}
+
+// The SIMD expand kernels process the mask a byte (8 pixels) at a time. This function does the pixels before the first
+// byte boundary, and returns how many that were.
+static inline int expand_head( uint32_t *pDst, const uint8_t *pBits, int nBit, int n, uint32_t nColour ) {
+    int nHead = std::min( n, (8 - (nBit & 7)) & 7 );
+    expand_scalar( pDst, pBits, nBit, nHead, nColour );
+    return nHead;
+}
+
+#ifdef SGE_X86_KERNELS
+
+// ==============================/ SSE2 kernels /==============================
+
+SGE_TARGET( "sse2" )
+static void fill_sse2( uint32_t *pDst, uint32_t nColour, int n ) {
+    __m128i vCol = _mm_set1_epi32( (int)nColour );
+    int i = 0;
+    for ( ; i + 4 <= n; i += 4)
+        _mm_storeu_si128( (__m128i *)(pDst + i), vCol );
+    for ( ; i < n; i++)
+        pDst[i] = nColour;
+}
+
+SGE_TARGET( "sse2" )
+static void copy_sse2( uint32_t *pDst, const uint32_t *pSrc, int n ) {
+    int i = 0;
+    for ( ; i + 8 <= n; i += 8) {
+        __m128i v0 = _mm_loadu_si128( (const __m128i *)(pSrc + i    ));
+        __m128i v1 = _mm_loadu_si128( (const __m128i *)(pSrc + i + 4));
+        _mm_storeu_si128( (__m128i *)(pDst + i    ), v0 );
+        _mm_storeu_si128( (__m128i *)(pDst + i + 4), v1 );
+    }
+    for ( ; i < n; i++)
+        pDst[i] = pSrc[i];
+}
+
+// The blend kernels do the same float calculations as blend_alpha(), in the same order, but on all four channels of
+// a pixel at once (lane 3 is alpha). The alpha lane of the result is patched in afterwards.
+SGE_TARGET( "sse2" )
+static inline uint32_t blend_pixel_sse2( uint32_t nSrc, uint32_t nDst, __m128 vBlend ) {
+    const __m128i vZero  = _mm_setzero_si128();
+    const __m128  v255   = _mm_set1_ps( 255.0f );
+    const __m128  vOne   = _mm_set1_ps( 1.0f );
+    const __m128  vAMask = _mm_castsi128_ps( _mm_set_epi32( -1, 0, 0, 0 ));
+
+    __m128 vS = _mm_cvtepi32_ps( _mm_unpacklo_epi16( _mm_unpacklo_epi8( _mm_cvtsi32_si128( (int)nSrc ), vZero ), vZero ));
+    __m128 vD = _mm_cvtepi32_ps( _mm_unpacklo_epi16( _mm_unpacklo_epi8( _mm_cvtsi32_si128( (int)nDst ), vZero ), vZero ));
+
+    __m128 vAlphaSrc = _mm_mul_ps( _mm_div_ps( _mm_shuffle_ps( vS, vS, 0xFF ), v255 ), vBlend );
+    __m128 vAlphaDst =             _mm_div_ps( _mm_shuffle_ps( vD, vD, 0xFF ), v255 );
+    __m128 vInvSrc   = _mm_sub_ps( vOne, vAlphaSrc );
+    __m128 vAlphaNew = _mm_add_ps( vAlphaSrc, _mm_mul_ps( vAlphaDst, vInvSrc ));
+
+    __m128 vRGB = _mm_div_ps( _mm_add_ps( _mm_mul_ps( vS, vAlphaSrc ), _mm_mul_ps( _mm_mul_ps( vD, vAlphaDst ), vInvSrc )), vAlphaNew );
+    __m128 vA   = _mm_mul_ps( vAlphaNew, v255 );
+    __m128 vRes = _mm_or_ps( _mm_andnot_ps( vAMask, vRGB ), _mm_and_ps( vAMask, vA ));
+
+    __m128i vInt = _mm_cvttps_epi32( vRes );
+    vInt = _mm_packs_epi32( vInt, vInt );
+    vInt = _mm_packus_epi16( vInt, vInt );
+    return (uint32_t)_mm_cvtsi128_si32( vInt );
+}
+
+SGE_TARGET( "sse2" )
+static void blend_sse2( uint32_t *pDst, const uint32_t *pSrc, int nSrcStep, int n, float fBlend ) {
+    __m128 vBlend = _mm_set1_ps( fBlend );
+    for (int i = 0; i < n; i++, pSrc += nSrcStep)
+        pDst[i] = blend_pixel_sse2( *pSrc, pDst[i], vBlend );
+}
+
+SGE_TARGET( "sse2" )
+static void convert_sse2( uint32_t *pDst, const uint32_t *pSrc, int n ) {
+    const __m128i vAG = _mm_set1_epi32( (int)0xFF00FF00 );
+    const __m128i vLo = _mm_set1_epi32( 0x000000FF );
+    int i = 0;
+    for ( ; i + 4 <= n; i += 4) {
+        __m128i v   = _mm_loadu_si128( (const __m128i *)(pSrc + i));
+        __m128i vRB = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( v, 16 ), vLo ), _mm_slli_epi32( _mm_and_si128( v, vLo ), 16 ));
+        _mm_storeu_si128( (__m128i *)(pDst + i), _mm_or_si128( _mm_and_si128( v, vAG ), vRB ));
+    }
+    convert_scalar( pDst + i, pSrc + i, n - i );
+}
+
+// each mask byte is spread over the lanes of two registers, and compared to the bit that belongs to each lane
+SGE_TARGET( "sse2" )
+static void expand_sse2( uint32_t *pDst, const uint8_t *pBits, int nBit, int n, uint32_t nColour ) {
+    const __m128i vCol = _mm_set1_epi32( (int)nColour );
+    const __m128i vHi  = _mm_setr_epi32( 0x80, 0x40, 0x20, 0x10 );
+    const __m128i vLo  = _mm_setr_epi32( 0x08, 0x04, 0x02, 0x01 );
+    int i = expand_head( pDst, pBits, nBit, n, nColour );
+    const uint8_t *pByte = pBits + ((nBit + i) >> 3);
+    for ( ; i + 8 <= n; i += 8, pByte++) {
+        if (*pByte == 0)
+            continue;
+        __m128i vByte = _mm_set1_epi32( *pByte );
+        __m128i vMask0 = _mm_cmpeq_epi32( _mm_and_si128( vByte, vHi ), vHi );
+        __m128i vMask1 = _mm_cmpeq_epi32( _mm_and_si128( vByte, vLo ), vLo );
+        __m128i vDst0 = _mm_loadu_si128( (const __m128i *)(pDst + i    ));
+        __m128i vDst1 = _mm_loadu_si128( (const __m128i *)(pDst + i + 4));
+        _mm_storeu_si128( (__m128i *)(pDst + i    ), _mm_or_si128( _mm_and_si128( vMask0, vCol ), _mm_andnot_si128( vMask0, vDst0 )));
+        _mm_storeu_si128( (__m128i *)(pDst + i + 4), _mm_or_si128( _mm_and_si128( vMask1, vCol ), _mm_andnot_si128( vMask1, vDst1 )));
+    }
+    expand_scalar( pDst + i, pBits, nBit + i, n - i, nColour );
+}
+
+// ==============================/ SSE4.1 kernels /==============================
+
+SGE_TARGET( "sse4.1" )
+static inline uint32_t blend_pixel_sse41( uint32_t nSrc, uint32_t nDst, __m128 vBlend ) {
+    const __m128 v255 = _mm_set1_ps( 255.0f );
+    const __m128 vOne = _mm_set1_ps( 1.0f );
+
+    __m128 vS = _mm_cvtepi32_ps( _mm_cvtepu8_epi32( _mm_cvtsi32_si128( (int)nSrc )));
+    __m128 vD = _mm_cvtepi32_ps( _mm_cvtepu8_epi32( _mm_cvtsi32_si128( (int)nDst )));
+
+    __m128 vAlphaSrc = _mm_mul_ps( _mm_div_ps( _mm_shuffle_ps( vS, vS, 0xFF ), v255 ), vBlend );
+    __m128 vAlphaDst =             _mm_div_ps( _mm_shuffle_ps( vD, vD, 0xFF ), v255 );
+    __m128 vInvSrc   = _mm_sub_ps( vOne, vAlphaSrc );
+    __m128 vAlphaNew = _mm_add_ps( vAlphaSrc, _mm_mul_ps( vAlphaDst, vInvSrc ));
+
+    __m128 vRGB = _mm_div_ps( _mm_add_ps( _mm_mul_ps( vS, vAlphaSrc ), _mm_mul_ps( _mm_mul_ps( vD, vAlphaDst ), vInvSrc )), vAlphaNew );
+    __m128 vRes = _mm_blend_ps( vRGB, _mm_mul_ps( vAlphaNew, v255 ), 0x08 );
+
+    __m128i vInt = _mm_cvttps_epi32( vRes );
+    vInt = _mm_packs_epi32( vInt, vInt );
+    vInt = _mm_packus_epi16( vInt, vInt );
+    return (uint32_t)_mm_cvtsi128_si32( vInt );
+}
+
+SGE_TARGET( "sse4.1" )
+static void blend_sse41( uint32_t *pDst, const uint32_t *pSrc, int nSrcStep, int n, float fBlend ) {
+    __m128 vBlend = _mm_set1_ps( fBlend );
+    for (int i = 0; i < n; i++, pSrc += nSrcStep)
+        pDst[i] = blend_pixel_sse41( *pSrc, pDst[i], vBlend );
+}
+
+// the byte shuffle is part of SSSE3, which is implied by SSE4.1
+SGE_TARGET( "sse4.1" )
+static void convert_sse41( uint32_t *pDst, const uint32_t *pSrc, int n ) {
+    const __m128i vShuffle = _mm_setr_epi8( 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15 );
+    int i = 0;
+    for ( ; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128( (const __m128i *)(pSrc + i));
+        _mm_storeu_si128( (__m128i *)(pDst + i), _mm_shuffle_epi8( v, vShuffle ));
+    }
+    convert_scalar( pDst + i, pSrc + i, n - i );
+}
+
+// ==============================/ AVX2 kernels /==============================
+
+SGE_TARGET( "avx2" )
+static void fill_avx2( uint32_t *pDst, uint32_t nColour, int n ) {
+    __m256i vCol = _mm256_set1_epi32( (int)nColour );
+    int i = 0;
+    for ( ; i + 8 <= n; i += 8)
+        _mm256_storeu_si256( (__m256i *)(pDst + i), vCol );
+    for ( ; i < n; i++)
+        pDst[i] = nColour;
+}
+
+SGE_TARGET( "avx2" )
+static void copy_avx2( uint32_t *pDst, const uint32_t *pSrc, int n ) {
+    int i = 0;
+    for ( ; i + 16 <= n; i += 16) {
+        __m256i v0 = _mm256_loadu_si256( (const __m256i *)(pSrc + i    ));
+        __m256i v1 = _mm256_loadu_si256( (const __m256i *)(pSrc + i + 8));
+        _mm256_storeu_si256( (__m256i *)(pDst + i    ), v0 );
+        _mm256_storeu_si256( (__m256i *)(pDst + i + 8), v1 );
+    }
+    for ( ; i < n; i++)
+        pDst[i] = pSrc[i];
+}
+
+// two pixels per iteration, one in each 128 bit half of the registers
+SGE_TARGET( "avx2" )
+static void blend_avx2( uint32_t *pDst, const uint32_t *pSrc, int nSrcStep, int n, float fBlend ) {
+    const __m256 v255   = _mm256_set1_ps( 255.0f );
+    const __m256 vOne   = _mm256_set1_ps( 1.0f );
+    const __m256 vBlend = _mm256_set1_ps( fBlend );
+
+    int i = 0;
+    for ( ; i + 2 <= n; i += 2, pSrc += 2 * nSrcStep) {
+        __m128i vSrc2 = _mm_unpacklo_epi32( _mm_cvtsi32_si128( (int)pSrc[0] ), _mm_cvtsi32_si128( (int)pSrc[nSrcStep] ));
+        __m128i vDst2 = _mm_loadl_epi64( (const __m128i *)(pDst + i));
+        __m256  vS = _mm256_cvtepi32_ps( _mm256_cvtepu8_epi32( vSrc2 ));
+        __m256  vD = _mm256_cvtepi32_ps( _mm256_cvtepu8_epi32( vDst2 ));
+
+        __m256 vAlphaSrc = _mm256_mul_ps( _mm256_div_ps( _mm256_shuffle_ps( vS, vS, 0xFF ), v255 ), vBlend );
+        __m256 vAlphaDst =                _mm256_div_ps( _mm256_shuffle_ps( vD, vD, 0xFF ), v255 );
+        __m256 vInvSrc   = _mm256_sub_ps( vOne, vAlphaSrc );
+        __m256 vAlphaNew = _mm256_add_ps( vAlphaSrc, _mm256_mul_ps( vAlphaDst, vInvSrc ));
+
+        __m256 vRGB = _mm256_div_ps( _mm256_add_ps( _mm256_mul_ps( vS, vAlphaSrc ), _mm256_mul_ps( _mm256_mul_ps( vD, vAlphaDst ), vInvSrc )), vAlphaNew );
+        __m256 vRes = _mm256_blend_ps( vRGB, _mm256_mul_ps( vAlphaNew, v255 ), 0x88 );
+
+        __m256i vInt = _mm256_cvttps_epi32( vRes );
+        vInt = _mm256_packs_epi32( vInt, vInt );
+        vInt = _mm256_packus_epi16( vInt, vInt );
+        pDst[i    ] = (uint32_t)_mm_cvtsi128_si32( _mm256_castsi256_si128( vInt ));
+        pDst[i + 1] = (uint32_t)_mm_cvtsi128_si32( _mm256_extracti128_si256( vInt, 1 ));
+    }
+    if (i < n)
+        pDst[i] = blend_pixel_sse41( *pSrc, pDst[i], _mm_set1_ps( fBlend ));
+}
+
+SGE_TARGET( "avx2" )
+static void scale_avx2( uint32_t *pDst, const uint32_t *pSrc, const int *pIndex, int n ) {
+    int i = 0;
+    for ( ; i + 8 <= n; i += 8) {
+        __m256i vIx = _mm256_loadu_si256( (const __m256i *)(pIndex + i));
+        _mm256_storeu_si256( (__m256i *)(pDst + i), _mm256_i32gather_epi32( (const int *)pSrc, vIx, 4 ));
+    }
+    for ( ; i < n; i++)
+        pDst[i] = pSrc[ pIndex[i] ];
+}
+
+SGE_TARGET( "avx2" )
+static void convert_avx2( uint32_t *pDst, const uint32_t *pSrc, int n ) {
+    const __m256i vShuffle = _mm256_setr_epi8( 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                               2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15 );
+    int i = 0;
+    for ( ; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256( (const __m256i *)(pSrc + i));
+        _mm256_storeu_si256( (__m256i *)(pDst + i), _mm256_shuffle_epi8( v, vShuffle ));
+    }
+    convert_scalar( pDst + i, pSrc + i, n - i );
+}
+
+// one mask byte per register, the masked store leaves the pixels of the cleared bits untouched
+SGE_TARGET( "avx2" )
+static void expand_avx2( uint32_t *pDst, const uint8_t *pBits, int nBit, int n, uint32_t nColour ) {
+    const __m256i vCol = _mm256_set1_epi32( (int)nColour );
+    const __m256i vBit = _mm256_setr_epi32( 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 );
+    int i = expand_head( pDst, pBits, nBit, n, nColour );
+    const uint8_t *pByte = pBits + ((nBit + i) >> 3);
+    for ( ; i + 8 <= n; i += 8, pByte++) {
+        if (*pByte == 0)
+            continue;
+        __m256i vMask = _mm256_cmpeq_epi32( _mm256_and_si256( _mm256_set1_epi32( *pByte ), vBit ), vBit );
+        _mm256_maskstore_epi32( (int *)(pDst + i), vMask, vCol );
+    }
+    expand_scalar( pDst + i, pBits, nBit + i, n - i, nColour );
+}
+
+#endif // SGE_X86_KERNELS
+
+#ifdef SGE_NEON_KERNELS
+
+// ==============================/ NEON kernels /==============================
+
+static void fill_neon( uint32_t *pDst, uint32_t nColour, int n ) {
+    uint32x4_t vCol = vdupq_n_u32( nColour );
+    int i = 0;
+    for ( ; i + 4 <= n; i += 4)
+        vst1q_u32( pDst + i, vCol );
+    for ( ; i < n; i++)
+        pDst[i] = nColour;
+}
+
+static void copy_neon( uint32_t *pDst, const uint32_t *pSrc, int n ) {
+    int i = 0;
+    for ( ; i + 8 <= n; i += 8) {
+        uint32x4_t v0 = vld1q_u32( pSrc + i     );
+        uint32x4_t v1 = vld1q_u32( pSrc + i + 4 );
+        vst1q_u32( pDst + i    , v0 );
+        vst1q_u32( pDst + i + 4, v1 );
+    }
+    for ( ; i < n; i++)
+        pDst[i] = pSrc[i];
+}
+
+// 32 bit ARM has no vector divide, so there the scalar blend is used
+#if defined( __aarch64__ ) || defined( _M_ARM64 )
+static void blend_neon( uint32_t *pDst, const uint32_t *pSrc, int nSrcStep, int n, float fBlend ) {
+    const float32x4_t v255 = vdupq_n_f32( 255.0f );
+    const float32x4_t vOne = vdupq_n_f32( 1.0f );
+    for (int i = 0; i < n; i++, pSrc += nSrcStep) {
+        float32x4_t vS = vcvtq_f32_u32( vmovl_u16( vget_low_u16( vmovl_u8( vcreate_u8( *pSrc  )))));
+        float32x4_t vD = vcvtq_f32_u32( vmovl_u16( vget_low_u16( vmovl_u8( vcreate_u8( pDst[i] )))));
+
+        float32x4_t vAlphaSrc = vmulq_n_f32( vdivq_f32( vdupq_laneq_f32( vS, 3 ), v255 ), fBlend );
+        float32x4_t vAlphaDst =              vdivq_f32( vdupq_laneq_f32( vD, 3 ), v255 );
+        float32x4_t vInvSrc   = vsubq_f32( vOne, vAlphaSrc );
+        float32x4_t vAlphaNew = vaddq_f32( vAlphaSrc, vmulq_f32( vAlphaDst, vInvSrc ));
+
+        float32x4_t vRGB = vdivq_f32( vaddq_f32( vmulq_f32( vS, vAlphaSrc ), vmulq_f32( vmulq_f32( vD, vAlphaDst ), vInvSrc )), vAlphaNew );
+        vRGB = vsetq_lane_f32( vgetq_lane_f32( vAlphaNew, 0 ) * 255.0f, vRGB, 3 );
+
+        uint16x4_t vWords = vqmovn_u32( vcvtq_u32_f32( vRGB ));
+        uint8x8_t  vBytes = vqmovn_u16( vcombine_u16( vWords, vWords ));
+        pDst[i] = vget_lane_u32( vreinterpret_u32_u8( vBytes ), 0 );
+    }
+}
+#else
+#define blend_neon blend_scalar
+#endif
+
+static void convert_neon( uint32_t *pDst, const uint32_t *pSrc, int n ) {
+    int i = 0;
+    for ( ; i + 16 <= n; i += 16) {
+        uint8x16x4_t v = vld4q_u8( (const uint8_t *)(pSrc + i));
+        uint8x16_t tmp = v.val[0];
+        v.val[0] = v.val[2];
+        v.val[2] = tmp;
+        vst4q_u8( (uint8_t *)(pDst + i), v );
+    }
+    convert_scalar( pDst + i, pSrc + i, n - i );
+}
+
+static void expand_neon( uint32_t *pDst, const uint8_t *pBits, int nBit, int n, uint32_t nColour ) {
+    const uint32x4_t vCol = vdupq_n_u32( nColour );
+    const uint32_t   nHi[4] = { 0x80, 0x40, 0x20, 0x10 };
+    const uint32_t   nLo[4] = { 0x08, 0x04, 0x02, 0x01 };
+    const uint32x4_t vHi = vld1q_u32( nHi );
+    const uint32x4_t vLo = vld1q_u32( nLo );
+    int i = expand_head( pDst, pBits, nBit, n, nColour );
+    const uint8_t *pByte = pBits + ((nBit + i) >> 3);
+    for ( ; i + 8 <= n; i += 8, pByte++) {
+        if (*pByte == 0)
+            continue;
+        uint32x4_t vByte = vdupq_n_u32( *pByte );
+        vst1q_u32( pDst + i    , vbslq_u32( vtstq_u32( vByte, vHi ), vCol, vld1q_u32( pDst + i     )));
+        vst1q_u32( pDst + i + 4, vbslq_u32( vtstq_u32( vByte, vLo ), vCol, vld1q_u32( pDst + i + 4 )));
+    }
+    expand_scalar( pDst + i, pBits, nBit + i, n - i, nColour );
+}
+
+#endif // SGE_NEON_KERNELS
+
+// ==============================/ kernel tables /==============================
+
+// the levels that have no specific version of a kernel use the one of the level below it
+static const flc::PixelKernels kernels_scalar = { fill_scalar, copy_scalar, blend_scalar, scale_scalar, convert_scalar, expand_scalar };
+#ifdef SGE_X86_KERNELS
+static const flc::PixelKernels kernels_sse2   = { fill_sse2,   copy_sse2,   blend_sse2,   scale_scalar, convert_sse2,   expand_sse2   };
+static const flc::PixelKernels kernels_sse41  = { fill_sse2,   copy_sse2,   blend_sse41,  scale_scalar, convert_sse41,  expand_sse2   };
+static const flc::PixelKernels kernels_avx2   = { fill_avx2,   copy_avx2,   blend_avx2,   scale_avx2,   convert_avx2,   expand_avx2   };
+#endif
+#ifdef SGE_NEON_KERNELS
+static const flc::PixelKernels kernels_neon   = { fill_neon,   copy_neon,   blend_neon,   scale_scalar, convert_neon,   expand_neon   };
+#endif
+
+//                           +------------------+                            //
+// --------------------------+ GLOBAL VARIABLES +--------------------------- //
+//                           +------------------+                            //
+
+flc::PixelKernels flc::glb_Kernels   = kernels_scalar;
+flc::SIMDLevel    flc::glb_SIMDLevel = flc::SIMD_SCALAR;
+
+//                              +------------+                               //
+// -----------------------------+ FUNCTIONS  +------------------------------ //
+//                              +------------+                               //
+
+flc::SIMDLevel flc::DetectSIMDLevel() {
+#if defined( SGE_X86_KERNELS )
+    if (SDL_HasAVX2())  return SIMD_AVX2;
+    if (SDL_HasSSE41()) return SIMD_SSE41;
+    if (SDL_HasSSE2())  return SIMD_SSE2;
+#elif defined( SGE_NEON_KERNELS )
+    #if defined( __aarch64__ ) || defined( _M_ARM64 )
+    // NEON is mandatory on 64 bit ARM
+    return SIMD_NEON;
+    #elif SDL_VERSION_ATLEAST( 2, 0, 6 )
+    if (SDL_HasNEON())  return SIMD_NEON;
+    #endif
+#endif
+    return SIMD_SCALAR;
+}
+
+const char *flc::SIMDLevelName( SIMDLevel level ) {
+    switch (level) {
+        case SIMD_SCALAR: return "scalar";
+        case SIMD_SSE2:   return "SSE2";
+        case SIMD_SSE41:  return "SSE4.1";
+        case SIMD_AVX2:   return "AVX2";
+        case SIMD_NEON:   return "NEON";
+    }
+    return "unknown";
+}
+
+// auxiliary function - parses the value of the SGE_SIMD environment variable. Returns false if it's not recognized.
+static bool parse_simd_level( const char *pValue, flc::SIMDLevel &level ) {
+    std::string s( pValue );
+    std::transform( s.begin(), s.end(), s.begin(), []( unsigned char c ) { return (char)std::tolower( c ); } );
+    if (s == "scalar" || s == "none") { level = flc::SIMD_SCALAR; return true; }
+    if (s == "sse2"                 ) { level = flc::SIMD_SSE2;   return true; }
+    if (s == "sse41" || s == "sse4.1") { level = flc::SIMD_SSE41;  return true; }
+    if (s == "avx2"                 ) { level = flc::SIMD_AVX2;   return true; }
+    if (s == "neon"                 ) { level = flc::SIMD_NEON;   return true; }
+    return false;
+}
+
+flc::SIMDLevel flc::InitPixelKernels() {
+
+    SIMDLevel nDetected = DetectSIMDLevel();
+    SIMDLevel nSelected = nDetected;
+
+    const char *pForced = std::getenv( "SGE_SIMD" );
+    if (pForced != nullptr && pForced[0] != '\0') {
+        SIMDLevel nForced;
+        if (!parse_simd_level( pForced, nForced )) {
+            std::cout << "WARNING: InitPixelKernels() --> unknown value for SGE_SIMD: " << pForced << std::endl;
+        } else if (nForced != SIMD_SCALAR && nForced != nDetected && (nDetected == SIMD_NEON || nForced > nDetected)) {
+            // the x86 levels are supersets of each other, NEON stands on it's own
+            std::cout << "WARNING: InitPixelKernels() --> SGE_SIMD level not supported on this CPU: " << pForced << std::endl;
+        } else {
+            nSelected = nForced;
+        }
+    }
+
+    switch (nSelected) {
+#ifdef SGE_X86_KERNELS
+        case SIMD_SSE2:  glb_Kernels = kernels_sse2;  break;
+        case SIMD_SSE41: glb_Kernels = kernels_sse41; break;
+        case SIMD_AVX2:  glb_Kernels = kernels_avx2;  break;
+#endif
+#ifdef SGE_NEON_KERNELS
+        case SIMD_NEON:  glb_Kernels = kernels_neon;  break;
+#endif
+        default:         glb_Kernels = kernels_scalar; nSelected = SIMD_SCALAR;
+    }
+    glb_SIMDLevel = nSelected;
+    return nSelected;
+}
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
@@ -0,0 +1,132 @@
+#ifndef SGE_KERNELS_H
+#define SGE_KERNELS_H
+
+/* SGE_Kernels.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * ===================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module contains the hot pixel kernels of the engine: the inner loops that fill, copy, blend, scale,
+ * convert and expand rows of pixels. Each kernel is available in a plain C++ version and in versions that use the SIMD
+ * instructions of the CPU (SSE2, SSE4.1 and AVX2 on x86, NEON on ARM).
+ *
+ * The best version that the CPU supports is selected at run time, in SDL_GameEngine::Construct(), and the kernels
+ * are called via the function pointers in glb_Kernels. So one executable runs on old and new hardware alike.
+ * The selection can be overruled by setting the environment variable SGE_SIMD to one of:
+ *
+ *     scalar, sse2, sse41, avx2, neon
+ *
+ * This is useful for testing and comparing the different code paths. A level that the CPU doesn't support is
+ * refused with a warning. The selected level is reported in the diagnostic output of Construct().
+ *
+ * NOTE - the SIMD kernels assume the ARGB8888 pixel format the engine uses (alpha in the most significant byte).
+ */
+
+#include <iostream>
+
+#include "SGE_Pixel.h"
+
+namespace flc {
+
+//                               +-----------+                               //
+// ------------------------------+ CONSTANTS +------------------------------ //
+//                               +-----------+                               //
+
+    // the instruction set levels, from low to high (NEON is separate from the x86 ones)
+    enum SIMDLevel {
+        SIMD_SCALAR = 0,
+        SIMD_SSE2,
+        SIMD_SSE41,
+        SIMD_AVX2,
+        SIMD_NEON
+    };
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    // the set of function pointers to the pixel kernels. All counts are in pixels.
+    struct PixelKernels {
+        // fills n pixels at pDst with nColour
+        void (*fill   )( uint32_t *pDst, uint32_t nColour, int n );
+        // copies n pixels from pSrc to pDst. The ranges must not overlap.
+        void (*copy   )( uint32_t *pDst, const uint32_t *pSrc, int n );
+        // alpha blends n pixels from pSrc onto pDst, where the source alpha is multiplied by fBlend (see blend_alpha()).
+        // pSrc is advanced nSrcStep pixels per pixel, so with nSrcStep == 0 one colour is blended onto the whole span
+        void (*blend  )( uint32_t *pDst, const uint32_t *pSrc, int nSrcStep, int n, float fBlend );
+        // gathers n pixels as pDst[i] = pSrc[ pIndex[i] ] - the inner loop of nearest neighbour scaling
+        void (*scale  )( uint32_t *pDst, const uint32_t *pSrc, const int *pIndex, int n );
+        // converts n pixels from ABGR8888 to ARGB8888 (or vice versa) by swapping the r and b channels. pDst may be pSrc.
+        void (*convert)( uint32_t *pDst, const uint32_t *pSrc, int n );
+        // sets the pixels pDst[i] for which bit (nBit + i) of the bit mask pBits is set to nColour, for i in [0, n).
+        // The bits are counted from the most significant bit of pBits[0] onwards. Used for 1 bit per pixel fonts.
+        void (*expand )( uint32_t *pDst, const uint8_t *pBits, int nBit, int n, uint32_t nColour );
+    };
+
+//                           +------------------+                            //
+// --------------------------+ GLOBAL VARIABLES +--------------------------- //
+//                           +------------------+                            //
+
+    // the kernels that are in use - these are the scalar versions until InitPixelKernels() is called
+    extern PixelKernels glb_Kernels;
+    // the instruction set level of the kernels in glb_Kernels
+    extern SIMDLevel    glb_SIMDLevel;
+
+//                              +------------+                               //
+// -----------------------------+ PROTOTYPES +------------------------------ //
+//                              +------------+                               //
+
+    // returns the highest level that is supported by both the CPU and the build
+    SIMDLevel DetectSIMDLevel();
+    // selects the kernels for the detected level (or the level forced by the SGE_SIMD environment variable),
+    // and returns the selected level
+    SIMDLevel InitPixelKernels();
+    // returns a printable name for level
+    const char *SIMDLevelName( SIMDLevel level );
+
+    // blends the source and the destination value according to alpha blending calculations, where the alpha of the
+    // source is additionally multiplied by fBlend. Returns the encoded resulting pixel. This is the reference that
+    // the blend kernels follow. See: https://en.wikipedia.org/wiki/Alpha_compositing
+    inline uint32_t blend_alpha( uint32_t srcCol, uint32_t dstCol, float fBlend ) {
+        flc::Pixel srcPix = flc::Pixel( srcCol );
+        flc::Pixel dstPix = flc::Pixel( dstCol );
+        // lerp new alpha value from src and dst alphas
+        float fAlpha_src = float( srcPix.getA()) / 255.0f * fBlend;
+        float fAlpha_dst = float( dstPix.getA()) / 255.0f;
+        float fAlpha_new = fAlpha_src + fAlpha_dst * ( 1.0f - fAlpha_src );
+        // lerp new rgb values using src and dst alpha, and divide by new alpha value
+        int nR_new = int(( float( srcPix.getR() ) * fAlpha_src + float( dstPix.getR() ) * fAlpha_dst * (1.0f - fAlpha_src) ) / fAlpha_new);
+        int nG_new = int(( float( srcPix.getG() ) * fAlpha_src + float( dstPix.getG() ) * fAlpha_dst * (1.0f - fAlpha_src) ) / fAlpha_new);
+        int nB_new = int(( float( srcPix.getB() ) * fAlpha_src + float( dstPix.getB() ) * fAlpha_dst * (1.0f - fAlpha_src) ) / fAlpha_new);
+        int nA_new = int( fAlpha_new * 255 );
+        return flc::Pixel( (uint8_t)nR_new, (uint8_t)nG_new, (uint8_t)nB_new, (uint8_t)nA_new ).Encode();
+    }
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_KERNELS_H
@@ -0,0 +1,408 @@
+/* SGE_PostProcess.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =========================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include     <cmath>
+#include <algorithm>
+#include   <cstring>
+
+#include "SGE_PostProcess.h"
+
+// NOTE - the blur and downsample passes treat the 4 bytes of a pixel as 4 independent channels, so they don't need to
+//        know the pixel format. Only the passes that need to know which channel is which use the glb_Xshift values.
+//        The blur and downsample passes work on the bytes of a row directly, using the auxiliary loops below. These
+//        have no branches and no per channel logic, so the compiler vectorizes them. The edges of the image are
+//        handled outside of these loops (by padding or clamping per row).
+
+// auxiliary - acc[i] += nWeight * byte i of pIn, for nBytes bytes
+static inline void mul_add_bytes( uint32_t *acc, const uint32_t *pIn, int nBytes, uint32_t nWeight ) {
+    const uint8_t *pB = (const uint8_t *)pIn;
+    for (int i = 0; i < nBytes; i++)
+        acc[i] += nWeight * pB[i];
+}
+
+// auxiliary - acc[i] += byte i of pAdd - byte i of pSub, for nBytes bytes
+static inline void add_sub_bytes( uint32_t *acc, const uint32_t *pAdd, const uint32_t *pSub, int nBytes ) {
+    const uint8_t *pA = (const uint8_t *)pAdd;
+    const uint8_t *pS = (const uint8_t *)pSub;
+    for (int i = 0; i < nBytes; i++)
+        acc[i] += uint32_t( pA[i] ) - uint32_t( pS[i] );
+}
+
+// auxiliary - byte i of pOut = (acc[i] * nMul + nBias) >> 16, for nBytes bytes. The caller makes sure the result fits
+static inline void scale_pack_bytes( uint32_t *pOut, const uint32_t *acc, int nBytes, uint32_t nMul, uint32_t nBias = 0 ) {
+    uint8_t *pO = (uint8_t *)pOut;
+    for (int i = 0; i < nBytes; i++)
+        pO[i] = uint8_t( (acc[i] * nMul + nBias) >> 16 );
+}
+
+// auxiliary - copies the row of w pixels into pPad, with nLeft resp. nRight copies of the edge pixels at both sides
+static inline void pad_row( uint32_t *pPad, const uint32_t *pIn, int w, int nLeft, int nRight ) {
+    std::fill( pPad, pPad + nLeft, pIn[0] );
+    std::copy( pIn, pIn + w, pPad + nLeft );
+    std::fill( pPad + nLeft + w, pPad + nLeft + w + nRight, pIn[w - 1] );
+}
+
+// ==============================/ Class PostProcessChain /==============================
+
+void flc::PostProcessChain::AddPass( PostProcessPass *pPass ) {
+    if (pPass == nullptr) {
+        std::cout << "ERROR: AddPass() --> can't handle nullptr argument!" << std::endl;
+    } else {
+        vPasses.push_back( pPass );
+    }
+}
+
+void flc::PostProcessChain::Clear() {
+    vPasses.clear();
+}
+
+uint32_t *flc::PostProcessChain::AcquireBuffer() {
+    for (int i = 0; i < (int)vBuffers.size(); i++) {
+        if (!vInUse[i]) {
+            vInUse[i] = true;
+            return vBuffers[i].data();
+        }
+    }
+    // NOTE - moving a std::vector doesn't move it's data, so pointers handed out earlier stay valid
+    vBuffers.emplace_back( size_t( nBufWidth ) * nBufHeight );
+    vInUse.push_back( true );
+    return vBuffers.back().data();
+}
+
+void flc::PostProcessChain::ReleaseBuffer( uint32_t *pBuffer ) {
+    for (int i = 0; i < (int)vBuffers.size(); i++) {
+        if (vBuffers[i].data() == pBuffer) {
+            vInUse[i] = false;
+            return;
+        }
+    }
+    std::cout << "ERROR: ReleaseBuffer() --> buffer doesn't belong to this chain" << std::endl;
+}
+
+void flc::PostProcessChain::ParallelBands( int nItems, const std::function<void( int, int )> &fnBand ) {
+    if (nItems <= 0)
+        return;
+    if (pThreadPool == nullptr) {
+        fnBand( 0, nItems );
+    } else {
+        int nBands = std::min( nItems, (pThreadPool->GetNrThreads() + 1) * 4 );
+        pThreadPool->ParallelFor( nBands, [=, &fnBand]( int nBand ) {
+            fnBand( int( int64_t( nItems ) * nBand / nBands ), int( int64_t( nItems ) * (nBand + 1) / nBands ));
+        } );
+    }
+}
+
+// The passes ping pong between two buffers from the pool. The first pass reads directly from the canvas, unless the
+// canvas rows are padded (then it's copied into a buffer first).
+const uint32_t *flc::PostProcessChain::Run( flc::Sprite *pCanvas, flc::ThreadPool *pPool ) {
+    SDL_Surface *pSrfce = pCanvas->GetSurfacePtr();
+    int w = pCanvas->width;
+    int h = pCanvas->height;
+    if (w != nBufWidth || h != nBufHeight) {
+        // (re)create the buffer pool for the canvas size
+        nBufWidth  = w;
+        nBufHeight = h;
+        vBuffers.clear();
+        vInUse.clear();
+    }
+    pThreadPool = pPool;
+
+    uint32_t *pPing = AcquireBuffer();
+    uint32_t *pPong = AcquireBuffer();
+
+    const uint32_t *pSrc = (const uint32_t *)pSrfce->pixels;
+    if (pSrfce->pitch != w * 4) {
+        for (int y = 0; y < h; y++) {
+            const uint32_t *pRow = (const uint32_t *)((const uint8_t *)pSrfce->pixels + y * pSrfce->pitch);
+            std::copy( pRow, pRow + w, pPong + y * w );
+        }
+        pSrc = pPong;
+    }
+    for (auto pPass : vPasses) {
+        pPass->Apply( pSrc, pPing, w, h, *this );
+        pSrc = pPing;
+        std::swap( pPing, pPong );
+    }
+    ReleaseBuffer( pPing );
+    ReleaseBuffer( pPong );
+    pThreadPool = nullptr;
+    // the buffer that pSrc points to is released, but it won't be touched until the next call to Run()
+    return pSrc;
+}
+
+// ==============================/ Class PP_BoxBlur /==============================
+
+flc::PP_BoxBlur::PP_BoxBlur( int radius ) {
+    if (radius < 0 || radius > nMaxRadius) {
+        std::cout << "WARNING: PP_BoxBlur() --> radius out of range [0, " << nMaxRadius << "]: " << radius << std::endl;
+        radius = std::clamp( radius, 0, nMaxRadius );
+    }
+    nRadius = radius;
+}
+
+// Horizontal pass per row with a running sum per channel, over a padded copy of the row. The vertical pass is done on bands
+// of columns, but row by row with a running sum per column, so that the memory is still accessed in row order.
+void flc::PP_BoxBlur::Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) {
+    int r = nRadius;
+    // reciprocal of the window size n in 16.16 fixed point, rounded down. The bias makes up for the rounding, so that a
+    // constant area keeps it's exact value: n * nInv + (65536 mod n) = 65536. The result can't exceed 255 this way, and
+    // it's exact for n <= 257 (hence the maximum radius of 128)
+    uint32_t nInv  = 65536 / (2 * r + 1);
+    uint32_t nBias = 255 * (65536 % (2 * r + 1));
+    uint32_t *pTmp = chain.AcquireBuffer();
+
+    chain.ParallelBands( h, [=]( int y0, int y1 ) {
+        std::vector<uint32_t> vPad( w + 2 * r + 1 );
+        for (int y = y0; y < y1; y++) {
+            pad_row( vPad.data(), pSrc + y * w, w, r, r + 1 );
+            const uint8_t *pB = (const uint8_t *)vPad.data();
+            uint8_t *pO = (uint8_t *)(pTmp + y * w);
+            // running sum per channel - the 4 channels are processed side by side
+            uint32_t sum[4] = { 0, 0, 0, 0 };
+            for (int i = 0; i <= 2 * r; i++)
+                for (int c = 0; c < 4; c++) sum[c] += pB[i * 4 + c];
+            for (int x = 0; x < w; x++) {
+                for (int c = 0; c < 4; c++) {
+                    pO[x * 4 + c] = uint8_t( (sum[c] * nInv + nBias) >> 16 );
+                    sum[c] += uint32_t( pB[(x + 2 * r + 1) * 4 + c] ) - uint32_t( pB[x * 4 + c] );
+                }
+            }
+        }
+    } );
+
+    chain.ParallelBands( w, [=]( int x0, int x1 ) {
+        int nBytes = (x1 - x0) * 4;
+        std::vector<uint32_t> vSum( nBytes, 0 );
+        for (int i = -r; i <= r; i++)
+            mul_add_bytes( vSum.data(), pTmp + std::clamp( i, 0, h - 1 ) * w + x0, nBytes, 1 );
+        for (int y = 0; y < h; y++) {
+            scale_pack_bytes( pDst + y * w + x0, vSum.data(), nBytes, nInv, nBias );
+            const uint32_t *pAdd = pTmp + std::min( y + r + 1, h - 1 ) * w + x0;
+            const uint32_t *pSub = pTmp + std::max( y - r, 0 ) * w + x0;
+            add_sub_bytes( vSum.data(), pAdd, pSub, nBytes );
+        }
+    } );
+
+    chain.ReleaseBuffer( pTmp );
+}
+
+// ==============================/ Class PP_GaussianBlur /==============================
+
+flc::PP_GaussianBlur::PP_GaussianBlur( float sigma ) {
+    if (sigma <= 0.0f) {
+        std::cout << "WARNING: PP_GaussianBlur() --> sigma must be > 0.0f: " << sigma << std::endl;
+        sigma = 0.01f;
+    }
+    nRadius = std::max( 1, (int)std::ceil( 3.0f * sigma ));
+    std::vector<float> vAux( 2 * nRadius + 1 );
+    float fSum = 0.0f;
+    for (int i = -nRadius; i <= nRadius; i++) {
+        vAux[i + nRadius] = std::exp( -float( i * i ) / (2.0f * sigma * sigma));
+        fSum += vAux[i + nRadius];
+    }
+    // convert to fixed point, and put the rounding error in the center weight so that the sum is exactly 65536
+    uint32_t nSum = 0;
+    vWeights.resize( vAux.size() );
+    for (int i = 0; i < (int)vAux.size(); i++) {
+        vWeights[i] = uint32_t( vAux[i] / fSum * 65536.0f );
+        nSum += vWeights[i];
+    }
+    vWeights[nRadius] += 65536 - nSum;
+}
+
+// Both passes are done row by row, so they can both be spread over the threads by rows. The horizontal pass adds the
+// weighted shifted copies of a padded row, the vertical pass accumulates whole rows. So in both passes the inner loop
+// runs over consecutive memory.
+void flc::PP_GaussianBlur::Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) {
+    uint32_t *pTmp = chain.AcquireBuffer();
+    int r = nRadius;
+    const uint32_t *pW = vWeights.data();
+
+    chain.ParallelBands( h, [=]( int y0, int y1 ) {
+        std::vector<uint32_t> vPad( w + 2 * r );
+        std::vector<uint32_t> vAcc( w * 4 );
+        for (int y = y0; y < y1; y++) {
+            pad_row( vPad.data(), pSrc + y * w, w, r, r );
+            std::fill( vAcc.begin(), vAcc.end(), 0 );
+            for (int k = 0; k <= 2 * r; k++)
+                mul_add_bytes( vAcc.data(), vPad.data() + k, w * 4, pW[k] );
+            scale_pack_bytes( pTmp + y * w, vAcc.data(), w * 4, 1 );
+        }
+    } );
+
+    chain.ParallelBands( h, [=]( int y0, int y1 ) {
+        std::vector<uint32_t> vAcc( w * 4 );
+        for (int y = y0; y < y1; y++) {
+            std::fill( vAcc.begin(), vAcc.end(), 0 );
+            for (int k = -r; k <= r; k++)
+                mul_add_bytes( vAcc.data(), pTmp + std::clamp( y + k, 0, h - 1 ) * w, w * 4, pW[k + r] );
+            scale_pack_bytes( pDst + y * w, vAcc.data(), w * 4, 1 );
+        }
+    } );
+
+    chain.ReleaseBuffer( pTmp );
+}
+
+// ==============================/ Class PP_Bloom /==============================
+
+flc::PP_Bloom::PP_Bloom( int threshold, float sigma, float intensity ) : cBlur( sigma ) {
+    nThreshold = threshold;
+    nIntensity = uint32_t( std::max( 0.0f, intensity ) * 256.0f );
+}
+
+// auxiliary - the bright pass of the bloom for n pixels. The parameters are passed by value (instead of captured by the
+// lambda's below), so that the compiler knows they don't change in the loop, and vectorizes it. Same for add_bloom().
+static void bright_pass( uint32_t *pDst, const uint32_t *pSrc, int n, int rs, int gs, int bs, uint32_t nAmask, int nThres ) {
+    for (int i = 0; i < n; i++) {
+        uint32_t p = pSrc[i];
+        int nLum = (77 * int( (p >> rs) & 0xFF ) + 150 * int( (p >> gs) & 0xFF ) + 29 * int( (p >> bs) & 0xFF )) >> 8;
+        pDst[i] = (nLum >= nThres) ? p : (p & nAmask);
+    }
+}
+
+// auxiliary - adds the blurred pixels pBlur with intensity nInt (8.8 fixed point) to the pixels pSrc, for n pixels
+static void add_bloom( uint32_t *pDst, const uint32_t *pSrc, const uint32_t *pBlur, int n, int rs, int gs, int bs, uint32_t nAmask, uint32_t nInt ) {
+    for (int i = 0; i < n; i++) {
+        uint32_t p = pSrc[i];
+        uint32_t q = pBlur[i];
+        uint32_t nR = std::min( 255u, ((p >> rs) & 0xFF) + ((((q >> rs) & 0xFF) * nInt) >> 8) );
+        uint32_t nG = std::min( 255u, ((p >> gs) & 0xFF) + ((((q >> gs) & 0xFF) * nInt) >> 8) );
+        uint32_t nB = std::min( 255u, ((p >> bs) & 0xFF) + ((((q >> bs) & 0xFF) * nInt) >> 8) );
+        pDst[i] = (p & nAmask) | (nR << rs) | (nG << gs) | (nB << bs);
+    }
+}
+
+void flc::PP_Bloom::Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) {
+    uint32_t *pBright  = chain.AcquireBuffer();
+    uint32_t *pBlurred = chain.AcquireBuffer();
+    int rs = glb_rshift, gs = glb_gshift, bs = glb_bshift;
+    uint32_t nAmask = glb_amask;
+    int nThres = nThreshold;
+    uint32_t nInt = nIntensity;
+
+    // 1. bright pass - keep the pixels with a luminance above the threshold, make the rest black
+    chain.ParallelBands( h, [=]( int y0, int y1 ) {
+        bright_pass( pBright + y0 * w, pSrc + y0 * w, (y1 - y0) * w, rs, gs, bs, nAmask, nThres );
+    } );
+    // 2. blur the bright pixels
+    cBlur.Apply( pBright, pBlurred, w, h, chain );
+    // 3. add the blurred bright pixels to the original (the alpha value of the original is kept)
+    chain.ParallelBands( h, [=]( int y0, int y1 ) {
+        add_bloom( pDst + y0 * w, pSrc + y0 * w, pBlurred + y0 * w, (y1 - y0) * w, rs, gs, bs, nAmask, nInt );
+    } );
+
+    chain.ReleaseBuffer( pBlurred );
+    chain.ReleaseBuffer( pBright );
+}
+
+// ==============================/ Class PP_ColourLUT /==============================
+
+flc::PP_ColourLUT::PP_ColourLUT( const std::function<int( int nChannel, int nValue )> &fnMap ) {
+    int shifts[3] = { glb_rshift, glb_gshift, glb_bshift };
+    for (int c = 0; c < 3; c++) {
+        for (int v = 0; v < 256; v++) {
+            lut[c][v] = uint32_t( std::clamp( fnMap( c, v ), 0, 255 )) << shifts[c];
+        }
+    }
+}
+
+void flc::PP_ColourLUT::Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) {
+    int rs = glb_rshift, gs = glb_gshift, bs = glb_bshift;
+    uint32_t nAmask = glb_amask;
+    const uint32_t (*pLut)[256] = lut;
+    chain.ParallelBands( h, [=]( int y0, int y1 ) {
+        for (int i = y0 * w; i < y1 * w; i++) {
+            uint32_t p = pSrc[i];
+            pDst[i] = (p & nAmask) | pLut[0][(p >> rs) & 0xFF] | pLut[1][(p >> gs) & 0xFF] | pLut[2][(p >> bs) & 0xFF];
+        }
+    } );
+}
+
+// ==============================/ Class PP_Scanlines /==============================
+
+// auxiliary - darkens the n pixels of a row with the factors fRow * pColF[x] (8.8 fixed point). The parameters are passed
+// by value so that the loop vectorizes (see bright_pass())
+static void darken_row( uint32_t *pOut, const uint32_t *pIn, const uint32_t *pColF, uint32_t fRow, int n, int rs, int gs, int bs, uint32_t nAmask ) {
+    for (int x = 0; x < n; x++) {
+        uint32_t f = (fRow * pColF[x]) >> 8;
+        uint32_t p = pIn[x];
+        pOut[x] = (p & nAmask) | (((((p >> rs) & 0xFF) * f) >> 8) << rs)
+                               | (((((p >> gs) & 0xFF) * f) >> 8) << gs)
+                               | (((((p >> bs) & 0xFF) * f) >> 8) << bs);
+    }
+}
+
+// The darkening factor of a pixel is the product of a row factor and a column factor (in 8.8 fixed point), so that the
+// vignette needs no per pixel calculations.
+void flc::PP_Scanlines::Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) {
+    auto vignette = [=]( int i, int n ) {
+        float t = (float( i ) + 0.5f) / float( n ) * 2.0f - 1.0f;
+        return std::clamp( 1.0f - fVignette * t * t, 0.0f, 1.0f );
+    };
+    std::vector<uint32_t> vColF( w ), vRowF( h );
+    for (int x = 0; x < w; x++)
+        vColF[x] = uint32_t( vignette( x, w ) * 256.0f );
+    for (int y = 0; y < h; y++)
+        vRowF[y] = uint32_t( vignette( y, h ) * ((y & 1) ? 1.0f - std::clamp( fDarken, 0.0f, 1.0f ) : 1.0f) * 256.0f );
+
+    int rs = glb_rshift, gs = glb_gshift, bs = glb_bshift;
+    uint32_t nAmask = glb_amask;
+    const uint32_t *pColF = vColF.data();
+    const uint32_t *pRowF = vRowF.data();
+    chain.ParallelBands( h, [=]( int y0, int y1 ) {
+        for (int y = y0; y < y1; y++)
+            darken_row( pDst + y * w, pSrc + y * w, pColF, pRowF[y], w, rs, gs, bs, nAmask );
+    } );
+}
+
+// ==============================/ Class PP_Downsample /==============================
+
+// The rows of a block row are added into column sums first (vectorized), then the column sums of each block are added.
+void flc::PP_Downsample::Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) {
+    int n = std::max( 1, nFactor );
+    int nBlockRows = (h + n - 1) / n;
+    chain.ParallelBands( nBlockRows, [=]( int b0, int b1 ) {
+        std::vector<uint32_t> vColSum( w * 4 );
+        for (int b = b0; b < b1; b++) {
+            int y0 = b * n, y1 = std::min( y0 + n, h );
+            std::fill( vColSum.begin(), vColSum.end(), 0 );
+            for (int y = y0; y < y1; y++)
+                mul_add_bytes( vColSum.data(), pSrc + y * w, w * 4, 1 );
+            for (int x0 = 0; x0 < w; x0 += n) {
+                int x1 = std::min( x0 + n, w );
+                uint32_t sum[4] = { 0, 0, 0, 0 };
+                for (int x = x0; x < x1; x++)
+                    for (int c = 0; c < 4; c++) sum[c] += vColSum[x * 4 + c];
+                uint32_t nCount = uint32_t( (y1 - y0) * (x1 - x0) );
+                uint8_t avg[4];
+                for (int c = 0; c < 4; c++) avg[c] = uint8_t( sum[c] / nCount );
+                uint32_t nAvg;
+                memcpy( &nAvg, avg, 4 );
+                for (int y = y0; y < y1; y++)
+                    std::fill( pDst + y * w + x0, pDst + y * w + x1, nAvg );
+            }
+        }
+    } );
+}
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
@@ -0,0 +1,180 @@
+#ifndef SGE_POSTPROCESS_H
+#define SGE_POSTPROCESS_H
+
+/* SGE_PostProcess.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =======================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module implements post processing on layer canvases. A post processing chain is a list of passes that
+ * is applied to the canvas of a layer in the render cycle, just before the canvas is uploaded to the GPU. The
+ * canvas itself is not altered: the chain renders into buffers of it's own, and the output of the last pass
+ * is uploaded instead of the canvas.
+ *
+ *   - PostProcessPass  - abstract base class for a pass. Derive from it to make your own passes.
+ *   - PostProcessChain - the list of passes for a layer, with a pool of (ping pong) buffers and the logic to
+ *                        spread the rows of a pass over the threads of the engine's thread pool.
+ *
+ * Available passes:
+ *   - PP_BoxBlur      - separable box blur with running sums
+ *   - PP_GaussianBlur - separable gaussian blur
+ *   - PP_Bloom        - bright pass, gaussian blur and additive composite
+ *   - PP_ColourLUT    - per channel lookup tables (colour grading, gamma, inversion...)
+ *   - PP_Scanlines    - darkened odd rows with optional vignette, for a CRT look
+ *   - PP_Downsample   - averages blocks of n x n pixels (pixelation)
+ *
+ * Usage: create the passes yourself, and add them to a layer with SDL_GameEngine::AddPostProcess(). The passes
+ * are not owned by the engine, so you must delete them yourself (in OnUserDestroy() for instance).
+ */
+
+#include <iostream>
+#include <vector>
+#include <functional>
+
+#include "SGE_Sprite.h"
+#include "SGE_ThreadPool.h"
+
+namespace flc {
+
+    class PostProcessChain;
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    class PostProcessPass {
+    public:
+        virtual ~PostProcessPass() {}
+        // processes the w x h pixels of pSrc into pDst. Both buffers are tightly packed (pitch == w) and never overlap.
+        // Use the chain to get temporary buffers and to spread the work over multiple threads.
+        virtual void Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) = 0;
+    };
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    class PostProcessChain {
+    public:
+        PostProcessChain() {}
+        ~PostProcessChain() {}
+
+        void AddPass( PostProcessPass *pPass );
+        void Clear();
+        bool IsEmpty() { return vPasses.empty(); }
+
+        // runs all passes on the canvas, and returns a pointer to the result (w * h pixels, pitch == w). The result is
+        // valid until the next call to Run()
+        const uint32_t *Run( flc::Sprite *pCanvas, flc::ThreadPool *pPool );
+
+        // for use by the passes: temporary buffers of the canvas size. Release them when done.
+        uint32_t *AcquireBuffer();
+        void      ReleaseBuffer( uint32_t *pBuffer );
+        // for use by the passes: divides [0, nItems) into bands, and calls fnBand( i0, i1 ) for each band in parallel
+        void ParallelBands( int nItems, const std::function<void( int, int )> &fnBand );
+
+    private:
+        std::vector<PostProcessPass *> vPasses;
+
+        // buffer pool - all buffers have the size of the canvas
+        int nBufWidth  = 0;
+        int nBufHeight = 0;
+        std::vector<std::vector<uint32_t>> vBuffers;
+        std::vector<bool>                  vInUse;
+
+        flc::ThreadPool *pThreadPool = nullptr;   // only valid during Run()
+    };
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    // box blur over (2 * radius + 1) pixels, first horizontally then vertically. The radius is clamped to [0, nMaxRadius]
+    class PP_BoxBlur : public PostProcessPass {
+    public:
+        static const int nMaxRadius = 128;
+
+        PP_BoxBlur( int radius = 2 );
+        void Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) override;
+    private:
+        int nRadius;
+    };
+
+    // gaussian blur with the specified standard deviation (in pixels). The kernel radius is 3 * sigma.
+    class PP_GaussianBlur : public PostProcessPass {
+    public:
+        PP_GaussianBlur( float sigma = 2.0f );
+        void Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) override;
+    private:
+        std::vector<uint32_t> vWeights;   // 2 * radius + 1 weights in 16.16 fixed point, summing up to 65536
+        int nRadius = 0;
+    };
+
+    // pixels with a luminance >= threshold (in [0, 255]) are blurred, and added to the original with the specified intensity
+    class PP_Bloom : public PostProcessPass {
+    public:
+        PP_Bloom( int threshold = 200, float sigma = 4.0f, float intensity = 1.0f );
+        void Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) override;
+    private:
+        int             nThreshold;
+        uint32_t        nIntensity;   // in 8.8 fixed point
+        PP_GaussianBlur cBlur;
+    };
+
+    // maps each of the r, g and b channels through a lookup table. The tables are filled upon construction, by calling
+    // fnMap( channel, value ) for each channel (0 = r, 1 = g, 2 = b) and each value in [0, 255]
+    class PP_ColourLUT : public PostProcessPass {
+    public:
+        PP_ColourLUT( const std::function<int( int nChannel, int nValue )> &fnMap );
+        void Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) override;
+    private:
+        uint32_t lut[3][256];   // the mapped values, already shifted into place
+    };
+
+    // darkens the odd rows by fDarken (in [0.0f, 1.0f]), and optionally darkens the edges with a vignette of strength fVignette
+    class PP_Scanlines : public PostProcessPass {
+    public:
+        PP_Scanlines( float fDarken = 0.4f, float fVignette = 0.0f ) : fDarken( fDarken ), fVignette( fVignette ) {}
+        void Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) override;
+    private:
+        float fDarken;
+        float fVignette;
+    };
+
+    // replaces each block of factor x factor pixels by it's average value - the size of the output is not altered
+    class PP_Downsample : public PostProcessPass {
+    public:
+        PP_Downsample( int factor = 2 ) : nFactor( factor ) {}
+        void Apply( const uint32_t *pSrc, uint32_t *pDst, int w, int h, PostProcessChain &chain ) override;
+    private:
+        int nFactor;
+    };
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_POSTPROCESS_H
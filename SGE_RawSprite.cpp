@@ -0,0 +1,235 @@
+/* SGE_RawSprite.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =======================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include  <climits>
+#include  <cstring>
+#include  <fstream>
+#include   <vector>
+#include <sys/stat.h>
+
+#if defined( _WIN32 )
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include    <fcntl.h>
+    #include   <unistd.h>
+#endif
+
+#include "SGE_RawSprite.h"
+
+static_assert( sizeof( flc::RawSpriteHeader ) == RAWSPRITE_ALIGN, "raw sprite header must be RAWSPRITE_ALIGN bytes" );
+
+// ==============================/ Class MappedFile /==============================
+
+flc::MappedFile::~MappedFile() {
+    Close();
+}
+
+#if defined( _WIN32 )
+
+bool flc::MappedFile::Open( const std::string &sFileName ) {
+    Close();
+    HANDLE hF = CreateFileA( sFileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if (hF == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER nFileSize;
+    if (!GetFileSizeEx( hF, &nFileSize ) || nFileSize.QuadPart == 0) {
+        CloseHandle( hF );
+        return false;
+    }
+    HANDLE hM = CreateFileMappingA( hF, nullptr, PAGE_WRITECOPY, 0, 0, nullptr );
+    if (hM == nullptr) {
+        CloseHandle( hF );
+        return false;
+    }
+    pData = (uint8_t *)MapViewOfFile( hM, FILE_MAP_COPY, 0, 0, 0 );
+    if (pData == nullptr) {
+        CloseHandle( hM );
+        CloseHandle( hF );
+        return false;
+    }
+    nSize    = size_t( nFileSize.QuadPart );
+    hFile    = hF;
+    hMapping = hM;
+    return true;
+}
+
+void flc::MappedFile::Close() {
+    if (pData != nullptr)
+        UnmapViewOfFile( pData );
+    if (hMapping != nullptr)
+        CloseHandle( (HANDLE)hMapping );
+    if (hFile != nullptr)
+        CloseHandle( (HANDLE)hFile );
+    pData    = nullptr;
+    nSize    = 0;
+    hFile    = nullptr;
+    hMapping = nullptr;
+}
+
+#else
+
+bool flc::MappedFile::Open( const std::string &sFileName ) {
+    Close();
+    int fd = open( sFileName.c_str(), O_RDONLY );
+    if (fd < 0)
+        return false;
+    struct stat sInfo;
+    if (fstat( fd, &sInfo ) != 0 || sInfo.st_size == 0) {
+        close( fd );
+        return false;
+    }
+    // a private mapping is copy on write, so it can be written to while the file is opened read only
+    void *p = mmap( nullptr, size_t( sInfo.st_size ), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );    // the mapping stays valid
+    if (p == MAP_FAILED)
+        return false;
+    pData = (uint8_t *)p;
+    nSize = size_t( sInfo.st_size );
+    return true;
+}
+
+void flc::MappedFile::Close() {
+    if (pData != nullptr)
+        munmap( pData, nSize );
+    pData = nullptr;
+    nSize = 0;
+}
+
+#endif
+
+// ==============================/ Raw sprite functions /==============================
+
+// auxiliary function - returns the modification time of a file, or -1 if it doesn't exist
+static long long file_time( const std::string &sFileName ) {
+    struct stat sInfo;
+    if (stat( sFileName.c_str(), &sInfo ) != 0)
+        return -1;
+    return (long long)sInfo.st_mtime;
+}
+
+bool flc::SaveRawSprite( Sprite *pSprite, const std::string &sRawFile ) {
+    if (pSprite == nullptr || pSprite->IsEmpty()) {
+        std::cout << "ERROR: SaveRawSprite() --> nullptr or empty sprite for file: " << sRawFile << std::endl;
+        return false;
+    }
+    SDL_Surface *pSrfce = pSprite->GetSurfacePtr();
+
+    RawSpriteHeader sHeader;
+    memset( &sHeader, 0, sizeof( sHeader ));
+    memcpy( sHeader.sMagic, RAWSPRITE_MAGIC, 8 );
+    sHeader.nWidth      = uint32_t( pSprite->width  );
+    sHeader.nHeight     = uint32_t( pSprite->height );
+    sHeader.nFormat     = SDL_PIXELFORMAT_ARGB8888;
+    sHeader.nPitch      = uint32_t( (pSprite->width * 4 + RAWSPRITE_ALIGN - 1) / RAWSPRITE_ALIGN * RAWSPRITE_ALIGN );
+    sHeader.nDataOffset = sizeof( sHeader );
+
+    std::ofstream ofs( sRawFile, std::ios::binary | std::ios::trunc );
+    if (!ofs.good()) {
+        std::cout << "ERROR: SaveRawSprite() --> can't open file for writing: " << sRawFile << std::endl;
+        return false;
+    }
+    ofs.write( (const char *)&sHeader, sizeof( sHeader ));
+    std::vector<uint8_t> vRow( sHeader.nPitch, 0 );
+    SDL_LockSurface( pSrfce );
+    for (int y = 0; y < pSprite->height; y++) {
+        memcpy( vRow.data(), (uint8_t *)pSrfce->pixels + y * pSrfce->pitch, pSprite->width * 4 );
+        ofs.write( (const char *)vRow.data(), vRow.size() );
+    }
+    SDL_UnlockSurface( pSrfce );
+    if (!ofs.good()) {
+        std::cout << "ERROR: SaveRawSprite() --> failure writing file: " << sRawFile << std::endl;
+        return false;
+    }
+    return true;
+}
+
+flc::Sprite *flc::LoadRawSprite( const std::string &sRawFile ) {
+    MappedFile *pMapping = new MappedFile;
+    if (!pMapping->Open( sRawFile )) {
+        std::cout << "ERROR: LoadRawSprite() --> can't map file: " << sRawFile << std::endl;
+        delete pMapping;
+        return nullptr;
+    }
+    // check the header, and that the file is large enough for all the rows. The sizes are checked in 64 bit, and must
+    // fit in an int (that's what SDL takes)
+    const RawSpriteHeader *pHeader = (const RawSpriteHeader *)pMapping->GetData();
+    bool bValid = pMapping->GetSize() >= sizeof( RawSpriteHeader ) &&
+                  memcmp( pHeader->sMagic, RAWSPRITE_MAGIC, 8 ) == 0 &&
+                  pHeader->nFormat == SDL_PIXELFORMAT_ARGB8888;
+    if (bValid) {
+        uint64_t nWidth  = pHeader->nWidth;
+        uint64_t nHeight = pHeader->nHeight;
+        uint64_t nPitch  = pHeader->nPitch;
+        uint64_t nOffset = pHeader->nDataOffset;
+        bValid = nWidth  > 0 && nWidth  <= INT_MAX / 4 &&
+                 nHeight > 0 && nHeight <= INT_MAX / 4 &&
+                 nPitch >= nWidth * 4 && nPitch <= INT_MAX && nPitch % RAWSPRITE_ALIGN == 0 &&
+                 nOffset >= sizeof( RawSpriteHeader ) && nOffset % RAWSPRITE_ALIGN == 0 &&
+                 uint64_t( pMapping->GetSize() ) >= nOffset + nPitch * nHeight;
+    }
+    if (!bValid) {
+        std::cout << "ERROR: LoadRawSprite() --> not a valid raw sprite file: " << sRawFile << std::endl;
+        delete pMapping;
+        return nullptr;
+    }
+    // the surface uses the mapped pixels as they are - SDL doesn't free them with the surface
+    SDL_Surface *pSrfce = SDL_CreateRGBSurfaceFrom(
+        pMapping->GetData() + pHeader->nDataOffset, int( pHeader->nWidth ), int( pHeader->nHeight ), 32, int( pHeader->nPitch ),
+        glb_rmask, glb_gmask, glb_bmask, glb_amask
+    );
+    if (pSrfce == nullptr) {
+        std::cout << "ERROR: LoadRawSprite() --> failure in SDL_CreateRGBSurfaceFrom(): " << SDL_GetError() << std::endl;
+        delete pMapping;
+        return nullptr;
+    }
+    Sprite *pSprite = new Sprite();
+    pSprite->SetSurface( pSrfce );
+    pSprite->m_Mapping = pMapping;
+    return pSprite;
+}
+
+bool flc::ConvertToRawSprite( const std::string &sImageFile, const std::string &sRawFile ) {
+    Sprite cImage( sImageFile );
+    if (cImage.IsEmpty())
+        return false;
+    return SaveRawSprite( &cImage, sRawFile.empty() ? sImageFile + RAWSPRITE_EXTENSION : sRawFile );
+}
+
+flc::Sprite *flc::LoadSpriteCached( const std::string &sImageFile ) {
+    std::string sRawFile  = sImageFile + RAWSPRITE_EXTENSION;
+    long long   nRawTime  = file_time( sRawFile   );
+    long long   nImgTime  = file_time( sImageFile );
+    if (nRawTime >= 0 && nRawTime >= nImgTime) {
+        Sprite *pSprite = LoadRawSprite( sRawFile );
+        if (pSprite != nullptr)
+            return pSprite;
+    }
+    // no (valid) raw file - load the image, and write the raw file for the next time
+    Sprite *pSprite = new Sprite( sImageFile );
+    if (pSprite->IsEmpty()) {
+        delete pSprite;
+        return nullptr;
+    }
+    SaveRawSprite( pSprite, sRawFile );
+    return pSprite;
+}
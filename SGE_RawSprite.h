@@ -0,0 +1,127 @@
+#ifndef SGE_RAWSPRITE_H
+#define SGE_RAWSPRITE_H
+
+/* SGE_RawSprite.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =====================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module implements a raw file format for sprites, that can be loaded without any decoding or conversion.
+ *
+ * Loading a png or jpg file means decompressing it, and converting the pixels to the pixel format of the engine. A raw
+ * sprite file contains the pixels exactly as they are in memory: a header of 64 bytes, followed by the rows of ARGB8888
+ * pixels. Each row starts at a multiple of 64 bytes. The file is memory mapped, and the sprite surface is built right
+ * on top of the mapped pixels, so loading costs next to nothing (the pages are read from disk when they are touched).
+ * The mapping is copy on write: drawing onto the sprite doesn't change the file.
+ *
+ *     ConvertToRawSprite( "tiles.png" );                          // writes "tiles.png.sgeraw"
+ *     flc::Sprite *pTiles = LoadRawSprite( "tiles.png.sgeraw" );
+ *
+ * or, to do the conversion on first use, and use the raw file from then on:
+ *
+ *     flc::Sprite *pTiles = LoadSpriteCached( "tiles.png" );
+ *
+ * LoadSpriteCached() converts again if the image file is newer than the raw file. Raw files are several times the size
+ * of the image files, so it's a trade of disk space for loading time.
+ *
+ * Header layout (all numbers are 32 bit, little endian - as in memory on the supported platforms):
+ *     magic "SGERAW01" (8 bytes), width, height, pixel format (SDL_PIXELFORMAT_ARGB8888), pitch (bytes per row, a
+ *     multiple of 64), offset of the first row (64), followed by zeroes up to 64 bytes.
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+
+#include "SGE_Sprite.h"
+
+//                               +-----------+                               //
+// ------------------------------+ CONSTANTS +------------------------------ //
+//                               +-----------+                               //
+
+#define RAWSPRITE_MAGIC      "SGERAW01"
+#define RAWSPRITE_ALIGN      64            // alignment of the header size and the rows, in bytes
+#define RAWSPRITE_EXTENSION  ".sgeraw"     // appended to the image file name by the conversion functions
+
+namespace flc {
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    // the header of a raw sprite file
+    struct RawSpriteHeader {
+        char     sMagic[8];
+        uint32_t nWidth;
+        uint32_t nHeight;
+        uint32_t nFormat;
+        uint32_t nPitch;
+        uint32_t nDataOffset;
+        uint8_t  nReserved[ RAWSPRITE_ALIGN - 28 ];
+    };
+
+    // A file that is mapped into memory (copy on write). The sprites that are loaded from raw files own their mapping.
+    class MappedFile {
+    public:
+        MappedFile() {}
+        ~MappedFile();
+
+        // maps the file into memory - returns false upon failure
+        bool Open( const std::string &sFileName );
+        void Close();
+
+        uint8_t *GetData() { return pData; }
+        size_t   GetSize() { return nSize; }
+
+    private:
+        uint8_t *pData = nullptr;
+        size_t   nSize = 0;
+#if defined( _WIN32 )
+        void    *hFile    = nullptr;    // the Windows handles of the file and the file mapping
+        void    *hMapping = nullptr;
+#endif
+    };
+
+//                              +------------+                               //
+// -----------------------------+ PROTOTYPES +------------------------------ //
+//                              +------------+                               //
+
+    // writes pSprite as a raw sprite file - returns false upon failure
+    bool SaveRawSprite( Sprite *pSprite, const std::string &sRawFile );
+    // maps a raw sprite file into memory, and returns a sprite on top of it (or nullptr upon failure)
+    Sprite *LoadRawSprite( const std::string &sRawFile );
+    // loads an image file (png, jpg, ...) and writes it as a raw sprite file. If sRawFile is empty, the name of the
+    // image file with RAWSPRITE_EXTENSION appended is used. Returns false upon failure
+    bool ConvertToRawSprite( const std::string &sImageFile, const std::string &sRawFile = "" );
+    // loads the raw sprite file that goes with sImageFile. If it doesn't exist yet (or is older than the image file) the
+    // image file is loaded, and the raw sprite file is written next to it for the next time.
+    Sprite *LoadSpriteCached( const std::string &sImageFile );
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_RAWSPRITE_H
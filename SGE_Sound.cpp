@@ -78,6 +78,7 @@ float       flc::Music::GetVolume() {   return m_MusicVolume; }
 
 // returns the name of the file that was used to load the music object
 std::string flc::Music::GetFileName() { return m_MusicFile;   }
+bool        flc::Music::IsEmpty()     { return m_MusicPtr == nullptr; }
 
 
 // ====================/   Chunk class   /==============================
@@ -120,6 +121,8 @@ void flc::Chunk::SetVolume(float value) {
 float       flc::Chunk::GetVolume() {   return m_ChunkVolume; }
 // returns the name of the file that was used to load the chunk object
 std::string flc::Chunk::GetFileName() { return m_ChunkFile;   }
+bool        flc::Chunk::IsEmpty()     { return m_ChunkPtr == nullptr; }
+int         flc::Chunk::GetSize()     { return m_ChunkPtr == nullptr ? 0 : int( m_ChunkPtr->alen ); }
 
 //                                                                           //
 // ------------------------------------------------------------------------- //
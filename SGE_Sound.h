@@ -73,6 +73,8 @@ namespace flc {
 
         // returns the name of the file that was used to load this music object
         std::string GetFileName();
+        // returns true if the music couldn't be loaded
+        bool IsEmpty();
 
     private:
         // hide the default constructor - make only the constructor with the file name
@@ -106,6 +108,10 @@ namespace flc {
 
         // returns the name of the file that was used to load this chunk object
         std::string GetFileName();
+        // returns true if the chunk couldn't be loaded
+        bool IsEmpty();
+        // returns the size of the (decoded) sound data in bytes
+        int GetSize();
 
     private:
         // hide the default constructor - make only the constructor with the file name
@@ -20,19 +20,56 @@
  *
  * Change trace:
  * 12/10/2022 - Little correction to flc::Sprite::Sample()
+ * 10/18/2026 - SpriteFont keeps all fonts that were used resident, with a decal per renderer. SetFont() only switches
+ *              the current font, the font data and margins are compiled into the code (see SGE_FontData)
+ * 10/18/2026 - fonts are stored as 1 bit per pixel bit masks, glyphs are drawn with the expand kernel. The font sprite
+ *              is only created when GetSprite() or GetDecal() is called
+ * 10/18/2026 - the font sheet is repacked into an atlas of the visible parts of the characters (see PackFontAtlas())
+ * 10/18/2026 - added the SDF mode to SpriteFont: characters are rendered from a signed distance field
+ * 10/18/2026 - added GetTextSize() with a cache of measured strings
+ * 10/18/2026 - added GetCharSize() to SpriteFont and an UpdateSprite() for a part of the decal (used by ConsoleGrid)
+ * 10/18/2026 - decals can be a part of a shared texture (m_origin), for the decals of an atlas (see SGE_DecalAtlas)
+ * 10/18/2026 - a sprite can own the memory mapped file of it's pixels (see SGE_RawSprite)
+ * 10/18/2026 - all pixel access takes the pitch into account (GetPixel() and SetPixel() used the width resp. the
+ *              height as row length). Added RowPtr()
+ * 10/18/2026 - sprites are created with rows aligned on SPRITE_ROW_ALIGN bytes
+ * 10/18/2026 - added GetPixelRaw(), SetPixelRaw(), ReadRect(), WriteRect() and GetView() (struct PixelView)
+ * 10/18/2026 - SpriteFont::GetSprite() returns the font sheet in it's tile layout again, the atlas is available via
+ *              GetAtlasSprite()
  */
 
 #include "SGE_Sprite.h"
 
-#include  <cmath>
-#include <string>
+#include     <cmath>
+#include <algorithm>
+#include    <string>
+#include   <cstring>
+#include     <mutex>
 
 #include       <SDL.h>
 #include <SDL_image.h>
 
 #include  "SGE_FontData.h"
+#include   "SGE_Kernels.h"
+#include "SGE_RawSprite.h"
 #include "SGE_Utilities.h"
 
+// auxiliary functions - allocate resp. free a block of memory that is aligned on nAlign bytes (a power of 2). The
+// address that malloc() returned is stored just in front of the aligned block.
+static void *alloc_aligned( size_t nSize, size_t nAlign ) {
+    void *pRaw = malloc( nSize + nAlign + sizeof( void * ));
+    if (pRaw == nullptr)
+        return nullptr;
+    uintptr_t nAligned = (uintptr_t( pRaw ) + sizeof( void * ) + nAlign - 1) & ~uintptr_t( nAlign - 1 );
+    ((void **)nAligned)[-1] = pRaw;
+    return (void *)nAligned;
+}
+
+static void free_aligned( void *p ) {
+    if (p != nullptr)
+        free( ((void **)p)[-1] );
+}
+
 // ==============================/ Class Sprite /==============================
 
 //                           +------------------+                            //
@@ -54,6 +91,36 @@ flc::Sprite::~Sprite() {
     }
     m_SurfacePtr = nullptr;
     m_ColData    = nullptr;
+    InvalidateRLE();
+    // the surface is gone, so the memory mapped resp. allocated pixels can be released
+    delete m_Mapping;
+    m_Mapping    = nullptr;
+    free_aligned( m_PixelBuffer );
+    m_PixelBuffer = nullptr;
+}
+
+// Creates the surface with a pitch that is a multiple of SPRITE_ROW_ALIGN, on a buffer that is aligned likewise. SDL doesn't
+// free the pixels of a surface that is created on an existing buffer, so the sprite frees the buffer in it's destructor.
+bool flc::Sprite::CreateAlignedSurface( int w, int h ) {
+    int nPitch = (std::max( w, 1 ) * 4 + SPRITE_ROW_ALIGN - 1) / SPRITE_ROW_ALIGN * SPRITE_ROW_ALIGN;
+    void *pBuffer = alloc_aligned( size_t( nPitch ) * std::max( h, 1 ), SPRITE_ROW_ALIGN );
+    if (pBuffer == nullptr) {
+        std::cout << "ERROR: Sprite() --> can't allocate pixels for size: " << w << " x " << h << std::endl;
+        return false;
+    }
+    memset( pBuffer, 0, size_t( nPitch ) * std::max( h, 1 ));
+    SDL_Surface *pSrfce = SDL_CreateRGBSurfaceFrom( pBuffer, w, h, 32, nPitch, glb_rmask, glb_gmask, glb_bmask, glb_amask );
+    if (pSrfce == nullptr) {
+        std::cout << "ERROR: Sprite() --> failure in SDL_CreateRGBSurfaceFrom(): " << SDL_GetError() << std::endl;
+        free_aligned( pBuffer );
+        return false;
+    }
+    m_SurfacePtr  = pSrfce;
+    m_PixelBuffer = pBuffer;
+    m_ColData     = (uint32_t *)pBuffer;
+    width         = w;
+    height        = h;
+    return true;
 }
 
 // Creates a sprite object based upon the file specified by sFilename.
@@ -70,8 +137,29 @@ flc::Sprite::Sprite( std::string sFileName ) {
         m_ColData = nullptr;
     } else {
 
-        //Convert surface to screen format to enhance performance
-        m_SurfacePtr = SDL_ConvertSurface( rawSurface, glbPixelFormatPtr, 0 );
+        //Convert surface to screen format to enhance performance - the result is put in a surface with aligned rows
+        if (rawSurface->format->format == SDL_PIXELFORMAT_ABGR8888 && glbPixelFormatPtr->format == SDL_PIXELFORMAT_ARGB8888) {
+            // 32 bit RGBA images (most png files) only need their r and b channels swapped - let the convert kernel do that
+            if (CreateAlignedSurface( rawSurface->w, rawSurface->h )) {
+                SDL_LockSurface( rawSurface );
+                for (int y = 0; y < rawSurface->h; y++) {
+                    glb_Kernels.convert( RowPtr( y ), (uint32_t *)((uint8_t *)rawSurface->pixels + y * rawSurface->pitch), rawSurface->w );
+                }
+                SDL_UnlockSurface( rawSurface );
+            }
+        } else {
+            SDL_Surface *convSurface = SDL_ConvertSurface( rawSurface, glbPixelFormatPtr, 0 );
+            if (convSurface != nullptr) {
+                if (CreateAlignedSurface( convSurface->w, convSurface->h )) {
+                    SDL_LockSurface( convSurface );
+                    for (int y = 0; y < convSurface->h; y++) {
+                        glb_Kernels.copy( RowPtr( y ), (uint32_t *)((uint8_t *)convSurface->pixels + y * convSurface->pitch), convSurface->w );
+                    }
+                    SDL_UnlockSurface( convSurface );
+                }
+                SDL_FreeSurface( convSurface );
+            }
+        }
         //Get rid of old loaded surface
         SDL_FreeSurface( rawSurface );
 
@@ -94,39 +182,12 @@ flc::Sprite::Sprite( std::string sFileName ) {
     }
 }
 
-// create an empty sprite of the specified width and height
+// create an empty sprite of the specified width and height - all pixels are 0 (blank)
 flc::Sprite::Sprite( int w, int h ) {
-
-    // create a new surface as the sprite
-    SDL_Surface *rawSurface = SDL_CreateRGBSurface(
-                                  0,            // unused flags, should be set to 0
-                                  w,            // width of surface
-                                  h,            // height of surface
-                                  32,           // depth of surface in bits (typically set to 32)
-                                  glb_rmask,    // mask for r value
-                                  glb_gmask,    //          g
-                                  glb_bmask,    //          b
-                                  glb_amask     //          a
-                              );
-    if (rawSurface == nullptr) {
-        std::cout << "ERROR: Sprite( width, height ) during call to SDL_CreateRGBSurface(): " << SDL_GetError() << std::endl;
+    if (!CreateAlignedSurface( w, h )) {
         m_ColData = nullptr;
         width  = 0;
         height = 0;
-    } else {
-        m_SurfacePtr = SDL_ConvertSurface( rawSurface, glbPixelFormatPtr, 0 );
-        SDL_FreeSurface( rawSurface );
-        rawSurface = nullptr;
-        if (m_SurfacePtr == nullptr) {
-            std::cout << "ERROR: Sprite( width, height ) during call to SDL_ConvertSurface(): " << SDL_GetError() << std::endl;
-            m_ColData = nullptr;
-            width  = 0;
-            height = 0;
-        } else {
-            m_ColData = (uint32_t *)m_SurfacePtr->pixels;
-            width  = m_SurfacePtr->w;
-            height = m_SurfacePtr->h;
-        }
     }
 }
 
@@ -147,7 +208,7 @@ flc::Pixel flc::Sprite::GetPixel( int x, int y ) {
     }
     // read the pixel value as a uint32_t from the sprite data
     SDL_LockSurface( m_SurfacePtr );
-    uint32_t pixelValue = m_ColData[ y * width + x ];
+    uint32_t pixelValue = RowPtr( y )[x];
     SDL_UnlockSurface( m_SurfacePtr );
     // build pixel and return it
     return flc::Pixel( pixelValue );
@@ -165,8 +226,9 @@ void flc::Sprite::SetPixel( int x, int y, flc::Pixel pix ) {
         uint32_t pixelValue = pix.Encode();
         // write the pixel value as a uint32_t into the sprite data
         SDL_LockSurface( m_SurfacePtr );
-        m_ColData[ y * height + x ] = pixelValue;
+        RowPtr( y )[x] = pixelValue;
         SDL_UnlockSurface( m_SurfacePtr );
+        InvalidateRLE();
     }
 }
 
@@ -192,6 +254,56 @@ bool flc::Sprite::IsEmpty() {
     return (m_SurfacePtr == nullptr);
 }
 
+// internal function - checks the rectangle and buffer that are passed to ReadRect() and WriteRect()
+static bool rect_in_sprite( const char *sFunc, flc::Sprite *pSprite, int x, int y, int w, int h, const void *pBuffer ) {
+    if (pSprite->IsEmpty() || pBuffer == nullptr) {
+        std::cout << "ERROR: " << sFunc << "() --> empty sprite or nullptr buffer" << std::endl;
+        return false;
+    }
+    if (x < 0 || y < 0 || w < 0 || h < 0 || x + w > pSprite->width || y + h > pSprite->height) {
+        std::cout << "ERROR: " << sFunc << "() --> rectangle (" << x << ", " << y << ", " << w << ", " << h << ") not within sprite of size: "
+                  << pSprite->width << " x " << pSprite->height << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool flc::Sprite::ReadRect( int x, int y, int w, int h, uint32_t *pBuffer, int nBufStride ) {
+    if (!rect_in_sprite( "ReadRect", this, x, y, w, h, pBuffer ))
+        return false;
+    if (nBufStride <= 0) nBufStride = w;
+    SDL_LockSurface( m_SurfacePtr );
+    for (int r = 0; r < h; r++) {
+        glb_Kernels.copy( pBuffer + r * nBufStride, RowPtr( y + r ) + x, w );
+    }
+    SDL_UnlockSurface( m_SurfacePtr );
+    return true;
+}
+
+bool flc::Sprite::WriteRect( int x, int y, int w, int h, const uint32_t *pBuffer, int nBufStride ) {
+    if (!rect_in_sprite( "WriteRect", this, x, y, w, h, pBuffer ))
+        return false;
+    if (nBufStride <= 0) nBufStride = w;
+    SDL_LockSurface( m_SurfacePtr );
+    for (int r = 0; r < h; r++) {
+        glb_Kernels.copy( RowPtr( y + r ) + x, pBuffer + r * nBufStride, w );
+    }
+    SDL_UnlockSurface( m_SurfacePtr );
+    InvalidateRLE();
+    return true;
+}
+
+flc::PixelView flc::Sprite::GetView() {
+    PixelView view;
+    if (m_SurfacePtr != nullptr) {
+        view.pData   = (uint32_t *)m_SurfacePtr->pixels;
+        view.nWidth  = width;
+        view.nHeight = height;
+        view.nStride = m_SurfacePtr->pitch / 4;
+    }
+    return view;
+}
+
 SDL_Surface *flc::Sprite::GetSurfacePtr() {
     return m_SurfacePtr;
 }
@@ -205,9 +317,68 @@ void flc::Sprite::SetSurface( SDL_Surface *pSurf ) {
         m_ColData    = (uint32_t *)pSurf->pixels;
         width  = pSurf->w;
         height = pSurf->h;
+        InvalidateRLE();
     }
 }
 
+// guards the lazy building and the invalidation of the run length encoding, since a sprite can be drawn by multiple
+// DrawContexts at once
+static std::mutex glbRLEMutex;
+
+// builds the run length encoded representation of this sprite (if it isn't there yet) and returns a pointer to it
+std::shared_ptr<flc::SpriteRLE> flc::Sprite::GetRLE() {
+    std::lock_guard<std::mutex> lock( glbRLEMutex );
+    if (m_RLE == nullptr && m_SurfacePtr != nullptr) {
+        m_RLE = std::make_shared<SpriteRLE>();
+        m_RLE->vRowIx.reserve( height + 1 );
+
+        uint32_t nAmask = glb_amask;
+        int nPitch = m_SurfacePtr->pitch / 4;
+        SDL_LockSurface( m_SurfacePtr );
+        for (int y = 0; y < height; y++) {
+            m_RLE->vRowIx.push_back( (int)m_RLE->vRuns.size() );
+            uint32_t *pRow = m_ColData + y * nPitch;
+            int x = 0;
+            while (x < width) {
+                uint32_t nAlpha = pRow[x] & nAmask;
+                if (nAlpha == 0) {
+                    // transparent pixels are not stored
+                    x++;
+                } else {
+                    // collect the run of pixels that are all opaque, or all partially transparent
+                    SpriteRLE::Run run;
+                    run.x       = x;
+                    run.bOpaque = (nAlpha == nAmask);
+                    while (x < width) {
+                        nAlpha = pRow[x] & nAmask;
+                        if (nAlpha == 0 || (nAlpha == nAmask) != run.bOpaque)
+                            break;
+                        x++;
+                    }
+                    run.len = x - run.x;
+                    m_RLE->vRuns.push_back( run );
+                }
+            }
+        }
+        m_RLE->vRowIx.push_back( (int)m_RLE->vRuns.size() );
+        SDL_UnlockSurface( m_SurfacePtr );
+    }
+    return m_RLE;
+}
+
+// discards the run length encoded representation, it will be rebuilt upon the next call to GetRLE(). A DrawContext that
+// is drawing from it keeps it's own reference, so it's only freed once that drawing is done.
+void flc::Sprite::InvalidateRLE() {
+    std::lock_guard<std::mutex> lock( glbRLEMutex );
+    m_RLE.reset();
+}
+
+void flc::Sprite::EnableRLE( bool bEnable ) {
+    m_bUseRLE = bEnable;
+    if (!bEnable)
+        InvalidateRLE();
+}
+
 // create an exact duplicate of this sprite and return a pointer to it
 flc::Sprite* flc::Sprite::Duplicate() {
 
@@ -259,7 +430,7 @@ flc::Decal::Decal( flc::Sprite *spritePtr, bool bFilter, bool bClamp ) {
 
 // NOTE: the associated sprite is not disposed by this destructor
 flc::Decal::~Decal() {
-    if (m_decal != nullptr) {
+    if (m_decal != nullptr && m_bOwnsTexture) {
         SDL_DestroyTexture( m_decal );
         m_decal = nullptr;
     }
@@ -279,6 +450,17 @@ flc::Decal::Decal(const uint32_t nExistingTextureResource, flc::Sprite* spr) {
     // no implementation (yet)
 }
 
+flc::Decal::Decal( flc::Decal *pAtlas, flc::Sprite *spr, int x, int y ) {
+    if (pAtlas == nullptr || spr == nullptr) {
+        std::cout << "ERROR: Decal() --> can't construct with a nullptr atlas or sprite pointer argument " << std::endl;
+    } else {
+        m_sprite = spr;
+        m_decal  = pAtlas->m_decal;
+        InitSDL_Point( m_origin, x, y );
+        m_bOwnsTexture = false;
+    }
+}
+
 void flc::Decal::Update() {
     // NOTE: JavidX9 performs some actions on the scaling of the decal before Updating the sprite...?
     // this is not implemented yet - so Update() is identical to UpdateSprite()
@@ -287,7 +469,24 @@ void flc::Decal::Update() {
 
 void flc::Decal::UpdateSprite() {
     SDL_Surface *spriteSurface = m_sprite->GetSurfacePtr();
-    SDL_UpdateTexture( m_decal, nullptr, spriteSurface->pixels, spriteSurface->pitch );
+    if (m_bOwnsTexture) {
+        SDL_UpdateTexture( m_decal, nullptr, spriteSurface->pixels, spriteSurface->pitch );
+    } else {
+        SDL_Rect sRect;
+        InitSDL_Rect( sRect, m_origin.x, m_origin.y, m_sprite->width, m_sprite->height );
+        SDL_UpdateTexture( m_decal, &sRect, spriteSurface->pixels, spriteSurface->pitch );
+    }
+}
+
+void flc::Decal::UpdateSprite( const SDL_Rect &rect ) {
+    SDL_Surface *spriteSurface = m_sprite->GetSurfacePtr();
+    SDL_Rect sRect;
+    if (!SDL_IntersectRect( &rect, &spriteSurface->clip_rect, &sRect ))
+        return;
+    uint8_t *pPixels = (uint8_t *)spriteSurface->pixels + sRect.y * spriteSurface->pitch + sRect.x * 4;
+    sRect.x += m_origin.x;
+    sRect.y += m_origin.y;
+    SDL_UpdateTexture( m_decal, &sRect, pPixels, spriteSurface->pitch );
 }
 
 // ==============================/ Class SpriteFont /==============================
@@ -298,17 +497,25 @@ void flc::Decal::UpdateSprite() {
 
 // default constructor
 flc::SpriteFont::SpriteFont() {
-    fontSprite = nullptr;
-    fontDecal  = nullptr;
+    vFaces.resize( NR_OF_SPRITE_FONTS, nullptr );
 }
 
 // default destructor
 flc::SpriteFont::~SpriteFont() {
-    delete fontSprite;
-    delete fontDecal ;
-    fontSprite = nullptr;
-    fontDecal  = nullptr;
-    vMargins.clear();
+    for (auto &pElt : vFaces) {
+        if (pElt != nullptr) {
+            for (auto &d : pElt->vDecals)
+                delete d.second;
+            for (auto &d : pElt->vSDFDecals)
+                delete d.second;
+            delete pElt->pSprite;
+            delete pElt->pSheetSprite;
+            delete pElt->pSDFSprite;
+            delete pElt;
+            pElt = nullptr;
+        }
+    }
+    pFace = nullptr;
 }
 
 //                               +----------+                                //
@@ -316,150 +523,181 @@ flc::SpriteFont::~SpriteFont() {
 //                               +----------+                                //
 
 // select the sprite font indexed by the input parameter. If the index is out of range
-// of [ 0, NR_OF_SPRITE_FONTS ] the default index 0 will be used
+// of [ 0, NR_OF_SPRITE_FONTS ] the default index 0 will be used. A font is only loaded the
+// first time it is selected, after that selecting it is just a pointer switch.
 void flc::SpriteFont::SetFont( int index ) {
 
     if (index < 0 || index >= NR_OF_SPRITE_FONTS) {
         std::cout << "WARNING: SpriteFont( i ) - index out of range: " << index << ", using default font" << std::endl;
         index = 0;
     }
+    // the string functions may run on other threads, so don't switch fonts while they draw
+    std::lock_guard<std::mutex> lock( mtxDraw );
+    if (vFaces[index] == nullptr)
+        vFaces[index] = LoadFontFace( index );
+
+    pFace      = vFaces[index];
+    nFontIndex = index;
+    if (eMode == SDF && pFace->vSDF.empty())
+        BuildSDFAtlas( pFace );
+}
+
+// selects bitmap or SDF rendering. The distance field of a font is generated the first time it's used in SDF mode.
+void flc::SpriteFont::SetMode( Mode eNewMode ) {
+    std::lock_guard<std::mutex> lock( mtxDraw );
+    eMode = eNewMode;
+    if (eMode == SDF && pFace != nullptr && pFace->vSDF.empty())
+        BuildSDFAtlas( pFace );
+}
+
+// returns the font sheet of the current font, and creates it if it doesn't exist yet (see CreateSheetSprite())
+flc::Sprite *flc::SpriteFont::GetSprite() {
+    std::lock_guard<std::mutex> lock( mtxDraw );
+    if (pFace->pSheetSprite == nullptr)
+        pFace->pSheetSprite = CreateSheetSprite( pFace );
+    return pFace->pSheetSprite;
+}
 
-    // this function takes the index as input, and sets valid values for it's other arguments.
-    // the font data is initialized from code and passed back in sFontDataString
-    std::string sFontDataString;
-    InitFontSprite( index, fontSpriteFile, nTilesX, nTilesY, nTileSizeX, nTileSizeY, nOffset, sFontDataString );
-    // set the sprite sheet size, using the number of tiles * the tile size
-    nFontSpriteSizeX = nTilesX * nTileSizeX;
-    nFontSpriteSizeY = nTilesY * nTileSizeY;
-    // convert the data string into a sprite, and dynamically calculate the margins for it.
-    LoadFontFromDataString( nFontSpriteSizeX, nFontSpriteSizeY, sFontDataString );
-    InitFontSpriteMargins();
+// returns the atlas sprite of the current font, and creates it if it doesn't exist yet (see CurrentSprite())
+flc::Sprite *flc::SpriteFont::GetAtlasSprite() {
+    std::lock_guard<std::mutex> lock( mtxDraw );
+    return CurrentSprite();
 }
 
-// loads the font sprite file that is specified by sFileName, and makes it accessible
-// via fontSprite. Returns true upon success, false otherwise.
-bool flc::SpriteFont::LoadFontFromFile( std::string sFileName ) {
-    if (fontSprite != nullptr) {
-        delete fontSprite;
-        fontSprite = nullptr;
+// returns the atlas sprite of the current font, and creates it from the bit mask if it doesn't exist yet: white pixels
+// for the set bits, blank pixels otherwise. In SDF mode the sprite is created from the distance field. The caller holds
+// mtxDraw.
+flc::Sprite *flc::SpriteFont::CurrentSprite() {
+    if (eMode == SDF) {
+        if (pFace->pSDFSprite == nullptr)
+            pFace->pSDFSprite = CreateSDFSprite( pFace );
+        return pFace->pSDFSprite;
     }
-    if (fontDecal != nullptr) {
-        delete fontDecal;
-        fontDecal = nullptr;
+    if (pFace->pSprite == nullptr) {
+        Sprite *fontSprite = new Sprite( pFace->nSpriteSizeX, pFace->nSpriteSizeY );
+        if (fontSprite == nullptr || fontSprite->GetSurfacePtr() == nullptr) {
+            std::cout << "ERROR: CurrentSprite() --> allocation/creation of font sprite failed" << std::endl;
+            return fontSprite;
+        }
+        SDL_Surface *pSrfce = fontSprite->GetSurfacePtr();
+        SDL_LockSurface( pSrfce );
+        for (int y = 0; y < pFace->nSpriteSizeY; y++) {
+            uint32_t *pRow = (uint32_t *)((uint8_t *)pSrfce->pixels + y * pSrfce->pitch);
+            glb_Kernels.fill(   pRow, (uint32_t)0x00000000, pFace->nSpriteSizeX );
+            glb_Kernels.expand( pRow, pFace->vBits.data() + y * pFace->nStride, 0, pFace->nSpriteSizeX, (uint32_t)0xFFFFFFFF );
+        }
+        SDL_UnlockSurface( pSrfce );
+        pFace->pSprite = fontSprite;
     }
-    fontSprite = new Sprite( sFileName );
-    fontDecal  = new Decal( fontSprite );
-    return (fontSprite->width > 0 && fontSprite->height > 0);
+    return pFace->pSprite;
 }
 
-// for the complete sprite sheet the margins are determined per character.
-// A margin is the maximum number of rows resp. columns that can be removed from the left, right, top or bottom
-// without actually touching the character (i.e. containing only blank pixels).
-void flc::SpriteFont::InitFontSpriteMargins() {
+// returns the decal of the current font for the current renderer, and creates it if it doesn't exist yet. A texture
+// can only be used with the renderer that created it, so each window needs it's own decal.
+flc::Decal *flc::SpriteFont::GetDecal() {
+    std::lock_guard<std::mutex> lock( mtxDraw );
+    std::vector<std::pair<SDL_Renderer *, Decal *>> &vDecals = (eMode == SDF) ? pFace->vSDFDecals : pFace->vDecals;
+    for (auto &d : vDecals) {
+        if (d.first == glbRendererPtr)
+            return d.second;
+    }
+    Decal *pDecal = new Decal( CurrentSprite() );
+    if (pDecal == nullptr) {
+        std::cout << "ERROR: GetDecal() --> allocation/creation of font decal failed" << std::endl;
+    } else if (eMode == SDF && pDecal->m_decal != nullptr) {
+#if SDL_VERSION_ATLEAST( 2, 0, 12 )
+        SDL_SetTextureScaleMode( pDecal->m_decal, SDL_ScaleModeLinear );
+#endif
+    }
+    vDecals.push_back( std::make_pair( glbRendererPtr, pDecal ));
+    return pDecal;
+}
 
-    // clear margins vector
-    vMargins.clear();
-    // get a pointer to the sprite data
+// The visible part of each character is put back in it's tile, at the offset given by it's left and top margins. Since
+// the margins only contain blank pixels, this gives back the original font sheet.
+flc::Sprite *flc::SpriteFont::CreateSheetSprite( FontFace *pSheetFace ) {
+    Sprite *fontSprite = new Sprite( pSheetFace->nTilesX * pSheetFace->nTileSizeX, pSheetFace->nTilesY * pSheetFace->nTileSizeY );
+    if (fontSprite == nullptr || fontSprite->GetSurfacePtr() == nullptr) {
+        std::cout << "ERROR: CreateSheetSprite() --> allocation/creation of font sprite failed" << std::endl;
+        return fontSprite;
+    }
     SDL_Surface *pSrfce = fontSprite->GetSurfacePtr();
-    uint32_t *sprite = (uint32_t *)pSrfce->pixels;
-    // process all tiles in the sprite and insert the margins per tile in the vSpacings vector
-    int max_j = nTilesX * nTilesY;
     SDL_LockSurface( pSrfce );
-    for (int j = 0; j < max_j; j++) {
-        // get tile coordinates of current character tile
-        int tx = j % nTilesX;
-        int ty = j / nTilesX;
-        // get pixel coordinates (origin = upper left corner) of character tile
-        int px = tx * nTileSizeX;
-        int py = ty * nTileSizeY;
-
-        CharSpacing tmpSpacing;
-
-        // process left side
-        int x_left = 0;
-        bool bFoundNonBlank = false;
-        while (!bFoundNonBlank && x_left < nTileSizeX) {
-            for (int yc = 0; yc < nTileSizeY; yc++) {
-                // get the current pixel in uint32_t form
-                uint32_t aux = sprite[ (py + yc) * fontSprite->width + (px + x_left) ];
-                // check if it's blank or not
-                bFoundNonBlank |= (aux != (uint32_t)0);
-            }
-            if (!bFoundNonBlank)   // if current column was completely blank
-                x_left += 1;       // scan next column
-        }
-        tmpSpacing.lft = x_left;
-
-        // process right side
-        int x_right = nTileSizeX - 1;
-        bFoundNonBlank = false;
-        while (!bFoundNonBlank && x_right >= 0) {
-            for (int yc = 0; yc < nTileSizeY; yc++) {
-                uint32_t aux = sprite[ (py + yc) * fontSprite->width + (px + x_right) ];
-                bFoundNonBlank |= (aux != (uint32_t)0);
-            }
-            if (!bFoundNonBlank)
-                x_right -= 1;
-        }
-        tmpSpacing.rgt = nTileSizeX - 1 - x_right;
-
-        // process top side
-        int y_top = 0;
-        bFoundNonBlank = false;
-        while (!bFoundNonBlank && y_top < nTileSizeY) {
-            for (int xc = 0; xc < nTileSizeX; xc++) {
-                uint32_t aux = sprite[ (py + y_top) * fontSprite->width + (px + xc) ];
-                bFoundNonBlank |= (aux != (uint32_t)0);
-            }
-            if (!bFoundNonBlank)
-                y_top += 1;
-        }
-        tmpSpacing.top = y_top;
-
-        // process bottom side
-        int y_bottom = nTileSizeY - 1;
-        bFoundNonBlank = false;
-        while (!bFoundNonBlank && y_bottom >= 0) {
-            for (int xc = 0; xc < nTileSizeX; xc++) {
-                uint32_t aux = sprite[ (py + y_bottom) * fontSprite->width + (px + xc) ];
-                bFoundNonBlank |= (aux != (uint32_t)0);
-            }
-            if (!bFoundNonBlank)
-                y_bottom -= 1;
+    for (int y = 0; y < fontSprite->height; y++)
+        glb_Kernels.fill( (uint32_t *)((uint8_t *)pSrfce->pixels + y * pSrfce->pitch), (uint32_t)0x00000000, fontSprite->width );
+    int nNrTiles = pSheetFace->nTilesX * pSheetFace->nTilesY;
+    for (int j = 0; j < nNrTiles; j++) {
+        const SDL_Rect    &r = pSheetFace->vGlyphRects[j];
+        const CharSpacing &m = pSheetFace->vMargins[j];
+        int nDstX = (j % pSheetFace->nTilesX) * pSheetFace->nTileSizeX + m.lft;
+        int nDstY = (j / pSheetFace->nTilesX) * pSheetFace->nTileSizeY + m.top;
+        for (int yc = 0; yc < r.h; yc++) {
+            uint32_t *pRow = (uint32_t *)((uint8_t *)pSrfce->pixels + (nDstY + yc) * pSrfce->pitch);
+            glb_Kernels.expand( pRow + nDstX, pSheetFace->vBits.data() + (r.y + yc) * pSheetFace->nStride, r.x, r.w, (uint32_t)0xFFFFFFFF );
         }
-        tmpSpacing.bot = nTileSizeY - 1 - y_bottom;
-
-        vMargins.push_back( tmpSpacing );
     }
     SDL_UnlockSurface( pSrfce );
-
-    // determine the width of the slimmest character and use that as nominal margin
-    int nCharIx = (int)'|' - nOffset;
-    nNominalMargin = nTileSizeX - (vMargins[nCharIx].lft + vMargins[nCharIx].rgt);
+    return fontSprite;
 }
 
-// Loads a font from sDataString, using the inverse algorithm that was used to write sprite file data to text.
-// The sDataString data is provided from module SGE_FontData
-void flc::SpriteFont::LoadFontFromDataString( int nSpriteSizeX, int nSpriteSizeY, std::string &sDataString ) {
+// creates the face for font nFontIndex. The font info, the sprite data and the margins are all compiled into the code,
+// so the only work left is decoding the bit mask and deriving the proportional spacing from the margins.
+flc::SpriteFont::FontFace *flc::SpriteFont::LoadFontFace( int nFontIndex ) {
+    const FontData &data = GetFontData( nFontIndex );
+
+    FontFace *pNewFace = new FontFace;
+    pNewFace->sFontSpriteFile = data.sFileName;
+    pNewFace->nTilesX         = data.nCharsHor;
+    pNewFace->nTilesY         = data.nCharsVer;
+    pNewFace->nTileSizeX      = data.nTileSizeX;
+    pNewFace->nTileSizeY      = data.nTileSizeY;
+    pNewFace->nOffset         = data.nAsciiOffset;
+
+    // copy the precomputed margins
+    int nNrTiles = pNewFace->nTilesX * pNewFace->nTilesY;
+    pNewFace->vMargins.resize( nNrTiles );
+    for (int j = 0; j < nNrTiles; j++) {
+        pNewFace->vMargins[j].lft = data.pMargins[ 4 * j + 0 ];
+        pNewFace->vMargins[j].rgt = data.pMargins[ 4 * j + 1 ];
+        pNewFace->vMargins[j].top = data.pMargins[ 4 * j + 2 ];
+        pNewFace->vMargins[j].bot = data.pMargins[ 4 * j + 3 ];
+    }
 
-    // if the fontPtr already contained some SDL_Texture, get rid of it.
-    if (fontSprite != nullptr) {
-        delete fontSprite;
-        fontSprite = nullptr;
+    // decode the complete font sheet, and keep only the visible parts of the characters
+    std::vector<uint8_t> vSheet;
+    LoadFontFromDataStrings( pNewFace->nTilesX * pNewFace->nTileSizeX, pNewFace->nTilesY * pNewFace->nTileSizeY,
+                             data.pDataLines, data.nDataLines, vSheet );
+    PackFontAtlas( pNewFace, vSheet );
+
+    // determine the width of the slimmest character and use that as nominal margin
+    int nCharIx = (int)'|' - pNewFace->nOffset;
+    pNewFace->nNominalMargin = pNewFace->nTileSizeX - (pNewFace->vMargins[nCharIx].lft + pNewFace->vMargins[nCharIx].rgt);
+
+    // precompute the proportional spacing per character: the part of the margins that exceeds the desired inter
+    // character spacing is skipped. The space character gets a fixed width instead.
+    int nSpacing = pNewFace->nNominalMargin * nInterChSpc;
+    pNewFace->vAdvances.resize( nNrTiles );
+    for (int j = 0; j < nNrTiles; j++) {
+        pNewFace->vAdvances[j].lft = std::max( 0, pNewFace->vMargins[j].lft - nSpacing );
+        pNewFace->vAdvances[j].rgt = std::max( 0, pNewFace->vMargins[j].rgt - nSpacing );
     }
-    if (fontDecal != nullptr) {
-        delete fontDecal;
-        fontDecal = nullptr;
+    nCharIx = (int)' ' - pNewFace->nOffset;
+    if (nCharIx >= 0 && nCharIx < nNrTiles) {
+        pNewFace->vAdvances[nCharIx].lft = pNewFace->nTileSizeX - (pNewFace->nNominalMargin * nSpaceChar);
+        pNewFace->vAdvances[nCharIx].rgt = 0;
     }
+    pNewFace->vPropWidths.resize( nNrTiles );
+    for (int j = 0; j < nNrTiles; j++)
+        pNewFace->vPropWidths[j] = pNewFace->nTileSizeX - pNewFace->vAdvances[j].lft - pNewFace->vAdvances[j].rgt;
+    return pNewFace;
+}
 
-    fontSprite = new Sprite( nSpriteSizeX, nSpriteSizeY );
-    if (fontSprite == nullptr) {
-        std::cout << "ERROR: LoadFontFromDataString() --> allocation/creation of font sprite failed" << std::endl;
-    } else if (fontSprite->GetSurfacePtr() == nullptr) {
-        std::cout << "ERROR: LoadFontFromDataString() --> can't get font sprite SDL_Surface pointer " << std::endl;
-    } else if (fontSprite->GetSurfacePtr()->pixels == nullptr) {
-        std::cout << "ERROR: LoadFontFromDataString() --> SDL_Surface has nullptr pixel pointer " << std::endl;
-    }
+// Decodes the font sheet from the data lines into a bit mask, using the inverse algorithm that was used to write sprite
+// file data to text. The lines are processed as if they were one string. The data is provided by module SGE_FontData.
+void flc::SpriteFont::LoadFontFromDataStrings( int nSizeX, int nSizeY, const char *const *pDataLines, int nDataLines, std::vector<uint8_t> &vSheet ) {
+
+    int nStride = (nSizeX + 7) / 8;
+    vSheet.assign( nStride * nSizeY, 0 );
 
     // The data string uses only 6 bits to prevent problem with difficult printable characters. The offset2Printable of 48
     // in combination with the useBits of 6 makes sure that all data is written in non complex printable
@@ -468,272 +706,539 @@ void flc::SpriteFont::LoadFontFromDataString( int nSpriteSizeX, int nSpriteSizeY
     const int useBits  = 6;
     const int offset2Printable = 48;
 
-    // get a pointer to the sprite data
-    SDL_Surface *pSrfce = fontSprite->GetSurfacePtr();
-    uint32_t *sprite = (uint32_t *)pSrfce->pixels;
-    // set the counter for reading the data string and read initial byte
-    int dataCnt = 0;
-    char nextBits = (char)(sDataString[dataCnt] - offset2Printable);
+    // set the line and character pointer for reading the data and read initial byte. When the end of a line is
+    // reached, reading continues with the next line.
+    int nLine = 0;
+    const char *pData = pDataLines[0];
+    char nextBits = (char)(*pData - offset2Printable);
 
-    SDL_LockSurface( pSrfce );
-    for (int y = 0; y < fontSprite->height; y++) {
-        for (int x = 0; x < fontSprite->width; x++) {
+    for (int y = 0; y < nSizeY; y++) {
+        uint8_t *pRow = vSheet.data() + y * nStride;
+        for (int x = 0; x < nSizeX; x++) {
 
-            // calculate which bit to process
+            // calculate which bit to process, and set the corresponding bit of the mask if it's set
             int bitCntr = x % useBits;
-            // if the bit is not set, fill sprite with blank pixel, otherwise fill sprite with white pixel
-            if ((nextBits & (0x20 >> bitCntr)) == 0x00)
-                sprite[ y * fontSprite->width + x ] = (uint32_t)0x00000000;    // blank
-            else
-                sprite[ y * fontSprite->width + x ] = (uint32_t)0xFFFFFFFF;    // white
+            if ((nextBits & (0x20 >> bitCntr)) != 0x00)
+                pRow[ x >> 3 ] |= (uint8_t)(0x80 >> (x & 7));
 
             // check if next data byte should be fetched. This is the case if either the current data byte
             // is completely processed, or wrap around the sprite width occurs
-            if (bitCntr == (useBits - 1) || (x == fontSprite->width - 1)) {
-                dataCnt += 1;
-                nextBits = (char)(sDataString[dataCnt] - offset2Printable);
+            if (bitCntr == (useBits - 1) || (x == nSizeX - 1)) {
+                pData += 1;
+                if (*pData == '\0' && nLine + 1 < nDataLines)
+                    pData = pDataLines[ ++nLine ];
+                nextBits = (char)(*pData - offset2Printable);
             }
         }
     }
-    SDL_UnlockSurface( pSrfce );
+}
 
-    // now that the font sprite is initialized from the datastring, also create a decal from it
-    fontDecal = new Decal( fontSprite );
-    if (fontDecal == nullptr) {
-        std::cout << "ERROR: LoadFontFromDataString() --> allocation/creation of font decal failed" << std::endl;
+// auxiliary function - copies n bits from bit position nSrcBit of pSrc to bit position nDstBit of pDst
+static void copy_bits( uint8_t *pDst, int nDstBit, const uint8_t *pSrc, int nSrcBit, int n ) {
+    for (int i = 0; i < n; i++, nSrcBit++, nDstBit++) {
+        if (pSrc[ nSrcBit >> 3 ] & (0x80 >> (nSrcBit & 7)))
+            pDst[ nDstBit >> 3 ] |= (uint8_t)(0x80 >> (nDstBit & 7));
     }
 }
 
-//                       +------------------------+                                //
-// ----------------------+ STRING DRAWING METHODS +------------------------------- //
-//                       +------------------------+                                //
+// auxiliary function - packs the rects (of which only w and h need to be set) on shelves: they are sorted on height, and
+// placed from left to right on a shelf until the atlas width is reached, then a new shelf is started below it. The atlas
+// width is chosen so that the atlas becomes roughly square. Empty rects are skipped. Returns the size of the atlas.
+static void pack_on_shelves( std::vector<SDL_Rect> &vRects, int nSpacing, int &nAtlasW, int &nAtlasH ) {
+    std::vector<int> vOrder;
+    int nArea = 0, nMaxW = 0;
+    for (int j = 0; j < (int)vRects.size(); j++) {
+        if (vRects[j].w > 0 && vRects[j].h > 0) {
+            vOrder.push_back( j );
+            nArea += (vRects[j].w + nSpacing) * (vRects[j].h + nSpacing);
+            nMaxW  = std::max( nMaxW, vRects[j].w + nSpacing );
+        }
+    }
+    std::stable_sort( vOrder.begin(), vOrder.end(), [&]( int a, int b ) { return vRects[a].h > vRects[b].h; } );
+
+    nAtlasW = std::max( nMaxW, int( std::ceil( std::sqrt( float( nArea )))));
+    int x = 0, y = 0, nShelfH = 0;
+    for (auto j : vOrder) {
+        SDL_Rect &r = vRects[j];
+        if (x + r.w + nSpacing > nAtlasW) {
+            x  = 0;
+            y += nShelfH;
+            nShelfH = 0;
+        }
+        r.x = x;
+        r.y = y;
+        x += r.w + nSpacing;
+        nShelfH = std::max( nShelfH, r.h + nSpacing );
+    }
+    nAtlasW = std::max( 1, nAtlasW );
+    nAtlasH = std::max( 1, y + nShelfH );
+}
 
-// Draws a string at specified location to the SDL_Surface pointed at by pSrfce, in the specified colour and scale
-void flc::SpriteFont::DrawString( SDL_Surface *pSrfce, int x, int y, const std::string &sText, Pixel nColour, int nScale ) {
+// A spacing of one pixel is kept between the characters in the atlas, so that scaled decals don't pick up pixels of
+// neighbouring characters.
+void flc::SpriteFont::PackFontAtlas( FontFace *pNewFace, const std::vector<uint8_t> &vSheet ) {
+    int nNrTiles     = pNewFace->nTilesX * pNewFace->nTilesY;
+    int nSheetStride = (pNewFace->nTilesX * pNewFace->nTileSizeX + 7) / 8;
+
+    // determine the size of the visible part of each character - blank characters get an empty rect
+    pNewFace->vGlyphRects.resize( nNrTiles );
+    for (int j = 0; j < nNrTiles; j++) {
+        const CharSpacing &m = pNewFace->vMargins[j];
+        SDL_Rect &r = pNewFace->vGlyphRects[j];
+        InitSDL_Rect( r, 0, 0, std::max( 0, pNewFace->nTileSizeX - m.lft - m.rgt ), std::max( 0, pNewFace->nTileSizeY - m.top - m.bot ));
+        if (r.w == 0 || r.h == 0)
+            r.w = r.h = 0;
+    }
+    pack_on_shelves( pNewFace->vGlyphRects, 1, pNewFace->nSpriteSizeX, pNewFace->nSpriteSizeY );
+    pNewFace->nStride = (pNewFace->nSpriteSizeX + 7) / 8;
+    pNewFace->vBits.assign( pNewFace->nStride * pNewFace->nSpriteSizeY, 0 );
+
+    // copy the visible parts from the sheet into the atlas
+    for (int j = 0; j < nNrTiles; j++) {
+        const SDL_Rect    &r = pNewFace->vGlyphRects[j];
+        const CharSpacing &m = pNewFace->vMargins[j];
+        int nSrcX = (j % pNewFace->nTilesX) * pNewFace->nTileSizeX + m.lft;
+        int nSrcY = (j / pNewFace->nTilesX) * pNewFace->nTileSizeY + m.top;
+        for (int yc = 0; yc < r.h; yc++) {
+            copy_bits( pNewFace->vBits.data() + (r.y + yc) * pNewFace->nStride, r.x,
+                       vSheet.data() + (nSrcY + yc) * nSheetStride, nSrcX, r.w );
+        }
+    }
+}
 
-    // set colour mode and alpha mode for this font surface
-    SDL_Surface *pFontSrfce = fontSprite->GetSurfacePtr();
-    SDL_SetSurfaceColorMod( pFontSrfce, nColour.getR(), nColour.getG(), nColour.getB() );
-    SDL_SetSurfaceAlphaMod( pFontSrfce, nColour.getA() );
+// The distance field of each character covers it's visible part plus a border of nSDFSpread pixels. Per pixel the
+// distance to the nearest pixel of the opposite kind (ink vs. blank) is searched within the spread, and stored as
+// 127.5 + 127.5 * (signed distance to the edge) / nSDFSpread, where the distance is positive inside the character.
+// So a value of 128 or more means ink, and at scale 1 thresholding gives back the original bitmap.
+void flc::SpriteFont::BuildSDFAtlas( FontFace *pNewFace ) {
+    const int S = nSDFSpread;
+
+    int nNrTiles = (int)pNewFace->vGlyphRects.size();
+    pNewFace->vSDFRects.resize( nNrTiles );
+    for (int j = 0; j < nNrTiles; j++) {
+        const SDL_Rect &r = pNewFace->vGlyphRects[j];
+        if (r.w > 0)
+            InitSDL_Rect( pNewFace->vSDFRects[j], 0, 0, r.w + 2 * S, r.h + 2 * S );
+        else
+            InitSDL_Rect( pNewFace->vSDFRects[j], 0, 0, 0, 0 );
+    }
+    // the border of the fields keeps the characters apart, so no extra spacing is needed
+    pack_on_shelves( pNewFace->vSDFRects, 0, pNewFace->nSDFSizeX, pNewFace->nSDFSizeY );
+    pNewFace->vSDF.assign( pNewFace->nSDFSizeX * pNewFace->nSDFSizeY, 0 );
+
+    // the squared distances that can be found within the spread, and the values they map to
+    std::vector<uint8_t> vInk;
+    for (int j = 0; j < nNrTiles; j++) {
+        const SDL_Rect &r  = pNewFace->vGlyphRects[j];
+        const SDL_Rect &rf = pNewFace->vSDFRects[j];
+        if (r.w == 0)
+            continue;
+        // expand the bits of the character (including the border) to one byte per pixel, for easy lookup
+        vInk.assign( rf.w * rf.h, 0 );
+        for (int y = 0; y < r.h; y++) {
+            const uint8_t *pRow = pNewFace->vBits.data() + (r.y + y) * pNewFace->nStride;
+            for (int x = 0; x < r.w; x++) {
+                int xs = r.x + x;
+                vInk[ (y + S) * rf.w + x + S ] = (pRow[ xs >> 3 ] & (0x80 >> (xs & 7))) ? 1 : 0;
+            }
+        }
+        for (int y = 0; y < rf.h; y++) {
+            uint8_t *pDst = pNewFace->vSDF.data() + (rf.y + y) * pNewFace->nSDFSizeX + rf.x;
+            for (int x = 0; x < rf.w; x++) {
+                uint8_t nInk = vInk[ y * rf.w + x ];
+                // search the nearest pixel of the opposite kind - if there's none, the distance is capped
+                int nMinDist2 = (S + 1) * (S + 1);
+                for (int dy = std::max( -S, -y ); dy <= std::min( S, rf.h - 1 - y ); dy++) {
+                    const uint8_t *pInk = vInk.data() + (y + dy) * rf.w;
+                    for (int dx = std::max( -S, -x ); dx <= std::min( S, rf.w - 1 - x ); dx++) {
+                        if (pInk[ x + dx ] != nInk)
+                            nMinDist2 = std::min( nMinDist2, dx * dx + dy * dy );
+                    }
+                }
+                float fDist = std::min( std::sqrt( float( nMinDist2 )), S + 0.5f ) - 0.5f;
+                float fVal  = 127.5f + 127.5f * (nInk ? fDist : -fDist) / float( S );
+                pDst[x] = (uint8_t)std::max( 0.0f, std::min( 255.0f, fVal + 0.5f ));
+            }
+        }
+    }
+}
 
-    // do you want characters displayed in normalized width & height?
-    int nUseCharWidth  = nTileSizeX;    // could also be nNormX resp. nNormY
-    int nUseCharHeight = nTileSizeY;
+// The sprite for the decal path is white, with an alpha that rises from 0 to 255 over about one pixel around the edge
+// (the value 127.5 in the field). When the decal is scaled, SDL interpolates the alpha (linear scaling is set on the
+// texture), so the edge stays smooth.
+flc::Sprite *flc::SpriteFont::CreateSDFSprite( FontFace *pSDFFace ) {
+    Sprite *fontSprite = new Sprite( pSDFFace->nSDFSizeX, pSDFFace->nSDFSizeY );
+    if (fontSprite == nullptr || fontSprite->GetSurfacePtr() == nullptr) {
+        std::cout << "ERROR: CreateSDFSprite() --> allocation/creation of font sprite failed" << std::endl;
+        return fontSprite;
+    }
+    SDL_Surface *pSrfce = fontSprite->GetSurfacePtr();
+    SDL_LockSurface( pSrfce );
+    for (int y = 0; y < pSDFFace->nSDFSizeY; y++) {
+        uint32_t      *pRow   = (uint32_t *)((uint8_t *)pSrfce->pixels + y * pSrfce->pitch);
+        const uint8_t *pField = pSDFFace->vSDF.data() + y * pSDFFace->nSDFSizeX;
+        for (int x = 0; x < pSDFFace->nSDFSizeX; x++) {
+            float fAlpha = 127.5f + (float( pField[x] ) - 127.5f) * float( nSDFSpread );
+            int   nAlpha = int( std::max( 0.0f, std::min( 255.0f, fAlpha )));
+            pRow[x] = (nAlpha == 0) ? 0 : Pixel( (uint8_t)255, (uint8_t)255, (uint8_t)255, (uint8_t)nAlpha ).Encode();
+        }
+    }
+    SDL_UnlockSurface( pSrfce );
+    return fontSprite;
+}
 
-    // draw the string by rendering the right partial sprites from the font sprite sheet
-    int x_offset = 0;
-    int y_offset = 0;
-    for (int j = 0; j < (int)sText.length(); j++) {
-        // get the correct partial sprite by using the character itself as index into the sprite sheet
-        // the nOffset provides for sprite sheets that don't have the '0' on position 48, and 'A' on position 65 etc.
-        int nCharIx = (int)sText[j] - nOffset;
+//                       +------------------------+                                //
+// ----------------------+ STRING DRAWING METHODS +------------------------------- //
+//                       +------------------------+                                //
 
-        if (sText[j] == '\n') {
-            y_offset += nUseCharHeight * nScale;
-            x_offset = 0;
-        } else {
-            // source rectangle for the desired character - get the coords. in pixel space
-            int nSrcX = (nCharIx % nTilesX) * nTileSizeX;
-            int nSrcY = (nCharIx / nTilesX) * nTileSizeY;
-            SDL_Rect part;
-            InitSDL_Rect( part, nSrcX, nSrcY, nTileSizeX, nTileSizeY );
+// returns the glyph for nCharIx in the specified scale. If it's not cached yet, it's built from the character in the font
+// atlas, scaled up nScale times.
+const flc::Glyph *flc::SpriteFont::GetGlyph( int nCharIx, int nScale ) {
+    uint64_t nKey = GlyphCache::MakeKey( nFontIndex, nCharIx, nScale, eMode == SDF );
+    Glyph *pGlyph = cGlyphCache.Find( nKey );
+    if (pGlyph != nullptr)
+        return pGlyph;
+
+    pGlyph = cGlyphCache.Insert( nKey );
+    if (eMode == SDF) {
+        BuildSDFGlyph( nCharIx, nScale, *pGlyph );
+        return pGlyph;
+    }
 
-            // dest rectangle - where to put this character on the drawtarget surface
-            int nDstX = x + x_offset;
-            int nDstY = y + y_offset;
-            SDL_Rect pos;
-            InitSDL_Rect( pos, nDstX, nDstY, nUseCharWidth * nScale, nUseCharHeight * nScale );
+    const SDL_Rect    &r = pFace->vGlyphRects[nCharIx];
+    const CharSpacing &m = pFace->vMargins[nCharIx];
+    pGlyph->w        = r.w * nScale;
+    pGlyph->h        = r.h * nScale;
+    pGlyph->nOffsetX = m.lft * nScale;
+    pGlyph->nOffsetY = m.top * nScale;
+    pGlyph->nStride  = (pGlyph->w + 7) / 8;
+    pGlyph->vBits.assign( pGlyph->nStride * pGlyph->h, 0 );
+
+    for (int y = 0; y < pGlyph->h; y++) {
+        const uint8_t *pSrc = pFace->vBits.data() + (r.y + y / nScale) * pFace->nStride;
+        uint8_t       *pDst = pGlyph->vBits.data() + y * pGlyph->nStride;
+        for (int x = 0; x < pGlyph->w; x++) {
+            int xs = r.x + x / nScale;
+            if (pSrc[ xs >> 3 ] & (0x80 >> (xs & 7)))
+                pDst[ x >> 3 ] |= (uint8_t)(0x80 >> (x & 7));
+        }
+    }
+    return pGlyph;
+}
 
-            // now copy the subsprite to the drawtarget surface
-            SDL_BlitScaled( fontSprite->GetSurfacePtr(), &part, pSrfce, &pos );
+// The glyph is sampled from the distance field of the character with bilinear interpolation, at the centers of the
+// scaled pixels, and thresholded at the edge value. This happens once per glyph, the drawing itself uses the same bit
+// expansion as the bitmap glyphs.
+void flc::SpriteFont::BuildSDFGlyph( int nCharIx, int nScale, Glyph &glyph ) {
+    const SDL_Rect    &rf = pFace->vSDFRects[nCharIx];
+    const CharSpacing &m  = pFace->vMargins[nCharIx];
+    glyph.w        = rf.w * nScale;
+    glyph.h        = rf.h * nScale;
+    glyph.nOffsetX = (m.lft - nSDFSpread) * nScale;
+    glyph.nOffsetY = (m.top - nSDFSpread) * nScale;
+    glyph.nStride  = (glyph.w + 7) / 8;
+    glyph.vBits.assign( glyph.nStride * glyph.h, 0 );
+    if (glyph.w == 0)
+        return;
+
+    // the row of sampled values is thresholded in a separate loop, which the compiler can vectorize. The field rects are
+    // at least 2 * nSDFSpread + 1 pixels in size, so there are always two samples to interpolate between.
+    std::vector<float> vRow( glyph.w );
+    const uint8_t *pField = pFace->vSDF.data() + rf.y * pFace->nSDFSizeX + rf.x;
+    int nFieldPitch = pFace->nSDFSizeX;
+    float fInvScale = 1.0f / float( nScale );
+    for (int y = 0; y < glyph.h; y++) {
+        float fv = std::max( 0.0f, std::min( float( rf.h - 1 ), (y + 0.5f) * fInvScale - 0.5f ));
+        int   v0 = std::min( int( fv ), rf.h - 2 );
+        int   v1 = v0 + 1;
+        float fy = fv - v0;
+        const uint8_t *pRow0 = pField + v0 * nFieldPitch;
+        const uint8_t *pRow1 = pField + v1 * nFieldPitch;
+        for (int x = 0; x < glyph.w; x++) {
+            float fu = std::max( 0.0f, std::min( float( rf.w - 1 ), (x + 0.5f) * fInvScale - 0.5f ));
+            int   u0 = std::min( int( fu ), rf.w - 2 );
+            int   u1 = u0 + 1;
+            float fx = fu - u0;
+            float fTop = pRow0[u0] + (pRow0[u1] - pRow0[u0]) * fx;
+            float fBot = pRow1[u0] + (pRow1[u1] - pRow1[u0]) * fx;
+            vRow[x] = fTop + (fBot - fTop) * fy;
+        }
+        uint8_t *pDst = glyph.vBits.data() + y * glyph.nStride;
+        for (int x = 0; x < glyph.w; x++)
+            pDst[ x >> 3 ] |= (uint8_t)((vRow[x] >= 127.5f ? 0x80 : 0x00) >> (x & 7));
+    }
+}
 
-            x_offset += nUseCharWidth * nScale;
+// draws the visible part of the glyph. With an opaque colour the set bits are expanded straight into the target,
+// with a translucent colour each run of set bits is blended.
+void flc::SpriteFont::DrawGlyph( SDL_Surface *pSrfce, int x, int y, const Glyph *pGlyph, uint32_t nColour ) {
+    x += pGlyph->nOffsetX;
+    y += pGlyph->nOffsetY;
+    const SDL_Rect &clip = pSrfce->clip_rect;
+    int y0 = std::max( y, clip.y ), y1 = std::min( y + pGlyph->h, clip.y + clip.h );
+    int x0 = std::max( x, clip.x ), x1 = std::min( x + pGlyph->w, clip.x + clip.w );
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    bool bOpaque = ((nColour & glb_amask) == glb_amask);
+    int  nPitch  = pSrfce->pitch / 4;
+    for (int yd = y0; yd < y1; yd++) {
+        uint32_t      *pDstRow = (uint32_t *)pSrfce->pixels + yd * nPitch + x;
+        const uint8_t *pBits   = pGlyph->vBits.data() + (yd - y) * pGlyph->nStride;
+        if (bOpaque) {
+            glb_Kernels.expand( pDstRow + (x0 - x), pBits, x0 - x, x1 - x0, nColour );
+        } else {
+            // find the runs of set bits (in glyph coordinates)
+            int xs = x0 - x, xe = x1 - x;
+            while (xs < xe) {
+                if ((pBits[ xs >> 3 ] & (0x80 >> (xs & 7))) == 0) {
+                    xs++;
+                } else {
+                    int nRunStart = xs;
+                    while (xs < xe && (pBits[ xs >> 3 ] & (0x80 >> (xs & 7))) != 0)
+                        xs++;
+                    glb_Kernels.blend( pDstRow + nRunStart, &nColour, 0, xs - nRunStart, 1.0f );
+                }
+            }
         }
     }
 }
 
-// This method very much resembles DrawString(). However, instead of directly blitting the character partial
-// sprites to the draw target, it prepares a vector of information to render the partial decals in the main
-// rendering loop.
-void flc::SpriteFont::DrawStringDecal( int x, int y,
-                                       const std::string &sText,
-                                       Pixel nColour,
-                                       float scaleX, float scaleY,
-                                       std::vector<std::pair<SDL_Rect, SDL_Rect>> &drawInfo ) {
+// Draws a string at specified location to the SDL_Surface pointed at by pSrfce, in the specified colour and scale
+void flc::SpriteFont::DrawString( SDL_Surface *pSrfce, int x, int y, const std::string &sText, Pixel nColour, int nScale ) {
+    // a fully transparent colour draws nothing
+    uint32_t nCol = nColour.Encode();
+    if (nScale < 1 || (nCol & glb_amask) == 0)
+        return;
+    std::lock_guard<std::mutex> lock( mtxDraw );
 
     // do you want characters displayed in normalized width & height?
-    int nUseCharWidth  = nTileSizeX;    // could also be nNormX resp. nNormY
-    int nUseCharHeight = nTileSizeY;
+    int nUseCharWidth  = pFace->nTileSizeX;    // could also be nNormX resp. nNormY
+    int nUseCharHeight = pFace->nTileSizeY;
+    int nNrTiles       = pFace->nTilesX * pFace->nTilesY;
 
-    // draw the string by rendering the right partial decals from the font decal sheet
+    // draw the string by drawing the glyphs for it's characters
     int x_offset = 0;
     int y_offset = 0;
+    SDL_LockSurface( pSrfce );
     for (int j = 0; j < (int)sText.length(); j++) {
-        // get the correct partial decal by using the character itself as index into the decal sheet
-        // the nOffset provides for sprite sheets that don't have the '0' on position 48, and 'A' on position 65 etc.
-        int nCharIx = (int)sText[j] - nOffset;
+        // get the glyph by using the character itself as index into the sprite sheet
+        // the nOffset of the font provides for sprite sheets that don't have the '0' on position 48, and 'A' on position 65 etc.
+        int nCharIx = (int)sText[j] - pFace->nOffset;
 
         if (sText[j] == '\n') {
-            y_offset += nUseCharHeight * scaleY;
+            y_offset += nUseCharHeight * nScale;
             x_offset = 0;
         } else {
-            // source rectangle for the desired character - get the coords. in pixel space
-            int nSrcX = (nCharIx % nTilesX) * nTileSizeX;
-            int nSrcY = (nCharIx / nTilesX) * nTileSizeY;
-            SDL_Rect part;
-            InitSDL_Rect( part, nSrcX, nSrcY, nTileSizeX, nTileSizeY );
+            // characters that are not in the sprite sheet are left blank
+            if (nCharIx >= 0 && nCharIx < nNrTiles)
+                DrawGlyph( pSrfce, x + x_offset, y + y_offset, GetGlyph( nCharIx, nScale ), nCol );
 
-            // dest rectangle - where to put this character on the screen
-            int nDstX = x + x_offset;
-            int nDstY = y + y_offset;
-            SDL_Rect pos;
-            InitSDL_Rect( pos, nDstX, nDstY, nUseCharWidth * scaleX, nUseCharHeight * scaleY );
-
-            drawInfo.push_back( std::make_pair( part, pos ));
-
-            x_offset += nUseCharWidth * scaleX;
+            x_offset += nUseCharWidth * nScale;
         }
     }
+    SDL_UnlockSurface( pSrfce );
 }
 
 // Draws a string at specified location to the SDL_Surface pointed at by pSrfce, in the specified colour and scale
 void flc::SpriteFont::DrawStringProp( SDL_Surface *pSrfce, int x, int y, const std::string &sText, Pixel nColour, int nScale ) {
-
-    // set colour mode and alpha mode for this font surface
-    SDL_Surface *pFontSrfce = fontSprite->GetSurfacePtr();
-    SDL_SetSurfaceColorMod( pFontSrfce, nColour.getR(), nColour.getG(), nColour.getB() );
-    SDL_SetSurfaceAlphaMod( pFontSrfce, nColour.getA() );
+    // a fully transparent colour draws nothing
+    uint32_t nCol = nColour.Encode();
+    if (nScale < 1 || (nCol & glb_amask) == 0)
+        return;
+    std::lock_guard<std::mutex> lock( mtxDraw );
 
     // do you want characters displayed in normalized width & height?
-    int nUseCharWidth  = nTileSizeX;    // could also be nNormX resp. nNormY
-    int nUseCharHeight = nTileSizeY;
+    int nUseCharWidth  = pFace->nTileSizeX;    // could also be nNormX resp. nNormY
+    int nUseCharHeight = pFace->nTileSizeY;
+    int nNrTiles       = pFace->nTilesX * pFace->nTilesY;
 
     // init accumulated margins counter - keeps track of accumulated spacing corrections
     int nAccSpacings = 0;
-    // draw the string by rendering the right partial sprites from the font sprite sheet
+    // draw the string by drawing the glyphs for it's characters
     int x_offset = 0;
     int y_offset = 0;
+    SDL_LockSurface( pSrfce );
     for (int j = 0; j < (int)sText.length(); j++) {
-        // get the correct partial sprite by using the character itself as index into the sprite sheet
-        // the nOffset provides for sprite sheets that don't have the '0' on position 48, and 'A' on position 65 etc.
-        int nCharIx = (int)sText[j] - nOffset;
+        // get the glyph by using the character itself as index into the sprite sheet
+        // the nOffset of the font provides for sprite sheets that don't have the '0' on position 48, and 'A' on position 65 etc.
+        int nCharIx = (int)sText[j] - pFace->nOffset;
 
         if (sText[j] == '\n') {
             y_offset += nUseCharHeight * nScale;
             x_offset = 0;
             nAccSpacings = 0;
         } else {
-
-            // check if charachter is space, this must be handled differently
-            bool bIsSpace = sText[j] == ' ';
-
-            // source rectangle - get the coords. in pixel space
-            int nSrcX = (nCharIx % nTilesX) * nTileSizeX;
-            int nSrcY = (nCharIx / nTilesX) * nTileSizeY;
-            SDL_Rect part;
-            InitSDL_Rect( part, nSrcX, nSrcY, nTileSizeX, nTileSizeY );
-
-            // account for spacing on left side of character
-            if (bIsSpace) // this is a space character
-                nAccSpacings += nUseCharWidth - (nNominalMargin * nSpaceChar);
-            else {
-                // how many space is available in the sprite sheet vs how many is desired?
-                int tmpSpc = vMargins[nCharIx].lft - (nNominalMargin * nInterChSpc);
-                if (tmpSpc > 0)
-                    nAccSpacings += tmpSpc;
-            }
-
-            // dest rectangle - where to put this character on the draw target buffer
-            int nDstX = x + x_offset - (nAccSpacings * nScale);
-            int nDstY = y + y_offset;
-            SDL_Rect pos;
-            InitSDL_Rect( pos, nDstX, nDstY, nUseCharWidth * nScale, nUseCharHeight * nScale );
-            // now copy the subsprite to the draw target surface
-            SDL_BlitScaled( fontSprite->GetSurfacePtr(), &part, pSrfce, &pos );
-
-            // account for spacing on right side of character
-            if (!bIsSpace) {
-                // how many space is available in the sprite sheet vs how many is desired?
-                int tmpSpc = vMargins[nCharIx].rgt - (nNominalMargin * nInterChSpc);
-                if (tmpSpc > 0)
-                    nAccSpacings += tmpSpc;
+            // characters that are not in the sprite sheet are left blank
+            if (nCharIx >= 0 && nCharIx < nNrTiles) {
+                // account for spacing on left side of character, draw it, and account for spacing on the right side
+                nAccSpacings += pFace->vAdvances[nCharIx].lft;
+                DrawGlyph( pSrfce, x + x_offset - (nAccSpacings * nScale), y + y_offset, GetGlyph( nCharIx, nScale ), nCol );
+                nAccSpacings += pFace->vAdvances[nCharIx].rgt;
             }
 
             x_offset += nUseCharWidth * nScale;
         }
     }
+    SDL_UnlockSurface( pSrfce );
 }
 
-// This method very much resembles DrawStringProp(). However, instead of directly blitting the character partial
-// sprites to the draw target, it prepares a vector of information to render the partial decals in the main
-// rendering loop.
-void flc::SpriteFont::DrawStringPropDecal( int x, int y,
-                                           const std::string &sText,
-                                           Pixel nColour,
-                                           float scaleX, float scaleY,
-                                           std::vector<std::pair<SDL_Rect, SDL_Rect>> &drawInfo ) {
+// computes the position of each character of sText relative to the origin of the string. This is the layout that
+// DrawString() resp. DrawStringProp() use (depending on bProp), with floating point scaling
+void flc::SpriteFont::BuildTextLayout( const std::string &sText, float scaleX, float scaleY, bool bProp, TextLayout &layout ) {
+
+    layout.sText = sText;
+    layout.vChars.clear();
+    layout.vChars.reserve( sText.length() );
 
     // do you want characters displayed in normalized width & height?
-    int nUseCharWidth  = nTileSizeX;    // could also be nNormX resp. nNormY
-    int nUseCharHeight = nTileSizeY;
+    int nUseCharWidth  = pFace->nTileSizeX;    // could also be nNormX resp. nNormY
+    int nUseCharHeight = pFace->nTileSizeY;
+    int nNrTiles       = pFace->nTilesX * pFace->nTilesY;
 
     // init accumulated margins counter - keeps track of accumulated spacing corrections
     int nAccSpacings = 0;
-    // draw the string by rendering the right partial sprites from the font sprite sheet
     int x_offset = 0;
     int y_offset = 0;
     for (int j = 0; j < (int)sText.length(); j++) {
-        // get the correct partial sprite by using the character itself as index into the sprite sheet
-        // the nOffset provides for sprite sheets that don't have the '0' on position 48, and 'A' on position 65 etc.
-        int nCharIx = (int)sText[j] - nOffset;
+        // the nOffset of the font provides for sprite sheets that don't have the '0' on position 48, and 'A' on position 65 etc.
+        int nCharIx = (int)sText[j] - pFace->nOffset;
 
         if (sText[j] == '\n') {
             y_offset += nUseCharHeight * scaleY;
             x_offset = 0;
             nAccSpacings = 0;
-        } else {
+        } else if (nCharIx >= 0 && nCharIx < nNrTiles) {
+            // account for spacing on left side of character
+            if (bProp)
+                nAccSpacings += pFace->vAdvances[nCharIx].lft;
+            // source rectangle for the desired character is it's visible part in the atlas, the destination is moved
+            // by the left and top margins. In SDF mode the border of the field is included. Blank characters have
+            // nothing to draw.
+            const SDL_Rect &r = (eMode == SDF) ? pFace->vSDFRects[nCharIx] : pFace->vGlyphRects[nCharIx];
+            if (r.w > 0) {
+                const CharSpacing &m = pFace->vMargins[nCharIx];
+                int nBorder = (eMode == SDF) ? nSDFSpread : 0;
+                TextLayout::Char c;
+                c.nCharIx  = nCharIx;
+                c.src      = r;
+                c.fOffsetX = x_offset - (nAccSpacings * scaleX) + (m.lft - nBorder) * scaleX;
+                c.nOffsetY = y_offset + int( (m.top - nBorder) * scaleY );
+                c.w        = int( r.w * scaleX );
+                c.h        = int( r.h * scaleY );
+                layout.vChars.push_back( c );
+            }
+            // account for spacing on right side of character
+            if (bProp)
+                nAccSpacings += pFace->vAdvances[nCharIx].rgt;
 
-            // check if charachter is space, this must be handled differently
-            bool bIsSpace = sText[j] == ' ';
+            x_offset += nUseCharWidth * scaleX;
+        } else {
+            // characters that are not in the sprite sheet are left blank
+            x_offset += nUseCharWidth * scaleX;
+        }
+    }
+}
 
-            // source rectangle - get the coords. in pixel space
-            int nSrcX = (nCharIx % nTilesX) * nTileSizeX;
-            int nSrcY = (nCharIx / nTilesX) * nTileSizeY;
-            SDL_Rect part;
-            InitSDL_Rect( part, nSrcX, nSrcY, nTileSizeX, nTileSizeY );
+// the key is a hash over the font, the render mode, the scale, the spacing mode and the text. The text is stored with the layout, so that
+// a hash collision results in rebuilding the layout instead of drawing the wrong one
+const flc::TextLayout *flc::SpriteFont::GetTextLayout( const std::string &sText, float scaleX, float scaleY, bool bProp ) {
+    uint64_t nKey = HashValue( uint64_t( nFontIndex ) << 2 | (eMode == SDF ? 2 : 0) | (bProp ? 1 : 0) );
+    uint32_t nScaleX, nScaleY;
+    memcpy( &nScaleX, &scaleX, 4 );
+    memcpy( &nScaleY, &scaleY, 4 );
+    nKey = HashValue( uint64_t( nScaleX ) << 32 | nScaleY, nKey );
+    nKey = HashString( sText, nKey );
+
+    TextLayout *pLayout = cLayoutCache.Find( nKey );
+    if (pLayout == nullptr || pLayout->sText != sText) {
+        pLayout = cLayoutCache.Insert( nKey );
+        BuildTextLayout( sText, scaleX, scaleY, bProp, *pLayout );
+    }
+    return pLayout;
+}
 
-            // account for spacing on left side of character
-            if (bIsSpace) // this is a space character
-                nAccSpacings += nUseCharWidth - (nNominalMargin * nSpaceChar);
-            else {
-                // how many space is available in the sprite sheet vs how many is desired?
-                int tmpSpc = vMargins[nCharIx].lft - (nNominalMargin * nInterChSpc);
-                if (tmpSpc > 0)
-                    nAccSpacings += tmpSpc;
-            }
+// The width of a line is where the "pen" ends up after drawing it: every character advances the tile width, minus it's
+// proportional spacing if bProp is set. Characters that are not in the font advance the tile width, like in DrawString().
+flc::vi2d flc::SpriteFont::MeasureText( const std::string &sText, bool bProp ) {
+    int nNrTiles = pFace->nTilesX * pFace->nTilesY;
+    int nMaxW = 0, nLineW = 0, nLines = 1;
+    for (auto ch : sText) {
+        if (ch == '\n') {
+            nMaxW  = std::max( nMaxW, nLineW );
+            nLineW = 0;
+            nLines += 1;
+        } else {
+            int nCharIx = (int)ch - pFace->nOffset;
+            if (bProp && nCharIx >= 0 && nCharIx < nNrTiles)
+                nLineW += pFace->vPropWidths[nCharIx];
+            else
+                nLineW += pFace->nTileSizeX;
+        }
+    }
+    nMaxW = std::max( nMaxW, nLineW );
+    return { nMaxW, sText.empty() ? 0 : nLines * pFace->nTileSizeY };
+}
 
-            // dest rectangle - where to put this character on the screen
-            int nDstX = x + x_offset - (nAccSpacings * scaleX);
-            int nDstY = y + y_offset;
-            SDL_Rect pos;
-            InitSDL_Rect( pos, nDstX, nDstY, nUseCharWidth * scaleX, nUseCharHeight * scaleY );
+// the sizes are cached unscaled, with a key over the font, the spacing mode and the text (see GetTextLayout())
+flc::vi2d flc::SpriteFont::GetTextSize( const std::string &sText, int nScale, bool bProp ) {
+    uint64_t nKey = HashValue( uint64_t( nFontIndex ) << 1 | (bProp ? 1 : 0) );
+    nKey = HashString( sText, nKey );
 
-            // now push the drawinfo into the vector
-            drawInfo.push_back( std::make_pair( part, pos ));
+    TextSize *pSize = cSizeCache.Find( nKey );
+    if (pSize == nullptr || pSize->sText != sText) {
+        pSize = cSizeCache.Insert( nKey );
+        pSize->sText = sText;
+        pSize->size  = MeasureText( sText, bProp );
+    }
+    return { pSize->size.x * nScale, pSize->size.y * nScale };
+}
 
-            // account for spacing on right side of character
-            if (!bIsSpace) {
-                // how many space is available in the sprite sheet vs how many is desired?
-                int tmpSpc = vMargins[nCharIx].rgt - (nNominalMargin * nInterChSpc);
-                if (tmpSpc > 0)
-                    nAccSpacings += tmpSpc;
-            }
+// This method very much resembles DrawString(). However, instead of directly blitting the character partial
+// sprites to the draw target, it prepares a vector of information to render the partial decals in the main
+// rendering loop. The source rects are taken from the (cached) text layout, and refer to the font decal (GetDecal()).
+// The colour is applied when the decals are drawn, so it isn't used in here.
+void flc::SpriteFont::DrawStringDecal( int x, int y,
+                                       const std::string &sText,
+                                       Pixel /*nColour*/,
+                                       float scaleX, float scaleY,
+                                       std::vector<std::pair<SDL_Rect, SDL_Rect>> &drawInfo ) {
+    const TextLayout *pLayout = GetTextLayout( sText, scaleX, scaleY, false );
+    for (auto &c : pLayout->vChars) {
+        SDL_Rect pos;
+        InitSDL_Rect( pos, int( x + c.fOffsetX ), y + c.nOffsetY, c.w, c.h );
+        drawInfo.push_back( std::make_pair( c.src, pos ));
+    }
+}
 
-            x_offset += nUseCharWidth * scaleX;
-        }
+// similar, but the layout uses proportional spacing
+void flc::SpriteFont::DrawStringPropDecal( int x, int y,
+                                           const std::string &sText,
+                                           Pixel /*nColour*/,
+                                           float scaleX, float scaleY,
+                                           std::vector<std::pair<SDL_Rect, SDL_Rect>> &drawInfo ) {
+    const TextLayout *pLayout = GetTextLayout( sText, scaleX, scaleY, true );
+    for (auto &c : pLayout->vChars) {
+        SDL_Rect pos;
+        InitSDL_Rect( pos, int( x + c.fOffsetX ), y + c.nOffsetY, c.w, c.h );
+        drawInfo.push_back( std::make_pair( c.src, pos ));
     }
 }
 
+// ==============================/ Class GlyphCache /==============================
+
+//                               +----------+                                //
+// ------------------------------+ METHODS  +------------------------------- //
+//                               +----------+                                //
+
+// the key packs the SDF flag (1 bit), font index (8 bits), character index (16 bits) and scale (32 bits)
+uint64_t flc::GlyphCache::MakeKey( int nFont, int nCharIx, int nScale, bool bSDF ) {
+    return (uint64_t( bSDF ? 1 : 0 ) << 56) |
+           (uint64_t( nFont   & 0xFF   ) << 48) |
+           (uint64_t( nCharIx & 0xFFFF ) << 32) |
+            uint64_t( uint32_t( nScale ));
+}
+
 //                                                                           //
 // ------------------------------------------------------------------------- //
 //                                                                           //
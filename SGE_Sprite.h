@@ -30,14 +30,24 @@
  * This module implements class Sprite, class Decal, class SpriteFont and
  * class DecalFrame:
  *   - Sprite     - a generic 2d surface like structure for drawing and rendering
+ *   - SpriteRLE  - a run length encoded representation of a sprite, for fast drawing of
+ *                  (mostly) transparent sprites
+ *   - PixelView  - a non owning view on the pixels of a sprite, for fast per pixel processing
  *   - SpriteFont - a specific application of font sprite files implemented as
  *                  code using datastrings.
+ *   - GlyphCache - an LRU cache of scaled 1 bit per pixel glyphs, used by SpriteFont for fast
+ *                  software text drawing
+ *   - TextLayout - the positions of the characters of a string, cached by SpriteFont for the
+ *                  decal string functions
  *   - Decal      - a generic 2d texture like structur for rendering by the GPU
  *   - DecalFrame - a structure needed for the rendering cycle in combination with Decals
  */
 
 #include <iostream>
 #include <vector>
+#include <memory>
+#include <mutex>
+#include <cassert>
 
 #include "SGE_Utilities.h"
 #include "SGE_Pixel.h"
@@ -48,6 +58,42 @@ namespace flc {
 // --------------------------+ CLASS DEFINITION +--------------------------- //
 //                           +------------------+                            //
 
+    // Run length encoded representation of a sprite. Per row only the runs of non transparent pixels are stored, so
+    // that the transparent parts of a sprite are skipped at no cost when drawing it. Each run is either fully opaque
+    // (can be copied as a whole) or partially transparent (must be blended). See Sprite::GetRLE()
+    struct SpriteRLE {
+        struct Run {
+            int  x       = 0;        // start column of the run
+            int  len     = 0;        // nr of pixels in the run
+            bool bOpaque = false;    // true if all pixels of the run have alpha 255
+        };
+        std::vector<Run> vRuns;      // all runs, ordered on row and column
+        std::vector<int> vRowIx;     // the runs for row y are vRuns[ vRowIx[y] ] upto (excluding) vRuns[ vRowIx[y + 1] ]
+    };
+
+    // the rows of the pixels of sprites that are created by the engine start at a multiple of this nr of bytes, so that
+    // SIMD code can use aligned loads and stores on them. Use RowPtr() or the pitch of the surface to address the rows.
+    #define SPRITE_ROW_ALIGN 64
+
+    // A non owning view on all pixels of a sprite (see Sprite::GetView()), comparable to a 2d std::span. The pixels are
+    // the packed (encoded) uint32_t values. Rows are nStride pixels apart, which can be more than nWidth. The view is
+    // valid as long as the surface of the sprite is. As with the raw access functions of Sprite, the bounds are only
+    // checked in debug builds.
+    struct PixelView {
+        uint32_t *pData   = nullptr;
+        int       nWidth  = 0;
+        int       nHeight = 0;
+        int       nStride = 0;    // in pixels
+
+        uint32_t *Row( int y ) const { assert( y >= 0 && y < nHeight ); return pData + y * nStride; }
+        uint32_t &operator () ( int x, int y ) const { assert( x >= 0 && x < nWidth ); return Row( y )[x]; }
+        // true if the rows are adjacent, i.e. the pixels can be processed as one array of nWidth * nHeight pixels
+        bool IsContiguous() const { return nStride == nWidth; }
+        bool IsEmpty() const { return pData == nullptr; }
+    };
+
+    class MappedFile;
+
     class Sprite {
     public:
         // this enum denotes in what direction a sprite must be flipped (if at all)
@@ -57,6 +103,11 @@ namespace flc {
             VERT,
             BOTH   // flip both horizontally and vertically
         };
+        // this enum denotes how a sprite is sampled when it's drawn with a non integer scale
+        enum Filter {
+            NEAREST = 0,   // take the nearest source pixel
+            BILINEAR       // interpolate between the 4 nearest source pixels
+        };
 
     public:
         // default constructor, creates an empty sprite object
@@ -86,15 +137,62 @@ namespace flc {
         // returns true if the sprite has no valid surface
         bool IsEmpty();
 
+        // Returns a pointer to the first pixel of row y. The rows are GetPitch() bytes apart, which can be more than
+        // width * 4, so always walk the pixels row by row (never as one array of width * height pixels)
+        uint32_t *RowPtr( int y ) { return (uint32_t *)((uint8_t *)m_SurfacePtr->pixels + y * m_SurfacePtr->pitch); }
+        int GetPitch() { return m_SurfacePtr->pitch; }
+
+        // Fast variants of GetPixel() and SetPixel() on the packed (encoded) pixel values. The coordinates are only
+        // checked in debug builds, and SetPixelRaw() doesn't invalidate the RLE representation - call InvalidateRLE()
+        // yourself when you're done altering the pixels.
+        uint32_t GetPixelRaw( int x, int y ) {
+            assert( x >= 0 && x < width && y >= 0 && y < height );
+            return RowPtr( y )[x];
+        }
+        void SetPixelRaw( int x, int y, uint32_t nPixel ) {
+            assert( x >= 0 && x < width && y >= 0 && y < height );
+            RowPtr( y )[x] = nPixel;
+        }
+        // Copies the w x h pixels at (x, y) from resp. into a user buffer, whose rows are nBufStride pixels apart
+        // (0 means w). The rectangle must lie within the sprite, otherwise nothing is copied and false is returned.
+        // WriteRect() invalidates the RLE representation.
+        bool ReadRect(  int x, int y, int w, int h,       uint32_t *pBuffer, int nBufStride = 0 );
+        bool WriteRect( int x, int y, int w, int h, const uint32_t *pBuffer, int nBufStride = 0 );
+        // returns a view on all pixels of this sprite (an empty view if the sprite is empty)
+        PixelView GetView();
+
         int width  = 0;
         int height = 0;
 
         SDL_Surface *GetSurfacePtr();
         void SetSurface( SDL_Surface *pSurf );
 
+        // returns the run length encoded representation of this sprite. It is built on first use, and invalidated by
+        // SetPixel() and SetSurface(), and by the engine when the sprite becomes the draw target. If you alter the
+        // pixels in another way, call InvalidateRLE() yourself. The returned pointer keeps the representation alive, also
+        // when it's invalidated by another thread meanwhile.
+        std::shared_ptr<SpriteRLE> GetRLE();
+        void InvalidateRLE();
+        // if enabled, the engine uses the RLE representation to draw this sprite in MASK and ALPHA mode (unscaled and
+        // unflipped only). Worthwhile for sprites that are mostly transparent, like characters and tiles.
+        void EnableRLE( bool bEnable = true );
+        bool IsRLEEnabled() { return m_bUseRLE; }
+
     private:
         SDL_Surface *m_SurfacePtr = nullptr;
         uint32_t    *m_ColData    = nullptr;
+
+        std::shared_ptr<SpriteRLE> m_RLE;
+        bool         m_bUseRLE    = false;
+
+        // the memory mapped file that holds the pixels, for sprites loaded with LoadRawSprite() (see SGE_RawSprite.h)
+        MappedFile  *m_Mapping    = nullptr;
+        // the (aligned) pixel buffer of the surface, if it was allocated by the sprite itself
+        void        *m_PixelBuffer = nullptr;
+
+        // internal function - creates the surface (with aligned rows) for a sprite of w x h pixels
+        bool CreateAlignedSurface( int w, int h );
+        friend Sprite *LoadRawSprite( const std::string &sRawFile );
     };
 
 //                           +------------------+                            //
@@ -107,12 +205,17 @@ namespace flc {
         // filter and clamp are ignored / have no effect
         Decal( flc::Sprite* spr, bool filter = false, bool clamp = true );
         Decal( const uint32_t nExistingTextureResource, flc::Sprite* spr );
+        // added functionality - a decal for the part of the texture of pAtlas at (x, y), with the size of spr (see
+        // SGE_DecalAtlas). The texture is shared, and not destroyed by this decal.
+        Decal( flc::Decal *pAtlas, flc::Sprite *spr, int x, int y );
         virtual ~Decal();
         // use Update() if you want to associate a new / another sprite to the decal
         void Update();
         // use UpdateSprite() if the sprite that is already associated has changed, and you want to
         // put the changes in the GPU memory
         void UpdateSprite();
+        // added functionality - only puts the specified rect of the sprite in the GPU memory
+        void UpdateSprite( const SDL_Rect &rect );
         // added functionality - the size of a Decal is identical to the size of the associated sprite
         int GetWidth();
         int GetHeight();
@@ -120,6 +223,9 @@ namespace flc {
     public:
         flc::Sprite *m_sprite = nullptr;
         SDL_Texture *m_decal  = nullptr;
+        // the position of the decal within it's texture - this is only non zero for the decals of an atlas
+        SDL_Point    m_origin = { 0, 0 };
+        bool         m_bOwnsTexture = true;
     };
 
 //                           +------------------+                            //
@@ -143,14 +249,75 @@ namespace flc {
             bot = 0;
     };
 
+    // The proportional spacing of a character, derived from it's margins: the nr of (unscaled) pixels that the
+    // character and the text after it are moved to the left when drawn proportionally.
+    struct CharAdvance {
+        int lft = 0,     // correction before the character is drawn
+            rgt = 0;     // correction after the character is drawn
+    };
+
+    // A glyph that is ready for drawing: the visible part of a character as a bit mask (1 bit per pixel), scaled up. It's
+    // drawn by setting the pixels for the set bits to the text colour, so the same glyph serves every colour.
+    struct Glyph {
+        int w = 0;                       // size of the visible part - 0 for blank characters
+        int h = 0;
+        int nOffsetX = 0;                // position of the visible part within the (scaled) character tile
+        int nOffsetY = 0;
+        int nStride  = 0;                // nr of bytes per row in vBits
+        std::vector<uint8_t> vBits;      // h rows of w bits, most significant bit first
+    };
+
+    // LRU cache of glyphs, keyed on font, character, scale and render mode (see MakeKey())
+    class GlyphCache : public LRUCache<uint64_t, Glyph> {
+    public:
+        GlyphCache( int nCapacity = 512 ) : LRUCache<uint64_t, Glyph>( nCapacity ) {}
+
+        static uint64_t MakeKey( int nFont, int nCharIx, int nScale, bool bSDF = false );
+    };
+
+    // The layout of a string for the decal string functions: the source rect in the font atlas and the position
+    // relative to the origin of the string for the visible part of each character. Blank characters are left out. The
+    // x offset is kept as a float, so that adding the string position gives the same result as computing it directly.
+    struct TextLayout {
+        struct Char {
+            int      nCharIx;
+            SDL_Rect src;
+            float    fOffsetX;
+            int      nOffsetY;
+            int      w, h;
+        };
+        std::string       sText;     // to detect hash collisions
+        std::vector<Char> vChars;
+    };
+
+    // The measured size of a string, see SpriteFont::GetTextSize()
+    struct TextSize {
+        std::string sText;               // to detect hash collisions
+        vi2d        size;                // unscaled size in pixels
+    };
+
     class SpriteFont {
+    public:
+        // the way the characters are rendered
+        enum Mode {
+            BITMAP = 0,    // from the font bitmap - pixel exact, scaling makes the pixels bigger
+            SDF            // from a signed distance field - smooth edges at any scale
+        };
+
     public:
         SpriteFont();
         ~SpriteFont();
 
-        // select the sprite font indexed by the input parameter.
+        // select the sprite font indexed by the input parameter. Fonts that were selected before are kept loaded, so
+        // switching between fonts is cheap.
         // NOTE: index 0 is the default
         void SetFont( int index = 0 );
+        // selects the render mode for all fonts. In SDF mode the characters are rendered from a signed distance field
+        // that is generated from the font bitmap the first time a font is used in this mode. Both the software and the
+        // decal string functions follow the mode.
+        void SetMode( Mode eNewMode );
+        Mode GetMode() { return eMode; }
+
         // draw a string in the specified colour with the specified scale
         void DrawString(     SDL_Surface *screen, int x, int y, const std::string &sText, Pixel nColour = WHITE, int nScale = 1 );
         // like DrawString() but with variable = proportional (horizontal) character spacing
@@ -161,48 +328,136 @@ namespace flc {
         // similar, but to DrawStringProp()
         void DrawStringPropDecal( int x, int y, const std::string &sText, Pixel nColour, float scaleX, float scaleY, std::vector<std::pair<SDL_Rect, SDL_Rect>> &drawInfo );
 
-        // return a pointer to the sprite font for this object
-        Sprite *GetSprite() { return fontSprite; }
-        Decal  *GetDecal() {  return fontDecal;  }
+        // return a pointer to the sprite of the font sheet for this object: the characters in a grid of tiles of
+        // GetCharSize(), in ascii order. The fonts are stored as 1 bit per pixel bit masks, the (32 bit) sprite is only
+        // created when it's asked for. It always holds the bitmap characters, whatever the mode.
+        Sprite *GetSprite();
+        // returns the sprite of the font atlas, that only holds the visible part of each character (see GetGlyphRect()).
+        // In SDF mode it's made from the distance field. Like GetSprite(), it's only created when it's asked for.
+        Sprite *GetAtlasSprite();
+        // returns the decal of the font atlas (see GetAtlasSprite()) for the current renderer. The source rects of
+        // DrawStringDecal() and DrawStringPropDecal() refer to it. The decals are created on first use for each renderer
+        // (window), and kept for as long as this object exists.
+        Decal  *GetDecal();
+
+        // returns the index of the current font (see SetFont())
+        int GetFontIndex() { return nFontIndex; }
+        // returns the size of a character tile of the current font (the size of a character drawn by DrawString())
+        vi2d GetCharSize() { return { pFace->nTileSizeX, pFace->nTileSizeY }; }
+        // returns the margins of the character with index nCharIx in the font sheet (see SGE_FontData)
+        const CharSpacing &GetMargins( int nCharIx ) { return pFace->vMargins[nCharIx]; }
+        // returns the rect of the visible part of character nCharIx in the font atlas (w and h are 0 for blank characters)
+        const SDL_Rect &GetGlyphRect( int nCharIx ) { return pFace->vGlyphRects[nCharIx]; }
+
+        // Returns the size in pixels that sText takes when it's drawn with DrawString() (or DrawStringProp() if bProp is
+        // true) at the specified scale. The width is that of the longest line, the height is the nr of lines times the
+        // character height. The sizes are cached, so measuring the same strings again (each frame) is cheap. Main
+        // thread only.
+        vi2d GetTextSize( const std::string &sText, int nScale = 1, bool bProp = false );
+        LRUCache<uint64_t, TextSize> &GetSizeCache() { return cSizeCache; }
+
+        // the glyph cache for the software string drawing functions
+        GlyphCache &GetGlyphCache() { return cGlyphCache; }
+        // returns the (cached) layout of sText for the decal string functions - main thread only. If bProp is true, the
+        // layout uses proportional spacing
+        const TextLayout *GetTextLayout( const std::string &sText, float scaleX, float scaleY, bool bProp );
+        LRUCache<uint64_t, TextLayout> &GetLayoutCache() { return cLayoutCache; }
 
     private:
-        // save the name of the sprite file the sprite was loaded from (for testing/debugging)
-        std::string fontSpriteFile = "un-initialized";
-        // internal pointers to the sprite and decal objects.
-        Sprite *fontSprite = nullptr;
-        Decal  *fontDecal  = nullptr;
-
-        int nTilesX    = -1;             // font sprite info - how much tiles horizontally
-        int nTilesY    = -1;             //                  - vertically
-        int nTileSizeX = -1;             //                  - horizontal size per tile in pixels
-        int nTileSizeY = -1;             //                  - vertical size per tile in pixels
-        int nOffset    =  0;             // not all sprites are 1 on 1 with ascii values
-
-        int nFontSpriteSizeX;
-        int nFontSpriteSizeY;
-
-        int nNominalMargin = 1;          // this is reset per font to be 1/8 of the nTileSizeX
-        int nInterChSpc    = 1;          // inter character spacing is ... times nNormSpc
-
-    private:
-
-        int nSpaceChar  = 4;             // the spacing for the "space" character is ... times nNormSpace
+        // A font that was selected with SetFont(). Once loaded a font stays resident, so that switching between fonts
+        // only needs to change the pointer to the current face.
+        struct FontFace {
+            // save the name of the sprite file the sprite was loaded from (for testing/debugging)
+            std::string sFontSpriteFile;
+            // The font atlas as 1 bit per pixel bit mask: nSpriteSizeY rows of nStride bytes, most significant bit first.
+            // The atlas only holds the visible part of each character (the tile without it's margins), tightly packed.
+            std::vector<uint8_t> vBits;
+            int nSpriteSizeX = 0;
+            int nSpriteSizeY = 0;
+            int nStride      = 0;
+            // the rect of each character in the atlas. It's position within the tile is given by the left and top margins
+            std::vector<SDL_Rect> vGlyphRects;
+            // the font atlas as sprite - only created if it's needed (see GetAtlasSprite())
+            Sprite     *pSprite = nullptr;
+            // the font sheet in it's tile layout - only created if it's needed (see GetSprite())
+            Sprite     *pSheetSprite = nullptr;
+            // the decals for this font, one per renderer
+            std::vector<std::pair<SDL_Renderer *, Decal *>> vDecals;
+
+            // The signed distance field atlas, one byte per pixel - only generated if the font is used in SDF mode. The
+            // rect of each character includes a border of nSDFSpread pixels around it's visible part.
+            std::vector<uint8_t>  vSDF;
+            int nSDFSizeX = 0;
+            int nSDFSizeY = 0;
+            std::vector<SDL_Rect> vSDFRects;
+            Sprite     *pSDFSprite = nullptr;
+            std::vector<std::pair<SDL_Renderer *, Decal *>> vSDFDecals;
+
+            int nTilesX    = -1;         // font sprite info - how much tiles horizontally
+            int nTilesY    = -1;         //                  - vertically
+            int nTileSizeX = -1;         //                  - horizontal size per tile in pixels
+            int nTileSizeY = -1;         //                  - vertical size per tile in pixels
+            int nOffset    =  0;         // not all sprites are 1 on 1 with ascii values
+
+            int nNominalMargin = 1;      // the width of the slimmest character
+
+            // contains margins for all characters in the same order as the sprite
+            std::vector<CharSpacing> vMargins;
+            // contains the proportional spacing for all characters, precomputed from vMargins
+            std::vector<CharAdvance> vAdvances;
+            // the horizontal advance per character when drawn proportionally (the tile width minus the spacing)
+            std::vector<int>         vPropWidths;
+        };
 
-        // contains margins for all characters in the same order as the sprite
-        std::vector<CharSpacing> vMargins;
+        // the fonts that are loaded, indexed by font index (nullptr if not loaded yet)
+        std::vector<FontFace *> vFaces;
+        // the current font, and it's index
+        FontFace *pFace      = nullptr;
+        int       nFontIndex = -1;
+        Mode      eMode      = BITMAP;
+        // the distance (in font pixels) over which the distance fields run from fully outside to fully inside
+        static const int nSDFSpread = 4;
+
+        // the software string drawing functions share the glyph cache, so they are serialized. SetFont(), SetMode(),
+        // GetSprite(), GetAtlasSprite() and GetDecal() take it as well, since they change the current face or it's lazy
+        // sprites
+        std::mutex mtxDraw;
+        GlyphCache cGlyphCache;
+        // the layouts of the strings that were drawn with the decal string functions
+        LRUCache<uint64_t, TextLayout> cLayoutCache = LRUCache<uint64_t, TextLayout>( 256 );
+        // the sizes of the strings that were measured with GetTextSize()
+        LRUCache<uint64_t, TextSize>   cSizeCache   = LRUCache<uint64_t, TextSize>( 1024 );
+
+        int nInterChSpc = 1;             // inter character spacing is ... times nNominalMargin
+        int nSpaceChar  = 4;             // the spacing for the "space" character is ... times nNominalMargin
 
     private:
-        // loads the font sprite from a file that is specified by sFileName, and makes it accessible
-        // via class variable fontPtr. Returns true upon success, false otherwise.
-        bool LoadFontFromFile( std::string sFileName );
-        // for all characters in the sprite the margins are determined per character.
-        // A spacing is the maximum number of pixel rows resp. pixel columns that can be removed from the
-        // left, right, top or bottom without actually touching the character (i.e. that contain only
-        // blank pixels). The margins are stored in std::vector vmargins
-        void InitFontSpriteMargins();
-        // loads the font sprite from data that is stored as data strings in the code. Makes it accessible
-        // via fontPtr.
-        void LoadFontFromDataString( int nSpriteSizeX, int nSpriteSizeY, std::string &sDataString );
+        // creates the face for font nFontIndex from the font data that is compiled into the code (see SGE_FontData)
+        FontFace *LoadFontFace( int nFontIndex );
+        // decodes the font sheet from the data strings into vSheet, as a bit mask with rows of (nSizeX + 7) / 8 bytes
+        void LoadFontFromDataStrings( int nSizeX, int nSizeY, const char *const *pDataLines, int nDataLines, std::vector<uint8_t> &vSheet );
+        // packs the visible parts of the characters of the font sheet in the atlas of pNewFace. The margins must be set.
+        void PackFontAtlas( FontFace *pNewFace, const std::vector<uint8_t> &vSheet );
+        // generates the signed distance field atlas of pNewFace from it's (bitmap) atlas
+        void BuildSDFAtlas( FontFace *pNewFace );
+        // creates the sprite for the decal path in SDF mode
+        Sprite *CreateSDFSprite( FontFace *pSDFFace );
+        // GetAtlasSprite() without locking mtxDraw - for use by functions that already hold it
+        Sprite *CurrentSprite();
+        // creates the sprite of the font sheet (see GetSprite()) from the atlas of pSheetFace
+        Sprite *CreateSheetSprite( FontFace *pSheetFace );
+        // builds the glyph for nCharIx at scale nScale from the distance field
+        void BuildSDFGlyph( int nCharIx, int nScale, Glyph &glyph );
+
+        // returns the glyph for character index nCharIx in the specified scale. It's built from the font atlas if it's
+        // not in the glyph cache.
+        const Glyph *GetGlyph( int nCharIx, int nScale );
+        // draws the glyph at (x, y) on pSrfce in colour nColour, clipped against the clip rect of the surface
+        void DrawGlyph( SDL_Surface *pSrfce, int x, int y, const Glyph *pGlyph, uint32_t nColour );
+        // measures sText (unscaled)
+        vi2d MeasureText( const std::string &sText, bool bProp );
+        // computes the layout of sText into layout
+        void BuildTextLayout( const std::string &sText, float scaleX, float scaleY, bool bProp, TextLayout &layout );
     };
 
 //                           +------------------+                            //
@@ -227,6 +482,9 @@ namespace flc {
             SDL_Point    m_point_rot;
 
             flc::Pixel   m_tint = flc::WHITE;
+
+            bool         m_bClipped = false;   // if true, rendering is clipped to m_rect_clip
+            SDL_Rect     m_rect_clip;
 	};
 
 } // namespace flc
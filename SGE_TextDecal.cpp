@@ -0,0 +1,160 @@
+/* SGE_TextDecal.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =======================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include     <cmath>
+#include <algorithm>
+#include   <cstring>
+#include   <climits>
+
+#include "SGE_TextDecal.h"
+
+// ==============================/ Class TextDecal /==============================
+
+//                           +------------------+                            //
+// --------------------------+ CONSTRUCTORS ETC +--------------------------- //
+//                           +------------------+                            //
+
+flc::TextDecal::TextDecal( SpriteFont *pFont, const std::string &sText, Pixel nColour, int nScale, bool bProp ) {
+    if (pFont == nullptr) {
+        std::cout << "ERROR: TextDecal() --> can't construct with a nullptr font pointer argument " << std::endl;
+    }
+    this->pFont   = pFont;
+    this->sText   = sText;
+    this->nColour = nColour;
+    this->nScale  = std::max( 1, nScale );
+    this->bProp   = bProp;
+}
+
+flc::TextDecal::~TextDecal() {
+    delete pDecal;
+    delete pSprite;
+    pDecal  = nullptr;
+    pSprite = nullptr;
+}
+
+//                               +----------+                                //
+// ------------------------------+ METHODS  +------------------------------- //
+//                               +----------+                                //
+
+void flc::TextDecal::SetText( const std::string &sText ) {
+    if (sText != this->sText) {
+        this->sText = sText;
+        bDirty = true;
+    }
+}
+
+void flc::TextDecal::SetColour( Pixel nColour ) {
+    if (nColour != this->nColour) {
+        this->nColour = nColour;
+        bDirty = true;
+    }
+}
+
+void flc::TextDecal::SetScale( int nScale ) {
+    nScale = std::max( 1, nScale );
+    if (nScale != this->nScale) {
+        this->nScale = nScale;
+        bDirty = true;
+    }
+}
+
+void flc::TextDecal::SetProportional( bool bProp ) {
+    if (bProp != this->bProp) {
+        this->bProp = bProp;
+        bDirty = true;
+    }
+}
+
+flc::Decal *flc::TextDecal::GetDecal() {
+    Render();
+    return pDecal;
+}
+
+flc::vi2d flc::TextDecal::GetOffset() {
+    Render();
+    return vOffset;
+}
+
+int flc::TextDecal::GetWidth() {
+    Render();
+    return pSprite == nullptr ? 0 : pSprite->width;
+}
+
+int flc::TextDecal::GetHeight() {
+    Render();
+    return pSprite == nullptr ? 0 : pSprite->height;
+}
+
+// The bounds of the text are taken from it's layout (the same one the decal string functions use), trimmed to the
+// visible pixels. If the size didn't change, the sprite and texture are reused, otherwise they are created anew.
+void flc::TextDecal::Render() {
+    if (pFont == nullptr || (!bDirty && nFontIndex == pFont->GetFontIndex() && eFontMode == pFont->GetMode()))
+        return;
+    bDirty     = false;
+    nFontIndex = pFont->GetFontIndex();
+    eFontMode  = pFont->GetMode();
+
+    // determine the bounding box of the visible pixels of all characters - the layout only contains the visible parts
+    const TextLayout *pLayout = pFont->GetTextLayout( sText, float( nScale ), float( nScale ), bProp );
+    int x0 = INT_MAX, y0 = INT_MAX, x1 = INT_MIN, y1 = INT_MIN;
+    for (auto &c : pLayout->vChars) {
+        int cx = int( std::floor( c.fOffsetX ));
+        x0 = std::min( x0, cx );
+        y0 = std::min( y0, c.nOffsetY );
+        x1 = std::max( x1, cx + c.w );
+        y1 = std::max( y1, c.nOffsetY + c.h );
+    }
+    if (x0 >= x1) {
+        // nothing visible to render
+        delete pDecal;
+        delete pSprite;
+        pDecal  = nullptr;
+        pSprite = nullptr;
+        vOffset = { 0, 0 };
+        return;
+    }
+    int w = x1 - x0;
+    int h = y1 - y0;
+    vOffset = { x0, y0 };
+
+    if (pSprite == nullptr || pSprite->width != w || pSprite->height != h) {
+        delete pDecal;
+        delete pSprite;
+        pSprite = new Sprite( w, h );
+        pDecal  = nullptr;
+    }
+    // clear the sprite to blank, and render the text into it
+    SDL_Surface *pSrfce = pSprite->GetSurfacePtr();
+    SDL_LockSurface( pSrfce );
+    for (int y = 0; y < h; y++) {
+        memset( (uint8_t *)pSrfce->pixels + y * pSrfce->pitch, 0, w * 4 );
+    }
+    SDL_UnlockSurface( pSrfce );
+    if (bProp)
+        pFont->DrawStringProp( pSrfce, -x0, -y0, sText, nColour, nScale );
+    else
+        pFont->DrawString(     pSrfce, -x0, -y0, sText, nColour, nScale );
+
+    if (pDecal == nullptr)
+        pDecal = new Decal( pSprite );
+    else
+        pDecal->UpdateSprite();
+}
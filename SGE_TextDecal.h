@@ -0,0 +1,104 @@
+#ifndef SGE_TEXTDECAL_H
+#define SGE_TEXTDECAL_H
+
+/* SGE_TextDecal.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * =====================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module implements class TextDecal: a string that is rendered once into a decal of it's own. It's meant for
+ * text that seldom changes, like scores, menu items and tooltips. DrawStringDecal() produces a decal frame per
+ * character each frame, where a TextDecal is drawn as one decal.
+ *
+ * The text is rendered with the font, colour, scale and spacing mode that are set on the TextDecal, into a sprite
+ * that is just large enough to hold it. It's only rendered again when one of these changes (including a switch to
+ * another font or font mode). Since a decal is a texture of the renderer, a TextDecal must be used from the main thread.
+ *
+ *     flc::TextDecal cScore( GetFont() );
+ *     ...
+ *     cScore.SetText( "Score: " + std::to_string( nScore ));   // no effect if the score didn't change
+ *     DrawTextDecal( { 10.0f, 10.0f }, &cScore );
+ */
+
+#include <iostream>
+
+#include "SGE_Utilities.h"
+#include "SGE_Pixel.h"
+#include "SGE_Sprite.h"
+
+namespace flc {
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    class TextDecal {
+    public:
+        // pFont is the font to render with - it must outlive the TextDecal
+        TextDecal( SpriteFont *pFont, const std::string &sText = "", Pixel nColour = WHITE, int nScale = 1, bool bProp = false );
+        ~TextDecal();
+
+        // the setters only mark the text for rendering if the value actually changes
+        void SetText( const std::string &sText );
+        void SetColour( Pixel nColour );
+        void SetScale( int nScale );
+        void SetProportional( bool bProp );
+
+        const std::string &GetText() { return sText; }
+
+        // returns the decal with the rendered text (rendering it first if needed), or nullptr if the text is empty
+        Decal *GetDecal();
+        // the position of the decal relative to the position of the text. In proportional mode the first character can
+        // start left of the text position, just like with DrawStringProp()
+        vi2d GetOffset();
+        // the size of the decal in pixels
+        int GetWidth();
+        int GetHeight();
+
+    private:
+        SpriteFont  *pFont   = nullptr;
+        std::string  sText;
+        Pixel        nColour = WHITE;
+        int          nScale  = 1;
+        bool         bProp   = false;
+
+        Sprite *pSprite = nullptr;
+        Decal  *pDecal  = nullptr;
+        vi2d    vOffset = { 0, 0 };
+
+        bool bDirty     = true;
+        int  nFontIndex = -1;        // the font index the text was rendered with
+        SpriteFont::Mode eFontMode = SpriteFont::BITMAP;    // and the font mode
+
+        // internal function - renders the text if it's dirty or the font (mode) was switched
+        void Render();
+    };
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_TEXTDECAL_H
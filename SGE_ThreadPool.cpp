@@ -0,0 +1,132 @@
+/* SGE_ThreadPool.cpp - part of the SDL2-based Game Engine (SGE) v.20221204
+ * ========================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+#include    <atomic>
+#include    <memory>
+#include <algorithm>
+
+#include "SGE_ThreadPool.h"
+
+// ==============================/ Class ThreadPool /==============================
+
+//                           +------------------+                            //
+// --------------------------+ CONSTRUCTORS ETC +--------------------------- //
+//                           +------------------+                            //
+
+// starts the worker threads
+flc::ThreadPool::ThreadPool( int nThreads ) {
+    if (nThreads <= 0) {
+        // hardware_concurrency() may return 0 if the nr of cores can't be determined
+        nThreads = std::max( 1, (int)std::thread::hardware_concurrency() - 1 );
+    }
+    for (int i = 0; i < nThreads; i++) {
+        vWorkers.emplace_back( [this] { WorkerLoop(); } );
+    }
+}
+
+// signals the worker threads to stop, and waits until they are finished
+flc::ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> lock( mtxQueue );
+        bStopping = true;
+    }
+    cvQueue.notify_all();
+    for (auto &t : vWorkers) {
+        if (t.joinable())
+            t.join();
+    }
+}
+
+//                               +----------+                                //
+// ------------------------------+ METHODS  +------------------------------- //
+//                               +----------+                                //
+
+// each worker thread waits for tasks, and executes them. Upon stopping the remaining tasks are finished first.
+void flc::ThreadPool::WorkerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock( mtxQueue );
+            cvQueue.wait( lock, [this] { return bStopping || !qTasks.empty(); } );
+            if (bStopping && qTasks.empty())
+                return;
+            task = std::move( qTasks.front() );
+            qTasks.pop_front();
+        }
+        task();
+    }
+}
+
+void flc::ThreadPool::Enqueue( const std::function<void()> &task ) {
+    {
+        std::unique_lock<std::mutex> lock( mtxQueue );
+        qTasks.push_back( task );
+    }
+    cvQueue.notify_one();
+}
+
+// The jobs are handed out via an atomic counter. Both the helper tasks on the worker threads and the calling thread
+// keep grabbing the next job index until all are taken. The shared state is reference counted, since helper tasks may
+// start (and find nothing to do) after ParallelFor() has returned.
+void flc::ThreadPool::ParallelFor( int nJobs, const std::function<void( int )> &fnJob ) {
+    if (nJobs <= 0)
+        return;
+    if (nJobs == 1 || vWorkers.empty()) {
+        for (int i = 0; i < nJobs; i++)
+            fnJob( i );
+        return;
+    }
+
+    struct sSharedState {
+        std::atomic<int>        nNext{ 0 };
+        std::atomic<int>        nDone{ 0 };
+        int                     nJobs = 0;
+        std::function<void( int )> fnJob;
+        std::mutex              mtxDone;
+        std::condition_variable cvDone;
+    };
+    auto state = std::make_shared<sSharedState>();
+    state->nJobs = nJobs;
+    state->fnJob = fnJob;
+
+    auto work = [state] {
+        int i;
+        while ((i = state->nNext.fetch_add( 1 )) < state->nJobs) {
+            state->fnJob( i );
+            if (state->nDone.fetch_add( 1 ) + 1 == state->nJobs) {
+                std::unique_lock<std::mutex> lock( state->mtxDone );
+                state->cvDone.notify_all();
+            }
+        }
+    };
+    // no use in starting more helpers than there are jobs left after the calling thread took one
+    int nHelpers = std::min( (int)vWorkers.size(), nJobs - 1 );
+    for (int i = 0; i < nHelpers; i++)
+        Enqueue( work );
+    work();
+
+    std::unique_lock<std::mutex> lock( state->mtxDone );
+    state->cvDone.wait( lock, [&] { return state->nDone.load() == state->nJobs; } );
+}
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
@@ -0,0 +1,87 @@
+#ifndef SGE_THREADPOOL_H
+#define SGE_THREADPOOL_H
+
+/* SGE_ThreadPool.h - part of the SDL2-based Game Engine (SGE) v.20221204
+ * ======================================================================
+ *
+ * The SGE was developed by Joseph21 and is heavily inspired bij the Pixel Game Engine (PGE) by Javidx9
+ * (see: https://github.com/OneLoneCoder/olcPixelGameEngine). It's interface is deliberately kept very
+ * close to that of the PGE, so that programs can be ported from the one to the other quite easily.
+ *
+ * License
+ * -------
+ * This code is completely free to use, change, rewrite or get inspiration from. At the same time, there's
+ * no warranty that this code is free of bugs. If you use (any part of) this code, you accept each and any
+ * risk or consequence thereof.
+ *
+ * Although there is no obligation to mention or shout out to the creator, I wouldn't mind if you did :)
+ *
+ * Have fun with it!
+ *
+ * Joseph21
+ * december 4, 2022
+ */
+
+//                          +--------------------+                           //
+// -------------------------+ MODULE DESCRIPTION +-------------------------- //
+//                          +--------------------+                           //
+
+/*
+ * This module implements a simple thread pool. A fixed number of worker threads is started upon construction,
+ * and they wait for tasks to be put in the (shared) task queue. The pool is used by the engine to spread
+ * per pixel work (see SDL_GameEngine::ForEachPixel() and SDL_GameEngine::Shade()) over all cores.
+ *
+ * ParallelFor() is the main entry point: it executes a function for a range of job indices, and blocks until
+ * all of them are done. The calling thread participates in the work, so it's safe to call ParallelFor() from
+ * within a task that runs on the pool itself.
+ */
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace flc {
+
+//                           +------------------+                            //
+// --------------------------+ CLASS DEFINITION +--------------------------- //
+//                           +------------------+                            //
+
+    class ThreadPool {
+    public:
+        // creates the pool with nThreads worker threads. If nThreads is 0, the number of worker threads is derived
+        // from the number of available cores (minus 1, since the calling thread participates in ParallelFor())
+        ThreadPool( int nThreads = 0 );
+        ~ThreadPool();
+
+        // returns the number of worker threads in the pool
+        int GetNrThreads() { return (int)vWorkers.size(); }
+
+        // puts a task in the queue. It will be executed by the first worker thread that's available
+        void Enqueue( const std::function<void()> &task );
+
+        // executes fnJob( i ) for each i in [0, nJobs), spread over the worker threads and the calling thread.
+        // Blocks until all jobs are done.
+        void ParallelFor( int nJobs, const std::function<void( int )> &fnJob );
+
+    private:
+        std::vector<std::thread>          vWorkers;
+        std::deque<std::function<void()>> qTasks;
+
+        std::mutex              mtxQueue;
+        std::condition_variable cvQueue;
+        bool                    bStopping = false;
+
+        // the function that each of the worker threads executes
+        void WorkerLoop();
+    };
+
+} // namespace flc
+
+//                                                                           //
+// ------------------------------------------------------------------------- //
+//                                                                           //
+
+#endif // SGE_THREADPOOL_H
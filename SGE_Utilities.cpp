@@ -156,6 +156,25 @@ void flc::InitSDL_Rect( SDL_Rect &rect, int x, int y, int w, int h ) {
     rect = { x, y, w, h };
 }
 
+// FNV-1a: each byte is xor-ed into the hash, which is then multiplied by the FNV prime
+uint64_t flc::HashString( const std::string &s, uint64_t nSeed ) {
+    uint64_t nHash = nSeed;
+    for (char c : s) {
+        nHash ^= (uint8_t)c;
+        nHash *= 0x100000001B3ULL;
+    }
+    return nHash;
+}
+
+uint64_t flc::HashValue( uint64_t nValue, uint64_t nSeed ) {
+    uint64_t nHash = nSeed;
+    for (int i = 0; i < 8; i++) {
+        nHash ^= (nValue >> (i * 8)) & 0xFF;
+        nHash *= 0x100000001B3ULL;
+    }
+    return nHash;
+}
+
 // fills an SDL_Rect structure using the input parameters
 void flc::InitSDL_Point( SDL_Point &point, int x, int y ) {
     point = { x, y };
@@ -27,6 +27,10 @@
 //                          +--------------------+                           //
 
 #include <fstream>
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <algorithm>
 
 #include <SDL.h>
 
@@ -88,6 +92,77 @@ namespace flc {
     void InitSDL_Rect(  SDL_Rect  &rec, int x, int y, int w, int h );
     void InitSDL_Point( SDL_Point &pnt, int x, int y );
 
+    // returns a 64 bit (FNV-1a) hash of s. Pass the result of a previous call as nSeed to hash multiple values
+    uint64_t HashString( const std::string &s, uint64_t nSeed = 0xCBF29CE484222325ULL );
+    uint64_t HashValue(  uint64_t nValue,      uint64_t nSeed = 0xCBF29CE484222325ULL );
+
+    // Least recently used cache of values of type V, keyed on K. Find() makes the value the most recently used one,
+    // and Insert() evicts the least recently used value(s) if the cache is full. The pointers that are returned stay
+    // valid until the value is evicted.
+    template <typename K, typename V>
+    class LRUCache {
+    public:
+        LRUCache( int nCapacity ) : nCapacity( nCapacity ) {}
+
+        // returns the value for key (and marks it as most recently used), or nullptr if it's not in the cache
+        V *Find( const K &key ) {
+            auto it = mIndex.find( key );
+            if (it == mIndex.end()) {
+                nMisses += 1;
+                return nullptr;
+            }
+            nHits += 1;
+            // move the entry to the front of the list - the iterators stay valid
+            lEntries.splice( lEntries.begin(), lEntries, it->second );
+            return &it->second->second;
+        }
+        // adds a default constructed value for key and returns it. If key is already present, it's value is reset
+        V *Insert( const K &key ) {
+            auto it = mIndex.find( key );
+            if (it != mIndex.end()) {
+                lEntries.splice( lEntries.begin(), lEntries, it->second );
+                it->second->second = V();
+                return &it->second->second;
+            }
+            Evict( nCapacity - 1 );
+            lEntries.emplace_front( key, V() );
+            mIndex[key] = lEntries.begin();
+            return &lEntries.front().second;
+        }
+        void Clear() {
+            lEntries.clear();
+            mIndex.clear();
+        }
+
+        void SetCapacity( int nEntries ) {
+            nCapacity = std::max( 1, nEntries );
+            Evict( nCapacity );
+        }
+        int GetCapacity() { return nCapacity; }
+        int GetSize()     { return (int)lEntries.size(); }
+        // statistics - the nr of calls to Find() that did resp. didn't find the key
+        int GetHits()     { return nHits;   }
+        int GetMisses()   { return nMisses; }
+
+    private:
+        typedef std::list<std::pair<K, V>> EntryList;
+
+        EntryList lEntries;                                    // most recently used entry first
+        std::unordered_map<K, typename EntryList::iterator> mIndex;
+
+        int nCapacity;
+        int nHits   = 0;
+        int nMisses = 0;
+
+        // removes the least recently used entries until there are at most nKeep left
+        void Evict( int nKeep ) {
+            while (!lEntries.empty() && (int)lEntries.size() > nKeep) {
+                mIndex.erase( lEntries.back().first );
+                lEntries.pop_back();
+            }
+        }
+    };
+
     // the v2d_generic<> templated types are from vector_types.h
     // I want these typedefs to be available inside namespace flc...
     typedef v2d_generic<int      > vi2d;
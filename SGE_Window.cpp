@@ -119,29 +119,14 @@ bool flc::SGE_Window::CreateWindow(
     bIsShown = true;
 
     // Create a sprite that represents the screen (or actually the layer[0] canvas for this window)
-    // NOTE - since some of the Sprite constructors need the pixel format for the screen sprite, and that pixel
-    // format is not yet know at this point, an empty sprite and the associated SDL_Surface are created
-    // explicitly here (and the pixel format is derived thereof).
-    pScreenCanvas = new Sprite();
-    // create a new surface for the screen sprite
-    SDL_Surface *auxSurface = SDL_CreateRGBSurface(
-        0,                        // unused flags, should be set to 0
-        m_WidthLogical,           // width of surface
-        m_HeightLogical,          // height of surface
-        32,                       // depth of surface in bits (typically set to 32)
-        glb_rmask,                // mask for r value
-        glb_gmask,                //          g
-        glb_bmask,                //          b
-        glb_amask                 //          a
-    );
-    if (auxSurface == nullptr) {
-        std::cout << "ERROR: CreateWindow() --> failed call to SDL_CreateRGBSurface(): " << SDL_GetError() << std::endl;
+    // NOTE - this constructor doesn't need the pixel format of the screen (which is not yet known at this point), it
+    // creates the surface with the glb_ masks directly. It's rows are aligned on SPRITE_ROW_ALIGN bytes, like all sprites.
+    pScreenCanvas = new Sprite( m_WidthLogical, m_HeightLogical );
+    if (pScreenCanvas->IsEmpty()) {
+        std::cout << "ERROR: CreateWindow() --> failed to create the screen canvas sprite" << std::endl;
         return false;
     }
 
-    pScreenCanvas->SetSurface( auxSurface );  // other (internal) variables of the pScreenCanvas sprite are also set in this call
-    auxSurface = nullptr;
-
     // create texture to update from the pScreenCanvas each frame
     // NOTE 1 - the SDL_TEXTUREACCESS_STREAMING is mandatory in this create call!
     // NOTE 2 - the ARGB8888 pixel format appears to be faster than others... ? (see: https://gamedev.stackexchange.com/a/87770)
@@ -350,6 +335,8 @@ void flc::SGE_Window::ClearLayers() {
         e.pLayerCanvas = nullptr;
         SDL_DestroyTexture( e.pRenderTexture );
         e.pRenderTexture = nullptr;
+        delete e.pPostChain;
+        e.pPostChain = nullptr;
     }
     vLayers.clear();
 }
@@ -397,6 +384,27 @@ void flc::SGE_Window::SetLayerTint( uint8_t layer, const flc::Pixel& tint ) {
     vLayers[layer].bDirty = true;
 }
 
+// the post processing chain for a layer is created when the first pass is added
+void flc::SGE_Window::AddPostProcess( uint8_t layer, flc::PostProcessPass *pPass ) {
+    if (layer >= (int)vLayers.size()) {
+        std::cout << "ERROR: AddPostProcess() --> layer index out of range: " << int( layer ) << std::endl;
+    } else {
+        if (vLayers[layer].pPostChain == nullptr)
+            vLayers[layer].pPostChain = new flc::PostProcessChain;
+        vLayers[layer].pPostChain->AddPass( pPass );
+        vLayers[layer].bDirty = true;
+    }
+}
+
+void flc::SGE_Window::ClearPostProcess( uint8_t layer ) {
+    if (layer >= (int)vLayers.size()) {
+        std::cout << "ERROR: ClearPostProcess() --> layer index out of range: " << int( layer ) << std::endl;
+    } else if (vLayers[layer].pPostChain != nullptr) {
+        vLayers[layer].pPostChain->Clear();
+        vLayers[layer].bDirty = true;
+    }
+}
+
 //                                                                           //
 // ------------------------------------------------------------------------- //
 //                                                                           //
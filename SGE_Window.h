@@ -61,6 +61,7 @@
 
 #include "SGE_Sprite.h"
 #include "SGE_vector_types.h"
+#include "SGE_PostProcess.h"
 
 //                           +------------------+                            //
 // --------------------------+ CLASS DEFINITION +--------------------------- //
@@ -189,6 +190,8 @@ namespace flc {
             SDL_Texture *pRenderTexture = nullptr;   // the canvas and all decals are converted into an SDL_Texture in the render cycle
 
             std::vector<DecalFrame> vDecals;         // to hold all the decals that are drawn to this layer
+
+            flc::PostProcessChain *pPostChain = nullptr;   // optional post processing, applied before the canvas is rendered
         };
 
     public:
@@ -203,6 +206,9 @@ namespace flc {
         void SetLayerScale(    uint8_t layer, float x, float y );
         void SetLayerScaleInv( uint8_t layer, float x, float y );
         void SetLayerTint(     uint8_t layer, const flc::Pixel &tint );
+        // add a post processing pass to the layer, or remove all of them
+        void AddPostProcess(   uint8_t layer, flc::PostProcessPass *pPass );
+        void ClearPostProcess( uint8_t layer );
         // for compatibility with PGE
         void SetLayerOffset(   uint8_t layer, const flc::vf2d &offset ) { SetLayerOffset(   layer, offset.x, offset.y ); }
         void SetLayerScale(    uint8_t layer, const flc::vf2d &scale  ) { SetLayerScale(    layer,  scale.x,  scale.y ); }
@@ -39,7 +39,7 @@
  *   5. v2d_hom_texture - homogeneous 2d vector for texturing, contains components u, v and w ;
  *
  * For each of these types the following functionality is implemented:
- *   * default, initializer and copy constructor;
+ *   * default, initializer and copy constructor, copy assignment;
  *   * length, normalization, perpendicular vector, dot and cross product, reciprocal
  *   * round, floor, ceil and trunc (component wise)
  *   * min, max, clamp (component wise)
@@ -68,6 +68,7 @@ struct v2d_generic {
     v2d_generic()                       : x( (T)0 ), y( (T)0 ) {}    // default constructor
     v2d_generic( T _x, T _y )           : x(   _x ), y(   _y ) {}    // initializer constructor
     v2d_generic( const v2d_generic &v ) : x(  v.x ), y(  v.y ) {}    // copy constructor
+    v2d_generic &operator = ( const v2d_generic &v ) { x = v.x; y = v.y; return *this; }    // copy assignment
 
     // utility functions ======================================================
     T mag()                           { return sqrt( x * x + y * y );                           }    // returns magnitude (length)
@@ -169,6 +170,7 @@ struct v3d_generic {
     v3d_generic()                       : x( (T)0 ), y( (T)0 ), z( (T)0 ) {}    // default constructor
     v3d_generic( T _x, T _y, T _z )     : x(   _x ), y(   _y ), z(   _z ) {}    // initializer constructor
     v3d_generic( const v3d_generic &v ) : x(  v.x ), y(  v.y ), z(  v.z ) {}    // copy constructor
+    v3d_generic &operator = ( const v3d_generic &v ) { x = v.x; y = v.y; z = v.z; return *this; }    // copy assignment
 
     // utility functions ======================================================
     T mag()            { return sqrt( x * x + y * y + z * z );                          }    // returns magnitude (length)
@@ -283,6 +285,7 @@ struct v2d_hom_generic {
     v2d_hom_generic()                           : x( (T)0 ), y( (T)0 ), w( (T)1 ) {}    // default constructor
     v2d_hom_generic( T _x, T _y, T _w = (T)1 )  : x(   _x ), y(   _y ), w(   _w ) {}    // initializer constructor
     v2d_hom_generic( const v2d_hom_generic &v ) : x(  v.x ), y(  v.y ), w(  v.w ) {}    // copy constructor
+    v2d_hom_generic &operator = ( const v2d_hom_generic &v ) { x = v.x; y = v.y; w = v.w; return *this; }    // copy assignment
 
     // utility functions ======================================================
     T mag()                { return sqrt( x * x + y * y );                                                }    // returns magnitude (length)
@@ -382,6 +385,7 @@ struct v3d_hom_generic {
     v3d_hom_generic()                                : x( (T)0 ), y( (T)0 ), z( (T)0 ), w( (T)1 ) {}    // default constructor
     v3d_hom_generic( T _x, T _y, T _z, T _w = (T)1 ) : x(   _x ), y(   _y ), z(   _z ), w(   _w ) {}    // initializer constructor
     v3d_hom_generic( const v3d_hom_generic &v )      : x(  v.x ), y(  v.y ), z(  v.z ), w(  v.w ) {}    // copy constructor
+    v3d_hom_generic &operator = ( const v3d_hom_generic &v ) { x = v.x; y = v.y; z = v.z; w = v.w; return *this; }    // copy assignment
 
     // utility functions ======================================================
     T mag()                { return sqrt( x * x + y * y + z * z );                                       }    // returns magnitude (length)
@@ -483,6 +487,7 @@ struct v2d_hom_textures {
     v2d_hom_textures()                            : u( (T)0 ), v( (T)0 ), w( (T)1 ) {}    // default constructor
     v2d_hom_textures( T _u, T _v, T _w = (T)1 )   : u(   _u ), v(   _v ), w(   _w ) {}    // initializer constructor
     v2d_hom_textures( const v2d_hom_textures &v ) : u(  v.u ), v(  v.v ), w(  v.w ) {}    // copy constructor
+    v2d_hom_textures &operator = ( const v2d_hom_textures &rhs ) { u = rhs.u; v = rhs.v; w = rhs.w; return *this; }    // copy assignment
 
     // utility functions ======================================================
     T mag()                 { return sqrt( u * u + v * v );                                                 }    // returns magnitude (length)
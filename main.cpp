@@ -19,6 +19,8 @@
  * december 4, 2022
  */
 
+#include <random>
+
 #include "SGE/SGE_Core.h"
 
 // Override base class with your custom functionality
@@ -36,10 +38,13 @@ public:
     }
 
     bool OnUserUpdate(float fElapsedTime) override {
-        // Called once per frame, draws random coloured pixels
-        for (int x = 0; x < ScreenWidth(); x++)
-            for (int y = 0; y < ScreenHeight(); y++)
-                Draw(x, y, flc::Pixel(rand() % 256, rand() % 256, rand() % 256));
+        // Called once per frame, draws random coloured pixels. The rows are spread over all cores, so
+        // each thread uses it's own random generator (rand() is not thread safe)
+        Shade(0, 0, ScreenWidth(), ScreenHeight(), [](int /*y*/, int x0, int x1, uint32_t *pRow) {
+            thread_local std::minstd_rand rng(std::random_device{}());
+            for (int x = x0; x < x1; x++)
+                pRow[x] = flc::Pixel(int(rng() % 256), int(rng() % 256), int(rng() % 256)).Encode();
+        });
         return true;
     }
 };